@@ -66,7 +66,8 @@ namespace api
 		const bool is_port_configured, const uint16_t port,
 		const bool is_tls_port_configured, const uint16_t tls_port,
 		const cfg::mgr::Managers &managers_config,
-		const int worker_count)
+		const int worker_count,
+		const bool sharded)
 	{
 		auto http_server_manager = http::svr::HttpServerManager::GetInstance();
 
@@ -95,7 +96,7 @@ namespace api
 				[&](const ov::SocketAddress &address, bool is_https, const std::shared_ptr<http::svr::HttpServer> &http_server) {
 					http_server->AddInterceptor(http_interceptor);
 				},
-				worker_count))
+				worker_count, sharded))
 		{
 			_http_server_list = std::move(http_server_list);
 			_https_server_list = std::move(https_server_list);
@@ -127,6 +128,7 @@ namespace api
 		bool is_configured;
 		auto worker_count = api_bind_config.GetWorkerCount(&is_configured);
 		worker_count = is_configured ? worker_count : HTTP_SERVER_USE_DEFAULT_COUNT;
+		auto sharded = api_bind_config.UseShardedWorkers();
 
 		bool is_port_configured;
 		auto &port_config = api_bind_config.GetPort(&is_port_configured);
@@ -147,7 +149,7 @@ namespace api
 				   is_port_configured, port_config.GetPort(),
 				   is_tls_port_configured, tls_port_config.GetPort(),
 				   managers_config,
-				   worker_count);
+				   worker_count, sharded);
 	}
 
 	std::shared_ptr<http::svr::RequestInterceptor> Server::CreateInterceptor()
@@ -36,7 +36,8 @@ namespace api
 			const bool is_port_configured, const uint16_t port,
 			const bool is_tls_port_configured, const uint16_t tls_port,
 			const cfg::mgr::Managers &managers_config,
-			const int worker_count);
+			const int worker_count,
+			const bool sharded);
 
 		bool SetupCORS(const cfg::mgr::api::API &api_config);
 		bool SetupAccessToken(const cfg::mgr::api::API &api_config);
@@ -18,6 +18,8 @@ namespace api
 			{
 				RegisterGet(R"()", &InternalsController::OnGetInternals);
 				RegisterGet(R"(\/queues)", &InternalsController::OnGetQueues);
+				RegisterGet(R"(\/memoryPools)", &InternalsController::OnGetMemoryPools);
+				RegisterGet(R"(\/socketPools)", &InternalsController::OnGetSocketPools);
 			};
 
 			ApiResponse InternalsController::OnGetInternals(const std::shared_ptr<http::svr::HttpExchange> &client)
@@ -25,6 +27,8 @@ namespace api
 				Json::Value response(Json::ValueType::arrayValue);
 
 				response.append("/v1/stats/current/internals/queues");
+				response.append("/v1/stats/current/internals/memoryPools");
+				response.append("/v1/stats/current/internals/socketPools");
 
 				return response;
 			}
@@ -47,6 +51,32 @@ namespace api
 
 				return response;
 			}
+
+			ApiResponse InternalsController::OnGetMemoryPools(const std::shared_ptr<http::svr::HttpExchange> &client)
+			{
+				Json::Value response(Json::ValueType::arrayValue);
+
+				auto serverMetric = MonitorInstance->GetServerMetrics();
+
+				for (const auto &stats : serverMetric->GetMemoryPoolStats())
+				{
+					response.append(serdes::JsonFromMemoryPoolStats(stats));
+				}
+
+				return response;
+			}
+
+			ApiResponse InternalsController::OnGetSocketPools(const std::shared_ptr<http::svr::HttpExchange> &client)
+			{
+				Json::Value response(Json::ValueType::arrayValue);
+
+				for (const auto &socket_pool : ov::SocketPool::GetPoolList())
+				{
+					response.append(serdes::JsonFromSocketPool(socket_pool));
+				}
+
+				return response;
+			}
 		}  // namespace stats
 	}	   // namespace v1
-}  // namespace api
\ No newline at end of file
+}  // namespace api
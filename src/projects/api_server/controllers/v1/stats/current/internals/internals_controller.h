@@ -24,6 +24,8 @@ namespace api
 			protected:
 				ApiResponse OnGetInternals(const std::shared_ptr<http::svr::HttpExchange> &client);
 				ApiResponse OnGetQueues(const std::shared_ptr<http::svr::HttpExchange> &client);
+				ApiResponse OnGetMemoryPools(const std::shared_ptr<http::svr::HttpExchange> &client);
+				ApiResponse OnGetSocketPools(const std::shared_ptr<http::svr::HttpExchange> &client);
 			};
 		}  // namespace stats
 	}	   // namespace v1
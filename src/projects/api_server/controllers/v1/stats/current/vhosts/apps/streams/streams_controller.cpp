@@ -8,6 +8,10 @@
 //==============================================================================
 #include "streams_controller.h"
 
+#include <orchestrator/orchestrator.h>
+#include <publishers/webrtc/rtc_session.h>
+#include <publishers/webrtc/webrtc_publisher.h>
+
 namespace api
 {
 	namespace v1
@@ -17,6 +21,7 @@ namespace api
 			void StreamsController::PrepareHandlers()
 			{
 				RegisterGet(R"(\/(?<stream_name>[^\/]*))", &StreamsController::OnGetStream);
+				RegisterGet(R"(\/(?<stream_name>[^\/]*)\/webrtcSessions)", &StreamsController::OnGetWebRtcSessions);
 			};
 
 			ApiResponse StreamsController::OnGetStream(const std::shared_ptr<http::svr::HttpExchange> &client,
@@ -27,6 +32,56 @@ namespace api
 			{
 				return ::serdes::JsonFromMetrics(stream);
 			}
+
+			ApiResponse StreamsController::OnGetWebRtcSessions(const std::shared_ptr<http::svr::HttpExchange> &client,
+															   const std::shared_ptr<mon::HostMetrics> &vhost,
+															   const std::shared_ptr<mon::ApplicationMetrics> &app,
+															   const std::shared_ptr<mon::StreamMetrics> &stream,
+															   const std::vector<std::shared_ptr<mon::StreamMetrics>> &output_streams)
+			{
+				Json::Value response(Json::ValueType::arrayValue);
+
+				auto publisher = std::dynamic_pointer_cast<WebRtcPublisher>(ocst::Orchestrator::GetInstance()->GetPublisherFromType(PublisherType::Webrtc));
+				if (publisher == nullptr)
+				{
+					return response;
+				}
+
+				auto application = publisher->GetApplicationByName(app->GetName());
+				if (application == nullptr)
+				{
+					return response;
+				}
+
+				// The sessions are attached to the output streams
+				std::vector<std::shared_ptr<mon::StreamMetrics>> streams = output_streams;
+				streams.push_back(stream);
+
+				for (const auto &stream_metrics : streams)
+				{
+					auto rtc_stream = application->GetStream(stream_metrics->GetName());
+					if (rtc_stream == nullptr)
+					{
+						continue;
+					}
+
+					for (const auto &[session_id, session] : rtc_stream->GetAllSessions())
+					{
+						auto rtc_session = std::dynamic_pointer_cast<RtcSession>(session);
+						if (rtc_session == nullptr)
+						{
+							continue;
+						}
+
+						auto json_session = rtc_session->GetBandwidthStats();
+						json_session["stream"] = stream_metrics->GetName().CStr();
+
+						response.append(json_session);
+					}
+				}
+
+				return response;
+			}
 		}  // namespace stats
 	}	   // namespace v1
 }  // namespace api
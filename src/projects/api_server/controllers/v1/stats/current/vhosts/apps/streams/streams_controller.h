@@ -27,6 +27,13 @@ namespace api
 										const std::shared_ptr<mon::ApplicationMetrics> &app,
 										const std::shared_ptr<mon::StreamMetrics> &stream,
 										const std::vector<std::shared_ptr<mon::StreamMetrics>> &output_streams);
+
+				// GET /v1/stats/current/vhosts/<vhost_name>/apps/<app_name>/streams/<stream_name>/webrtcSessions
+				ApiResponse OnGetWebRtcSessions(const std::shared_ptr<http::svr::HttpExchange> &client,
+												const std::shared_ptr<mon::HostMetrics> &vhost,
+												const std::shared_ptr<mon::ApplicationMetrics> &app,
+												const std::shared_ptr<mon::StreamMetrics> &stream,
+												const std::vector<std::shared_ptr<mon::StreamMetrics>> &output_streams);
 			};
 		}  // namespace stats
 	}	   // namespace v1
@@ -104,6 +104,15 @@ enum class WebRtcBandwidthEstimationType : uint8_t
 	None,
 };
 
+// Which losses the ULPFEC packets of a frame are arranged to recover
+enum class UlpfecMaskType : uint8_t
+{
+	// More combinations of the scattered losses
+	Random,
+	// Any run of consecutive losses up to the number of FEC packets
+	Bursty,
+};
+
 enum class FrameType : int8_t
 {
 	EmptyFrame,
@@ -619,6 +619,7 @@ std::shared_ptr<MediaTrack> MediaTrack::Clone()
 	track->_has_bframe = _has_bframe;
 	track->_preset = _preset;
 	track->_use_hwaccel = _use_hwaccel;
+	track->_key_frame_decode_only = _key_frame_decode_only;
 	track->_colorspace = _colorspace;
 
 	// Audio Track
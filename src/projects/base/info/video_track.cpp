@@ -19,6 +19,7 @@ VideoTrack::VideoTrack()
 	  _key_frame_interval_conf(0),
 	  _b_frames(0),
 	  _has_bframe(false),
+	  _key_frame_decode_only(false),
 	  _preset(""),
 	  _thread_count(0)
 {
@@ -217,3 +218,13 @@ bool VideoTrack::GetHardwareAccel() const
 {
 	return _use_hwaccel;
 }
+
+void VideoTrack::SetKeyFrameDecodeOnly(bool key_frame_decode_only)
+{
+	_key_frame_decode_only = key_frame_decode_only;
+}
+
+bool VideoTrack::IsKeyFrameDecodeOnly() const
+{
+	return _key_frame_decode_only;
+}
@@ -78,6 +78,10 @@ public:
 	void SetHardwareAccel(bool hwaccel);
 	bool GetHardwareAccel() const;
 
+	// Only the key frames are decoded (ex: the track is transcoded only to thumbnails)
+	void SetKeyFrameDecodeOnly(bool key_frame_decode_only);
+	bool IsKeyFrameDecodeOnly() const;
+
 protected:
 
 	// framerate (measurement)
@@ -115,6 +119,9 @@ protected:
 	// Enable hardware acceleration
 	bool _use_hwaccel;
 
+	// Decode only the key frames (set by transcoder)
+	bool _key_frame_decode_only;
+
 	// Preset for encoder (set by user)
 	ov::String _preset;
 
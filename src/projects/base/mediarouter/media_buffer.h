@@ -40,6 +40,14 @@ static ov::String GetMediaPacketFlagString(const MediaPacketFlag flag)
 class MediaPacket
 {
 public:
+	// Creates a packet whose object and shared_ptr control block are allocated from ov::MemoryPool.
+	// Use this instead of MediaPacket::Create() on the packet path.
+	template <typename... Targs>
+	static std::shared_ptr<MediaPacket> Create(Targs &&...args)
+	{
+		return std::allocate_shared<MediaPacket>(ov::PoolAllocator<MediaPacket>(), std::forward<Targs>(args)...);
+	}
+
 	// Provider must inform the bitstream format so that MediaRouter can handle it.
 	// This constructor is usually used by the Provider to send media packets to the MediaRouter.
 	MediaPacket(uint32_t msid, cmn::MediaType media_type, int32_t track_id, const std::shared_ptr<ov::Data> &data, int64_t pts, int64_t dts, cmn::BitstreamFormat bitstream_format, cmn::PacketType packet_type)
@@ -231,7 +239,7 @@ public:
 
 	std::shared_ptr<MediaPacket> ClonePacket() const
 	{
-		auto packet = std::make_shared<MediaPacket>(
+		auto packet = MediaPacket::Create(
 			GetMsid(),
 			GetMediaType(),
 			GetTrackId(),
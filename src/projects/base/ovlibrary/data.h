@@ -11,17 +11,22 @@
 #include "./string.h"
 #include "./assert.h"
 #include "./memory_utilities.h"
+#include "./memory_pool.h"
 #include "./data.h"
 
 #include <memory>
 #include <algorithm>
 #include <cstddef>
+#include <vector>
 
 namespace ov
 {
 	class Data
 	{
 	public:
+		// The storage is allocated from ov::MemoryPool to avoid malloc() on the packet path
+		typedef std::vector<uint8_t, PoolAllocator<uint8_t>> Buffer;
+
 		// Default constructor
 		Data();
 
@@ -214,10 +219,17 @@ namespace ov
 		/// @return true on success, false on failure
 		bool Detach();
 
+		// Allocates the buffer and the control block of the shared_ptr from the pool
+		template <typename... Targs>
+		static std::shared_ptr<Buffer> CreateBuffer(Targs &&...args)
+		{
+			return std::allocate_shared<Buffer>(PoolAllocator<Buffer>(), std::forward<Targs>(args)...);
+		}
+
 		const void *_reference_data = nullptr;
 
 		// Allocated data. If this data is subdata, _current_data and _data can be different.
-		std::shared_ptr<std::vector<uint8_t>> _allocated_data = nullptr;
+		std::shared_ptr<Buffer> _allocated_data = nullptr;
 		// Offset from _allocated_data
 		off_t _offset = 0;
 
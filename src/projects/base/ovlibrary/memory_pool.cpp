@@ -0,0 +1,555 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by agent
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "memory_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+
+namespace ov
+{
+	// log2(OV_MEMORY_POOL_MIN_BLOCK_SIZE)
+	static constexpr size_t MIN_BLOCK_SHIFT = 5;
+	// Number of size classes between two powers of 2
+	static constexpr size_t SIZE_CLASS_STEP_SHIFT = 2;
+	static constexpr size_t SIZE_CLASS_STEPS = 1 << SIZE_CLASS_STEP_SHIFT;
+	// 32, 40, 48, 56, 64, 80, 96, 112, 128, ..., 1 MB
+	static constexpr size_t SIZE_CLASS_COUNT = 1 + (SIZE_CLASS_STEPS * 15);
+
+	static_assert((1 << MIN_BLOCK_SHIFT) == OV_MEMORY_POOL_MIN_BLOCK_SIZE, "Invalid block shift");
+
+	// Counters are accumulated in the thread cache, and published to the global stats every N operations
+	static constexpr uint32_t STATS_PUBLISH_INTERVAL = 64;
+	// Thread caches check whether the trim interval has elapsed every N operations
+	static constexpr uint32_t TRIM_CHECK_INTERVAL = 1024;
+
+	struct FreeBlock
+	{
+		FreeBlock *next;
+	};
+
+	struct alignas(64) SizeClass
+	{
+		std::mutex depot_mutex;
+		FreeBlock *depot = nullptr;
+		size_t depot_count = 0;
+		// The smallest depot_count since the last trim (the blocks that were not needed during the interval)
+		size_t depot_low_count = 0;
+
+		std::atomic<uint64_t> hit_count{0};
+		std::atomic<uint64_t> miss_count{0};
+		std::atomic<int64_t> used_bytes{0};
+		std::atomic<int64_t> footprint_bytes{0};
+	};
+
+	// These are never destroyed explicitly (all members are trivially destructible),
+	// so blocks can be freed even while the static objects are being destroyed.
+	static SizeClass size_classes[SIZE_CLASS_COUNT];
+	static SizeClass large_class;
+
+	// Bytes cached in the depots of all size classes
+	static std::atomic<int64_t> depot_bytes{0};
+	static std::atomic<int64_t> depot_trimmed_time_ms{0};
+
+	static constexpr size_t GetBlockSize(size_t index)
+	{
+		if (index == 0)
+		{
+			return OV_MEMORY_POOL_MIN_BLOCK_SIZE;
+		}
+
+		// (index - 1) / SIZE_CLASS_STEPS: the power of 2 range, (index - 1) % SIZE_CLASS_STEPS + 1: the step in the range
+		const size_t base = static_cast<size_t>(OV_MEMORY_POOL_MIN_BLOCK_SIZE) << ((index - 1) >> SIZE_CLASS_STEP_SHIFT);
+
+		return base + (base >> SIZE_CLASS_STEP_SHIFT) * (((index - 1) & (SIZE_CLASS_STEPS - 1)) + 1);
+	}
+
+	static_assert(GetBlockSize(SIZE_CLASS_COUNT - 1) == OV_MEMORY_POOL_MAX_BLOCK_SIZE, "Invalid size class count");
+
+	static inline size_t GetSizeClassIndex(size_t size)
+	{
+		if (size <= OV_MEMORY_POOL_MIN_BLOCK_SIZE)
+		{
+			return 0;
+		}
+
+		const auto value = static_cast<unsigned long long>(size - 1);
+		// floor(log2(size - 1))
+		const size_t shift = 63 - __builtin_clzll(value);
+		const size_t step = (value - (1ULL << shift)) >> (shift - SIZE_CLASS_STEP_SHIFT);
+
+		return 1 + ((shift - MIN_BLOCK_SHIFT) << SIZE_CLASS_STEP_SHIFT) + step;
+	}
+
+	static inline size_t GetThreadCacheLimit(size_t index)
+	{
+		return std::clamp<size_t>(OV_MEMORY_POOL_THREAD_CACHE_CLASS_BYTES / GetBlockSize(index), 4, 1024);
+	}
+
+	static inline int64_t GetTimeMs()
+	{
+		return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	// Detaches the first `count` blocks from the list
+	static FreeBlock *DetachBlocks(FreeBlock *&head, size_t count)
+	{
+		if ((head == nullptr) || (count == 0))
+		{
+			return nullptr;
+		}
+
+		auto detached_head = head;
+		auto detached_tail = head;
+
+		for (size_t index = 1; (index < count) && (detached_tail->next != nullptr); index++)
+		{
+			detached_tail = detached_tail->next;
+		}
+
+		head = detached_tail->next;
+		detached_tail->next = nullptr;
+
+		return detached_head;
+	}
+
+	// Releases the blocks of the list to the system
+	static void ReleaseToSystem(size_t index, FreeBlock *head)
+	{
+		const auto block_size = GetBlockSize(index);
+		int64_t released_bytes = 0;
+
+		while (head != nullptr)
+		{
+			auto next = head->next;
+
+			::operator delete(head);
+			released_bytes += block_size;
+
+			head = next;
+		}
+
+		size_classes[index].footprint_bytes.fetch_sub(released_bytes, std::memory_order_relaxed);
+	}
+
+	// Releases the blocks that stayed in the depot since the last trim (or all blocks if `all` is true)
+	static void TrimDepots(bool all)
+	{
+		for (size_t index = 0; index < SIZE_CLASS_COUNT; index++)
+		{
+			auto &size_class = size_classes[index];
+			FreeBlock *trimmed_head = nullptr;
+
+			{
+				std::lock_guard lock_guard(size_class.depot_mutex);
+
+				const auto trim_count = all ? size_class.depot_count : size_class.depot_low_count;
+
+				if (trim_count > 0)
+				{
+					trimmed_head = DetachBlocks(size_class.depot, trim_count);
+					size_class.depot_count -= trim_count;
+					depot_bytes.fetch_sub(static_cast<int64_t>(trim_count * GetBlockSize(index)), std::memory_order_relaxed);
+				}
+
+				size_class.depot_low_count = size_class.depot_count;
+			}
+
+			ReleaseToSystem(index, trimmed_head);
+		}
+	}
+
+	static void TrimDepotsIfNeeded()
+	{
+		const auto now_ms = GetTimeMs();
+		auto trimmed_time_ms = depot_trimmed_time_ms.load(std::memory_order_relaxed);
+
+		if ((now_ms - trimmed_time_ms) < OV_MEMORY_POOL_TRIM_INTERVAL_MS)
+		{
+			return;
+		}
+
+		// Only one thread trims the depots
+		if (depot_trimmed_time_ms.compare_exchange_strong(trimmed_time_ms, now_ms, std::memory_order_relaxed))
+		{
+			TrimDepots(false);
+		}
+	}
+
+	// Moves the blocks of the list to the depot (blocks that exceed OV_MEMORY_POOL_DEPOT_BYTES are released to the system)
+	static void ReleaseToDepot(size_t index, FreeBlock *head)
+	{
+		auto &size_class = size_classes[index];
+		const auto block_size = GetBlockSize(index);
+		FreeBlock *overflow_head = nullptr;
+
+		{
+			std::lock_guard lock_guard(size_class.depot_mutex);
+
+			while (head != nullptr)
+			{
+				auto next = head->next;
+
+				if ((depot_bytes.load(std::memory_order_relaxed) + static_cast<int64_t>(block_size)) <= OV_MEMORY_POOL_DEPOT_BYTES)
+				{
+					head->next = size_class.depot;
+					size_class.depot = head;
+					size_class.depot_count++;
+					depot_bytes.fetch_add(block_size, std::memory_order_relaxed);
+				}
+				else
+				{
+					head->next = overflow_head;
+					overflow_head = head;
+				}
+
+				head = next;
+			}
+		}
+
+		ReleaseToSystem(index, overflow_head);
+
+		TrimDepotsIfNeeded();
+	}
+
+	// thread_local variable with a trivial type doesn't need a guard, so it is safe to read at thread exit
+	static thread_local bool thread_cache_destroyed = false;
+
+	struct ThreadCache
+	{
+		struct Bin
+		{
+			FreeBlock *head = nullptr;
+			size_t count = 0;
+			// The smallest count since the last trim
+			size_t low_count = 0;
+
+			uint32_t pending_operations = 0;
+			uint64_t pending_hit_count = 0;
+			int64_t pending_used_bytes = 0;
+		};
+
+		Bin bins[SIZE_CLASS_COUNT];
+
+		// Bytes cached in all bins
+		size_t cached_bytes = 0;
+
+		uint32_t trim_check_operations = 0;
+		int64_t trimmed_time_ms = GetTimeMs();
+
+		~ThreadCache()
+		{
+			for (size_t index = 0; index < SIZE_CLASS_COUNT; index++)
+			{
+				PublishStats(index, bins[index]);
+			}
+
+			ReleaseAll();
+
+			thread_cache_destroyed = true;
+		}
+
+		// Moves `count` blocks of the bin to the depot
+		void Release(size_t index, size_t count)
+		{
+			auto &bin = bins[index];
+
+			count = std::min(count, bin.count);
+
+			if (count == 0)
+			{
+				return;
+			}
+
+			auto released_head = DetachBlocks(bin.head, count);
+
+			bin.count -= count;
+			bin.low_count = std::min(bin.low_count, bin.count);
+			cached_bytes -= count * GetBlockSize(index);
+
+			ReleaseToDepot(index, released_head);
+		}
+
+		void ReleaseAll()
+		{
+			for (size_t index = 0; index < SIZE_CLASS_COUNT; index++)
+			{
+				Release(index, bins[index].count);
+			}
+		}
+
+		// Moves the blocks that were not needed since the last trim to the depot
+		void TrimIfNeeded()
+		{
+			trim_check_operations++;
+
+			if (trim_check_operations < TRIM_CHECK_INTERVAL)
+			{
+				return;
+			}
+
+			trim_check_operations = 0;
+
+			const auto now_ms = GetTimeMs();
+
+			if ((now_ms - trimmed_time_ms) < OV_MEMORY_POOL_TRIM_INTERVAL_MS)
+			{
+				return;
+			}
+
+			trimmed_time_ms = now_ms;
+
+			for (size_t index = 0; index < SIZE_CLASS_COUNT; index++)
+			{
+				auto &bin = bins[index];
+
+				Release(index, bin.low_count);
+				bin.low_count = bin.count;
+			}
+
+			// The depots are trimmed here as well, since they are not touched while the thread caches can serve the requests
+			TrimDepotsIfNeeded();
+		}
+
+		static void PublishStats(size_t index, Bin &bin)
+		{
+			auto &size_class = size_classes[index];
+
+			size_class.hit_count.fetch_add(bin.pending_hit_count, std::memory_order_relaxed);
+			size_class.used_bytes.fetch_add(bin.pending_used_bytes, std::memory_order_relaxed);
+
+			bin.pending_operations = 0;
+			bin.pending_hit_count = 0;
+			bin.pending_used_bytes = 0;
+		}
+
+		static void PublishStatsIfNeeded(size_t index, Bin &bin)
+		{
+			bin.pending_operations++;
+
+			if (bin.pending_operations >= STATS_PUBLISH_INTERVAL)
+			{
+				PublishStats(index, bin);
+			}
+		}
+	};
+
+	static inline ThreadCache *GetThreadCache()
+	{
+		if (thread_cache_destroyed)
+		{
+			return nullptr;
+		}
+
+		thread_local ThreadCache thread_cache;
+
+		return &thread_cache;
+	}
+
+	static bool RefillFromDepot(size_t index, ThreadCache &thread_cache)
+	{
+		auto &size_class = size_classes[index];
+		auto &bin = thread_cache.bins[index];
+		const auto refill_count = std::max<size_t>(GetThreadCacheLimit(index) / 2, 1);
+		size_t count = 0;
+
+		{
+			std::lock_guard lock_guard(size_class.depot_mutex);
+
+			while ((size_class.depot != nullptr) && (count < refill_count))
+			{
+				auto block = size_class.depot;
+				size_class.depot = block->next;
+
+				block->next = bin.head;
+				bin.head = block;
+
+				count++;
+			}
+
+			size_class.depot_count -= count;
+			size_class.depot_low_count = std::min(size_class.depot_low_count, size_class.depot_count);
+			depot_bytes.fetch_sub(static_cast<int64_t>(count * GetBlockSize(index)), std::memory_order_relaxed);
+		}
+
+		bin.count += count;
+		thread_cache.cached_bytes += count * GetBlockSize(index);
+
+		TrimDepotsIfNeeded();
+
+		return (count > 0);
+	}
+
+	void *MemoryPool::Allocate(size_t size)
+	{
+		size = std::max<size_t>(size, 1);
+
+		if (size > OV_MEMORY_POOL_MAX_BLOCK_SIZE)
+		{
+			auto pointer = ::operator new(size);
+
+			large_class.miss_count.fetch_add(1, std::memory_order_relaxed);
+			large_class.used_bytes.fetch_add(size, std::memory_order_relaxed);
+			large_class.footprint_bytes.fetch_add(size, std::memory_order_relaxed);
+
+			return pointer;
+		}
+
+		const auto index = GetSizeClassIndex(size);
+		const auto block_size = GetBlockSize(index);
+		auto &size_class = size_classes[index];
+
+		auto thread_cache = GetThreadCache();
+
+		if (thread_cache != nullptr)
+		{
+			auto &bin = thread_cache->bins[index];
+
+			if ((bin.head != nullptr) || RefillFromDepot(index, *thread_cache))
+			{
+				auto block = bin.head;
+				bin.head = block->next;
+				bin.count--;
+				bin.low_count = std::min(bin.low_count, bin.count);
+				thread_cache->cached_bytes -= block_size;
+
+				bin.pending_hit_count++;
+				bin.pending_used_bytes += block_size;
+				ThreadCache::PublishStatsIfNeeded(index, bin);
+
+				thread_cache->TrimIfNeeded();
+
+				return block;
+			}
+		}
+		else
+		{
+			// The thread is exiting - use the depot directly
+			std::lock_guard lock_guard(size_class.depot_mutex);
+
+			auto block = size_class.depot;
+
+			if (block != nullptr)
+			{
+				size_class.depot = block->next;
+				size_class.depot_count--;
+				size_class.depot_low_count = std::min(size_class.depot_low_count, size_class.depot_count);
+				depot_bytes.fetch_sub(block_size, std::memory_order_relaxed);
+
+				size_class.hit_count.fetch_add(1, std::memory_order_relaxed);
+				size_class.used_bytes.fetch_add(block_size, std::memory_order_relaxed);
+
+				return block;
+			}
+		}
+
+		auto pointer = ::operator new(block_size);
+
+		size_class.miss_count.fetch_add(1, std::memory_order_relaxed);
+		size_class.used_bytes.fetch_add(block_size, std::memory_order_relaxed);
+		size_class.footprint_bytes.fetch_add(block_size, std::memory_order_relaxed);
+
+		return pointer;
+	}
+
+	void MemoryPool::Free(void *pointer, size_t size) noexcept
+	{
+		if (pointer == nullptr)
+		{
+			return;
+		}
+
+		size = std::max<size_t>(size, 1);
+
+		if (size > OV_MEMORY_POOL_MAX_BLOCK_SIZE)
+		{
+			::operator delete(pointer);
+
+			large_class.used_bytes.fetch_sub(size, std::memory_order_relaxed);
+			large_class.footprint_bytes.fetch_sub(size, std::memory_order_relaxed);
+
+			return;
+		}
+
+		const auto index = GetSizeClassIndex(size);
+		const auto block_size = GetBlockSize(index);
+		auto block = static_cast<FreeBlock *>(pointer);
+
+		auto thread_cache = GetThreadCache();
+
+		if (thread_cache == nullptr)
+		{
+			size_classes[index].used_bytes.fetch_sub(block_size, std::memory_order_relaxed);
+
+			block->next = nullptr;
+			ReleaseToDepot(index, block);
+
+			return;
+		}
+
+		auto &bin = thread_cache->bins[index];
+
+		block->next = bin.head;
+		bin.head = block;
+		bin.count++;
+		thread_cache->cached_bytes += block_size;
+
+		bin.pending_used_bytes -= block_size;
+		ThreadCache::PublishStatsIfNeeded(index, bin);
+
+		if ((bin.count > GetThreadCacheLimit(index)) || (thread_cache->cached_bytes > OV_MEMORY_POOL_THREAD_CACHE_BYTES))
+		{
+			// Keep half of the blocks, and move the rest to the depot so that other threads can use them
+			thread_cache->Release(index, std::max<size_t>(bin.count / 2, 1));
+		}
+
+		thread_cache->TrimIfNeeded();
+	}
+
+	void MemoryPool::Trim()
+	{
+		auto thread_cache = GetThreadCache();
+
+		if (thread_cache != nullptr)
+		{
+			thread_cache->ReleaseAll();
+		}
+
+		TrimDepots(true);
+	}
+
+	std::vector<MemoryPool::Stats> MemoryPool::GetStats()
+	{
+		std::vector<Stats> stats_list;
+		stats_list.reserve(SIZE_CLASS_COUNT + 1);
+
+		auto to_stats = [](const SizeClass &size_class, size_t block_size) -> Stats {
+			Stats stats;
+
+			stats.block_size = block_size;
+			stats.hit_count = size_class.hit_count.load(std::memory_order_relaxed);
+			stats.miss_count = size_class.miss_count.load(std::memory_order_relaxed);
+			// The counters of the thread caches are published periodically, so they can be slightly off
+			stats.used_bytes = static_cast<uint64_t>(std::max<int64_t>(size_class.used_bytes.load(std::memory_order_relaxed), 0));
+			stats.footprint_bytes = static_cast<uint64_t>(std::max<int64_t>(size_class.footprint_bytes.load(std::memory_order_relaxed), 0));
+
+			return stats;
+		};
+
+		for (size_t index = 0; index < SIZE_CLASS_COUNT; index++)
+		{
+			stats_list.push_back(to_stats(size_classes[index], GetBlockSize(index)));
+		}
+
+		stats_list.push_back(to_stats(large_class, 0));
+
+		return stats_list;
+	}
+}  // namespace ov
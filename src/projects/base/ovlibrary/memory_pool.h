@@ -0,0 +1,114 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by agent
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <vector>
+
+// Smallest/largest block served by the pool (power of 2)
+#define OV_MEMORY_POOL_MIN_BLOCK_SIZE (32)
+#define OV_MEMORY_POOL_MAX_BLOCK_SIZE (1024 * 1024)
+
+// Maximum bytes cached per size class in each thread
+#define OV_MEMORY_POOL_THREAD_CACHE_CLASS_BYTES (1024 * 1024)
+// Maximum bytes cached in each thread (all size classes)
+#define OV_MEMORY_POOL_THREAD_CACHE_BYTES (4 * 1024 * 1024)
+// Maximum bytes cached in the global depots (all size classes, shared by all threads)
+#define OV_MEMORY_POOL_DEPOT_BYTES (64 * 1024 * 1024)
+
+// Cached blocks that were not needed during this interval are released to the system
+#define OV_MEMORY_POOL_TRIM_INTERVAL_MS (5 * 1000)
+
+namespace ov
+{
+	// Size-class memory pool with per-thread caches
+	//
+	// Requests are rounded up to a size class (32 bytes ~ 1 MB, 4 classes between powers of 2, so a block wastes
+	// at most 25%), and freed blocks are kept in the cache of the freeing thread. When a thread cache grows too
+	// large, half of it moves to a global depot, where other threads (ex: the producer of a packet that is released
+	// by a publisher thread) pick it up. Larger requests are forwarded to ::operator new()/delete().
+	//
+	// Cached blocks are bounded (OV_MEMORY_POOL_THREAD_CACHE_BYTES per thread, OV_MEMORY_POOL_DEPOT_BYTES in total
+	// for the depots), and the blocks that stayed unused for OV_MEMORY_POOL_TRIM_INTERVAL_MS are released to the
+	// system, so a traffic spike doesn't stay resident.
+	class MemoryPool
+	{
+	public:
+		struct Stats
+		{
+			// Block size of the size class (0 == larger than OV_MEMORY_POOL_MAX_BLOCK_SIZE)
+			size_t block_size = 0;
+
+			// Allocations served from the cache/depot
+			uint64_t hit_count = 0;
+			// Allocations that needed ::operator new()
+			uint64_t miss_count = 0;
+
+			// Bytes currently handed out to the users
+			uint64_t used_bytes = 0;
+			// Bytes obtained from the system (used + cached)
+			uint64_t footprint_bytes = 0;
+		};
+
+		static void *Allocate(size_t size);
+		static void Free(void *pointer, size_t size) noexcept;
+
+		// Releases the blocks cached in the calling thread and in the depots to the system
+		static void Trim();
+
+		// Returns the stats for each size class (and the last item for the large blocks)
+		static std::vector<Stats> GetStats();
+	};
+
+	// STL compatible allocator that uses MemoryPool
+	//
+	// Usage:
+	//   std::vector<uint8_t, ov::PoolAllocator<uint8_t>> buffer;
+	//   auto instance = std::allocate_shared<Foo>(ov::PoolAllocator<Foo>(), ...);
+	template <typename T>
+	class PoolAllocator
+	{
+	public:
+		typedef T value_type;
+
+		PoolAllocator() noexcept = default;
+
+		template <typename U>
+		PoolAllocator(const PoolAllocator<U> &) noexcept
+		{
+		}
+
+		T *allocate(size_t count)
+		{
+			static_assert(alignof(T) <= alignof(std::max_align_t), "Over-aligned types are not supported");
+
+			return static_cast<T *>(MemoryPool::Allocate(count * sizeof(T)));
+		}
+
+		void deallocate(T *pointer, size_t count) noexcept
+		{
+			MemoryPool::Free(pointer, count * sizeof(T));
+		}
+
+		template <typename U>
+		bool operator==(const PoolAllocator<U> &) const noexcept
+		{
+			return true;
+		}
+
+		template <typename U>
+		bool operator!=(const PoolAllocator<U> &) const noexcept
+		{
+			return false;
+		}
+	};
+}  // namespace ov
@@ -24,6 +24,7 @@
 #include "./json.h"
 #include "./log.h"
 #include "./memory_utilities.h"
+#include "./memory_pool.h"
 #include "./ovdata_structure.h"
 #include "./path_manager.h"
 #include "./pcm_utilities.h"
@@ -31,12 +32,15 @@
 #include "./queue.h"
 #include "./raii_ptr.h"
 #include "./random.h"
+#include "./rcu.h"
+#include "./rcu_hash_map.h"
 #include "./regex.h"
 #include "./semaphore.h"
 #include "./singleton.h"
 #include "./stack_trace.h"
 #include "./stop_watch.h"
 #include "./string.h"
+#include "./thread_topology.h"
 #include "./time.h"
 #include "./type.h"
 #include "./unique.h"
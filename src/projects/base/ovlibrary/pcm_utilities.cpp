@@ -8,3 +8,601 @@
 //==============================================================================
 #include "pcm_utilities.h"
 
+#include <math.h>
+
+#include <algorithm>
+#include <atomic>
+
+#if defined(__x86_64__) || defined(__i386__)
+#	define OV_PCM_X86
+#	include <immintrin.h>
+#endif
+
+namespace ov
+{
+	namespace pcm
+	{
+		namespace
+		{
+			struct Kernels
+			{
+				PcmSimdLevel level;
+
+				void (*convert_s16_to_float)(float *destination, const int16_t *source, int samples);
+				void (*convert_float_to_s16)(int16_t *destination, const float *source, int samples);
+				void (*interleave_stereo_float)(float *destination, const float *left, const float *right, int samples);
+				void (*interleave_stereo_s16)(int16_t *destination, const int16_t *left, const int16_t *right, int samples);
+				void (*interleave_stereo_to_s16)(int16_t *destination, const float *left, const float *right, int samples);
+				void (*deinterleave_stereo)(float *left, float *right, const float *source, int samples);
+				void (*deinterleave_stereo_from_s16)(float *left, float *right, const int16_t *source, int samples);
+				void (*downmix_stereo)(float *destination, const float *left, const float *right, int samples);
+				float (*dot_product)(const float *a, const float *b, int count);
+			};
+
+			constexpr float S16_TO_FLOAT = 1.0f / 32768.0f;
+			constexpr float FLOAT_TO_S16 = 32768.0f;
+			constexpr float S16_MIN = -32768.0f;
+			constexpr float S16_MAX = 32767.0f;
+
+			//--------------------------------------------------------------------
+			// Scalar
+			//--------------------------------------------------------------------
+			inline int16_t FloatToS16(float sample)
+			{
+				return static_cast<int16_t>(::lrintf(std::min(std::max(sample * FLOAT_TO_S16, S16_MIN), S16_MAX)));
+			}
+
+			void ConvertS16ToFloatScalar(float *destination, const int16_t *source, int samples)
+			{
+				for (int index = 0; index < samples; index++)
+				{
+					destination[index] = source[index] * S16_TO_FLOAT;
+				}
+			}
+
+			void ConvertFloatToS16Scalar(int16_t *destination, const float *source, int samples)
+			{
+				for (int index = 0; index < samples; index++)
+				{
+					destination[index] = FloatToS16(source[index]);
+				}
+			}
+
+			void InterleaveStereoFloatScalar(float *destination, const float *left, const float *right, int samples)
+			{
+				for (int index = 0; index < samples; index++)
+				{
+					destination[index * 2] = left[index];
+					destination[index * 2 + 1] = right[index];
+				}
+			}
+
+			void InterleaveStereoS16Scalar(int16_t *destination, const int16_t *left, const int16_t *right, int samples)
+			{
+				for (int index = 0; index < samples; index++)
+				{
+					destination[index * 2] = left[index];
+					destination[index * 2 + 1] = right[index];
+				}
+			}
+
+			void InterleaveStereoToS16Scalar(int16_t *destination, const float *left, const float *right, int samples)
+			{
+				for (int index = 0; index < samples; index++)
+				{
+					destination[index * 2] = FloatToS16(left[index]);
+					destination[index * 2 + 1] = FloatToS16(right[index]);
+				}
+			}
+
+			void DeinterleaveStereoScalar(float *left, float *right, const float *source, int samples)
+			{
+				for (int index = 0; index < samples; index++)
+				{
+					left[index] = source[index * 2];
+					right[index] = source[index * 2 + 1];
+				}
+			}
+
+			void DeinterleaveStereoFromS16Scalar(float *left, float *right, const int16_t *source, int samples)
+			{
+				for (int index = 0; index < samples; index++)
+				{
+					left[index] = source[index * 2] * S16_TO_FLOAT;
+					right[index] = source[index * 2 + 1] * S16_TO_FLOAT;
+				}
+			}
+
+			void DownmixStereoScalar(float *destination, const float *left, const float *right, int samples)
+			{
+				for (int index = 0; index < samples; index++)
+				{
+					destination[index] = (left[index] + right[index]) * 0.5f;
+				}
+			}
+
+			float DotProductScalar(const float *a, const float *b, int count)
+			{
+				float sum = 0.0f;
+
+				for (int index = 0; index < count; index++)
+				{
+					sum += a[index] * b[index];
+				}
+
+				return sum;
+			}
+
+			const Kernels SCALAR_KERNELS = {
+				PcmSimdLevel::Scalar,
+				ConvertS16ToFloatScalar,
+				ConvertFloatToS16Scalar,
+				InterleaveStereoFloatScalar,
+				InterleaveStereoS16Scalar,
+				InterleaveStereoToS16Scalar,
+				DeinterleaveStereoScalar,
+				DeinterleaveStereoFromS16Scalar,
+				DownmixStereoScalar,
+				DotProductScalar};
+
+#if defined(OV_PCM_X86)
+			//--------------------------------------------------------------------
+			// SSE4.1
+			//--------------------------------------------------------------------
+			__attribute__((target("sse4.1"))) inline __m128i FloatToS32Sse4(__m128 samples)
+			{
+				samples = _mm_mul_ps(samples, _mm_set1_ps(FLOAT_TO_S16));
+				samples = _mm_min_ps(_mm_max_ps(samples, _mm_set1_ps(S16_MIN)), _mm_set1_ps(S16_MAX));
+
+				return _mm_cvtps_epi32(samples);
+			}
+
+			__attribute__((target("sse4.1"))) void ConvertS16ToFloatSse4(float *destination, const int16_t *source, int samples)
+			{
+				const __m128 scale = _mm_set1_ps(S16_TO_FLOAT);
+				int index = 0;
+
+				for (; index + 4 <= samples; index += 4)
+				{
+					__m128i s32 = _mm_cvtepi16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(source + index)));
+					_mm_storeu_ps(destination + index, _mm_mul_ps(_mm_cvtepi32_ps(s32), scale));
+				}
+
+				ConvertS16ToFloatScalar(destination + index, source + index, samples - index);
+			}
+
+			__attribute__((target("sse4.1"))) void ConvertFloatToS16Sse4(int16_t *destination, const float *source, int samples)
+			{
+				int index = 0;
+
+				for (; index + 8 <= samples; index += 8)
+				{
+					__m128i low = FloatToS32Sse4(_mm_loadu_ps(source + index));
+					__m128i high = FloatToS32Sse4(_mm_loadu_ps(source + index + 4));
+					_mm_storeu_si128(reinterpret_cast<__m128i *>(destination + index), _mm_packs_epi32(low, high));
+				}
+
+				ConvertFloatToS16Scalar(destination + index, source + index, samples - index);
+			}
+
+			__attribute__((target("sse4.1"))) void InterleaveStereoFloatSse4(float *destination, const float *left, const float *right, int samples)
+			{
+				int index = 0;
+
+				for (; index + 4 <= samples; index += 4)
+				{
+					__m128 l = _mm_loadu_ps(left + index);
+					__m128 r = _mm_loadu_ps(right + index);
+					_mm_storeu_ps(destination + index * 2, _mm_unpacklo_ps(l, r));
+					_mm_storeu_ps(destination + index * 2 + 4, _mm_unpackhi_ps(l, r));
+				}
+
+				InterleaveStereoFloatScalar(destination + index * 2, left + index, right + index, samples - index);
+			}
+
+			__attribute__((target("sse4.1"))) void InterleaveStereoS16Sse4(int16_t *destination, const int16_t *left, const int16_t *right, int samples)
+			{
+				int index = 0;
+
+				for (; index + 8 <= samples; index += 8)
+				{
+					__m128i l = _mm_loadu_si128(reinterpret_cast<const __m128i *>(left + index));
+					__m128i r = _mm_loadu_si128(reinterpret_cast<const __m128i *>(right + index));
+					_mm_storeu_si128(reinterpret_cast<__m128i *>(destination + index * 2), _mm_unpacklo_epi16(l, r));
+					_mm_storeu_si128(reinterpret_cast<__m128i *>(destination + index * 2 + 8), _mm_unpackhi_epi16(l, r));
+				}
+
+				InterleaveStereoS16Scalar(destination + index * 2, left + index, right + index, samples - index);
+			}
+
+			__attribute__((target("sse4.1"))) void InterleaveStereoToS16Sse4(int16_t *destination, const float *left, const float *right, int samples)
+			{
+				int index = 0;
+
+				for (; index + 4 <= samples; index += 4)
+				{
+					__m128i l = FloatToS32Sse4(_mm_loadu_ps(left + index));
+					__m128i r = FloatToS32Sse4(_mm_loadu_ps(right + index));
+					// L0 R0 L1 R1 L2 R2 L3 R3
+					_mm_storeu_si128(reinterpret_cast<__m128i *>(destination + index * 2), _mm_packs_epi32(_mm_unpacklo_epi32(l, r), _mm_unpackhi_epi32(l, r)));
+				}
+
+				InterleaveStereoToS16Scalar(destination + index * 2, left + index, right + index, samples - index);
+			}
+
+			__attribute__((target("sse4.1"))) void DeinterleaveStereoSse4(float *left, float *right, const float *source, int samples)
+			{
+				int index = 0;
+
+				for (; index + 4 <= samples; index += 4)
+				{
+					__m128 a = _mm_loadu_ps(source + index * 2);
+					__m128 b = _mm_loadu_ps(source + index * 2 + 4);
+					_mm_storeu_ps(left + index, _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+					_mm_storeu_ps(right + index, _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+				}
+
+				DeinterleaveStereoScalar(left + index, right + index, source + index * 2, samples - index);
+			}
+
+			__attribute__((target("sse4.1"))) void DeinterleaveStereoFromS16Sse4(float *left, float *right, const int16_t *source, int samples)
+			{
+				const __m128 scale = _mm_set1_ps(S16_TO_FLOAT);
+				int index = 0;
+
+				for (; index + 4 <= samples; index += 4)
+				{
+					// Each 32-bit word has a pair of samples: L (low 16 bits), R (high 16 bits)
+					__m128i pairs = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + index * 2));
+					__m128i l = _mm_srai_epi32(_mm_slli_epi32(pairs, 16), 16);
+					__m128i r = _mm_srai_epi32(pairs, 16);
+					_mm_storeu_ps(left + index, _mm_mul_ps(_mm_cvtepi32_ps(l), scale));
+					_mm_storeu_ps(right + index, _mm_mul_ps(_mm_cvtepi32_ps(r), scale));
+				}
+
+				DeinterleaveStereoFromS16Scalar(left + index, right + index, source + index * 2, samples - index);
+			}
+
+			__attribute__((target("sse4.1"))) void DownmixStereoSse4(float *destination, const float *left, const float *right, int samples)
+			{
+				const __m128 half = _mm_set1_ps(0.5f);
+				int index = 0;
+
+				for (; index + 4 <= samples; index += 4)
+				{
+					_mm_storeu_ps(destination + index, _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(left + index), _mm_loadu_ps(right + index)), half));
+				}
+
+				DownmixStereoScalar(destination + index, left + index, right + index, samples - index);
+			}
+
+			__attribute__((target("sse4.1"))) float DotProductSse4(const float *a, const float *b, int count)
+			{
+				__m128 sum0 = _mm_setzero_ps();
+				__m128 sum1 = _mm_setzero_ps();
+				int index = 0;
+
+				for (; index + 8 <= count; index += 8)
+				{
+					sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_loadu_ps(a + index), _mm_loadu_ps(b + index)));
+					sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_loadu_ps(a + index + 4), _mm_loadu_ps(b + index + 4)));
+				}
+
+				__m128 sum = _mm_add_ps(sum0, sum1);
+				sum = _mm_hadd_ps(sum, sum);
+				sum = _mm_hadd_ps(sum, sum);
+
+				return _mm_cvtss_f32(sum) + DotProductScalar(a + index, b + index, count - index);
+			}
+
+			const Kernels SSE4_KERNELS = {
+				PcmSimdLevel::Sse4,
+				ConvertS16ToFloatSse4,
+				ConvertFloatToS16Sse4,
+				InterleaveStereoFloatSse4,
+				InterleaveStereoS16Sse4,
+				InterleaveStereoToS16Sse4,
+				DeinterleaveStereoSse4,
+				DeinterleaveStereoFromS16Sse4,
+				DownmixStereoSse4,
+				DotProductSse4};
+
+			//--------------------------------------------------------------------
+			// AVX2
+			//--------------------------------------------------------------------
+			__attribute__((target("avx2"))) inline __m256i FloatToS32Avx2(__m256 samples)
+			{
+				samples = _mm256_mul_ps(samples, _mm256_set1_ps(FLOAT_TO_S16));
+				samples = _mm256_min_ps(_mm256_max_ps(samples, _mm256_set1_ps(S16_MIN)), _mm256_set1_ps(S16_MAX));
+
+				return _mm256_cvtps_epi32(samples);
+			}
+
+			__attribute__((target("avx2"))) void ConvertS16ToFloatAvx2(float *destination, const int16_t *source, int samples)
+			{
+				const __m256 scale = _mm256_set1_ps(S16_TO_FLOAT);
+				int index = 0;
+
+				for (; index + 8 <= samples; index += 8)
+				{
+					__m256i s32 = _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(source + index)));
+					_mm256_storeu_ps(destination + index, _mm256_mul_ps(_mm256_cvtepi32_ps(s32), scale));
+				}
+
+				ConvertS16ToFloatScalar(destination + index, source + index, samples - index);
+			}
+
+			__attribute__((target("avx2"))) void ConvertFloatToS16Avx2(int16_t *destination, const float *source, int samples)
+			{
+				int index = 0;
+
+				for (; index + 16 <= samples; index += 16)
+				{
+					__m256i low = FloatToS32Avx2(_mm256_loadu_ps(source + index));
+					__m256i high = FloatToS32Avx2(_mm256_loadu_ps(source + index + 8));
+					// packs works in 128-bit lanes: [L0-3 H0-3 L4-7 H4-7] -> [L0-7 H0-7]
+					__m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(low, high), _MM_SHUFFLE(3, 1, 2, 0));
+					_mm256_storeu_si256(reinterpret_cast<__m256i *>(destination + index), packed);
+				}
+
+				ConvertFloatToS16Scalar(destination + index, source + index, samples - index);
+			}
+
+			__attribute__((target("avx2"))) void InterleaveStereoFloatAvx2(float *destination, const float *left, const float *right, int samples)
+			{
+				int index = 0;
+
+				for (; index + 8 <= samples; index += 8)
+				{
+					__m256 l = _mm256_loadu_ps(left + index);
+					__m256 r = _mm256_loadu_ps(right + index);
+					// [L0 R0 L1 R1 | L4 R4 L5 R5], [L2 R2 L3 R3 | L6 R6 L7 R7]
+					__m256 low = _mm256_unpacklo_ps(l, r);
+					__m256 high = _mm256_unpackhi_ps(l, r);
+					_mm256_storeu_ps(destination + index * 2, _mm256_permute2f128_ps(low, high, 0x20));
+					_mm256_storeu_ps(destination + index * 2 + 8, _mm256_permute2f128_ps(low, high, 0x31));
+				}
+
+				InterleaveStereoFloatScalar(destination + index * 2, left + index, right + index, samples - index);
+			}
+
+			__attribute__((target("avx2"))) void InterleaveStereoS16Avx2(int16_t *destination, const int16_t *left, const int16_t *right, int samples)
+			{
+				int index = 0;
+
+				for (; index + 16 <= samples; index += 16)
+				{
+					__m256i l = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(left + index));
+					__m256i r = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(right + index));
+					__m256i low = _mm256_unpacklo_epi16(l, r);
+					__m256i high = _mm256_unpackhi_epi16(l, r);
+					_mm256_storeu_si256(reinterpret_cast<__m256i *>(destination + index * 2), _mm256_permute2x128_si256(low, high, 0x20));
+					_mm256_storeu_si256(reinterpret_cast<__m256i *>(destination + index * 2 + 16), _mm256_permute2x128_si256(low, high, 0x31));
+				}
+
+				InterleaveStereoS16Scalar(destination + index * 2, left + index, right + index, samples - index);
+			}
+
+			__attribute__((target("avx2"))) void InterleaveStereoToS16Avx2(int16_t *destination, const float *left, const float *right, int samples)
+			{
+				int index = 0;
+
+				for (; index + 8 <= samples; index += 8)
+				{
+					__m256i l = FloatToS32Avx2(_mm256_loadu_ps(left + index));
+					__m256i r = FloatToS32Avx2(_mm256_loadu_ps(right + index));
+					// [L0 R0 L1 R1 | L4 R4 L5 R5], [L2 R2 L3 R3 | L6 R6 L7 R7] are packed in the order of the samples
+					__m256i packed = _mm256_packs_epi32(_mm256_unpacklo_epi32(l, r), _mm256_unpackhi_epi32(l, r));
+					_mm256_storeu_si256(reinterpret_cast<__m256i *>(destination + index * 2), packed);
+				}
+
+				InterleaveStereoToS16Scalar(destination + index * 2, left + index, right + index, samples - index);
+			}
+
+			__attribute__((target("avx2"))) void DeinterleaveStereoAvx2(float *left, float *right, const float *source, int samples)
+			{
+				int index = 0;
+
+				for (; index + 8 <= samples; index += 8)
+				{
+					__m256 a = _mm256_loadu_ps(source + index * 2);
+					__m256 b = _mm256_loadu_ps(source + index * 2 + 8);
+					// [L0 L1 L4 L5 | L2 L3 L6 L7] -> [L0 L1 L2 L3 | L4 L5 L6 L7]
+					__m256 l = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+					__m256 r = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+					_mm256_storeu_ps(left + index, _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(l), _MM_SHUFFLE(3, 1, 2, 0))));
+					_mm256_storeu_ps(right + index, _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(r), _MM_SHUFFLE(3, 1, 2, 0))));
+				}
+
+				DeinterleaveStereoScalar(left + index, right + index, source + index * 2, samples - index);
+			}
+
+			__attribute__((target("avx2"))) void DeinterleaveStereoFromS16Avx2(float *left, float *right, const int16_t *source, int samples)
+			{
+				const __m256 scale = _mm256_set1_ps(S16_TO_FLOAT);
+				int index = 0;
+
+				for (; index + 8 <= samples; index += 8)
+				{
+					// Each 32-bit word has a pair of samples: L (low 16 bits), R (high 16 bits)
+					__m256i pairs = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source + index * 2));
+					__m256i l = _mm256_srai_epi32(_mm256_slli_epi32(pairs, 16), 16);
+					__m256i r = _mm256_srai_epi32(pairs, 16);
+					_mm256_storeu_ps(left + index, _mm256_mul_ps(_mm256_cvtepi32_ps(l), scale));
+					_mm256_storeu_ps(right + index, _mm256_mul_ps(_mm256_cvtepi32_ps(r), scale));
+				}
+
+				DeinterleaveStereoFromS16Scalar(left + index, right + index, source + index * 2, samples - index);
+			}
+
+			__attribute__((target("avx2"))) void DownmixStereoAvx2(float *destination, const float *left, const float *right, int samples)
+			{
+				const __m256 half = _mm256_set1_ps(0.5f);
+				int index = 0;
+
+				for (; index + 8 <= samples; index += 8)
+				{
+					_mm256_storeu_ps(destination + index, _mm256_mul_ps(_mm256_add_ps(_mm256_loadu_ps(left + index), _mm256_loadu_ps(right + index)), half));
+				}
+
+				DownmixStereoScalar(destination + index, left + index, right + index, samples - index);
+			}
+
+			__attribute__((target("avx2"))) float DotProductAvx2(const float *a, const float *b, int count)
+			{
+				__m256 sum0 = _mm256_setzero_ps();
+				__m256 sum1 = _mm256_setzero_ps();
+				int index = 0;
+
+				for (; index + 16 <= count; index += 16)
+				{
+					sum0 = _mm256_add_ps(sum0, _mm256_mul_ps(_mm256_loadu_ps(a + index), _mm256_loadu_ps(b + index)));
+					sum1 = _mm256_add_ps(sum1, _mm256_mul_ps(_mm256_loadu_ps(a + index + 8), _mm256_loadu_ps(b + index + 8)));
+				}
+
+				__m256 sum256 = _mm256_add_ps(sum0, sum1);
+				__m128 sum = _mm_add_ps(_mm256_castps256_ps128(sum256), _mm256_extractf128_ps(sum256, 1));
+				sum = _mm_hadd_ps(sum, sum);
+				sum = _mm_hadd_ps(sum, sum);
+
+				return _mm_cvtss_f32(sum) + DotProductScalar(a + index, b + index, count - index);
+			}
+
+			const Kernels AVX2_KERNELS = {
+				PcmSimdLevel::Avx2,
+				ConvertS16ToFloatAvx2,
+				ConvertFloatToS16Avx2,
+				InterleaveStereoFloatAvx2,
+				InterleaveStereoS16Avx2,
+				InterleaveStereoToS16Avx2,
+				DeinterleaveStereoAvx2,
+				DeinterleaveStereoFromS16Avx2,
+				DownmixStereoAvx2,
+				DotProductAvx2};
+#endif	// defined(OV_PCM_X86)
+
+			const Kernels *GetKernelsOf(PcmSimdLevel level)
+			{
+				switch (level)
+				{
+#if defined(OV_PCM_X86)
+					case PcmSimdLevel::Avx2:
+						return &AVX2_KERNELS;
+					case PcmSimdLevel::Sse4:
+						return &SSE4_KERNELS;
+#endif	// defined(OV_PCM_X86)
+					default:
+						return &SCALAR_KERNELS;
+				}
+			}
+
+			std::atomic<const Kernels *> &GetKernelsHolder()
+			{
+				static std::atomic<const Kernels *> kernels(GetKernelsOf(GetSupportedSimdLevel()));
+
+				return kernels;
+			}
+
+			inline const Kernels *GetKernels()
+			{
+				return GetKernelsHolder().load(std::memory_order_relaxed);
+			}
+		}  // namespace
+
+		PcmSimdLevel GetSimdLevel()
+		{
+			return GetKernels()->level;
+		}
+
+		PcmSimdLevel GetSupportedSimdLevel()
+		{
+#if defined(OV_PCM_X86)
+			__builtin_cpu_init();
+
+			if (__builtin_cpu_supports("avx2"))
+			{
+				return PcmSimdLevel::Avx2;
+			}
+
+			if (__builtin_cpu_supports("sse4.1"))
+			{
+				return PcmSimdLevel::Sse4;
+			}
+#endif	// defined(OV_PCM_X86)
+
+			return PcmSimdLevel::Scalar;
+		}
+
+		bool SetSimdLevel(PcmSimdLevel level)
+		{
+			if (level > GetSupportedSimdLevel())
+			{
+				return false;
+			}
+
+			GetKernelsHolder().store(GetKernelsOf(level), std::memory_order_relaxed);
+
+			return true;
+		}
+
+		const char *StringFromSimdLevel(PcmSimdLevel level)
+		{
+			switch (level)
+			{
+				case PcmSimdLevel::Scalar:
+					return "Scalar";
+				case PcmSimdLevel::Sse4:
+					return "SSE4.1";
+				case PcmSimdLevel::Avx2:
+					return "AVX2";
+			}
+
+			return "Unknown";
+		}
+
+		void ConvertS16ToFloat(float *destination, const int16_t *source, int samples)
+		{
+			GetKernels()->convert_s16_to_float(destination, source, samples);
+		}
+
+		void ConvertFloatToS16(int16_t *destination, const float *source, int samples)
+		{
+			GetKernels()->convert_float_to_s16(destination, source, samples);
+		}
+
+		void InterleaveStereo(float *destination, const float *left, const float *right, int samples)
+		{
+			GetKernels()->interleave_stereo_float(destination, left, right, samples);
+		}
+
+		void InterleaveStereo(int16_t *destination, const int16_t *left, const int16_t *right, int samples)
+		{
+			GetKernels()->interleave_stereo_s16(destination, left, right, samples);
+		}
+
+		void InterleaveStereoToS16(int16_t *destination, const float *left, const float *right, int samples)
+		{
+			GetKernels()->interleave_stereo_to_s16(destination, left, right, samples);
+		}
+
+		void DeinterleaveStereo(float *left, float *right, const float *source, int samples)
+		{
+			GetKernels()->deinterleave_stereo(left, right, source, samples);
+		}
+
+		void DeinterleaveStereoFromS16(float *left, float *right, const int16_t *source, int samples)
+		{
+			GetKernels()->deinterleave_stereo_from_s16(left, right, source, samples);
+		}
+
+		void DownmixStereo(float *destination, const float *left, const float *right, int samples)
+		{
+			GetKernels()->downmix_stereo(destination, left, right, samples);
+		}
+
+		float DotProduct(const float *a, const float *b, int count)
+		{
+			return GetKernels()->dot_product(a, b, count);
+		}
+	}  // namespace pcm
+}  // namespace ov
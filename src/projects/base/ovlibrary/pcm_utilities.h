@@ -8,8 +8,49 @@
 //==============================================================================
 #pragma once
 
+#include <stdint.h>
+
 namespace ov
 {
+	enum class PcmSimdLevel : uint8_t
+	{
+		Scalar,
+		Sse4,
+		Avx2
+	};
+
+	// Kernels of the common PCM conversions (used by the audio filters/codecs of the transcoder)
+	//
+	// The implementation is selected at runtime by the features of the CPU (AVX2 > SSE4.1 > Scalar),
+	// and can be changed using SetSimdLevel() (ex: by the benchmark).
+	namespace pcm
+	{
+		// Level of the kernels in use
+		PcmSimdLevel GetSimdLevel();
+		// The highest level supported by the CPU
+		PcmSimdLevel GetSupportedSimdLevel();
+		// Returns false if the CPU does not support the level
+		bool SetSimdLevel(PcmSimdLevel level);
+		const char *StringFromSimdLevel(PcmSimdLevel level);
+
+		// S16 <-> float ([-1.0, 1.0)). The float samples are clipped when they are converted to S16
+		void ConvertS16ToFloat(float *destination, const int16_t *source, int samples);
+		void ConvertFloatToS16(int16_t *destination, const float *source, int samples);
+
+		// Planar stereo <-> interleaved stereo
+		void InterleaveStereo(float *destination, const float *left, const float *right, int samples);
+		void InterleaveStereo(int16_t *destination, const int16_t *left, const int16_t *right, int samples);
+		void InterleaveStereoToS16(int16_t *destination, const float *left, const float *right, int samples);
+		void DeinterleaveStereo(float *left, float *right, const float *source, int samples);
+		void DeinterleaveStereoFromS16(float *left, float *right, const int16_t *source, int samples);
+
+		// destination = (left + right) / 2
+		void DownmixStereo(float *destination, const float *left, const float *right, int samples);
+
+		// Used by the FIR filters
+		float DotProduct(const float *a, const float *b, int count);
+	}  // namespace pcm
+
 // Interleave data of source and store it in destination
 	// For example, the source will be interleaved while channels = 2, samples = 5
 	// Source:
@@ -67,4 +108,18 @@ namespace ov
 
 		return true;
 	}
-}
\ No newline at end of file
+
+	template <>
+	inline bool Interleave<float>(void *destination, const void *left, const void *right, int samples)
+	{
+		pcm::InterleaveStereo(static_cast<float *>(destination), static_cast<const float *>(left), static_cast<const float *>(right), samples);
+		return true;
+	}
+
+	template <>
+	inline bool Interleave<int16_t>(void *destination, const void *left, const void *right, int samples)
+	{
+		pcm::InterleaveStereo(static_cast<int16_t *>(destination), static_cast<const int16_t *>(left), static_cast<const int16_t *>(right), samples);
+		return true;
+	}
+}  // namespace ov
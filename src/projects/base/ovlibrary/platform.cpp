@@ -9,10 +9,14 @@
 #include "platform.h"
 
 #include <pthread.h>
+#include <sched.h>
 #include <sys/syscall.h>
 #include <unistd.h>
 #include <zconf.h>
 
+#include <algorithm>
+#include <thread>
+
 namespace ov
 {
 	const char *Platform::GetName()
@@ -48,4 +52,92 @@ namespace ov
 
 		return name;
 	}
+
+	std::vector<int> Platform::GetAvailableCpuList()
+	{
+		std::vector<int> cpu_list;
+
+#if IS_LINUX
+		cpu_set_t cpu_set;
+		CPU_ZERO(&cpu_set);
+
+		if (::sched_getaffinity(0, sizeof(cpu_set), &cpu_set) == 0)
+		{
+			for (int cpu_index = 0; cpu_index < CPU_SETSIZE; cpu_index++)
+			{
+				if (CPU_ISSET(cpu_index, &cpu_set))
+				{
+					cpu_list.push_back(cpu_index);
+				}
+			}
+		}
+#endif	// IS_LINUX
+
+		if (cpu_list.empty())
+		{
+			auto count = std::max(static_cast<int>(std::thread::hardware_concurrency()), 1);
+
+			for (int cpu_index = 0; cpu_index < count; cpu_index++)
+			{
+				cpu_list.push_back(cpu_index);
+			}
+		}
+
+		return cpu_list;
+	}
+
+	bool Platform::SetThreadAffinity(pthread_t thread, int cpu_index)
+	{
+		return SetThreadAffinity(thread, std::vector<int>{cpu_index});
+	}
+
+	bool Platform::SetThreadAffinity(pthread_t thread, const std::vector<int> &cpu_list)
+	{
+#if IS_LINUX
+		cpu_set_t cpu_set;
+		CPU_ZERO(&cpu_set);
+
+		for (auto cpu_index : cpu_list)
+		{
+			if ((cpu_index < 0) || (cpu_index >= CPU_SETSIZE))
+			{
+				return false;
+			}
+
+			CPU_SET(cpu_index, &cpu_set);
+		}
+
+		if (CPU_COUNT(&cpu_set) == 0)
+		{
+			return false;
+		}
+
+		return (::pthread_setaffinity_np(thread, sizeof(cpu_set), &cpu_set) == 0);
+#else	// IS_LINUX
+		return false;
+#endif	// IS_LINUX
+	}
+
+	std::vector<int> Platform::GetThreadAffinity(pthread_t thread)
+	{
+		std::vector<int> cpu_list;
+
+#if IS_LINUX
+		cpu_set_t cpu_set;
+		CPU_ZERO(&cpu_set);
+
+		if (::pthread_getaffinity_np(thread, sizeof(cpu_set), &cpu_set) == 0)
+		{
+			for (int cpu_index = 0; cpu_index < CPU_SETSIZE; cpu_index++)
+			{
+				if (CPU_ISSET(cpu_index, &cpu_set))
+				{
+					cpu_list.push_back(cpu_index);
+				}
+			}
+		}
+#endif	// IS_LINUX
+
+		return cpu_list;
+	}
 }  // namespace ov
@@ -8,9 +8,12 @@
 //==============================================================================
 #pragma once
 
-#include <string>
+#include <pthread.h>
 #include <stdint.h>
 
+#include <string>
+#include <vector>
+
 #define IS_WINDOWS                              0
 #define IS_UNIX                                 0
 #define IS_LINUX                                0
@@ -118,5 +121,13 @@ namespace ov
 		static uint64_t GetProcessId();
 		static uint64_t GetThreadId();
 		static const char *GetThreadName();
+
+		// Returns the CPU indices that this process is allowed to run on (respects taskset/cgroup cpusets)
+		static std::vector<int> GetAvailableCpuList();
+		// Pins the thread to the CPU (Not supported on macOS)
+		static bool SetThreadAffinity(pthread_t thread, int cpu_index);
+		// Allows the thread to run on the CPUs (Not supported on macOS)
+		static bool SetThreadAffinity(pthread_t thread, const std::vector<int> &cpu_list);
+		static std::vector<int> GetThreadAffinity(pthread_t thread);
 	};
 }
\ No newline at end of file
@@ -0,0 +1,79 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by agent
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "./rcu.h"
+
+#include <thread>
+
+#include "./assert.h"
+
+namespace ov
+{
+	std::atomic<uint64_t> Rcu::_epoch{1};
+	std::atomic<Rcu::Slot *> Rcu::_slots{nullptr};
+	thread_local Rcu::ThreadState Rcu::_thread_state;
+
+	Rcu::ThreadState::~ThreadState()
+	{
+		if (slot != nullptr)
+		{
+			slot->epoch.store(0, std::memory_order_release);
+			slot->in_use.store(false, std::memory_order_release);
+		}
+	}
+
+	Rcu::Slot *Rcu::AcquireSlot()
+	{
+		// Reuse the slot of an exited thread
+		for (auto slot = _slots.load(std::memory_order_acquire); slot != nullptr; slot = slot->next)
+		{
+			bool in_use = false;
+
+			if ((slot->in_use.load(std::memory_order_relaxed) == false) &&
+				slot->in_use.compare_exchange_strong(in_use, true, std::memory_order_acquire))
+			{
+				return slot;
+			}
+		}
+
+		auto slot = new Slot();
+		slot->in_use.store(true, std::memory_order_relaxed);
+
+		auto head = _slots.load(std::memory_order_relaxed);
+		do
+		{
+			slot->next = head;
+		} while (_slots.compare_exchange_weak(head, slot, std::memory_order_release, std::memory_order_relaxed) == false);
+
+		return slot;
+	}
+
+	void Rcu::Synchronize()
+	{
+		OV_ASSERT(_thread_state.depth == 0, "Rcu::Synchronize() is called in the read-side critical section");
+
+		// The readers that enter after this point see the new epoch (and the unlinked pointers)
+		auto target_epoch = _epoch.fetch_add(1, std::memory_order_seq_cst) + 1;
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+
+		for (auto slot = _slots.load(std::memory_order_acquire); slot != nullptr; slot = slot->next)
+		{
+			while (true)
+			{
+				auto epoch = slot->epoch.load(std::memory_order_acquire);
+
+				if ((epoch == 0) || (epoch >= target_epoch))
+				{
+					break;
+				}
+
+				std::this_thread::yield();
+			}
+		}
+	}
+}  // namespace ov
@@ -0,0 +1,100 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by agent
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace ov
+{
+	// Epoch-based read-copy-update (RCU)
+	//
+	// A reader enters the read-side critical section by publishing the current epoch in the slot of its thread,
+	// so the readers never take a lock nor write a cache line shared with the other readers.
+	// A writer unlinks an object from the data structure first, and frees it after Synchronize() returns,
+	// which waits until all the readers that might still see the object have left the critical section.
+	//
+	// The read-side critical sections must be short (they delay the writers), and can be nested.
+	class Rcu
+	{
+	public:
+		class ReadLock
+		{
+		public:
+			ReadLock()
+			{
+				Rcu::Enter();
+			}
+
+			~ReadLock()
+			{
+				Rcu::Leave();
+			}
+
+			ReadLock(const ReadLock &) = delete;
+			ReadLock &operator=(const ReadLock &) = delete;
+		};
+
+		// Waits for the end of the read-side critical sections that are running.
+		// Must not be called in the read-side critical section (it would wait for itself)
+		static void Synchronize();
+
+	private:
+		struct alignas(64) Slot
+		{
+			// The epoch when the thread entered the critical section (0 if the thread is not in the critical section)
+			std::atomic<uint64_t> epoch{0};
+			// The slot of an exited thread is reused
+			std::atomic<bool> in_use{false};
+			// The slots are never removed from the list
+			Slot *next = nullptr;
+		};
+
+		struct ThreadState
+		{
+			~ThreadState();
+
+			Slot *slot = nullptr;
+			int depth = 0;
+		};
+
+		static Slot *AcquireSlot();
+
+		static void Enter()
+		{
+			auto &state = _thread_state;
+
+			if (state.depth++ == 0)
+			{
+				if (state.slot == nullptr)
+				{
+					state.slot = AcquireSlot();
+				}
+
+				state.slot->epoch.store(_epoch.load(std::memory_order_acquire), std::memory_order_relaxed);
+				// Pairs with the fence in Synchronize(): either the writer sees this slot, or this reader sees the unlinked pointers
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+			}
+		}
+
+		static void Leave()
+		{
+			auto &state = _thread_state;
+
+			if (--state.depth == 0)
+			{
+				state.slot->epoch.store(0, std::memory_order_release);
+			}
+		}
+
+		static std::atomic<uint64_t> _epoch;
+		static std::atomic<Slot *> _slots;
+		static thread_local ThreadState _thread_state;
+	};
+}  // namespace ov
@@ -0,0 +1,257 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by agent
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include "./rcu.h"
+
+namespace ov
+{
+	// Hash map for the lookups that are much more frequent than the modifications (ex: finding a session of every packet)
+	//
+	// The lookups don't take a lock (they run in the read-side critical section of ov::Rcu), and the writers are
+	// serialized by a mutex. The removed nodes (and the old table after growing) are freed after the grace period,
+	// so Erase() and Insert() may wait for the lookups running on the other threads.
+	//
+	// The values are copied out of the map, so Tvalue is usually a std::shared_ptr.
+	template <typename Tkey, typename Tvalue, typename Thash = std::hash<Tkey>, typename Tequal = std::equal_to<Tkey>>
+	class RcuHashMap
+	{
+	public:
+		// bucket_count must be a power of two
+		explicit RcuHashMap(size_t bucket_count = 64)
+			: _table(new Table(bucket_count))
+		{
+		}
+
+		~RcuHashMap()
+		{
+			DeleteTable(_table.load(std::memory_order_relaxed));
+		}
+
+		RcuHashMap(const RcuHashMap &) = delete;
+		RcuHashMap &operator=(const RcuHashMap &) = delete;
+
+		// Returns false if the key already exists
+		bool Insert(const Tkey &key, const Tvalue &value)
+		{
+			std::lock_guard<std::mutex> lock_guard(_writer_lock);
+
+			auto hash = GetHash(key);
+			auto table = _table.load(std::memory_order_relaxed);
+
+			if (FindNode(table, key, hash) != nullptr)
+			{
+				return false;
+			}
+
+			auto &bucket = table->buckets[hash & table->mask];
+			auto node = new Node(key, value, hash);
+
+			node->next.store(bucket.load(std::memory_order_relaxed), std::memory_order_relaxed);
+			bucket.store(node, std::memory_order_release);
+
+			auto count = _count.load(std::memory_order_relaxed) + 1;
+			_count.store(count, std::memory_order_relaxed);
+
+			if (count > (table->mask + 1))
+			{
+				Grow(table);
+			}
+
+			return true;
+		}
+
+		// Returns false if the key doesn't exist
+		bool Erase(const Tkey &key)
+		{
+			std::lock_guard<std::mutex> lock_guard(_writer_lock);
+
+			auto hash = GetHash(key);
+			auto table = _table.load(std::memory_order_relaxed);
+			auto link = &(table->buckets[hash & table->mask]);
+
+			for (auto node = link->load(std::memory_order_relaxed); node != nullptr; node = link->load(std::memory_order_relaxed))
+			{
+				if ((node->hash == hash) && Tequal()(node->key, key))
+				{
+					link->store(node->next.load(std::memory_order_relaxed), std::memory_order_release);
+					_count.store(_count.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+
+					// The lookups that have found the node are done after the grace period
+					Rcu::Synchronize();
+					delete node;
+
+					return true;
+				}
+
+				link = &(node->next);
+			}
+
+			return false;
+		}
+
+		// Returns false if the key doesn't exist (value is not changed)
+		bool Find(const Tkey &key, Tvalue *value) const
+		{
+			auto hash = GetHash(key);
+			Rcu::ReadLock read_lock;
+
+			auto node = FindNode(_table.load(std::memory_order_acquire), key, hash);
+			if (node == nullptr)
+			{
+				return false;
+			}
+
+			if (value != nullptr)
+			{
+				*value = node->value;
+			}
+
+			return true;
+		}
+
+		bool Contains(const Tkey &key) const
+		{
+			return Find(key, nullptr);
+		}
+
+		// function is called with (key, value) in the read-side critical section, so it must not modify the map
+		template <typename Tfunction>
+		void ForEach(const Tfunction &function) const
+		{
+			Rcu::ReadLock read_lock;
+
+			auto table = _table.load(std::memory_order_acquire);
+
+			for (size_t index = 0; index <= table->mask; index++)
+			{
+				for (auto node = table->buckets[index].load(std::memory_order_acquire); node != nullptr; node = node->next.load(std::memory_order_acquire))
+				{
+					function(node->key, node->value);
+				}
+			}
+		}
+
+		size_t GetCount() const
+		{
+			return _count.load(std::memory_order_relaxed);
+		}
+
+	private:
+		struct Node
+		{
+			Node(const Tkey &key, const Tvalue &value, size_t hash)
+				: key(key),
+				  value(value),
+				  hash(hash)
+			{
+			}
+
+			const Tkey key;
+			const Tvalue value;
+			const size_t hash;
+			std::atomic<Node *> next{nullptr};
+		};
+
+		struct Table
+		{
+			explicit Table(size_t bucket_count)
+				: mask(bucket_count - 1),
+				  buckets(new std::atomic<Node *>[bucket_count])
+			{
+				for (size_t index = 0; index < bucket_count; index++)
+				{
+					buckets[index].store(nullptr, std::memory_order_relaxed);
+				}
+			}
+
+			const size_t mask;
+			std::unique_ptr<std::atomic<Node *>[]> buckets;
+		};
+
+		static size_t GetHash(const Tkey &key)
+		{
+			// The hashes of std (and of ov::SocketAddress) are often the identity, so the bits are mixed
+			// before the lower bits are used as the index of the bucket (finalizer of MurmurHash3)
+			uint64_t hash = Thash()(key);
+
+			hash ^= hash >> 33;
+			hash *= 0xff51afd7ed558ccdULL;
+			hash ^= hash >> 33;
+			hash *= 0xc4ceb9fe1a85ec53ULL;
+			hash ^= hash >> 33;
+
+			return static_cast<size_t>(hash);
+		}
+
+		static Node *FindNode(const Table *table, const Tkey &key, size_t hash)
+		{
+			for (auto node = table->buckets[hash & table->mask].load(std::memory_order_acquire); node != nullptr; node = node->next.load(std::memory_order_acquire))
+			{
+				if ((node->hash == hash) && Tequal()(node->key, key))
+				{
+					return node;
+				}
+			}
+
+			return nullptr;
+		}
+
+		// Called with _writer_lock
+		void Grow(Table *table)
+		{
+			// The nodes are copied, because the lookups may be walking the chains of the old table
+			auto new_table = new Table((table->mask + 1) * 2);
+
+			for (size_t index = 0; index <= table->mask; index++)
+			{
+				for (auto node = table->buckets[index].load(std::memory_order_relaxed); node != nullptr; node = node->next.load(std::memory_order_relaxed))
+				{
+					auto &bucket = new_table->buckets[node->hash & new_table->mask];
+					auto new_node = new Node(node->key, node->value, node->hash);
+
+					new_node->next.store(bucket.load(std::memory_order_relaxed), std::memory_order_relaxed);
+					bucket.store(new_node, std::memory_order_relaxed);
+				}
+			}
+
+			_table.store(new_table, std::memory_order_release);
+
+			Rcu::Synchronize();
+			DeleteTable(table);
+		}
+
+		static void DeleteTable(Table *table)
+		{
+			for (size_t index = 0; index <= table->mask; index++)
+			{
+				auto node = table->buckets[index].load(std::memory_order_relaxed);
+
+				while (node != nullptr)
+				{
+					auto next = node->next.load(std::memory_order_relaxed);
+					delete node;
+					node = next;
+				}
+			}
+
+			delete table;
+		}
+
+		std::atomic<Table *> _table;
+		std::atomic<size_t> _count{0};
+
+		std::mutex _writer_lock;
+	};
+}  // namespace ov
@@ -0,0 +1,261 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by agent
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "./thread_topology.h"
+
+#include <sched.h>
+
+#include <fstream>
+#include <mutex>
+
+#include "./converter.h"
+#include "./log.h"
+#include "./ovlibrary_private.h"
+#include "./platform.h"
+
+namespace ov
+{
+	ThreadTopology::ScopedAffinity::ScopedAffinity(const char *pool_name)
+	{
+		ThreadPoolTopology topology;
+
+		if (ThreadTopology::GetInstance()->GetPool(pool_name, &topology) && (topology.cpu_list.empty() == false))
+		{
+			auto thread = ::pthread_self();
+
+			_previous_cpu_list = Platform::GetThreadAffinity(thread);
+			_changed = Platform::SetThreadAffinity(thread, topology.cpu_list);
+		}
+	}
+
+	ThreadTopology::ScopedAffinity::~ScopedAffinity()
+	{
+		if (_changed && (_previous_cpu_list.empty() == false))
+		{
+			Platform::SetThreadAffinity(::pthread_self(), _previous_cpu_list);
+		}
+	}
+
+	void ThreadTopology::SetPool(const String &pool_name, const ThreadPoolTopology &topology)
+	{
+		std::lock_guard lock_guard(_pool_map_mutex);
+
+		_pool_map[pool_name] = topology;
+	}
+
+	bool ThreadTopology::GetPool(const char *pool_name, ThreadPoolTopology *topology) const
+	{
+		std::shared_lock lock_guard(_pool_map_mutex);
+
+		auto item = _pool_map.find(pool_name);
+
+		if (item == _pool_map.end())
+		{
+			return false;
+		}
+
+		if (topology != nullptr)
+		{
+			*topology = item->second;
+		}
+
+		return true;
+	}
+
+	int ThreadTopology::GetThreadCount(const char *pool_name, int default_count) const
+	{
+		ThreadPoolTopology topology;
+
+		if (GetPool(pool_name, &topology) && (topology.thread_count > 0))
+		{
+			return topology.thread_count;
+		}
+
+		return default_count;
+	}
+
+	int ThreadTopology::GetCpuCount(const char *pool_name) const
+	{
+		return static_cast<int>(GetCpuList(pool_name).size());
+	}
+
+	std::vector<int> ThreadTopology::GetCpuList(const char *pool_name) const
+	{
+		ThreadPoolTopology topology;
+
+		if (GetPool(pool_name, &topology) && (topology.cpu_list.empty() == false))
+		{
+			return topology.cpu_list;
+		}
+
+		return Platform::GetAvailableCpuList();
+	}
+
+	bool ThreadTopology::Apply(const char *pool_name, pthread_t thread, int index) const
+	{
+		ThreadPoolTopology topology;
+
+		if (GetPool(pool_name, &topology) == false)
+		{
+			// Not configured
+			return true;
+		}
+
+		bool result = true;
+
+		if (topology.thread_name.IsEmpty() == false)
+		{
+			auto name = topology.thread_name;
+
+			if (index > 0)
+			{
+				name.AppendFormat("%d", index);
+			}
+
+			// Thread name can be up to 15 characters
+			name.SetLength(std::min<size_t>(name.GetLength(), 15));
+
+			::pthread_setname_np(thread, name.CStr());
+		}
+
+		if (topology.cpu_list.empty() == false)
+		{
+			auto succeeded = topology.pin_each_thread
+								 ? Platform::SetThreadAffinity(thread, topology.cpu_list[std::max(index, 0) % topology.cpu_list.size()])
+								 : Platform::SetThreadAffinity(thread, topology.cpu_list);
+
+			if (succeeded == false)
+			{
+				logtw("Could not set CPU affinity of %s thread #%d", pool_name, index);
+				result = false;
+			}
+		}
+
+#if IS_LINUX
+		if (topology.priority != ThreadPriority::Normal)
+		{
+			int policy = SCHED_OTHER;
+			sched_param param{};
+
+			switch (topology.priority)
+			{
+				case ThreadPriority::Normal:
+					break;
+
+				case ThreadPriority::Batch:
+					policy = SCHED_BATCH;
+					break;
+
+				case ThreadPriority::Idle:
+					policy = SCHED_IDLE;
+					break;
+
+				case ThreadPriority::Realtime:
+					policy = SCHED_RR;
+					param.sched_priority = ::sched_get_priority_min(SCHED_RR);
+					break;
+			}
+
+			auto error = ::pthread_setschedparam(thread, policy, &param);
+
+			if (error != 0)
+			{
+				logtw("Could not set priority of %s thread #%d to %s: %s", pool_name, index, StringFromPriority(topology.priority), ::strerror(error));
+				result = false;
+			}
+		}
+#endif	// IS_LINUX
+
+		return result;
+	}
+
+	bool ThreadTopology::ParseCpuList(const String &cpu_list_string, std::vector<int> *cpu_list)
+	{
+		std::vector<int> list;
+
+		for (const auto &token : cpu_list_string.Split(","))
+		{
+			auto item = token.Trim();
+
+			if (item.IsEmpty())
+			{
+				continue;
+			}
+
+			auto range = item.Split("-");
+
+			if ((range.size() == 1) && range[0].Trim().IsNumeric())
+			{
+				list.push_back(Converter::ToInt32(range[0].Trim()));
+			}
+			else if ((range.size() == 2) && range[0].Trim().IsNumeric() && range[1].Trim().IsNumeric())
+			{
+				auto from = Converter::ToInt32(range[0].Trim());
+				auto to = Converter::ToInt32(range[1].Trim());
+
+				if (from > to)
+				{
+					return false;
+				}
+
+				for (auto cpu_index = from; cpu_index <= to; cpu_index++)
+				{
+					list.push_back(cpu_index);
+				}
+			}
+			else
+			{
+				return false;
+			}
+		}
+
+		if (cpu_list != nullptr)
+		{
+			*cpu_list = std::move(list);
+		}
+
+		return true;
+	}
+
+	std::vector<int> ThreadTopology::GetNumaNodeCpuList(int numa_node)
+	{
+		std::vector<int> cpu_list;
+
+		std::ifstream file(String::FormatString("/sys/devices/system/node/node%d/cpulist", numa_node).CStr());
+
+		if (file.is_open())
+		{
+			std::string line;
+			std::getline(file, line);
+
+			ParseCpuList(line.c_str(), &cpu_list);
+		}
+
+		return cpu_list;
+	}
+
+	const char *ThreadTopology::StringFromPriority(ThreadPriority priority)
+	{
+		switch (priority)
+		{
+			case ThreadPriority::Normal:
+				return "Normal";
+
+			case ThreadPriority::Batch:
+				return "Batch";
+
+			case ThreadPriority::Idle:
+				return "Idle";
+
+			case ThreadPriority::Realtime:
+				return "Realtime";
+		}
+
+		return "Unknown";
+	}
+}  // namespace ov
@@ -0,0 +1,112 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by agent
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <pthread.h>
+
+#include <map>
+#include <shared_mutex>
+#include <vector>
+
+#include "./singleton.h"
+#include "./string.h"
+
+// Names of the thread pools that can be configured in <Threads>
+#define OV_THREAD_POOL_SOCKET_POOL "SocketPool"
+#define OV_THREAD_POOL_MEDIA_ROUTER "MediaRouter"
+#define OV_THREAD_POOL_APP_WORKER "AppWorker"
+#define OV_THREAD_POOL_STREAM_WORKER "StreamWorker"
+#define OV_THREAD_POOL_SEGMENT_WORKER "SegmentWorker"
+#define OV_THREAD_POOL_STREAM_MOTOR "StreamMotor"
+#define OV_THREAD_POOL_DECODER "Decoder"
+#define OV_THREAD_POOL_ENCODER "Encoder"
+// Shared by the decoders/filters/encoders of all streams (the codecs run on their own threads if it is not configured)
+#define OV_THREAD_POOL_TRANSCODER "Transcoder"
+
+namespace ov
+{
+	enum class ThreadPriority
+	{
+		// Keep the default scheduling policy
+		Normal,
+		// SCHED_BATCH: CPU-bound work that can tolerate latency (ex: encoders)
+		Batch,
+		// SCHED_IDLE: runs only when the CPU is otherwise idle
+		Idle,
+		// SCHED_RR: requires CAP_SYS_NICE
+		Realtime
+	};
+
+	struct ThreadPoolTopology
+	{
+		// Name of the threads (empty == keep the name given by the subsystem)
+		String thread_name;
+
+		// CPUs that the threads can run on (empty == all CPUs)
+		std::vector<int> cpu_list;
+		// If true, each thread is pinned to a single CPU of cpu_list (by the index of the thread)
+		bool pin_each_thread = false;
+
+		ThreadPriority priority = ThreadPriority::Normal;
+
+		// Number of threads used when the subsystem doesn't specify it (0 == use the default of the subsystem)
+		int thread_count = 0;
+	};
+
+	// Central place to decide the CPU set, name, priority and count of the threads of each pool
+	//
+	// The topology is configured once at startup (from <Server><Threads>), and each subsystem
+	// applies it to the threads it creates. Pinning the threads that hand packets over to each other
+	// (ex: SocketPool/StreamWorker) to the same NUMA node avoids cross-node cache line transfers.
+	class ThreadTopology : public Singleton<ThreadTopology>
+	{
+	public:
+		// Changes the CPU affinity of the current thread until the instance is destroyed.
+		// Useful for libraries that create threads internally (ex: FFmpeg), since the threads inherit the affinity.
+		class ScopedAffinity
+		{
+		public:
+			ScopedAffinity(const char *pool_name);
+			~ScopedAffinity();
+
+		protected:
+			bool _changed = false;
+			std::vector<int> _previous_cpu_list;
+		};
+
+	public:
+		void SetPool(const String &pool_name, const ThreadPoolTopology &topology);
+		bool GetPool(const char *pool_name, ThreadPoolTopology *topology) const;
+
+		// Returns the thread count of the pool if configured, otherwise default_count
+		int GetThreadCount(const char *pool_name, int default_count) const;
+
+		// Returns the number of CPUs that the pool can use
+		int GetCpuCount(const char *pool_name) const;
+
+		// Returns the CPU list of the pool (or all available CPUs if not configured)
+		std::vector<int> GetCpuList(const char *pool_name) const;
+
+		// Applies the topology of the pool to the thread
+		//
+		// index: the index of the thread in the pool (used when pin_each_thread is true)
+		bool Apply(const char *pool_name, pthread_t thread, int index = 0) const;
+
+		// "0-3,8,10-11" => [0, 1, 2, 3, 8, 10, 11]
+		static bool ParseCpuList(const String &cpu_list_string, std::vector<int> *cpu_list);
+		// Reads /sys/devices/system/node/node<N>/cpulist
+		static std::vector<int> GetNumaNodeCpuList(int numa_node);
+
+		static const char *StringFromPriority(ThreadPriority priority);
+
+	protected:
+		mutable std::shared_mutex _pool_map_mutex;
+		std::map<String, ThreadPoolTopology> _pool_map;
+	};
+}  // namespace ov
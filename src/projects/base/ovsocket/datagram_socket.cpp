@@ -34,13 +34,44 @@ namespace ov
 	{
 		CHECK_STATE(== SocketState::Created, false);
 
+		if (PrepareInternal(address))
+		{
+			_datagram_callback = std::move(datagram_callback);
+
+			return true;
+		}
+
+		return false;
+	}
+
+	bool DatagramSocket::Prepare(int port, DatagramBatchCallback datagram_batch_callback)
+	{
+		return Prepare(SocketAddress::CreateAndGetFirst(nullptr, port), std::move(datagram_batch_callback));
+	}
+
+	bool DatagramSocket::Prepare(const SocketAddress &address, DatagramBatchCallback datagram_batch_callback)
+	{
+		CHECK_STATE(== SocketState::Created, false);
+
+		if (PrepareInternal(address))
+		{
+			_datagram_batch_callback = std::move(datagram_batch_callback);
+
+			return true;
+		}
+
+		return false;
+	}
+
+	bool DatagramSocket::PrepareInternal(const SocketAddress &address)
+	{
 		if (
 			(
 				MakeNonBlocking(GetSharedPtrAs<ov::SocketAsyncInterface>()) &&
 				SetSockOpt<int>(SO_REUSEADDR, 1) &&
 				Bind(address)))
 		{
-			_datagram_callback = std::move(datagram_callback);
+			_received_datagrams.reserve(OV_SOCKET_RECV_BATCH_SIZE);
 
 			return true;
 		}
@@ -63,38 +94,61 @@ namespace ov
 		return false;
 	}
 
+	void DatagramSocket::PrepareRecvSlab()
+	{
+		for (auto &datagram : _recv_slab)
+		{
+			// use_count() == 1 means that the observers released the buffer after the previous callback
+			if ((datagram.data == nullptr) || (datagram.data.use_count() > 1))
+			{
+				datagram.data = std::make_shared<ov::Data>(UdpBufferSize);
+			}
+		}
+	}
+
 	void DatagramSocket::OnReadable()
 	{
 		logtp("Trying to read UDP packets...");
 
-		auto data = std::make_shared<ov::Data>(UdpBufferSize);
-
-		SocketAddressPair address_pair;
+		auto self = GetSharedPtrAs<DatagramSocket>();
 
 		while (true)
 		{
+			PrepareRecvSlab();
 
-			auto error = RecvFrom(data, &address_pair);
+			size_t received_count = 0;
+			auto error = RecvFromBatch(_recv_slab, OV_SOCKET_RECV_BATCH_SIZE, &received_count);
 
-			if (error == nullptr)
+			if (error != nullptr)
 			{
-				if (data->GetLength() == 0L)
-				{
-					// Try later
-					break;
-				}
-				else
+				// An error occurred
+				break;
+			}
+
+			if (received_count == 0)
+			{
+				// Try later
+				break;
+			}
+
+			if (_datagram_batch_callback != nullptr)
+			{
+				for (size_t index = 0; index < received_count; index++)
 				{
-					if (_datagram_callback != nullptr)
-					{
-						_datagram_callback(GetSharedPtrAs<DatagramSocket>(), address_pair, data->Clone());
-					}
+					_received_datagrams.push_back(_recv_slab[index]);
 				}
+
+				_datagram_batch_callback(self, _received_datagrams);
+
+				// Release the references so that the buffers can be reused
+				_received_datagrams.clear();
 			}
-			else
+			else if (_datagram_callback != nullptr)
 			{
-				// An error occurred
-				break;
+				for (size_t index = 0; index < received_count; index++)
+				{
+					_datagram_callback(self, _recv_slab[index].address_pair, _recv_slab[index].data);
+				}
 			}
 		}
 	}
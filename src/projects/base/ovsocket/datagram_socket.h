@@ -28,6 +28,10 @@ namespace ov
 		// Bind to the address specified by address
 		bool Prepare(const SocketAddress &address, DatagramCallback datagram_callback);
 
+		// Same as above, but the datagrams read by one recvmmsg() call are delivered at once
+		bool Prepare(int port, DatagramBatchCallback datagram_batch_callback);
+		bool Prepare(const SocketAddress &address, DatagramBatchCallback datagram_batch_callback);
+
 		using Socket::Close;
 		using Socket::Connect;
 		using Socket::GetState;
@@ -59,6 +63,18 @@ namespace ov
 			OV_ASSERT2(false);
 		}
 
+		bool PrepareInternal(const SocketAddress &address);
+
+		// Returns the buffers to read the next datagrams into.
+		// A buffer is reused if nobody references it anymore, otherwise a new buffer is allocated for the slot.
+		void PrepareRecvSlab();
+
 		DatagramCallback _datagram_callback = nullptr;
+		DatagramBatchCallback _datagram_batch_callback = nullptr;
+
+		// Receive buffers (only accessed by the socket pool worker thread)
+		Datagram _recv_slab[OV_SOCKET_RECV_BATCH_SIZE];
+		// Datagrams to pass to _datagram_batch_callback (to reuse the capacity)
+		std::vector<Datagram> _received_datagrams;
 	};
 }  // namespace ov
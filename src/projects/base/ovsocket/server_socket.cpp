@@ -92,7 +92,10 @@ namespace ov
 
 			logad("Trying to allocate a socket for client: %s", remote_address.ToString(false).CStr());
 
-			auto client = _pool->AllocSocket<ClientSocket>(remote_address.GetFamily(), GetSharedPtrAs<ServerSocket>(), client_socket, remote_address);
+			// In sharded mode, each worker has its own listener (SO_REUSEPORT), so the client stays in the worker of the listener
+			auto client = _pool->IsSharded()
+							  ? _pool->AllocSocketOnWorker<ClientSocket>(GetSocketPoolWorker()->GetIndex(), remote_address.GetFamily(), GetSharedPtrAs<ServerSocket>(), client_socket, remote_address)
+							  : _pool->AllocSocket<ClientSocket>(remote_address.GetFamily(), GetSharedPtrAs<ServerSocket>(), client_socket, remote_address);
 
 			if (client != nullptr)
 			{
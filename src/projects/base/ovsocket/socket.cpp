@@ -12,12 +12,19 @@
 #include <errno.h>
 #include <sys/fcntl.h>
 #include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 #include <algorithm>
 #include <atomic>
 #include <chrono>
 
+#if !IS_MACOS
+#	include <netinet/udp.h>
+#	include <sys/sendfile.h>
+#endif	// !IS_MACOS
+
 #include "epoll_wrapper.h"
 #include "socket_pool/socket_pool.h"
 #include "socket_private.h"
@@ -36,8 +43,30 @@
 #include "socket_profiler.h"
 #include "stats_counter.h"
 
+#if !IS_MACOS
+// UDP_SEGMENT is available since Linux 4.18, but old libc headers may not define it.
+// If the running kernel doesn't support it, sendmmsg() fails and GSO is disabled for the socket.
+#	ifndef UDP_SEGMENT
+#		define UDP_SEGMENT 103
+#	endif	// UDP_SEGMENT
+#endif	// !IS_MACOS
+
+// SocketSendBatch is flushed when this many datagrams (or bytes) are queued, so it stays small
+// even if it spans all the sessions of a StreamWorker
+#define SOCKET_SEND_BATCH_MAX_DATAGRAMS 64
+#define SOCKET_SEND_BATCH_MAX_BYTES (256 * 1024)
+// Maximum number of buffers kept by a thread to hold the datagrams of its batches
+#define SOCKET_SEND_BATCH_MAX_BUFFERS (SOCKET_SEND_BATCH_MAX_DATAGRAMS * 2)
+
 namespace ov
 {
+	// Turned off if sendmmsg()/recvmmsg() is not implemented in the running kernel
+	static std::atomic<bool> sendmmsg_available{true};
+	static std::atomic<bool> recvmmsg_available{true};
+
+	// Datagram sending batch of the current thread
+	static thread_local SocketSendBatch *current_send_batch = nullptr;
+
 	// Used to wait for connection
 	class ConnectHelper : public SocketAsyncInterface
 	{
@@ -256,21 +285,28 @@ namespace ov
 
 		if (dispatch_immediately)
 		{
-			switch (DispatchEvents())
-			{
-				case DispatchResult::Dispatched:
-					return true;
+			DispatchEventsAfterAppendCommand();
+		}
 
-				case DispatchResult::PartialDispatched:
-					_worker->EnqueueToDispatchLater(GetSharedPtr());
-					return true;
+		return true;
+	}
 
-				case DispatchResult::Error:
-					break;
-			}
+	bool Socket::DispatchEventsAfterAppendCommand()
+	{
+		switch (DispatchEvents())
+		{
+			case DispatchResult::Dispatched:
+				return true;
+
+			case DispatchResult::PartialDispatched:
+				_worker->EnqueueToDispatchLater(GetSharedPtr());
+				return true;
+
+			case DispatchResult::Error:
+				break;
 		}
 
-		return true;
+		return false;
 	}
 
 	bool Socket::AddToWorker(bool need_to_wait_first_epoll_event)
@@ -857,6 +893,10 @@ namespace ov
 				sent_bytes = SendFromToInternal(command.address_pair, data);
 				break;
 
+			case DispatchCommand::Type::SendFile:
+				sent_bytes = SendFileInternal(command.file, command.file_offset, command.file_length);
+				break;
+
 			case DispatchCommand::Type::HalfClose:
 				return HalfClose();
 
@@ -882,7 +922,7 @@ namespace ov
 			}
 		}
 
-		if (sent_bytes == static_cast<ssize_t>(command.data->GetLength()))
+		if (sent_bytes == static_cast<ssize_t>(command.GetLength()))
 		{
 			return DispatchResult::Dispatched;
 		}
@@ -896,9 +936,18 @@ namespace ov
 		{
 			// Since some data has been sent, the time needs to be updated.
 			command.UpdateTime();
-			data = data->Subdata(sent_bytes);
 
-			logad("Part of the data has been sent: %ld bytes, left: %ld bytes (%s)", sent_bytes, data->GetLength(), command.ToString().CStr());
+			if (command.type == DispatchCommand::Type::SendFile)
+			{
+				command.file_offset += sent_bytes;
+				command.file_length -= sent_bytes;
+			}
+			else
+			{
+				data = data->Subdata(sent_bytes);
+			}
+
+			logad("Part of the data has been sent: %ld bytes, left: %zu bytes (%s)", sent_bytes, command.GetLength(), command.ToString().CStr());
 		}
 		else
 		{
@@ -934,6 +983,37 @@ namespace ov
 
 				while (_dispatch_queue.empty() == false)
 				{
+					if ((_dispatch_queue.size() > 1) &&
+						IsGatherableCommand(_dispatch_queue.front()) &&
+						IsGatherableCommand(_dispatch_queue[1]) &&
+						(GetState() != SocketState::Closed))
+					{
+						// Two or more buffers are waiting - write them with one syscall
+						result = DispatchStreamsInternal();
+
+						if (result == DispatchResult::Dispatched)
+						{
+							continue;
+						}
+
+						break;
+					}
+
+					if ((_dispatch_queue.size() > 1) &&
+						IsBatchableCommand(_dispatch_queue.front()) &&
+						(GetState() != SocketState::Closed))
+					{
+						// Two or more datagrams are waiting - send them with as few syscalls as possible
+						result = DispatchDatagramsInternal();
+
+						if (result == DispatchResult::Dispatched)
+						{
+							continue;
+						}
+
+						break;
+					}
+
 					auto front = _dispatch_queue.front();
 					_dispatch_queue.pop_front();
 
@@ -980,6 +1060,12 @@ namespace ov
 							result = DispatchResult::Dispatched;
 							continue;
 						}
+
+						if ((GetType() == SocketType::Tcp) &&
+							((front.type == DispatchCommand::Type::Send) || (front.type == DispatchCommand::Type::SendFile)))
+						{
+							DropPendingStreamCommands();
+						}
 					}
 
 					break;
@@ -1117,6 +1203,7 @@ namespace ov
 			OV_ASSERT2(static_cast<ssize_t>(remaining_bytes) >= sent);
 
 			STATS_COUNTER_INCREASE_PPS();
+			STATS_COUNTER_INCREASE_SYSCALL();
 
 			data_to_send += sent;
 			remaining_bytes -= sent;
@@ -1125,6 +1212,12 @@ namespace ov
 			UpdateLastSentTime();
 		}
 
+		if (total_sent_bytes > 0L)
+		{
+			_sent_datagram_count++;
+			_datagram_send_syscall_count++;
+		}
+
 		logap("%zu bytes sent", total_sent_bytes);
 		return total_sent_bytes;
 	}
@@ -1241,6 +1334,290 @@ namespace ov
 		return Send((data == nullptr) ? nullptr : std::make_shared<Data>(data, length));
 	}
 
+	bool Socket::SendShared(const std::vector<std::shared_ptr<const Data>> &data_list)
+	{
+		switch (_blocking_mode)
+		{
+			case BlockingMode::Blocking:
+				for (const auto &data : data_list)
+				{
+					if ((data != nullptr) && (SendInternal(data) != static_cast<ssize_t>(data->GetLength())))
+					{
+						return false;
+					}
+				}
+
+				return true;
+
+			case BlockingMode::NonBlocking:
+				if (IsSendable())
+				{
+					// Enqueue all items before dispatching, so that they can be written at once
+					std::lock_guard lock_guard(_dispatch_queue_lock);
+
+					for (const auto &data : data_list)
+					{
+						if ((data != nullptr) && (data->IsEmpty() == false))
+						{
+							AppendCommand({data}, false);
+						}
+					}
+
+					DispatchEventsAfterAppendCommand();
+					return true;
+				}
+				break;
+		}
+
+		return false;
+	}
+
+	bool Socket::SendShared(const std::shared_ptr<const Data> &data)
+	{
+		if (data == nullptr)
+		{
+			OV_ASSERT2(data != nullptr);
+			return false;
+		}
+
+		return SendShared(std::vector<std::shared_ptr<const Data>>{data});
+	}
+
+	bool Socket::SendFile(const std::shared_ptr<const SocketFile> &file, size_t offset, size_t length)
+	{
+		if (file == nullptr)
+		{
+			OV_ASSERT2(file != nullptr);
+			return false;
+		}
+
+		if (GetType() != SocketType::Tcp)
+		{
+			logac("Could not send file - Invalid socket type: %s", StringFromSocketType(GetType()));
+			OV_ASSERT2(false);
+			return false;
+		}
+
+		if ((offset + length) > file->GetLength())
+		{
+			logae("Invalid file range: %zu bytes from %zu (file: %zu bytes)", length, offset, file->GetLength());
+			return false;
+		}
+
+		if (length == 0)
+		{
+			return true;
+		}
+
+		switch (_blocking_mode)
+		{
+			case BlockingMode::Blocking:
+				return (SendFileInternal(file, offset, length) == static_cast<ssize_t>(length));
+
+			case BlockingMode::NonBlocking:
+				if (IsSendable())
+				{
+					return AppendCommand({file, offset, length}, true);
+				}
+				break;
+		}
+
+		return false;
+	}
+
+	ssize_t Socket::SendFileInternal(const std::shared_ptr<const SocketFile> &file, size_t offset, size_t length)
+	{
+		size_t remaining_bytes = length;
+		size_t total_sent_bytes = 0L;
+
+		logap("Trying to send file %zu bytes from %zu...", length, offset);
+
+		while ((remaining_bytes > 0L) && (_force_stop == false))
+		{
+#if !IS_MACOS
+			off_t file_offset = static_cast<off_t>(offset + total_sent_bytes);
+			const auto sent = ::sendfile(GetNativeHandle(), file->GetNativeHandle(), &file_offset, remaining_bytes);
+#else	// !IS_MACOS
+			// macOS has a different sendfile() API - read the file and send it
+			uint8_t buffer[64 * 1024];
+			const auto read_bytes = ::pread(file->GetNativeHandle(), buffer, std::min(sizeof(buffer), remaining_bytes), static_cast<off_t>(offset + total_sent_bytes));
+
+			if (read_bytes <= 0)
+			{
+				logaw("Could not read file: %zd", read_bytes);
+				return -1L;
+			}
+
+			const auto sent = ::send(GetNativeHandle(), buffer, read_bytes, MSG_NOSIGNAL | MSG_DONTWAIT);
+#endif	// !IS_MACOS
+
+			if (sent < 0L)
+			{
+				return HandleSendError(sent, total_sent_bytes);
+			}
+
+			if (sent == 0L)
+			{
+				// The file is truncated
+				logaw("Could not send file - EOF reached: %zu bytes left", remaining_bytes);
+				return -1L;
+			}
+
+			STATS_COUNTER_INCREASE_PPS();
+			STATS_COUNTER_INCREASE_SYSCALL();
+
+			remaining_bytes -= sent;
+			total_sent_bytes += sent;
+
+			UpdateLastSentTime();
+		}
+
+		logap("%zu bytes of file sent", total_sent_bytes);
+		return total_sent_bytes;
+	}
+
+	bool Socket::IsGatherableCommand(const DispatchCommand &command) const
+	{
+		return (command.type == DispatchCommand::Type::Send) &&
+			   (GetType() == SocketType::Tcp) &&
+			   (command.data != nullptr) && (command.data->GetLength() > 0);
+	}
+
+	void Socket::DropPendingStreamCommands()
+	{
+		const auto count = _dispatch_queue.size();
+
+		// DispatchCommand is not assignable, so the commands to keep (ex: Close) are copied to a new queue
+		std::deque<DispatchCommand> remaining_queue;
+
+		for (const auto &command : _dispatch_queue)
+		{
+			if ((command.type != DispatchCommand::Type::Send) && (command.type != DispatchCommand::Type::SendFile))
+			{
+				remaining_queue.emplace_back(command);
+			}
+		}
+
+		_dispatch_queue.swap(remaining_queue);
+
+		logad("%zu pending commands are dropped due to the send error", count - _dispatch_queue.size());
+	}
+
+	Socket::DispatchResult Socket::DispatchStreamsInternal()
+	{
+		iovec iovs[OV_SOCKET_GATHER_MAX_COUNT]{};
+
+		const size_t command_limit = std::min<size_t>(_dispatch_queue.size(), OV_SOCKET_GATHER_MAX_COUNT);
+		size_t command_count = 0;
+		size_t total_bytes = 0;
+
+		while ((command_count < command_limit) && IsGatherableCommand(_dispatch_queue[command_count]))
+		{
+			const auto &data = _dispatch_queue[command_count].data;
+
+			// This is intentional conversion
+			iovs[command_count].iov_base = const_cast<void *>(data->GetData());
+			iovs[command_count].iov_len = data->GetLength();
+
+			total_bytes += data->GetLength();
+			command_count++;
+		}
+
+		if (command_count == 0)
+		{
+			OV_ASSERT2(command_count > 0);
+			return DispatchResult::Error;
+		}
+
+		msghdr msg{};
+		msg.msg_iov = iovs;
+		msg.msg_iovlen = command_count;
+
+		logap("Trying to send %zu buffers (%zu bytes)...", command_count, total_bytes);
+
+		// writev() can raise SIGPIPE, so sendmsg() is used instead
+		const auto sent = ::sendmsg(GetNativeHandle(), &msg, MSG_NOSIGNAL | MSG_DONTWAIT);
+
+		STATS_COUNTER_INCREASE_SYSCALL();
+
+		if (sent < 0L)
+		{
+			if (HandleSendError(sent, 0) == 0)
+			{
+				// Socket buffer is full - retry later
+				return DispatchResult::PartialDispatched;
+			}
+
+			// The following buffers of the stream would fail the same way
+			DropPendingStreamCommands();
+
+			return DispatchResult::Error;
+		}
+
+		STATS_COUNTER_INCREASE_PPS();
+		UpdateLastSentTime();
+
+		// Remove the buffers that have been sent completely
+		size_t remaining_sent_bytes = static_cast<size_t>(sent);
+
+		while (remaining_sent_bytes > 0)
+		{
+			auto &front = _dispatch_queue.front();
+			const auto length = front.data->GetLength();
+
+			if (remaining_sent_bytes < length)
+			{
+				// Since some data has been sent, the time needs to be updated.
+				front.UpdateTime();
+				front.data = front.data->Subdata(remaining_sent_bytes);
+				break;
+			}
+
+			remaining_sent_bytes -= length;
+			_dispatch_queue.pop_front();
+		}
+
+		logap("%zd/%zu bytes sent", sent, total_bytes);
+
+		return (static_cast<size_t>(sent) == total_bytes) ? DispatchResult::Dispatched : DispatchResult::PartialDispatched;
+	}
+
+	std::shared_ptr<SocketFile> SocketFile::Open(const char *file_path)
+	{
+		auto file_descriptor = ::open(file_path, O_RDONLY | O_CLOEXEC);
+
+		if (file_descriptor < 0)
+		{
+			logtw("Could not open file: %s (%s)", file_path, ::strerror(errno));
+			return nullptr;
+		}
+
+		struct stat file_stat;
+
+		if ((::fstat(file_descriptor, &file_stat) != 0) || (S_ISREG(file_stat.st_mode) == false))
+		{
+			logtw("Could not get the size of the file: %s", file_path);
+			::close(file_descriptor);
+			return nullptr;
+		}
+
+		return std::make_shared<SocketFile>(file_descriptor, static_cast<size_t>(file_stat.st_size));
+	}
+
+	SocketFile::SocketFile(int file_descriptor, size_t length)
+		: _file_descriptor(file_descriptor),
+		  _length(length)
+	{
+	}
+
+	SocketFile::~SocketFile()
+	{
+		if (_file_descriptor >= 0)
+		{
+			::close(_file_descriptor);
+		}
+	}
+
 	ssize_t Socket::SendToInternal(const SocketAddress &address, const std::shared_ptr<const Data> &data)
 	{
 		if (GetType() != SocketType::Udp)
@@ -1297,11 +1674,23 @@ namespace ov
 			case BlockingMode::NonBlocking:
 				if (IsSendable())
 				{
-					return AppendCommand(
-						(GetType() == SocketType::Udp)
-							? DispatchCommand(address, data->Clone())
-							: DispatchCommand(data->Clone()),
-						true);
+					if (GetType() == SocketType::Udp)
+					{
+						auto batch = SocketSendBatch::GetCurrent();
+
+						if (batch != nullptr)
+						{
+							// Sent when the batch is flushed
+							batch->AddSocket(GetSharedPtr());
+							auto result = AppendCommand(DispatchCommand(address, batch->Hold(data)), false);
+							batch->OnDatagramQueued(data->GetLength());
+							return result;
+						}
+
+						return AppendCommand(DispatchCommand(address, data->Clone()), true);
+					}
+
+					return AppendCommand(DispatchCommand(data->Clone()), true);
 				}
 				break;
 		}
@@ -1376,6 +1765,7 @@ namespace ov
 			OV_ASSERT2(static_cast<ssize_t>(remaining_bytes) >= sent);
 
 			STATS_COUNTER_INCREASE_PPS();
+			STATS_COUNTER_INCREASE_SYSCALL();
 
 			data_to_send += sent;
 			remaining_bytes -= sent;
@@ -1439,6 +1829,9 @@ namespace ov
 		if (total_sent_bytes > 0L)
 		{
 			UpdateLastSentTime();
+
+			_sent_datagram_count++;
+			_datagram_send_syscall_count++;
 		}
 
 		if (sent == false)
@@ -1470,11 +1863,23 @@ namespace ov
 			case BlockingMode::NonBlocking:
 				if (IsSendable())
 				{
-					return AppendCommand(
-						(GetType() == SocketType::Udp)
-							? DispatchCommand(address_pair, data->Clone())
-							: DispatchCommand(data->Clone()),
-						true);
+					if (GetType() == SocketType::Udp)
+					{
+						auto batch = SocketSendBatch::GetCurrent();
+
+						if (batch != nullptr)
+						{
+							// Sent when the batch is flushed
+							batch->AddSocket(GetSharedPtr());
+							auto result = AppendCommand(DispatchCommand(address_pair, batch->Hold(data)), false);
+							batch->OnDatagramQueued(data->GetLength());
+							return result;
+						}
+
+						return AppendCommand(DispatchCommand(address_pair, data->Clone()), true);
+					}
+
+					return AppendCommand(DispatchCommand(data->Clone()), true);
 				}
 		}
 
@@ -1486,6 +1891,335 @@ namespace ov
 		return SendFromTo(address_pair, (data == nullptr) ? nullptr : std::make_shared<Data>(data, length));
 	}
 
+	bool Socket::IsBatchableCommand(const DispatchCommand &command) const
+	{
+#if !IS_MACOS
+		if (sendmmsg_available == false)
+		{
+			return false;
+		}
+
+		switch (command.type)
+		{
+			case DispatchCommand::Type::SendTo:
+				[[fallthrough]];
+			case DispatchCommand::Type::SendFromTo:
+				return (GetType() == SocketType::Udp) && (command.data != nullptr) && (command.data->GetLength() > 0);
+
+			default:
+				break;
+		}
+#endif	// !IS_MACOS
+
+		return false;
+	}
+
+#if !IS_MACOS
+	template <typename Tpktinfo>
+	static cmsghdr *AppendPktInfo(msghdr *msg, cmsghdr *cmsg, const int msg_level, const int msg_type, const SocketAddress &local_address)
+	{
+		Tpktinfo pktinfo{};
+		SetAddr(&pktinfo, local_address);
+
+		cmsg->cmsg_level = msg_level;
+		cmsg->cmsg_type = msg_type;
+		cmsg->cmsg_len = CMSG_LEN(sizeof(pktinfo));
+		::memcpy(CMSG_DATA(cmsg), &pktinfo, sizeof(pktinfo));
+
+		msg->msg_controllen += CMSG_SPACE(sizeof(pktinfo));
+
+		return reinterpret_cast<cmsghdr *>(reinterpret_cast<uint8_t *>(cmsg) + CMSG_SPACE(sizeof(pktinfo)));
+	}
+#endif	// !IS_MACOS
+
+	Socket::DispatchResult Socket::DispatchDatagramsInternal()
+	{
+#if !IS_MACOS
+		// Enough space for in6_pktinfo + UDP_SEGMENT
+		struct Control
+		{
+			alignas(cmsghdr) uint8_t buffer[CMSG_SPACE(sizeof(in6_pktinfo)) + CMSG_SPACE(sizeof(uint16_t))];
+		};
+
+		mmsghdr messages[OV_SOCKET_SEND_BATCH_SIZE]{};
+		iovec iovs[OV_SOCKET_SEND_BATCH_SIZE]{};
+		Control controls[OV_SOCKET_SEND_BATCH_SIZE]{};
+		// Number of commands (= datagrams) in each message
+		size_t command_counts[OV_SOCKET_SEND_BATCH_SIZE]{};
+
+		auto is_same_destination = [](const DispatchCommand &command1, const DispatchCommand &command2) -> bool {
+			if (command1.type != command2.type)
+			{
+				return false;
+			}
+
+			return (command1.type == DispatchCommand::Type::SendTo)
+					   ? (command1.address == command2.address)
+					   : (command1.address_pair == command2.address_pair);
+		};
+
+		const bool use_gso = _gso_available;
+		bool gso_used = false;
+
+		const size_t command_limit = std::min<size_t>(_dispatch_queue.size(), OV_SOCKET_SEND_BATCH_SIZE);
+		size_t command_index = 0;
+		size_t message_count = 0;
+
+		while ((command_index < command_limit) && IsBatchableCommand(_dispatch_queue[command_index]))
+		{
+			const auto &first_command = _dispatch_queue[command_index];
+			const size_t segment_size = first_command.data->GetLength();
+
+			auto iov = &iovs[command_index];
+			size_t segment_count = 0;
+			size_t total_bytes = 0;
+
+			// Consecutive datagrams to the same destination are sent as one GSO message.
+			// Every segment except the last one must be exactly segment_size bytes.
+			while (command_index < command_limit)
+			{
+				const auto &command = _dispatch_queue[command_index];
+				const size_t length = (command.data != nullptr) ? command.data->GetLength() : 0;
+
+				if (segment_count > 0)
+				{
+					if ((use_gso == false) ||
+						(IsBatchableCommand(command) == false) ||
+						(is_same_destination(first_command, command) == false) ||
+						(iov[segment_count - 1].iov_len != segment_size) ||
+						(length > segment_size) ||
+						(segment_count >= OV_SOCKET_GSO_MAX_SEGMENTS) ||
+						((total_bytes + length) > OV_SOCKET_GSO_MAX_BYTES))
+					{
+						break;
+					}
+				}
+
+				// This is intentional conversion
+				iov[segment_count].iov_base = const_cast<void *>(command.data->GetData());
+				iov[segment_count].iov_len = length;
+
+				total_bytes += length;
+				segment_count++;
+				command_index++;
+			}
+
+			auto &msg = messages[message_count].msg_hdr;
+			const auto &remote_address = (first_command.type == DispatchCommand::Type::SendTo)
+											 ? first_command.address
+											 : first_command.address_pair.GetRemoteAddress();
+
+			// This is intentional conversion
+			msg.msg_name = const_cast<sockaddr *>(remote_address.ToSockAddr());
+			msg.msg_namelen = remote_address.GetSockAddrInLength();
+			msg.msg_iov = iov;
+			msg.msg_iovlen = segment_count;
+			msg.msg_control = controls[message_count].buffer;
+			msg.msg_controllen = 0;
+
+			auto cmsg = reinterpret_cast<cmsghdr *>(controls[message_count].buffer);
+
+			if (first_command.type == DispatchCommand::Type::SendFromTo)
+			{
+				const auto &local_address = first_command.address_pair.GetLocalAddress();
+
+				cmsg = (_family == SocketFamily::Inet6)
+						   ? AppendPktInfo<in6_pktinfo>(&msg, cmsg, IPPROTO_IPV6, IPV6_PKTINFO, local_address)
+						   : AppendPktInfo<in_pktinfo>(&msg, cmsg, IPPROTO_IP, IP_PKTINFO, local_address);
+			}
+
+			if (segment_count > 1)
+			{
+				const uint16_t gso_size = static_cast<uint16_t>(segment_size);
+
+				cmsg->cmsg_level = SOL_UDP;
+				cmsg->cmsg_type = UDP_SEGMENT;
+				cmsg->cmsg_len = CMSG_LEN(sizeof(gso_size));
+				::memcpy(CMSG_DATA(cmsg), &gso_size, sizeof(gso_size));
+
+				msg.msg_controllen += CMSG_SPACE(sizeof(gso_size));
+
+				gso_used = true;
+			}
+
+			if (msg.msg_controllen == 0)
+			{
+				msg.msg_control = nullptr;
+			}
+
+			command_counts[message_count] = segment_count;
+			message_count++;
+		}
+
+		if (message_count == 0)
+		{
+			OV_ASSERT2(message_count > 0);
+			return DispatchResult::Error;
+		}
+
+		logap("Trying to send %zu datagrams in %zu messages...", command_index, message_count);
+
+		const int sent_messages = ::sendmmsg(GetNativeHandle(), messages, static_cast<unsigned int>(message_count), MSG_NOSIGNAL | MSG_DONTWAIT);
+
+		if (sent_messages < 0)
+		{
+			const auto error_code = errno;
+
+			if (error_code == ENOSYS)
+			{
+				// Fallback: send the datagrams one by one from now on
+				logaw("sendmmsg() is not supported by the kernel, datagrams will be sent one by one");
+				sendmmsg_available = false;
+				return DispatchResult::Dispatched;
+			}
+
+			if (gso_used && ((error_code == EIO) || (error_code == EINVAL) || (error_code == ENOPROTOOPT) || (error_code == EOPNOTSUPP)))
+			{
+				// The kernel or the NIC doesn't support UDP GSO - retry without GSO
+				logad("UDP GSO is not available for this socket (%s), disabling it", ::strerror(error_code));
+				_gso_available = false;
+				return DispatchResult::Dispatched;
+			}
+
+			STATS_COUNTER_INCREASE_SYSCALL();
+
+			if (HandleSendError(sent_messages, 0) == 0)
+			{
+				// Socket buffer is full - retry later
+				return DispatchResult::PartialDispatched;
+			}
+
+			// Drop the datagrams that could not be sent, same as the non-batched path
+			for (size_t index = 0; index < command_counts[0]; index++)
+			{
+				_dispatch_queue.pop_front();
+			}
+
+			return DispatchResult::Error;
+		}
+
+		size_t sent_datagrams = 0;
+
+		for (int index = 0; index < sent_messages; index++)
+		{
+			sent_datagrams += command_counts[index];
+		}
+
+		for (size_t index = 0; index < sent_datagrams; index++)
+		{
+			STATS_COUNTER_INCREASE_PPS();
+			_dispatch_queue.pop_front();
+		}
+
+		STATS_COUNTER_INCREASE_SYSCALL();
+
+		_sent_datagram_count += sent_datagrams;
+		_datagram_send_syscall_count++;
+
+		UpdateLastSentTime();
+
+		logap("%zu datagrams sent", sent_datagrams);
+
+		// If some messages were not sent, the next sendmmsg() call will report the reason
+		return DispatchResult::Dispatched;
+#else	// !IS_MACOS
+		OV_ASSERT2(false);
+		return DispatchResult::Error;
+#endif	// !IS_MACOS
+	}
+
+	SocketSendBatch::SocketSendBatch()
+	{
+		if (current_send_batch == nullptr)
+		{
+			current_send_batch = this;
+			_is_active = true;
+		}
+	}
+
+	SocketSendBatch::~SocketSendBatch()
+	{
+		if (_is_active)
+		{
+			Flush();
+
+			current_send_batch = nullptr;
+		}
+	}
+
+	SocketSendBatch *SocketSendBatch::GetCurrent()
+	{
+		return current_send_batch;
+	}
+
+	void SocketSendBatch::AddSocket(const std::shared_ptr<Socket> &socket)
+	{
+		if (std::find(_sockets.begin(), _sockets.end(), socket) == _sockets.end())
+		{
+			_sockets.push_back(socket);
+		}
+	}
+
+	std::shared_ptr<const Data> SocketSendBatch::Hold(const std::shared_ptr<const Data> &data)
+	{
+		// The buffers are used in turn. A buffer is reused once the socket has sent (released) the datagram in it.
+		thread_local std::vector<std::shared_ptr<Data>> buffers;
+		thread_local size_t next_index = 0;
+
+		for (size_t count = 0; count < buffers.size(); count++)
+		{
+			auto &buffer = buffers[next_index];
+			next_index = (next_index + 1) % buffers.size();
+
+			if (buffer.use_count() == 1)
+			{
+				buffer->SetLength(data->GetLength());
+				::memcpy(buffer->GetWritableData(), data->GetData(), data->GetLength());
+				return buffer;
+			}
+		}
+
+		auto buffer = std::make_shared<Data>(data->GetData(), data->GetLength());
+
+		if (buffers.size() < SOCKET_SEND_BATCH_MAX_BUFFERS)
+		{
+			buffers.push_back(buffer);
+		}
+
+		return buffer;
+	}
+
+	void SocketSendBatch::OnDatagramQueued(size_t length)
+	{
+		_queued_datagram_count++;
+		_queued_bytes += length;
+
+		if ((_queued_datagram_count >= SOCKET_SEND_BATCH_MAX_DATAGRAMS) || (_queued_bytes >= SOCKET_SEND_BATCH_MAX_BYTES))
+		{
+			Flush();
+		}
+	}
+
+	void SocketSendBatch::Flush()
+	{
+		_queued_datagram_count = 0;
+		_queued_bytes = 0;
+
+		if (_sockets.empty())
+		{
+			return;
+		}
+
+		// Move first to prevent reentrance
+		auto sockets = std::move(_sockets);
+		_sockets.clear();
+
+		for (auto &socket : sockets)
+		{
+			socket->DispatchEventsAfterAppendCommand();
+		}
+	}
+
 	std::shared_ptr<const SocketError> Socket::Recv(std::shared_ptr<Data> &data, const bool non_block)
 	{
 		OV_ASSERT2(data != nullptr);
@@ -1823,6 +2557,135 @@ namespace ov
 		return socket_error;
 	}
 
+	std::shared_ptr<const SocketError> Socket::RecvFromBatch(Datagram *datagrams, size_t count, size_t *received_count, const bool non_block)
+	{
+		OV_ASSERT2(_socket.IsValid());
+		OV_ASSERT2(datagrams != nullptr);
+		OV_ASSERT2(received_count != nullptr);
+
+		*received_count = 0;
+
+		count = std::min<size_t>(count, OV_SOCKET_RECV_BATCH_SIZE);
+
+		if (count == 0)
+		{
+			return nullptr;
+		}
+
+#if !IS_MACOS
+		if ((GetType() == SocketType::Udp) && recvmmsg_available)
+		{
+			const size_t control_buf_size = CMSG_SPACE((_family == SocketFamily::Inet) ? sizeof(in_pktinfo) : sizeof(in6_pktinfo));
+
+			mmsghdr messages[OV_SOCKET_RECV_BATCH_SIZE]{};
+			iovec iovs[OV_SOCKET_RECV_BATCH_SIZE]{};
+			sockaddr_storage remotes[OV_SOCKET_RECV_BATCH_SIZE]{};
+			alignas(cmsghdr) uint8_t control_bufs[OV_SOCKET_RECV_BATCH_SIZE][CMSG_SPACE(sizeof(in6_pktinfo))];
+
+			for (size_t index = 0; index < count; index++)
+			{
+				auto &data = datagrams[index].data;
+
+				OV_ASSERT2(data != nullptr);
+				OV_ASSERT2(data->GetCapacity() > 0);
+
+				data->SetLength(data->GetCapacity());
+
+				iovs[index].iov_base = data->GetWritableData();
+				iovs[index].iov_len = data->GetLength();
+
+				auto &msg = messages[index].msg_hdr;
+				msg.msg_name = &remotes[index];
+				msg.msg_namelen = sizeof(remotes[index]);
+				msg.msg_iov = &iovs[index];
+				msg.msg_iovlen = 1;
+				msg.msg_control = control_bufs[index];
+				msg.msg_controllen = control_buf_size;
+			}
+
+			logad("Trying to read up to %zu datagrams from the socket...", count);
+
+			const int read_count = ::recvmmsg(
+				GetNativeHandle(),
+				messages, static_cast<unsigned int>(count),
+				((_blocking_mode == BlockingMode::NonBlocking) || non_block) ? MSG_DONTWAIT : 0,
+				nullptr);
+
+			if (read_count < 0)
+			{
+				auto error = Error::CreateErrorFromErrno();
+
+				for (size_t index = 0; index < count; index++)
+				{
+					datagrams[index].data->SetLength(0L);
+				}
+
+				if (error->GetCode() == EAGAIN)
+				{
+					// Timed out
+					return nullptr;
+				}
+
+				if (error->GetCode() != ENOSYS)
+				{
+					auto socket_error = SocketError::CreateError(error);
+
+					logae("An error occurred while read data: %s\nStack trace: %s",
+						  socket_error->What(),
+						  StackTrace::GetStackTrace().CStr());
+
+					CloseWithState(SocketState::Error);
+
+					return socket_error;
+				}
+
+				// Fallback: read the datagrams one by one from now on
+				logaw("recvmmsg() is not supported by the kernel, datagrams will be read one by one");
+				recvmmsg_available = false;
+			}
+			else
+			{
+				const auto port = GetLocalAddress()->Port();
+
+				for (int index = 0; index < read_count; index++)
+				{
+					auto &datagram = datagrams[index];
+
+					datagram.data->SetLength(messages[index].msg_len);
+
+					datagram.address_pair.SetLocalAddress(QueryLocalAddress(_family, port, remotes[index], &(messages[index].msg_hdr)));
+					datagram.address_pair.SetRemoteAddress(SocketAddress("", remotes[index]));
+				}
+
+				for (size_t index = read_count; index < count; index++)
+				{
+					datagrams[index].data->SetLength(0L);
+				}
+
+				logad("%d datagrams read", read_count);
+
+				*received_count = read_count;
+
+				if (read_count > 0)
+				{
+					UpdateLastRecvTime();
+				}
+
+				return nullptr;
+			}
+		}
+#endif	// !IS_MACOS
+
+		auto error = RecvFrom(datagrams[0].data, &(datagrams[0].address_pair), non_block);
+
+		if ((error == nullptr) && (datagrams[0].data->GetLength() > 0))
+		{
+			*received_count = 1;
+		}
+
+		return error;
+	}
+
 	std::chrono::system_clock::time_point Socket::GetLastRecvTime() const
 	{
 		return _last_recv_time;
@@ -26,16 +26,66 @@
 #include <map>
 #include <memory>
 #include <utility>
+#include <vector>
 
 // Failure to send data for the specified time period will be considered an error.
 // For example, it can occur when EAGAIN continues to occur for a period of time, or when the peer's TCP window is full and no longer receives data.
 #define OV_SOCKET_EXPIRE_TIMEOUT (10 * 1000)
 
+// Maximum number of datagrams sent by one sendmmsg() call
+#define OV_SOCKET_SEND_BATCH_SIZE 64
+// Maximum number of datagrams read by one recvmmsg() call
+#define OV_SOCKET_RECV_BATCH_SIZE 32
+// Maximum number of segments in a UDP GSO (UDP_SEGMENT) message (UDP_MAX_SEGMENTS of the kernel)
+#define OV_SOCKET_GSO_MAX_SEGMENTS 64
+// Maximum payload size of a UDP GSO message
+#define OV_SOCKET_GSO_MAX_BYTES 65000
+// Maximum number of queued buffers written by one sendmsg() call (TCP)
+#define OV_SOCKET_GATHER_MAX_COUNT 64
+
 namespace ov
 {
 	// Forward declaration
 	class Socket;
 	class SocketPoolWorker;
+	class SocketSendBatch;
+
+	// A datagram read by Socket::RecvFromBatch()
+	struct Datagram
+	{
+		SocketAddressPair address_pair;
+		std::shared_ptr<Data> data;
+	};
+
+	// A file opened to be sent with Socket::SendFile()
+	//
+	// The descriptor is closed when the last reference is released,
+	// so the file can be sent even if it is deleted while it is queued.
+	class SocketFile
+	{
+	public:
+		static std::shared_ptr<SocketFile> Open(const char *file_path);
+
+		SocketFile(int file_descriptor, size_t length);
+		~SocketFile();
+
+		SocketFile(const SocketFile &file) = delete;
+		SocketFile(SocketFile &&file) = delete;
+
+		int GetNativeHandle() const
+		{
+			return _file_descriptor;
+		}
+
+		size_t GetLength() const
+		{
+			return _length;
+		}
+
+	protected:
+		int _file_descriptor = -1;
+		size_t _length = 0;
+	};
 
 	class SocketAsyncInterface
 	{
@@ -55,6 +105,7 @@ namespace ov
 	{
 	protected:
 		friend class SocketPoolWorker;
+		friend class SocketSendBatch;
 
 		OV_SOCKET_DECLARE_PRIVATE_TOKEN();
 
@@ -181,6 +232,26 @@ namespace ov
 		bool SendFromTo(const SocketAddressPair &address_pair, const std::shared_ptr<const Data> &data);
 		bool SendFromTo(const SocketAddressPair &address_pair, const void *data, size_t length);
 
+		// Unlike Send(), the data is queued without being copied, so it MUST NOT be modified after calling this API
+		// (ex: a segment shared by all clients). Queued items are written with as few sendmsg() calls as possible (TCP only).
+		bool SendShared(const std::vector<std::shared_ptr<const Data>> &data_list);
+		bool SendShared(const std::shared_ptr<const Data> &data);
+
+		// Sends <length> bytes from <offset> of the file using sendfile() (TCP only)
+		bool SendFile(const std::shared_ptr<const SocketFile> &file, size_t offset, size_t length);
+
+		// Number of datagrams sent, and number of syscalls used to send them
+		// (GetSentDatagramCount() / GetDatagramSendSyscallCount() == packets per syscall)
+		uint64_t GetSentDatagramCount() const
+		{
+			return _sent_datagram_count;
+		}
+
+		uint64_t GetDatagramSendSyscallCount() const
+		{
+			return _datagram_send_syscall_count;
+		}
+
 		// When Recv is called in non-blocking mode,
 		//
 		// 1. return != nullptr: An error occurred (Include disconnecting the client)
@@ -196,6 +267,13 @@ namespace ov
 		// If MakeNonBlocking() is called, non_block is ignored
 		std::shared_ptr<const SocketError> RecvFrom(std::shared_ptr<Data> &data, SocketAddressPair *address_pair, const bool non_block = false);
 
+		// Reads up to <count> datagrams using one recvmmsg() call (UDP only).
+		// datagrams[n].data must be allocated by the caller, and is filled up to its capacity.
+		// The number of datagrams read is stored in <received_count> (0 == Retry later (EAGAIN))
+		//
+		// Falls back to RecvFrom() (1 datagram per call) if recvmmsg() is not available
+		std::shared_ptr<const SocketError> RecvFromBatch(Datagram *datagrams, size_t count, size_t *received_count, const bool non_block = false);
+
 		std::chrono::system_clock::time_point GetLastRecvTime() const;
 		std::chrono::system_clock::time_point GetLastSentTime() const;
 
@@ -262,6 +340,8 @@ namespace ov
 				SendTo = 0x02,
 				// Need to send data using sendmsg()
 				SendFromTo = 0x03,
+				// Need to send a file using sendfile()
+				SendFile = 0x04,
 
 				// Need to call shutdown(SHUT_WR) (TCP only)
 				HalfClose = CLOSE_TYPE_MASK | 0x01,
@@ -287,6 +367,9 @@ namespace ov
 					case Type::SendFromTo:
 						return "SendFromTo";
 
+					case Type::SendFile:
+						return "SendFile";
+
 					case Type::HalfClose:
 						return "HalfClose";
 
@@ -323,6 +406,15 @@ namespace ov
 			{
 			}
 
+			DispatchCommand(const std::shared_ptr<const SocketFile> &file, size_t file_offset, size_t file_length)
+				: type(Type::SendFile),
+				  file(file),
+				  file_offset(file_offset),
+				  file_length(file_length),
+				  enqueued_time(std::chrono::system_clock::now())
+			{
+			}
+
 			DispatchCommand(Type type)
 				: type(type),
 				  enqueued_time(std::chrono::system_clock::now())
@@ -343,6 +435,9 @@ namespace ov
 				  address(another_command.address),
 				  address_pair(another_command.address_pair),
 				  data(another_command.data),
+				  file(another_command.file),
+				  file_offset(another_command.file_offset),
+				  file_length(another_command.file_length),
 				  enqueued_time(another_command.enqueued_time)
 			{
 			}
@@ -355,9 +450,23 @@ namespace ov
 				std::swap(address, another_command.address);
 				std::swap(address_pair, another_command.address_pair);
 				std::swap(data, another_command.data);
+				std::swap(file, another_command.file);
+				std::swap(file_offset, another_command.file_offset);
+				std::swap(file_length, another_command.file_length);
 				std::swap(enqueued_time, another_command.enqueued_time);
 			}
 
+			// Number of bytes to send
+			size_t GetLength() const
+			{
+				if (type == Type::SendFile)
+				{
+					return file_length;
+				}
+
+				return (data != nullptr) ? data->GetLength() : 0;
+			}
+
 			bool IsCloseCommand() const
 			{
 				return OV_CHECK_FLAG(static_cast<uint8_t>(type), CLOSE_TYPE_MASK);
@@ -398,6 +507,11 @@ namespace ov
 					description.AppendFormat(", data: %zu bytes", data->GetLength());
 				}
 
+				if (file != nullptr)
+				{
+					description.AppendFormat(", file: %zu bytes from %zu", file_length, file_offset);
+				}
+
 				description.Append('>');
 
 				return description;
@@ -408,6 +522,9 @@ namespace ov
 			SocketAddress address;
 			SocketAddressPair address_pair;
 			std::shared_ptr<const Data> data;
+			std::shared_ptr<const SocketFile> file;
+			size_t file_offset = 0;
+			size_t file_length = 0;
 			std::chrono::time_point<std::chrono::system_clock> enqueued_time;
 		};
 
@@ -442,6 +559,21 @@ namespace ov
 		ssize_t SendInternal(const std::shared_ptr<const Data> &data);
 		ssize_t SendToInternal(const SocketAddress &address, const std::shared_ptr<const Data> &data);
 		ssize_t SendFromToInternal(const SocketAddressPair &address_pair, const std::shared_ptr<const Data> &data);
+		ssize_t SendFileInternal(const std::shared_ptr<const SocketFile> &file, size_t offset, size_t length);
+
+		// Writes the Send commands at the front of the _dispatch_queue using one sendmsg() with an iovec array (TCP only).
+		// This API MUST be called while _dispatch_queue_lock is held.
+		DispatchResult DispatchStreamsInternal();
+		bool IsGatherableCommand(const DispatchCommand &command) const;
+		// Removes the pending Send/SendFile commands after the TCP stream failed, since the rest of the stream can't be delivered.
+		// This API MUST be called while _dispatch_queue_lock is held.
+		void DropPendingStreamCommands();
+
+		// Sends the datagram commands (SendTo/SendFromTo) at the front of the _dispatch_queue using sendmmsg().
+		// Consecutive datagrams to the same destination are merged into one UDP GSO message if possible.
+		// This API MUST be called while _dispatch_queue_lock is held.
+		DispatchResult DispatchDatagramsInternal();
+		bool IsBatchableCommand(const DispatchCommand &command) const;
 
 		std::shared_ptr<SocketError> RecvInternal(void *data, size_t length, size_t *received_length);
 
@@ -536,6 +668,12 @@ namespace ov
 
 		String _stream_id;	// only available for SRT socket
 
+		// Whether UDP_SEGMENT can be used for this socket (turned off when the kernel/NIC rejects it)
+		bool _gso_available = true;
+
+		std::atomic<uint64_t> _sent_datagram_count{0};
+		std::atomic<uint64_t> _datagram_send_syscall_count{0};
+
 	private:
 		void UpdateLastRecvTime();
 		void UpdateLastSentTime();
@@ -543,4 +681,53 @@ namespace ov
 		std::chrono::system_clock::time_point _last_recv_time = std::chrono::system_clock::now();
 		std::chrono::system_clock::time_point _last_sent_time = std::chrono::system_clock::now();
 	};
+
+	// Batched datagram sending
+	//
+	// While a SocketSendBatch is alive, datagrams passed to SendTo()/SendFromTo() of non-blocking UDP sockets
+	// by the same thread are queued instead of being sent immediately, and are flushed with sendmmsg()
+	// (and UDP GSO if available) when the batch is destroyed or Flush() is called.
+	//
+	// Only the outermost batch of a thread is effective, nested batches are ignored.
+	// The batch is also flushed whenever 64 datagrams or 256 KB are queued.
+	//
+	// Usage:
+	//   {
+	//       SocketSendBatch batch;
+	//       for (auto &packet : packets) { socket->SendFromTo(address_pair, packet); }
+	//   }  // <-- sent here
+	class SocketSendBatch
+	{
+	public:
+		SocketSendBatch();
+		~SocketSendBatch();
+
+		// Disable copy & move operator
+		SocketSendBatch(const SocketSendBatch &batch) = delete;
+		SocketSendBatch(SocketSendBatch &&batch) = delete;
+
+		// Sends all queued datagrams
+		void Flush();
+
+		// Returns the active batch of the calling thread (nullptr if there is no batch)
+		static SocketSendBatch *GetCurrent();
+
+	protected:
+		friend class Socket;
+
+		void AddSocket(const std::shared_ptr<Socket> &socket);
+		// Copies the datagram into a buffer of the thread, so the caller can reuse (overwrite) its buffer
+		// without a copy-on-write while the datagram is queued
+		std::shared_ptr<const Data> Hold(const std::shared_ptr<const Data> &data);
+		// Flushes the batch if too many datagrams are queued
+		void OnDatagramQueued(size_t length);
+
+		bool _is_active = false;
+
+		size_t _queued_datagram_count = 0;
+		size_t _queued_bytes = 0;
+
+		// Sockets that have datagrams queued by this batch (usually just a few ports)
+		std::vector<std::shared_ptr<Socket>> _sockets;
+	};
 }  // namespace ov
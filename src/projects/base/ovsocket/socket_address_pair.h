@@ -15,6 +15,15 @@ namespace ov
 	class SocketAddressPair
 	{
 	public:
+		// Compares only the addresses like the ordering (operator==() also compares the host names)
+		struct AddressEqual
+		{
+			bool operator()(const SocketAddressPair &pair1, const SocketAddressPair &pair2) const
+			{
+				return ((pair1 < pair2) == false) && ((pair2 < pair1) == false);
+			}
+		};
+
 		SocketAddressPair()
 		{
 		}
@@ -99,3 +108,17 @@ namespace ov
 		SocketAddress _remote_address;
 	};
 }  // namespace ov
+
+namespace std
+{
+	template <>
+	struct hash<ov::SocketAddressPair>
+	{
+		std::size_t operator()(ov::SocketAddressPair const &pair) const
+		{
+			// The hashes are combined asymmetrically, so (A, B) and (B, A) are different
+			auto hash = pair.GetLocalAddress().Hash();
+			return hash ^ (pair.GetRemoteAddress().Hash() + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2));
+		}
+	};
+}  // namespace std
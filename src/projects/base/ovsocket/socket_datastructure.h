@@ -14,6 +14,7 @@
 #include <sys/epoll.h>
 
 #include <functional>
+#include <vector>
 
 #include "epoll_wrapper.h"
 #include "socket_error.h"
@@ -219,7 +220,10 @@ namespace ov
 	// For UDP sockets
 	class DatagramSocket;
 
+	struct Datagram;
+
 	typedef std::function<void(const std::shared_ptr<DatagramSocket> &client, const SocketAddressPair &address_pair, const std::shared_ptr<Data> &data)> DatagramCallback;
+	typedef std::function<void(const std::shared_ptr<DatagramSocket> &client, const std::vector<Datagram> &datagrams)> DatagramBatchCallback;
 
 	static String StringFromEpollEvent(const epoll_event &event)
 	{
@@ -8,6 +8,8 @@
 //==============================================================================
 #include "socket_pool.h"
 
+#include <algorithm>
+
 #include "../socket_private.h"
 
 #define logad(format, ...) logtd("[%p] " format, this, ##__VA_ARGS__)
@@ -20,6 +22,9 @@
 
 namespace ov
 {
+	static std::mutex pool_list_mutex;
+	static std::vector<std::weak_ptr<SocketPool>> pool_list;
+
 	SocketPool::SocketPool(PrivateToken token, const char *name, SocketType type)
 		: _name(name),
 		  _type(type)
@@ -44,7 +49,7 @@ namespace ov
 		return _type;
 	}
 
-	bool SocketPool::Initialize(int worker_count)
+	bool SocketPool::Initialize(int worker_count, bool sharded)
 	{
 		if (_initialized)
 		{
@@ -69,14 +74,22 @@ namespace ov
 
 			auto pool = GetSharedPtr();
 			bool succeeded = true;
+			std::vector<int> cpu_list;
+
+			if (sharded)
+			{
+				// Shard i is pinned to the i-th CPU of the SocketPool topology (or of the available CPUs if not configured)
+				cpu_list = ThreadTopology::GetInstance()->GetCpuList(OV_THREAD_POOL_SOCKET_POOL);
+			}
 
-			logad("Trying to initialize socket pool with %d workers...", worker_count);
+			logad("Trying to initialize socket pool with %d workers%s...", worker_count, sharded ? " (sharded)" : "");
 
 			for (int index = 0; index < worker_count; index++)
 			{
-				auto instance = std::make_shared<SocketPoolWorker>(SocketPoolWorker::PrivateToken{nullptr}, pool);
+				auto instance = std::make_shared<SocketPoolWorker>(SocketPoolWorker::PrivateToken{nullptr}, pool, index);
+				auto cpu_index = cpu_list.empty() ? -1 : cpu_list[index % cpu_list.size()];
 
-				if (instance->Initialize() == false)
+				if (instance->Initialize(cpu_index) == false)
 				{
 					succeeded = false;
 					break;
@@ -89,6 +102,7 @@ namespace ov
 			{
 				logad("%d workers were created successfully", worker_count);
 				_initialized = true;
+				_sharded = sharded;
 			}
 			else
 			{
@@ -99,6 +113,12 @@ namespace ov
 			}
 		}
 
+		if (_initialized)
+		{
+			std::lock_guard lock_guard(pool_list_mutex);
+			pool_list.emplace_back(GetSharedPtr());
+		}
+
 		return _initialized;
 	}
 
@@ -118,11 +138,56 @@ namespace ov
 	{
 		logad("Trying to uninitialize socket pool...");
 
+		{
+			std::lock_guard lock_guard(pool_list_mutex);
+
+			pool_list.erase(
+				std::remove_if(pool_list.begin(), pool_list.end(),
+							   [this](const std::weak_ptr<SocketPool> &item) {
+								   auto pool = item.lock();
+								   return (pool == nullptr) || (pool.get() == this);
+							   }),
+				pool_list.end());
+		}
+
 		std::lock_guard lock_guard(_worker_list_mutex);
 
 		return UninitializeInternal();
 	}
 
+	std::vector<SocketPoolWorker::Stats> SocketPool::GetWorkerStats() const
+	{
+		std::vector<SocketPoolWorker::Stats> stats_list;
+
+		std::lock_guard lock_guard(_worker_list_mutex);
+
+		for (auto &worker : _worker_list)
+		{
+			stats_list.push_back(worker->GetStats());
+		}
+
+		return stats_list;
+	}
+
+	std::vector<std::shared_ptr<SocketPool>> SocketPool::GetPoolList()
+	{
+		std::vector<std::shared_ptr<SocketPool>> list;
+
+		std::lock_guard lock_guard(pool_list_mutex);
+
+		for (auto &item : pool_list)
+		{
+			auto pool = item.lock();
+
+			if (pool != nullptr)
+			{
+				list.push_back(pool);
+			}
+		}
+
+		return list;
+	}
+
 	String SocketPool::ToString() const
 	{
 		String description;
@@ -130,8 +195,8 @@ namespace ov
 		std::lock_guard lock_guard(_worker_list_mutex);
 
 		description.AppendFormat(
-			"<SocketPool: %p, workers: %d",
-			this, _worker_list.size());
+			"<SocketPool: %p, workers: %zu%s",
+			this, _worker_list.size(), _sharded ? " (sharded)" : "");
 
 		for (auto &worker : _worker_list)
 		{
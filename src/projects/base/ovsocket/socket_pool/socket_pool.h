@@ -82,13 +82,25 @@ namespace ov
 
 		SocketType GetType() const;
 
-		bool Initialize(int worker_count);
+		// In sharded mode, each worker is pinned to a CPU, and sockets are explicitly allocated to the worker
+		// (ex: a listener per worker using SO_REUSEPORT, and the clients accepted by it stay in the same worker)
+		bool Initialize(int worker_count, bool sharded = false);
 
 		int GetWorkerCount() const
 		{
 			return static_cast<int>(_worker_list.size());
 		}
 
+		bool IsSharded() const
+		{
+			return _sharded;
+		}
+
+		std::vector<SocketPoolWorker::Stats> GetWorkerStats() const;
+
+		// Returns all socket pools which are initialized
+		static std::vector<std::shared_ptr<SocketPool>> GetPoolList();
+
 		template <typename Tsocket = ov::Socket, typename... Targuments>
 		std::shared_ptr<Tsocket> AllocSocket(const SocketFamily family, Targuments... args)
 		{
@@ -110,6 +122,28 @@ namespace ov
 			return nullptr;
 		}
 
+		// Allocates a socket to the specified worker (index: 0 ~ GetWorkerCount() - 1)
+		template <typename Tsocket = ov::Socket, typename... Targuments>
+		std::shared_ptr<Tsocket> AllocSocketOnWorker(int worker_index, const SocketFamily family, Targuments... args)
+		{
+			std::shared_ptr<SocketPoolWorker> worker = GetWorker(worker_index);
+
+			if (worker != nullptr)
+			{
+				auto socket = worker->AllocSocket<Tsocket>(family, args...);
+
+				if (socket == nullptr)
+				{
+					// Rollback
+					worker->DecreaseSocketCount();
+				}
+
+				return socket;
+			}
+
+			return nullptr;
+		}
+
 		bool ReleaseSocket(const std::shared_ptr<Socket> &socket)
 		{
 			return socket->GetSocketPoolWorker()->ReleaseSocket(socket);
@@ -139,6 +173,24 @@ namespace ov
 			return worker;
 		}
 
+		// This method will increase the number of sockets for that worker by 1
+		std::shared_ptr<SocketPoolWorker> GetWorker(int worker_index)
+		{
+			std::lock_guard lock_guard(_worker_list_mutex);
+
+			if ((worker_index < 0) || (worker_index >= static_cast<int>(_worker_list.size())))
+			{
+				OV_ASSERT(false, "Invalid worker index: %d (workers: %zu)", worker_index, _worker_list.size());
+				return nullptr;
+			}
+
+			auto worker = _worker_list[worker_index];
+
+			worker->IncreaseSocketCount();
+
+			return worker;
+		}
+
 		bool UninitializeInternal();
 
 		ov::String _name;
@@ -146,6 +198,7 @@ namespace ov
 		SocketType _type = SocketType::Unknown;
 
 		bool _initialized = false;
+		bool _sharded = false;
 
 		mutable std::mutex _worker_list_mutex;
 		std::vector<std::shared_ptr<SocketPoolWorker>> _worker_list;
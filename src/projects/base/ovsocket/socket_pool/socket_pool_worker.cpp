@@ -24,11 +24,13 @@
 #define logac(format, ...) logtc("[#%d] [%p] " format, (GetNativeHandle() == InvalidSocket) ? 0 : GetNativeHandle(), this, ##__VA_ARGS__)
 
 #define SOCKET_POOL_WORKER_GC_INTERVAL 1000
+#define SOCKET_POOL_WORKER_STATS_INTERVAL 1000
 
 namespace ov
 {
-	SocketPoolWorker::SocketPoolWorker(PrivateToken token, const std::shared_ptr<SocketPool> &pool)
-		: _pool(pool)
+	SocketPoolWorker::SocketPoolWorker(PrivateToken token, const std::shared_ptr<SocketPool> &pool, int index)
+		: _pool(pool),
+		  _index(index)
 	{
 		OV_ASSERT2(_pool != nullptr);
 	}
@@ -37,7 +39,7 @@ namespace ov
 	{
 	}
 
-	bool SocketPoolWorker::Initialize()
+	bool SocketPoolWorker::Initialize(int cpu_index)
 	{
 		if (GetNativeHandle() != InvalidSocket)
 		{
@@ -61,6 +63,22 @@ namespace ov
 
 		::pthread_setname_np(_epoll_thread.native_handle(), name.CStr());
 
+		// Sharded workers are pinned to a single CPU below, so the affinity of the topology is overridden
+		ThreadTopology::GetInstance()->Apply(OV_THREAD_POOL_SOCKET_POOL, _epoll_thread.native_handle(), _index);
+
+		if (cpu_index >= 0)
+		{
+			if (Platform::SetThreadAffinity(_epoll_thread.native_handle(), cpu_index))
+			{
+				_cpu_index = cpu_index;
+				logad("Worker #%d is pinned to CPU %d", _index, cpu_index);
+			}
+			else
+			{
+				logaw("Could not pin worker #%d to CPU %d", _index, cpu_index);
+			}
+		}
+
 		return true;
 	}
 
@@ -116,6 +134,45 @@ namespace ov
 		return _pool->GetType();
 	}
 
+	SocketPoolWorker::Stats SocketPoolWorker::GetStats() const
+	{
+		Stats stats;
+
+		stats.index = _index;
+		stats.cpu_index = _cpu_index;
+		stats.socket_count = _socket_count;
+		stats.event_count = _event_count;
+		stats.busy_time_us = _busy_time_us;
+		stats.events_per_second = _events_per_second;
+		stats.busy_ratio = _busy_ratio;
+
+		return stats;
+	}
+
+	void SocketPoolWorker::UpdateStats(int event_count, int64_t busy_time_us)
+	{
+		_event_count += std::max(event_count, 0);
+		_busy_time_us += std::max<int64_t>(busy_time_us, 0);
+
+		if (_stats_interval.IsElapsed(SOCKET_POOL_WORKER_STATS_INTERVAL))
+		{
+			auto elapsed_us = _stats_interval.Elapsed(true) / 1000;
+			_stats_interval.Update();
+
+			uint64_t total_event_count = _event_count;
+			uint64_t total_busy_time_us = _busy_time_us;
+
+			if (elapsed_us > 0)
+			{
+				_events_per_second = (total_event_count - _last_event_count) * 1000000 / elapsed_us;
+				_busy_ratio = std::min(static_cast<double>(total_busy_time_us - _last_busy_time_us) / elapsed_us, 1.0);
+			}
+
+			_last_event_count = total_event_count;
+			_last_busy_time_us = total_busy_time_us;
+		}
+	}
+
 	bool SocketPoolWorker::PrepareEpoll()
 	{
 		logad("Creating epoll for %s...", StringFromSocketType(GetType()));
@@ -262,11 +319,16 @@ namespace ov
 		_connection_callback_queue.Start();
 
 		_gc_interval.Start();
+		_stats_interval.Start();
+
+		StopWatch busy_watch;
 
 		while (_stop_epoll_thread == false)
 		{
 			int count = EpollWait(100);
 
+			busy_watch.Start();
+
 			if (count < 0)
 			{
 				logae("An error occurred - EpollWait()");
@@ -499,6 +561,8 @@ namespace ov
 			}
 
 			MergeSocketList();
+
+			UpdateStats(count, busy_watch.Elapsed(true) / 1000);
 		}
 
 		_connection_callback_queue.Stop();
@@ -23,16 +23,44 @@ namespace ov
 
 		OV_SOCKET_DECLARE_PRIVATE_TOKEN();
 
+	public:
+		struct Stats
+		{
+			int index = 0;
+			// -1 == not pinned
+			int cpu_index = -1;
+
+			int socket_count = 0;
+
+			// Total number of epoll events processed
+			uint64_t event_count = 0;
+			// Total time spent on processing events (except the time waiting for events)
+			uint64_t busy_time_us = 0;
+
+			// Values measured during the last second
+			uint64_t events_per_second = 0;
+			// 0.0 ~ 1.0
+			double busy_ratio = 0.0;
+		};
+
 	public:
 		// SocketPoolWorker can only be created within SocketPool
-		SocketPoolWorker(PrivateToken token, const std::shared_ptr<SocketPool> &pool);
+		SocketPoolWorker(PrivateToken token, const std::shared_ptr<SocketPool> &pool, int index);
 		~SocketPoolWorker() override;
 
-		bool Initialize();
+		// If cpu_index is not -1, the epoll thread is pinned to the CPU
+		bool Initialize(int cpu_index = -1);
 		bool Uninitialize();
 
 		int GetNativeHandle() const;
 
+		int GetIndex() const
+		{
+			return _index;
+		}
+
+		Stats GetStats() const;
+
 		template <typename Tsocket = Socket, typename... Targuments>
 		std::shared_ptr<Tsocket> AllocSocket(const SocketFamily family, Targuments... args)
 		{
@@ -82,6 +110,8 @@ namespace ov
 
 		void ThreadProc();
 
+		void UpdateStats(int event_count, int64_t busy_time_us);
+
 		bool AddToEpoll(const std::shared_ptr<Socket> &socket);
 		int EpollWait(int timeout_msec = Infinite);
 		bool DeleteFromEpoll(const std::shared_ptr<Socket> &socket);
@@ -94,6 +124,9 @@ namespace ov
 	protected:
 		std::shared_ptr<SocketPool> _pool;
 
+		int _index = 0;
+		int _cpu_index = -1;
+
 		// The number of sockets is determined in advance and managed separately for processing
 		// Because excessive concentration may not be properly distributed to the worker,
 		// the number of sockets can be specified in advance so that they can be distributed properly.
@@ -137,6 +170,16 @@ namespace ov
 		// Related to SRT
 		SRTSOCKET _srt_epoll = InvalidSocket;
 		std::vector<SRT_EPOLL_EVENT> _srt_epoll_events;
+
+		// Related to stats (updated only by the epoll thread)
+		std::atomic<uint64_t> _event_count{0};
+		std::atomic<uint64_t> _busy_time_us{0};
+		std::atomic<uint64_t> _events_per_second{0};
+		std::atomic<double> _busy_ratio{0.0};
+
+		StopWatch _stats_interval;
+		uint64_t _last_event_count = 0;
+		uint64_t _last_busy_time_us = 0;
 	};
 
 }  // namespace ov
\ No newline at end of file
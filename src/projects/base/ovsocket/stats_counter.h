@@ -16,6 +16,7 @@ namespace ov
 #	define STATS_COUNTER_INCREASE_PPS() stats_counter.IncreasePps()
 #	define STATS_COUNTER_INCREASE_RETRY() stats_counter.IncreaseRetry()
 #	define STATS_COUNTER_INCREASE_ERROR() stats_counter.IncreaseError()
+#	define STATS_COUNTER_INCREASE_SYSCALL() stats_counter.IncreaseSyscall()
 
 	class StatsCounter
 	{
@@ -53,6 +54,12 @@ namespace ov
 			_total_error_count++;
 		}
 
+		void IncreaseSyscall()
+		{
+			_syscall_count++;
+			_total_syscall_count++;
+		}
+
 		void StartTracking()
 		{
 			_stop = false;
@@ -80,6 +87,9 @@ namespace ov
 						int64_t error_count = _error_count;
 						_error_count = 0;
 
+						int64_t syscall_count = _syscall_count;
+						_syscall_count = 0;
+
 						if ((count > 0) || (retry_count > 0) || (error_count > 0))
 						{
 							loop_count++;
@@ -97,6 +107,10 @@ namespace ov
 							int64_t retry_average = _total_retry_count / ((loop_count == 0) ? 1 : loop_count);
 							int64_t error_average = _total_error_count / ((loop_count == 0) ? 1 : loop_count);
 
+							int64_t total_syscall_count = _total_syscall_count;
+							double packets_per_syscall = (syscall_count == 0) ? 0.0 : static_cast<double>(count) / syscall_count;
+							double total_packets_per_syscall = (total_syscall_count == 0) ? 0.0 : static_cast<double>(_total_count) / total_syscall_count;
+
 							logi("SockStat",
 								 "[Stats Counter] Total sampling count: %ld\n"
 								 "+-------+---------+---------+---------+---------+--------------+\n"
@@ -105,11 +119,13 @@ namespace ov
 								 "| PPS   | %7ld | %7ld | %7ld | %7ld | %12ld |\n"
 								 "| Retry | %7ld | %7ld | %7ld | %7ld | %12ld |\n"
 								 "| Error | %7ld | %7ld | %7ld | %7ld | %12ld |\n"
-								 "+-------+---------+---------+---------+---------+--------------+\n",
+								 "+-------+---------+---------+---------+---------+--------------+\n"
+								 "Packets per syscall: %.2f (current), %.2f (total)\n",
 								 loop_count,
 								 count, max, min, average, static_cast<int64_t>(_total_count),
 								 retry_count, retry_max, retry_min, retry_average, static_cast<int64_t>(_total_retry_count),
-								 error_count, error_max, error_min, error_average, static_cast<int64_t>(_total_error_count));
+								 error_count, error_max, error_min, error_average, static_cast<int64_t>(_total_error_count),
+								 packets_per_syscall, total_packets_per_syscall);
 						}
 
 						sleep(1);
@@ -129,6 +145,9 @@ namespace ov
 		std::atomic<int64_t> _error_count{0};
 		std::atomic<int64_t> _total_error_count{0};
 
+		std::atomic<int64_t> _syscall_count{0};
+		std::atomic<int64_t> _total_syscall_count{0};
+
 		std::thread _tracking_thread;
 		volatile bool _stop = true;
 	};
@@ -142,5 +161,6 @@ namespace ov
 #	define STATS_COUNTER_INCREASE_PPS() STATS_COUNTER_NOOP()
 #	define STATS_COUNTER_INCREASE_RETRY() STATS_COUNTER_NOOP()
 #	define STATS_COUNTER_INCREASE_ERROR() STATS_COUNTER_NOOP()
+#	define STATS_COUNTER_INCREASE_SYSCALL() STATS_COUNTER_NOOP()
 #endif	// USE_STATS_COUNTER
 }  // namespace ov
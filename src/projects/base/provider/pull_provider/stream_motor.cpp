@@ -41,6 +41,7 @@ namespace pvd
 		_stop_thread_flag = false;
 		_thread = std::thread(&StreamMotor::WorkerThread, this);
 		pthread_setname_np(_thread.native_handle(), "StreamMotor");
+		ov::ThreadTopology::GetInstance()->Apply(OV_THREAD_POOL_STREAM_MOTOR, _thread.native_handle(), _id);
 
 		return true;
 	}
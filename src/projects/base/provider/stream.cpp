@@ -114,7 +114,7 @@ namespace pvd
 			return false;
 		}
 
-		auto event_message = std::make_shared<MediaPacket>(GetMsid(),
+		auto event_message = MediaPacket::Create(GetMsid(),
 															cmn::MediaType::Data,
 															data_track->GetId(),
 															frame, 
@@ -23,6 +23,7 @@ namespace pub
 
 		auto name = ov::String::FormatString("AW-%s%d", _worker_name.CStr(), _worker_id);
 		pthread_setname_np(_worker_thread.native_handle(), name.CStr());
+		ov::ThreadTopology::GetInstance()->Apply(OV_THREAD_POOL_APP_WORKER, _worker_thread.native_handle(), _worker_id);
 
 		auto urn = std::make_shared<info::ManagedQueue::URN>(
 			_vhost_app_name,
@@ -48,7 +49,7 @@ namespace pub
 
 		_stop_thread_flag = true;
 
-		_queue_event.Stop();
+		_stream_data_queue.Stop();
 
 		if (_worker_thread.joinable())
 		{
@@ -63,37 +64,29 @@ namespace pub
 		auto data = std::make_shared<ApplicationWorker::StreamData>(stream, media_packet);
 		_stream_data_queue.Enqueue(std::move(data));
 
-		_queue_event.Notify();
-
 		return true;
 	}
 
-	std::shared_ptr<ApplicationWorker::StreamData> ApplicationWorker::PopStreamData()
-	{
-		if (_stream_data_queue.IsEmpty())
-		{
-			return nullptr;
-		}
-
-		auto data = _stream_data_queue.Dequeue(0);
-		if (data.has_value())
-		{
-			return data.value();
-		}
-
-		return nullptr;
-	}
-
 	void ApplicationWorker::WorkerThread()
 	{
+		std::vector<std::shared_ptr<StreamData>> stream_data_list;
+		stream_data_list.reserve(MANAGED_QUEUE_DEFAULT_BATCH_SIZE);
+
 		while (!_stop_thread_flag)
 		{
-			_queue_event.Wait();
+			// Wait until media data is available
+			if (_stream_data_queue.DequeueBatch(stream_data_list, MANAGED_QUEUE_DEFAULT_BATCH_SIZE, ov::Infinite) == 0)
+			{
+				continue;
+			}
 
-			// Check media data is available
-			auto stream_data = PopStreamData();
-			if ((stream_data != nullptr) && (stream_data->_stream != nullptr) && (stream_data->_media_packet != nullptr))
+			for (const auto &stream_data : stream_data_list)
 			{
+				if ((stream_data == nullptr) || (stream_data->_stream == nullptr) || (stream_data->_media_packet == nullptr))
+				{
+					continue;
+				}
+
 				if (stream_data->_media_packet->GetMediaType() == cmn::MediaType::Video)
 				{
 					stream_data->_stream->SendVideoFrame(stream_data->_media_packet);
@@ -111,6 +104,8 @@ namespace pub
 					// Nothing can do
 				}
 			}
+
+			stream_data_list.clear();
 		}
 	}
 
@@ -152,7 +147,13 @@ namespace pub
 
 	bool Application::Start()
 	{
-		_application_worker_count = GetConfig().GetAppWorkerCount();
+		bool is_configured = false;
+		_application_worker_count = GetConfig().GetPublishers().GetAppWorkerCount(&is_configured);
+		if (is_configured == false)
+		{
+			_application_worker_count = ov::ThreadTopology::GetInstance()->GetThreadCount(OV_THREAD_POOL_APP_WORKER, _application_worker_count);
+		}
+
 		if (_application_worker_count < MIN_APPLICATION_WORKER_COUNT)
 		{
 			_application_worker_count = MIN_APPLICATION_WORKER_COUNT;
@@ -220,7 +221,12 @@ namespace pub
 	// Called by MediaRouteApplicationObserver
 	bool Application::OnStreamCreated(const std::shared_ptr<info::Stream> &info)
 	{
-		auto stream_worker_count = GetConfig().GetStreamWorkerCount();
+		bool is_configured = false;
+		auto stream_worker_count = GetConfig().GetPublishers().GetStreamWorkerCount(&is_configured);
+		if (is_configured == false)
+		{
+			stream_worker_count = ov::ThreadTopology::GetInstance()->GetThreadCount(OV_THREAD_POOL_STREAM_WORKER, stream_worker_count);
+		}
 
 		auto stream = CreateStream(info, stream_worker_count);
 		if (!stream)
@@ -57,12 +57,12 @@ namespace pub
 			std::shared_ptr<Stream> _stream;
 			std::shared_ptr<MediaPacket> _media_packet;
 		};
-		std::shared_ptr<ApplicationWorker::StreamData> PopStreamData();
 
 		std::atomic<bool> _stop_thread_flag;
 		std::thread _worker_thread;
-		ov::Semaphore _queue_event;
 
+		// The worker thread waits on this queue directly. It is not in the ring mode (ov::ManagedQueueType::MpscRing),
+		// since a full ring would drop the media packets (including the key frames)
 		ov::ManagedQueue<std::shared_ptr<StreamData>> _stream_data_queue;
 
 		int64_t	_last_video_ts_ms = 0;
@@ -35,6 +35,12 @@ namespace pub
 		
 		virtual void SendOutgoingData(const std::any &packet){};
 		virtual void OnMessageReceived(const std::any &message){};
+		// Sends the data held back by the pacer of the session. Called by the StreamWorker after the packets are processed.
+		// Returns the time until it needs to be called again in milliseconds, or -1 if nothing is held back.
+		virtual int64_t SendPacedData() { return -1; }
+		// Whether the pacer holds back the data (checked by the StreamWorker after SendOutgoingData(),
+		// so that SendPacedData() is called only for these sessions)
+		virtual bool HasPacedData() const { return false; }
 
 		enum class SessionState : int8_t
 		{
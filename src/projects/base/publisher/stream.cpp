@@ -1,11 +1,16 @@
 #include "stream.h"
+
+#include <base/ovsocket/ovsocket.h>
+
 #include "application.h"
 #include "publisher_private.h"
 
 namespace pub
 {
-	StreamWorker::StreamWorker(const std::shared_ptr<Stream> &parent_stream)
-		: _packet_queue(nullptr, 500)
+	StreamWorker::StreamWorker(const std::shared_ptr<Stream> &parent_stream, int index)
+		: _index(index),
+		  _packet_queue(nullptr, 500),
+		  _message_queue(nullptr, 500)
 	{
 		_stop_thread_flag = true;
 		_parent = parent_stream;
@@ -28,10 +33,18 @@ namespace pub
 			"pub", 
 			ov::String::FormatString("streamworker_%s", _parent->GetApplication()->GetPublisherTypeName()).LowerCaseString());
 		_packet_queue.SetUrn(urn);
+
+		auto message_urn = std::make_shared<info::ManagedQueue::URN>(
+			_parent->GetApplicationName(),
+			_parent->GetName(),
+			"pub",
+			ov::String::FormatString("streamworker_%s_message", _parent->GetApplication()->GetPublisherTypeName()).LowerCaseString());
+		_message_queue.SetUrn(message_urn);
 		
 		_stop_thread_flag = false;
 		_worker_thread = std::thread(&StreamWorker::WorkerThread, this);
 		pthread_setname_np(_worker_thread.native_handle(), "StreamWorker");
+		ov::ThreadTopology::GetInstance()->Apply(OV_THREAD_POOL_STREAM_WORKER, _worker_thread.native_handle(), _index);
 
 		return true;
 	}
@@ -49,8 +62,7 @@ namespace pub
 		_stop_thread_flag = true;
 		// Generate Event
 		_packet_queue.Stop();
-		_session_message_queue.Stop();
-		_queue_event.Stop();
+		_message_queue.Stop();
 		
 		if(_worker_thread.joinable())
 		{
@@ -59,6 +71,8 @@ namespace pub
 
 		logtd("StreamWorker thread of %s has been stopped successfully", worker_name.CStr());
 
+		_paced_sessions.clear();
+
 		std::lock_guard<std::shared_mutex> lock(_session_map_mutex);
 
 		logtd("Try to stop all sessions of %s", worker_name.CStr());
@@ -126,67 +140,99 @@ namespace pub
 	void StreamWorker::SendPacket(const std::any &packet)
 	{
 		_packet_queue.Enqueue(packet);
-		_queue_event.Notify();
 	}
 
 	// Send to a specific session
 	void StreamWorker::SendMessage(const std::shared_ptr<Session> &session, const std::any &message)
 	{
-		_session_message_queue.Enqueue(std::make_shared<SessionMessage>(session, message));
-		_queue_event.Notify();
-	}
-
-	std::optional<std::any> StreamWorker::PopStreamPacket()
-	{
-		if (_packet_queue.IsEmpty())
-		{
-			return std::nullopt;
-		}
+		_message_queue.Enqueue(std::make_shared<SessionMessage>(session, message));
 
-		return _packet_queue.Dequeue();
+		// The worker waits on the packet queue
+		_packet_queue.WakeUp();
 	}
 
-	std::shared_ptr<StreamWorker::SessionMessage> StreamWorker::PopSessionMessage()
+	void StreamWorker::ProcessSessionMessages()
 	{
-		if (_session_message_queue.IsEmpty())
-		{
-			return nullptr;
-		}
+		std::vector<std::shared_ptr<SessionMessage>> messages;
 
-		auto data = _session_message_queue.Dequeue();
-		if(data.has_value())
+		while (_message_queue.DequeueBatch(messages, MANAGED_QUEUE_DEFAULT_BATCH_SIZE, 0) > 0)
 		{
-			return data.value();
+			for (const auto &session_message : messages)
+			{
+				if (session_message != nullptr && session_message->_session != nullptr && session_message->_message.has_value())
+				{
+					session_message->_session->OnMessageReceived(session_message->_message);
+				}
+			}
 		}
-
-		return nullptr;
 	}
 
 	void StreamWorker::WorkerThread()
 	{
-		std::shared_lock<std::shared_mutex> session_lock(_session_map_mutex, std::defer_lock);
+		std::vector<std::any> packets;
+		packets.reserve(MANAGED_QUEUE_DEFAULT_BATCH_SIZE);
+
+		// The worker wakes up when the pacer of a session can send the data held back
+		int timeout = ov::Infinite;
 
 		while (!_stop_thread_flag)
 		{
-			_queue_event.Wait();
+			_packet_queue.DequeueBatch(packets, MANAGED_QUEUE_DEFAULT_BATCH_SIZE, timeout);
 
-			auto session_message = PopSessionMessage();
-			if (session_message != nullptr && session_message->_session != nullptr && session_message->_message.has_value())
+			// Datagrams of the sessions (ex: RTP over ICE/UDP) are sent together with sendmmsg(),
+			// whenever the batch is full (see SocketSendBatch) and after the packets are processed
+			ov::SocketSendBatch send_batch;
+
+			// Session messages (ex: HTTP requests, RTCP) don't wait behind the stream packets
+			ProcessSessionMessages();
+
+			for (const auto &packet : packets)
 			{
-				session_message->_session->OnMessageReceived(session_message->_message);
-			}
+				// The lock is held per packet, so adding/removing a session waits for one packet at most
+				// (and a removed session is never stopped while a packet is being sent to it)
+				std::shared_lock<std::shared_mutex> session_lock(_session_map_mutex);
 
-			auto packet = PopStreamPacket();
-			if (packet.has_value())
-			{		
-				session_lock.lock();
 				for (auto const &x : _sessions)
 				{
 					auto session = x.second;
-					session->SendOutgoingData(packet.value());
+					session->SendOutgoingData(packet);
+
+					if (session->HasPacedData())
+					{
+						_paced_sessions.emplace(x.first, session);
+					}
+				}
+			}
+
+			// Only the sessions whose pacer holds back the data are visited
+			timeout = ov::Infinite;
+
+			for (auto item = _paced_sessions.begin(); item != _paced_sessions.end();)
+			{
+				// Same as above, a session removed by RemoveSession() is never stopped while its paced data is being sent
+				std::shared_lock<std::shared_mutex> session_lock(_session_map_mutex);
+
+				if ((_sessions.find(item->first) == _sessions.end()) || (item->second->GetState() != Session::SessionState::Started))
+				{
+					// Removed or stopped session
+					item = _paced_sessions.erase(item);
+					continue;
+				}
+
+				auto delay = item->second->SendPacedData();
+				if (delay < 0)
+				{
+					item = _paced_sessions.erase(item);
+					continue;
 				}
-				session_lock.unlock();
+
+				timeout = static_cast<int>(std::min<int64_t>(timeout, delay));
+				++item;
 			}
+
+			send_batch.Flush();
+
+			packets.clear();
 		}
 	}
 
@@ -243,7 +289,7 @@ namespace pub
 		// Create WorkerThread
 		for (uint32_t i = 0; i < _worker_count; i++)
 		{
-			auto stream_worker = std::make_shared<StreamWorker>(GetSharedPtr());
+			auto stream_worker = std::make_shared<StreamWorker>(GetSharedPtr(), i);
 						
 			if (stream_worker->Start() == false)
 			{
@@ -436,6 +482,8 @@ namespace pub
 		}
 		else
 		{
+			ov::SocketSendBatch send_batch;
+
 			std::shared_lock<std::shared_mutex> session_lock(_session_map_mutex);
 			for (auto const &x : _sessions)
 			{
@@ -15,7 +15,7 @@ namespace pub
 	class StreamWorker
 	{
 	public:
-		StreamWorker(const std::shared_ptr<Stream> &parent_stream);
+		StreamWorker(const std::shared_ptr<Stream> &parent_stream, int index = 0);
 		~StreamWorker();
 
 		bool Start();
@@ -32,16 +32,6 @@ namespace pub
 		void SendPacket(const std::any &packet);
 
 	private:
-		void WorkerThread();
-
-		std::map<session_id_t, std::shared_ptr<Session>> _sessions;
-		std::shared_mutex _session_map_mutex;
-		
-		ov::Semaphore _queue_event;
-
-		std::optional<std::any> PopStreamPacket();
-		ov::ManagedQueue<std::any> _packet_queue;
-
 		struct SessionMessage
 		{
 			SessionMessage(const std::shared_ptr<Session> &session, const std::any &message)
@@ -54,8 +44,23 @@ namespace pub
 			std::any _message;
 		};
 
-		std::shared_ptr<SessionMessage> PopSessionMessage();
-		ov::Queue<std::shared_ptr<SessionMessage>> _session_message_queue;
+		void WorkerThread();
+
+		void ProcessSessionMessages();
+
+		// Index of the worker in the stream (used to pin the thread when PinEachThread is set)
+		int _index = 0;
+
+		std::map<session_id_t, std::shared_ptr<Session>> _sessions;
+		std::shared_mutex _session_map_mutex;
+
+		// Stream packets, the worker thread waits on this queue
+		ov::ManagedQueue<std::any> _packet_queue;
+		// Session messages are handled before the pending packets (SendMessage() wakes the worker up with _packet_queue.WakeUp())
+		ov::ManagedQueue<std::shared_ptr<SessionMessage>> _message_queue;
+
+		// Sessions whose pacer holds back the data (only accessed by the worker thread)
+		std::map<session_id_t, std::shared_ptr<Session>> _paced_sessions;
 
 		std::atomic<bool> _stop_thread_flag;
 		std::thread _worker_thread;
@@ -0,0 +1,99 @@
+LOCAL_PATH := $(call get_local_path)
+
+# The benchmark is built only by "make benchmark" (and removed by "make clean")
+ifneq ($(filter benchmark clean,$(MAKECMDGOALS)),)
+
+include $(DEFAULT_VARIABLES)
+
+LOCAL_STATIC_LIBRARIES := \
+	webrtc_publisher \
+	llhls_publisher \
+	segment_publishers \
+	ovt_publisher \
+	file_publisher \
+	mpegtspush_publisher \
+	rtmppush_publisher \
+	srtpush_publisher \
+	thumbnail_publisher \
+	ovt_provider \
+	rtmp_provider \
+	srt_provider \
+	mpegts_provider \
+	rtspc_provider \
+	webrtc_provider \
+	transcoder \
+	rtc_signalling \
+	whip \
+	address_utilities \
+	ice \
+	api_server \
+	json_serdes \
+	bitstream \
+	containers \
+	http \
+	dtls_srtp \
+	rtp_rtcp \
+	sdp \
+	id3v2 \
+	segment_writer \
+	web_console \
+	mediarouter \
+	rtsp_module \
+	jitter_buffer \
+	ovt_packetizer \
+	orchestrator \
+	origin_map_client \
+	publisher \
+	application \
+	access_controller \
+	physical_port \
+	socket \
+	ovcrypto \
+	config \
+	ovlibrary \
+	monitoring \
+	jsoncpp \
+	dump \
+	srt \
+	file_provider \
+	managed_queue \
+	ffmpeg_wrapper \
+	
+
+LOCAL_PREBUILT_LIBRARIES := \
+	libpugixml.a
+
+LOCAL_LDFLAGS := -lpthread -luuid
+
+ifeq ($(shell echo $${OSTYPE}),linux-musl) 
+# For alpine linux
+LOCAL_LDFLAGS += -lexecinfo
+endif
+
+$(call add_pkg_config,srt)
+$(call add_pkg_config,libavformat)
+$(call add_pkg_config,libavfilter)
+$(call add_pkg_config,libavcodec)
+$(call add_pkg_config,libswresample)
+$(call add_pkg_config,libswscale)
+$(call add_pkg_config,libavutil)
+$(call add_pkg_config,openssl)
+$(call add_pkg_config,vpx)
+$(call add_pkg_config,opus)
+$(call add_pkg_config,libsrtp2)
+$(call add_pkg_config,libpcre2-8)
+$(call add_pkg_config,hiredis)
+
+# Enable Xilinx Media SDK
+ifeq ($(call chk_pkg_exist,libxma2api),0)
+$(call add_pkg_config,libxma2api)
+$(call add_pkg_config,libxma2plugin)
+$(call add_pkg_config,xvbm)
+$(call add_pkg_config,libxrm)
+endif
+
+LOCAL_TARGET := TranscoderBenchmark
+
+include $(BUILD_EXECUTABLE)
+
+endif
@@ -0,0 +1,330 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by agent
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "bwe_trace_replay.h"
+
+#include <fstream>
+
+#include "benchmark_private.h"
+
+// The timeline of the report has an entry per second
+#define TIMELINE_INTERVAL_US 1000000
+
+static std::vector<ov::String> Tokenize(const ov::String &line)
+{
+	std::vector<ov::String> tokens;
+
+	// Remove the comment
+	auto comment_index = line.IndexOf('#');
+	auto content = (comment_index >= 0) ? line.Substring(0, comment_index) : line;
+
+	for (auto &token : content.Trim().Split(" "))
+	{
+		if (token.IsEmpty() == false)
+		{
+			tokens.push_back(token);
+		}
+	}
+
+	return tokens;
+}
+
+bool BweTraceReplay::Run(const ov::String &trace_path)
+{
+	std::ifstream stream(trace_path.CStr());
+
+	if (stream.is_open() == false)
+	{
+		logte("Could not open the trace: %s", trace_path.CStr());
+		return false;
+	}
+
+	_trace_path = trace_path;
+
+	std::string line;
+	size_t line_number = 0;
+
+	while (std::getline(stream, line))
+	{
+		line_number++;
+
+		if (ProcessLine(line.c_str(), line_number) == false)
+		{
+			logte("Invalid line %zu of the trace: %s", line_number, line.c_str());
+			return false;
+		}
+	}
+
+	if (_estimator == nullptr)
+	{
+		logte("The trace has no init line: %s", trace_path.CStr());
+		return false;
+	}
+
+	return true;
+}
+
+bool BweTraceReplay::ProcessLine(const ov::String &line, size_t line_number)
+{
+	auto tokens = Tokenize(line);
+
+	if (tokens.empty())
+	{
+		return true;
+	}
+
+	auto &type = tokens[0];
+
+	if (type == "init")
+	{
+		if ((tokens.size() != 4) || (_estimator != nullptr))
+		{
+			return false;
+		}
+
+		_estimator = std::make_shared<SendSideBandwidthEstimator>(ov::Converter::ToInt64(tokens[1]), ov::Converter::ToInt64(tokens[2]), ov::Converter::ToInt64(tokens[3]));
+		_min_estimated_bitrate = _estimator->GetEstimatedBitrate();
+		_max_estimated_bitrate = _min_estimated_bitrate;
+
+		return true;
+	}
+
+	if (type == "rendition")
+	{
+		if (tokens.size() != 3)
+		{
+			return false;
+		}
+
+		_renditions.push_back({tokens[1], ov::Converter::ToInt64(tokens[2])});
+
+		return true;
+	}
+
+	if (_estimator == nullptr)
+	{
+		// The events must follow the init line
+		return false;
+	}
+
+	if (type == "expect")
+	{
+		return CheckExpectation(tokens, line_number);
+	}
+
+	if (tokens.size() < 3)
+	{
+		return false;
+	}
+
+	auto now_us = ov::Converter::ToInt64(tokens[1]);
+
+	if (type == "s")
+	{
+		if (tokens.size() != 4)
+		{
+			return false;
+		}
+
+		_estimator->OnPacketSent(static_cast<uint16_t>(ov::Converter::ToUInt32(tokens[2])), ov::Converter::ToUInt32(tokens[3]), now_us);
+		_sent_packet_count++;
+	}
+	else if (type == "f")
+	{
+		std::vector<SendSideBandwidthEstimator::PacketFeedback> feedbacks;
+
+		for (size_t index = 2; index < tokens.size(); index++)
+		{
+			auto values = tokens[index].Split(":");
+			if (values.size() != 2)
+			{
+				return false;
+			}
+
+			SendSideBandwidthEstimator::PacketFeedback feedback;
+			feedback.wide_sequence_number = static_cast<uint16_t>(ov::Converter::ToUInt32(values[0]));
+			feedback.received = (values[1] != "-");
+			feedback.receive_time_us = feedback.received ? ov::Converter::ToInt64(values[1]) : 0;
+
+			feedbacks.push_back(feedback);
+		}
+
+		_estimator->OnPacketFeedbacks(feedbacks, now_us);
+		_feedback_count++;
+	}
+	else if (type == "rr")
+	{
+		_estimator->OnReceiverReport(static_cast<uint8_t>(ov::Converter::ToUInt32(tokens[2])), now_us);
+		_receiver_report_count++;
+	}
+	else if (type == "remb")
+	{
+		_estimator->OnRemb(ov::Converter::ToInt64(tokens[2]), now_us);
+	}
+	else
+	{
+		return false;
+	}
+
+	OnEvent(now_us);
+
+	return true;
+}
+
+void BweTraceReplay::OnEvent(int64_t now_us)
+{
+	_last_event_us = now_us;
+
+	auto estimated_bitrate = _estimator->GetEstimatedBitrate();
+	_min_estimated_bitrate = std::min(_min_estimated_bitrate, estimated_bitrate);
+	_max_estimated_bitrate = std::max(_max_estimated_bitrate, estimated_bitrate);
+
+	while (static_cast<int64_t>(_timeline.size()) * TIMELINE_INTERVAL_US <= now_us)
+	{
+		_timeline.push_back(_estimator->GetStats());
+	}
+}
+
+bool BweTraceReplay::CheckExpectation(const std::vector<ov::String> &tokens, size_t line_number)
+{
+	if (tokens.size() < 3)
+	{
+		return false;
+	}
+
+	auto stats = _estimator->GetStats();
+	auto &name = tokens[1];
+	bool passed = false;
+	ov::String actual;
+
+	if ((name == "estimate") || (name == "overuse_count"))
+	{
+		if (tokens.size() != 4)
+		{
+			return false;
+		}
+
+		auto value = (name == "estimate") ? stats.estimated_bitrate : static_cast<int64_t>(stats.overuse_count);
+
+		passed = (value >= ov::Converter::ToInt64(tokens[2])) && (value <= ov::Converter::ToInt64(tokens[3]));
+		actual.Format("%lld", value);
+	}
+	else if (name == "state")
+	{
+		if (tokens.size() != 3)
+		{
+			return false;
+		}
+
+		actual = ov::String(SendSideBandwidthEstimator::StringFromDelayState(stats.delay_state)).LowerCaseString();
+		passed = (actual == tokens[2].LowerCaseString());
+	}
+	else if (name == "control")
+	{
+		if (tokens.size() != 3)
+		{
+			return false;
+		}
+
+		actual = ov::String(SendSideBandwidthEstimator::StringFromRateControlState(stats.rate_control_state)).LowerCaseString();
+		passed = (actual == tokens[2].LowerCaseString());
+	}
+	else if (name == "rendition")
+	{
+		if ((tokens.size() != 3) || _renditions.empty())
+		{
+			return false;
+		}
+
+		auto rendition = GetFittingRendition(stats.estimated_bitrate);
+		actual = rendition->name;
+		passed = (actual == tokens[2]);
+	}
+	else
+	{
+		return false;
+	}
+
+	_expectation_count++;
+
+	if (passed == false)
+	{
+		ov::String failure;
+
+		failure.Format("line %zu (%.3fs): expected %s %s, but %s (estimate: %lld)",
+					   line_number, _last_event_us / 1000000.0,
+					   name.CStr(), ov::String::Join(std::vector<ov::String>(tokens.begin() + 2, tokens.end()), " ").CStr(),
+					   actual.CStr(), stats.estimated_bitrate);
+
+		_failures.push_back(failure);
+	}
+
+	return true;
+}
+
+const BweTraceReplay::Rendition *BweTraceReplay::GetFittingRendition(int64_t estimated_bitrate) const
+{
+	const Rendition *lowest = nullptr;
+	const Rendition *fitting = nullptr;
+
+	for (auto &rendition : _renditions)
+	{
+		if ((lowest == nullptr) || (rendition.bitrate < lowest->bitrate))
+		{
+			lowest = &rendition;
+		}
+
+		if ((rendition.bitrate <= estimated_bitrate) && ((fitting == nullptr) || (rendition.bitrate > fitting->bitrate)))
+		{
+			fitting = &rendition;
+		}
+	}
+
+	return (fitting != nullptr) ? fitting : lowest;
+}
+
+ov::String BweTraceReplay::GetReportString() const
+{
+	ov::String report;
+
+	report.AppendFormat("Bandwidth estimator trace replay: %s\n", _trace_path.CStr());
+	report.AppendFormat("  Duration: %.3fs, Packets: %llu, Feedbacks: %llu, Receiver reports: %llu\n",
+						_last_event_us / 1000000.0, _sent_packet_count, _feedback_count, _receiver_report_count);
+
+	if (_estimator != nullptr)
+	{
+		auto stats = _estimator->GetStats();
+
+		report.AppendFormat("  Estimate: %lld (min: %lld, max: %lld), Overuses: %llu\n",
+							stats.estimated_bitrate, _min_estimated_bitrate, _max_estimated_bitrate, stats.overuse_count);
+	}
+
+	report.AppendFormat("\n  %6s %12s %12s %12s %12s %11s %9s %8s\n", "Time", "Estimate", "Delay-based", "Loss-based", "Acked", "Delay", "Control", "Lost");
+
+	for (size_t index = 0; index < _timeline.size(); index++)
+	{
+		auto &stats = _timeline[index];
+
+		report.AppendFormat("  %5zus %12lld %12lld %12lld %12lld %11s %9s %7.1f%%\n",
+							index, stats.estimated_bitrate, stats.delay_based_bitrate, stats.loss_based_bitrate, stats.acknowledged_bitrate,
+							SendSideBandwidthEstimator::StringFromDelayState(stats.delay_state),
+							SendSideBandwidthEstimator::StringFromRateControlState(stats.rate_control_state),
+							stats.fraction_lost * 100.0);
+	}
+
+	report.AppendFormat("\n  Expectations: %llu, Failed: %zu\n", _expectation_count, _failures.size());
+
+	for (auto &failure : _failures)
+	{
+		report.AppendFormat("  - FAILED %s\n", failure.CStr());
+	}
+
+	report.AppendFormat("  Result: %s\n", IsPassed() ? "PASSED" : "FAILED");
+
+	return report;
+}
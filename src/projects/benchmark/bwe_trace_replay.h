@@ -0,0 +1,80 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by agent
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+#include <modules/rtp_rtcp/send_side_bandwidth_estimator.h>
+
+#include <memory>
+#include <vector>
+
+// Replays a transport-cc trace through SendSideBandwidthEstimator, and checks the expectations in it
+//
+// The trace is a text file of events in the order they happened (times in microseconds, "#" starts a comment):
+//
+//   init <initial bitrate> <min bitrate> <max bitrate>
+//   rendition <name> <bitrate>                     (ABR ladder used by "expect ... rendition")
+//   s <send time> <wide sequence number> <bytes>   (packet sent)
+//   f <now> <wide sequence number>:<receive time or -> ...
+//                                                  (transport-cc feedback, "-" means not received)
+//   rr <now> <fraction lost (0~255)>               (receiver report)
+//   remb <now> <bitrate>
+//
+//   expect estimate <min> <max>                    (the estimate after the previous event)
+//   expect state <normal|overusing|underusing>
+//   expect control <hold|increase|decrease>        (state of the rate controller)
+//   expect overuse_count <min> <max>
+//   expect rendition <name>                        (the highest rendition that fits in the estimate)
+class BweTraceReplay
+{
+public:
+	bool Run(const ov::String &trace_path);
+
+	// Whether all expectations are met
+	bool IsPassed() const
+	{
+		return (_expectation_count > 0) && (_failures.empty());
+	}
+
+	ov::String GetReportString() const;
+
+private:
+	struct Rendition
+	{
+		ov::String name;
+		int64_t bitrate = 0;
+	};
+
+	bool ProcessLine(const ov::String &line, size_t line_number);
+	bool CheckExpectation(const std::vector<ov::String> &tokens, size_t line_number);
+
+	const Rendition *GetFittingRendition(int64_t estimated_bitrate) const;
+
+	// Called after each event to record the timeline
+	void OnEvent(int64_t now_us);
+
+	ov::String _trace_path;
+
+	std::shared_ptr<SendSideBandwidthEstimator> _estimator;
+	std::vector<Rendition> _renditions;
+
+	int64_t _last_event_us = 0;
+
+	uint64_t _sent_packet_count = 0;
+	uint64_t _feedback_count = 0;
+	uint64_t _receiver_report_count = 0;
+
+	// Estimate at every second of the trace
+	std::vector<SendSideBandwidthEstimator::Stats> _timeline;
+	int64_t _min_estimated_bitrate = 0;
+	int64_t _max_estimated_bitrate = 0;
+
+	uint64_t _expectation_count = 0;
+	std::vector<ov::String> _failures;
+};
@@ -0,0 +1,289 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by agent
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "ice_lookup_benchmark.h"
+
+#include <base/info/session.h>
+#include <base/ovsocket/socket_address_pair.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <random>
+#include <shared_mutex>
+#include <thread>
+
+#include "benchmark_private.h"
+
+// Interval of the writer to remove and add a session
+#define CHURN_INTERVAL_US 1000
+
+namespace
+{
+	struct SyntheticSession
+	{
+		uint32_t id;
+	};
+
+	// The tables of IcePort before ov::RcuHashMap
+	template <typename Tkey>
+	class LockedMapTable
+	{
+	public:
+		bool Insert(const Tkey &key, const std::shared_ptr<SyntheticSession> &session)
+		{
+			std::lock_guard<std::shared_mutex> lock_guard(_lock);
+			return _map.emplace(key, session).second;
+		}
+
+		bool Erase(const Tkey &key)
+		{
+			std::lock_guard<std::shared_mutex> lock_guard(_lock);
+			return _map.erase(key) > 0;
+		}
+
+		std::shared_ptr<SyntheticSession> Find(const Tkey &key)
+		{
+			std::shared_lock<std::shared_mutex> lock_guard(_lock);
+			auto item = _map.find(key);
+			if (item != _map.end())
+			{
+				return item->second;
+			}
+
+			return nullptr;
+		}
+
+	private:
+		std::shared_mutex _lock;
+		std::map<Tkey, std::shared_ptr<SyntheticSession>> _map;
+	};
+
+	template <typename Tkey, typename Tequal = std::equal_to<Tkey>>
+	class RcuTable
+	{
+	public:
+		bool Insert(const Tkey &key, const std::shared_ptr<SyntheticSession> &session)
+		{
+			return _map.Insert(key, session);
+		}
+
+		bool Erase(const Tkey &key)
+		{
+			return _map.Erase(key);
+		}
+
+		std::shared_ptr<SyntheticSession> Find(const Tkey &key)
+		{
+			std::shared_ptr<SyntheticSession> session;
+			_map.Find(key, &session);
+			return session;
+		}
+
+	private:
+		ov::RcuHashMap<Tkey, std::shared_ptr<SyntheticSession>, std::hash<Tkey>, Tequal> _map;
+	};
+
+	ov::SocketAddress CreateRandomAddress(std::mt19937 &random)
+	{
+		sockaddr_in address{};
+
+		address.sin_family = AF_INET;
+		address.sin_addr.s_addr = random();
+		address.sin_port = htons(1024 + (random() % 64512));
+
+		return ov::SocketAddress("", address);
+	}
+}  // namespace
+
+bool IceLookupBenchmark::Run(int session_count, double duration)
+{
+	if (session_count <= 0)
+	{
+		logte("Invalid session count: %d", session_count);
+		return false;
+	}
+
+	_session_count = session_count;
+	_duration = duration;
+	_results.clear();
+
+	std::mt19937 random(session_count);
+
+	// The local addresses are a few ports of the server, and the remote addresses are the clients
+	// (the duplicated keys, which are not likely, are ignored by the tables)
+	auto local_address = CreateRandomAddress(random);
+	std::vector<ov::SocketAddressPair> address_pairs;
+	std::vector<ov::String> ufrags;
+	std::vector<session_id_t> session_ids;
+
+	for (int index = 0; index < session_count; index++)
+	{
+		local_address.SetPort(10000 + (index % 4));
+		address_pairs.emplace_back(local_address, CreateRandomAddress(random));
+
+		ufrags.push_back(ov::Random::GenerateString(6));
+		session_ids.push_back(index);
+	}
+
+	std::vector<int> reader_counts = {1, 4};
+	int hardware_concurrency = std::thread::hardware_concurrency();
+	if (hardware_concurrency > 4)
+	{
+		reader_counts.push_back(hardware_concurrency);
+	}
+
+	for (auto reader_count : reader_counts)
+	{
+		Measure<LockedMapTable<ov::SocketAddressPair>>("Address pair", "std::map + std::shared_mutex", address_pairs, reader_count);
+		Measure<RcuTable<ov::SocketAddressPair, ov::SocketAddressPair::AddressEqual>>("Address pair", "ov::RcuHashMap", address_pairs, reader_count);
+
+		Measure<LockedMapTable<ov::String>>("Ufrag", "std::map + std::shared_mutex", ufrags, reader_count);
+		Measure<RcuTable<ov::String>>("Ufrag", "ov::RcuHashMap", ufrags, reader_count);
+
+		Measure<LockedMapTable<session_id_t>>("Session ID", "std::map + std::shared_mutex", session_ids, reader_count);
+		Measure<RcuTable<session_id_t>>("Session ID", "ov::RcuHashMap", session_ids, reader_count);
+	}
+
+	return true;
+}
+
+template <typename Ttable, typename Tkey>
+void IceLookupBenchmark::Measure(const ov::String &table_name, const ov::String &implementation, const std::vector<Tkey> &keys, int reader_count)
+{
+	Ttable table;
+
+	for (size_t index = 0; index < keys.size(); index++)
+	{
+		table.Insert(keys[index], std::make_shared<SyntheticSession>(SyntheticSession{static_cast<uint32_t>(index)}));
+	}
+
+	std::atomic<bool> stop{false};
+	std::atomic<uint64_t> total_lookups{0};
+	std::atomic<uint64_t> total_misses{0};
+	uint64_t churns = 0;
+
+	std::vector<std::thread> readers;
+
+	for (int reader_index = 0; reader_index < reader_count; reader_index++)
+	{
+		readers.emplace_back([&, reader_index]() {
+			// Each reader looks up the sessions in its own random order
+			std::vector<Tkey> order = keys;
+			std::mt19937 random(reader_index);
+			std::shuffle(order.begin(), order.end(), random);
+
+			uint64_t lookups = 0;
+			uint64_t misses = 0;
+
+			while (stop.load(std::memory_order_relaxed) == false)
+			{
+				for (auto &key : order)
+				{
+					auto session = table.Find(key);
+					if (session == nullptr)
+					{
+						misses++;
+					}
+				}
+
+				lookups += order.size();
+			}
+
+			total_lookups += lookups;
+			total_misses += misses;
+		});
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	auto end = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(_duration));
+	std::mt19937 random(0);
+
+	while (std::chrono::steady_clock::now() < end)
+	{
+		auto index = random() % keys.size();
+
+		table.Erase(keys[index]);
+		table.Insert(keys[index], std::make_shared<SyntheticSession>(SyntheticSession{static_cast<uint32_t>(index)}));
+		churns++;
+
+		std::this_thread::sleep_for(std::chrono::microseconds(CHURN_INTERVAL_US));
+	}
+
+	stop = true;
+
+	for (auto &reader : readers)
+	{
+		reader.join();
+	}
+
+	auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	Result result;
+	result.table = table_name;
+	result.implementation = implementation;
+	result.reader_count = reader_count;
+	result.lookups_per_second = static_cast<double>(total_lookups) / elapsed;
+	result.misses = total_misses;
+	result.churns = churns;
+
+	_results.push_back(result);
+}
+
+ov::String IceLookupBenchmark::GetReportString() const
+{
+	ov::String report;
+
+	report.AppendFormat("ICE session lookup benchmark (%d sessions, %.1fs per case, a session is removed/added every %dus)\n",
+						_session_count, _duration, CHURN_INTERVAL_US);
+
+	// Grouped by the table and the readers, in the order of the first result
+	std::vector<std::pair<ov::String, int>> groups;
+
+	for (auto &result : _results)
+	{
+		auto group = std::make_pair(result.table, result.reader_count);
+
+		if (std::find(groups.begin(), groups.end(), group) == groups.end())
+		{
+			groups.push_back(group);
+		}
+	}
+
+	for (auto &[table, reader_count] : groups)
+	{
+		double base_lookups_per_second = 0.0;
+
+		report.AppendFormat("\n\t%s (%d reader%s)\n", table.CStr(), reader_count, (reader_count > 1) ? "s" : "");
+
+		for (auto &result : _results)
+		{
+			if ((result.table != table) || (result.reader_count != reader_count))
+			{
+				continue;
+			}
+
+			report.AppendFormat("\t\t%-30s %10.2f Mlookups/s (misses: %" PRIu64 ", churns: %" PRIu64 ")",
+								result.implementation.CStr(), result.lookups_per_second / 1000000.0, result.misses, result.churns);
+
+			if (base_lookups_per_second > 0.0)
+			{
+				report.AppendFormat(" (%.2fx of std::map)", result.lookups_per_second / base_lookups_per_second);
+			}
+			else
+			{
+				base_lookups_per_second = result.lookups_per_second;
+			}
+
+			report.AppendFormat("\n");
+		}
+	}
+
+	return report;
+}
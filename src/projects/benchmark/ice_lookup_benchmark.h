@@ -0,0 +1,49 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by agent
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <vector>
+
+// Microbenchmarks of the session tables of IcePort
+//
+// The sessions of a synthetic table are looked up by the address pair, the ufrag and the session id
+// with std::map guarded by std::shared_mutex (the previous tables) and with ov::RcuHashMap.
+// The reader threads look up random sessions (as the packets are received/sent), while a writer thread
+// removes and adds a session every millisecond (as the clients come and go).
+class IceLookupBenchmark
+{
+public:
+	// session_count: Sessions in the table
+	// duration: seconds to measure each case
+	bool Run(int session_count, double duration);
+
+	ov::String GetReportString() const;
+
+private:
+	struct Result
+	{
+		ov::String table;
+		ov::String implementation;
+		int reader_count = 0;
+		// Lookups of all readers per second
+		double lookups_per_second = 0.0;
+		// Lookups that didn't find the session (being re-added by the writer)
+		uint64_t misses = 0;
+		uint64_t churns = 0;
+	};
+
+	template <typename Ttable, typename Tkey>
+	void Measure(const ov::String &table_name, const ov::String &implementation, const std::vector<Tkey> &keys, int reader_count);
+
+	int _session_count = 0;
+	double _duration = 1.0;
+	std::vector<Result> _results;
+};
@@ -0,0 +1,244 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by agent
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <getopt.h>
+#include <stdio.h>
+#include <transcoder/transcoder_executor.h>
+
+#include "benchmark_private.h"
+#include "bwe_trace_replay.h"
+#include "ice_lookup_benchmark.h"
+#include "pcm_benchmark.h"
+#include "transcoder_benchmark.h"
+
+extern "C"
+{
+#include <libavutil/log.h>
+}
+
+static void PrintUsage(const char *program)
+{
+	printf(
+		"Usage: %s [OPTION]...\n"
+		"Measures the throughput of the transcoder (decoder > filter > encoder) without network\n"
+		"\n"
+		"  -i <path>          Input file (H.264/H.265/VP8/AAC/OPUS). If omitted, synthetic frames are used\n"
+		"  -d <seconds>       Duration of the input to process (default: 30)\n"
+		"  -s <W>x<H>@<fps>   Synthetic video format (default: 1920x1080@30)\n"
+		"  -v <rendition>     Video rendition: <codec>:<width>x<height>:<bitrate>[:<framerate>]\n"
+		"                     (e.g. h264:1280x720:2m, h264_openh264:854x480:1000k:15, vp8:0x360:800k)\n"
+		"  -a <rendition>     Audio rendition: <codec>:<bitrate>[:<samplerate>[:<channel>]]\n"
+		"                     (e.g. aac:128k, opus:96k:48000:2)\n"
+		"  -x <count>         Run the codecs/filters on the shared transcoder executor with <count> threads\n"
+		"                     (default: each codec/filter has its own thread)\n"
+		"  -m                 Run the microbenchmarks of the PCM conversions (SIMD kernels vs libswresample) and exit\n"
+		"  -l <count>         Run the microbenchmarks of the ICE session lookups (std::map vs ov::RcuHashMap)\n"
+		"                     with <count> synthetic sessions and exit\n"
+		"  -b <path>          Replay a transport-cc trace through the bandwidth estimator, check the expectations\n"
+		"                     in it and exit (e.g. benchmark/traces/bwe_bottleneck.trace)\n"
+		"  -h                 Print this help\n"
+		"\n"
+		"-v and -a can be used multiple times. If no rendition is specified, the following are used:\n"
+		"  h264:1280x720:2m, h264:854x480:1m, vp8:1280x720:2m, aac:128k, opus:128k\n",
+		program);
+}
+
+static bool ParseSyntheticFormat(const ov::String &value, TranscoderBenchmark::Config *config)
+{
+	auto tokens = value.LowerCaseString().Split("@");
+	auto resolution = tokens[0].Split("x");
+
+	if ((tokens.size() > 2) || (resolution.size() != 2))
+	{
+		return false;
+	}
+
+	config->width = ov::Converter::ToInt32(resolution[0].CStr());
+	config->height = ov::Converter::ToInt32(resolution[1].CStr());
+
+	if (tokens.size() == 2)
+	{
+		config->framerate = ov::Converter::ToDouble(tokens[1].CStr());
+	}
+
+	return (config->width > 0) && (config->height > 0) && (config->framerate > 0.0);
+}
+
+int main(int argc, char *argv[])
+{
+	TranscoderBenchmark::Config config;
+	int executor_worker_count = 0;
+	bool pcm_benchmark = false;
+	int ice_lookup_session_count = 0;
+	ov::String bwe_trace_path;
+
+	int option;
+	while ((option = ::getopt(argc, argv, "i:d:s:v:a:x:ml:b:h")) != -1)
+	{
+		switch (option)
+		{
+			case 'i':
+				config.input_path = optarg;
+				break;
+
+			case 'd':
+				config.duration = ov::Converter::ToDouble(optarg);
+				if (config.duration <= 0.0)
+				{
+					fprintf(stderr, "Invalid duration: %s\n", optarg);
+					return 1;
+				}
+				break;
+
+			case 's':
+				if (ParseSyntheticFormat(optarg, &config) == false)
+				{
+					fprintf(stderr, "Invalid synthetic format: %s\n", optarg);
+					return 1;
+				}
+				break;
+
+			case 'v':
+			case 'a': {
+				TranscoderBenchmark::RenditionConfig rendition;
+				auto media_type = (option == 'v') ? cmn::MediaType::Video : cmn::MediaType::Audio;
+
+				if (TranscoderBenchmark::RenditionConfig::Parse(media_type, optarg, &rendition) == false)
+				{
+					fprintf(stderr, "Invalid %s rendition: %s\n", (option == 'v') ? "video" : "audio", optarg);
+					return 1;
+				}
+
+				config.renditions.push_back(rendition);
+				break;
+			}
+
+			case 'x':
+				executor_worker_count = ov::Converter::ToInt32(optarg);
+				if (executor_worker_count <= 0)
+				{
+					fprintf(stderr, "Invalid thread count: %s\n", optarg);
+					return 1;
+				}
+				break;
+
+			case 'm':
+				pcm_benchmark = true;
+				break;
+
+			case 'l':
+				ice_lookup_session_count = ov::Converter::ToInt32(optarg);
+				if (ice_lookup_session_count <= 0)
+				{
+					fprintf(stderr, "Invalid session count: %s\n", optarg);
+					return 1;
+				}
+				break;
+
+			case 'b':
+				bwe_trace_path = optarg;
+				break;
+
+			case 'h':
+				PrintUsage(argv[0]);
+				return 0;
+
+			default:
+				PrintUsage(argv[0]);
+				return 1;
+		}
+	}
+
+	if (config.renditions.empty())
+	{
+		const std::vector<std::pair<cmn::MediaType, const char *>> default_renditions = {
+			{cmn::MediaType::Video, "h264:1280x720:2000000"},
+			{cmn::MediaType::Video, "h264:854x480:1000000"},
+			{cmn::MediaType::Video, "vp8:1280x720:2000000"},
+			{cmn::MediaType::Audio, "aac:128000"},
+			{cmn::MediaType::Audio, "opus:128000"},
+		};
+
+		for (auto &[media_type, value] : default_renditions)
+		{
+			TranscoderBenchmark::RenditionConfig rendition;
+			TranscoderBenchmark::RenditionConfig::Parse(media_type, value, &rendition);
+			config.renditions.push_back(rendition);
+		}
+	}
+
+	// The logs of the codec libraries affect the result
+	::av_log_set_level(AV_LOG_ERROR);
+	ov_log_set_level(OVLogLevelInformation);
+
+	if (pcm_benchmark)
+	{
+		PcmBenchmark benchmark;
+
+		if (benchmark.Run(1.0) == false)
+		{
+			fprintf(stderr, "Failed to run the PCM benchmark\n");
+			return 1;
+		}
+
+		printf("%s", benchmark.GetReportString().CStr());
+
+		return 0;
+	}
+
+	if (bwe_trace_path.IsEmpty() == false)
+	{
+		BweTraceReplay replay;
+
+		if (replay.Run(bwe_trace_path) == false)
+		{
+			fprintf(stderr, "Failed to replay the trace: %s\n", bwe_trace_path.CStr());
+			return 1;
+		}
+
+		printf("%s", replay.GetReportString().CStr());
+
+		return replay.IsPassed() ? 0 : 1;
+	}
+
+	if (ice_lookup_session_count > 0)
+	{
+		IceLookupBenchmark benchmark;
+
+		if (benchmark.Run(ice_lookup_session_count, 1.0) == false)
+		{
+			fprintf(stderr, "Failed to run the ICE session lookup benchmark\n");
+			return 1;
+		}
+
+		printf("%s", benchmark.GetReportString().CStr());
+
+		return 0;
+	}
+
+	if ((executor_worker_count > 0) && (TranscoderExecutor::GetInstance()->Start(executor_worker_count) == false))
+	{
+		fprintf(stderr, "Could not start the transcoder executor\n");
+		return 1;
+	}
+
+	TranscoderBenchmark benchmark;
+	bool result = benchmark.Run(config);
+
+	TranscoderExecutor::GetInstance()->Stop();
+
+	if (result == false)
+	{
+		fprintf(stderr, "Failed to run the benchmark\n");
+		return 1;
+	}
+
+	printf("%s", benchmark.GetReportString().CStr());
+
+	return 0;
+}
@@ -0,0 +1,277 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by agent
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "pcm_benchmark.h"
+
+#include <math.h>
+#include <transcoder/filter/pcm_resampler.h>
+
+#include <algorithm>
+#include <chrono>
+
+#include "benchmark_private.h"
+
+extern "C"
+{
+#include <libavutil/channel_layout.h>
+#include <libavutil/opt.h>
+#include <libswresample/swresample.h>
+}
+
+#define FRAME_SAMPLES 1024
+
+namespace
+{
+	struct SwrConversion
+	{
+		int64_t input_layout;
+		AVSampleFormat input_format;
+		int input_rate;
+
+		int64_t output_layout;
+		AVSampleFormat output_format;
+		int output_rate;
+	};
+
+	SwrContext *CreateSwrContext(const SwrConversion &conversion)
+	{
+		SwrContext *context = ::swr_alloc_set_opts(nullptr,
+												   conversion.output_layout, conversion.output_format, conversion.output_rate,
+												   conversion.input_layout, conversion.input_format, conversion.input_rate,
+												   0, nullptr);
+
+		if ((context != nullptr) && (::swr_init(context) < 0))
+		{
+			::swr_free(&context);
+		}
+
+		return context;
+	}
+}  // namespace
+
+bool PcmBenchmark::Run(double duration)
+{
+	_duration = duration;
+	_results.clear();
+
+	// 440Hz (left), 660Hz (right)
+	std::vector<float> left(FRAME_SAMPLES), right(FRAME_SAMPLES), interleaved(FRAME_SAMPLES * 2);
+	std::vector<int16_t> interleaved_s16(FRAME_SAMPLES * 2);
+
+	for (int index = 0; index < FRAME_SAMPLES; index++)
+	{
+		left[index] = static_cast<float>(0.5 * ::sin(2.0 * M_PI * 440.0 * index / 48000.0));
+		right[index] = static_cast<float>(0.5 * ::sin(2.0 * M_PI * 660.0 * index / 48000.0));
+		interleaved[index * 2] = left[index];
+		interleaved[index * 2 + 1] = right[index];
+		interleaved_s16[index * 2] = static_cast<int16_t>(left[index] * 32767.0f);
+		interleaved_s16[index * 2 + 1] = static_cast<int16_t>(right[index] * 32767.0f);
+	}
+
+	// Large enough for the output of the resamplers
+	std::vector<float> output_left(FRAME_SAMPLES * 2), output_right(FRAME_SAMPLES * 2), output_interleaved(FRAME_SAMPLES * 4);
+	std::vector<int16_t> output_s16(FRAME_SAMPLES * 4);
+
+	auto original_level = ov::pcm::GetSimdLevel();
+	auto supported_level = ov::pcm::GetSupportedSimdLevel();
+
+	for (auto level : {ov::PcmSimdLevel::Scalar, ov::PcmSimdLevel::Sse4, ov::PcmSimdLevel::Avx2})
+	{
+		if (level > supported_level)
+		{
+			break;
+		}
+
+		ov::pcm::SetSimdLevel(level);
+		ov::String implementation = ov::String::FormatString("ov::pcm (%s)", ov::pcm::StringFromSimdLevel(level));
+
+		Measure("FLTP > S16 (stereo)", implementation, FRAME_SAMPLES, [&]() {
+			ov::pcm::InterleaveStereoToS16(output_s16.data(), left.data(), right.data(), FRAME_SAMPLES);
+		});
+
+		Measure("S16 > FLTP (stereo)", implementation, FRAME_SAMPLES, [&]() {
+			ov::pcm::DeinterleaveStereoFromS16(output_left.data(), output_right.data(), interleaved_s16.data(), FRAME_SAMPLES);
+		});
+
+		Measure("FLTP > FLT (stereo)", implementation, FRAME_SAMPLES, [&]() {
+			ov::pcm::InterleaveStereo(output_interleaved.data(), left.data(), right.data(), FRAME_SAMPLES);
+		});
+
+		Measure("FLT > FLTP (stereo)", implementation, FRAME_SAMPLES, [&]() {
+			ov::pcm::DeinterleaveStereo(output_left.data(), output_right.data(), interleaved.data(), FRAME_SAMPLES);
+		});
+
+		Measure("Stereo > Mono (FLTP)", implementation, FRAME_SAMPLES, [&]() {
+			ov::pcm::DownmixStereo(output_left.data(), left.data(), right.data(), FRAME_SAMPLES);
+		});
+
+		for (auto rates : {std::pair<int, int>(44100, 48000), std::pair<int, int>(48000, 44100)})
+		{
+			PcmResampler resampler;
+			std::vector<float> outputs[PcmResampler::MAX_CHANNELS];
+			const float *inputs[] = {left.data(), right.data()};
+
+			resampler.Configure(rates.first, rates.second, 2);
+
+			Measure(ov::String::FormatString("Resample %d > %d (FLTP stereo)", rates.first, rates.second), implementation, FRAME_SAMPLES, [&]() {
+				outputs[0].clear();
+				outputs[1].clear();
+				resampler.Process(inputs, FRAME_SAMPLES, outputs);
+			});
+		}
+	}
+
+	ov::pcm::SetSimdLevel(original_level);
+
+	// libswresample
+	struct SwrCase
+	{
+		ov::String name;
+		SwrConversion conversion;
+		bool planar_input;
+	};
+
+	std::vector<SwrCase> swr_cases = {
+		{"FLTP > S16 (stereo)", {AV_CH_LAYOUT_STEREO, AV_SAMPLE_FMT_FLTP, 48000, AV_CH_LAYOUT_STEREO, AV_SAMPLE_FMT_S16, 48000}, true},
+		{"S16 > FLTP (stereo)", {AV_CH_LAYOUT_STEREO, AV_SAMPLE_FMT_S16, 48000, AV_CH_LAYOUT_STEREO, AV_SAMPLE_FMT_FLTP, 48000}, false},
+		{"FLTP > FLT (stereo)", {AV_CH_LAYOUT_STEREO, AV_SAMPLE_FMT_FLTP, 48000, AV_CH_LAYOUT_STEREO, AV_SAMPLE_FMT_FLT, 48000}, true},
+		{"FLT > FLTP (stereo)", {AV_CH_LAYOUT_STEREO, AV_SAMPLE_FMT_FLT, 48000, AV_CH_LAYOUT_STEREO, AV_SAMPLE_FMT_FLTP, 48000}, false},
+		{"Stereo > Mono (FLTP)", {AV_CH_LAYOUT_STEREO, AV_SAMPLE_FMT_FLTP, 48000, AV_CH_LAYOUT_MONO, AV_SAMPLE_FMT_FLTP, 48000}, true},
+		{"Resample 44100 > 48000 (FLTP stereo)", {AV_CH_LAYOUT_STEREO, AV_SAMPLE_FMT_FLTP, 44100, AV_CH_LAYOUT_STEREO, AV_SAMPLE_FMT_FLTP, 48000}, true},
+		{"Resample 48000 > 44100 (FLTP stereo)", {AV_CH_LAYOUT_STEREO, AV_SAMPLE_FMT_FLTP, 48000, AV_CH_LAYOUT_STEREO, AV_SAMPLE_FMT_FLTP, 44100}, true},
+	};
+
+	for (auto &swr_case : swr_cases)
+	{
+		SwrContext *context = CreateSwrContext(swr_case.conversion);
+		if (context == nullptr)
+		{
+			logte("Could not create the context of libswresample for %s", swr_case.name.CStr());
+			return false;
+		}
+
+		const uint8_t *inputs[2];
+		uint8_t *outputs[2];
+
+		if (swr_case.planar_input)
+		{
+			inputs[0] = reinterpret_cast<const uint8_t *>(left.data());
+			inputs[1] = reinterpret_cast<const uint8_t *>(right.data());
+		}
+		else
+		{
+			inputs[0] = (swr_case.conversion.input_format == AV_SAMPLE_FMT_S16) ? reinterpret_cast<const uint8_t *>(interleaved_s16.data()) : reinterpret_cast<const uint8_t *>(interleaved.data());
+			inputs[1] = nullptr;
+		}
+
+		if (::av_sample_fmt_is_planar(swr_case.conversion.output_format))
+		{
+			outputs[0] = reinterpret_cast<uint8_t *>(output_left.data());
+			outputs[1] = reinterpret_cast<uint8_t *>(output_right.data());
+		}
+		else
+		{
+			outputs[0] = (swr_case.conversion.output_format == AV_SAMPLE_FMT_S16) ? reinterpret_cast<uint8_t *>(output_s16.data()) : reinterpret_cast<uint8_t *>(output_interleaved.data());
+			outputs[1] = nullptr;
+		}
+
+		Measure(swr_case.name, "libswresample", FRAME_SAMPLES, [&]() {
+			::swr_convert(context, outputs, FRAME_SAMPLES * 2, inputs, FRAME_SAMPLES);
+		});
+
+		::swr_free(&context);
+	}
+
+	return true;
+}
+
+void PcmBenchmark::Measure(const ov::String &name, const ov::String &implementation, int samples_per_call, const std::function<void()> &function)
+{
+	// Warm up (caches, the history of the resamplers)
+	for (int count = 0; count < 16; count++)
+	{
+		function();
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	auto end = start;
+	int64_t calls = 0;
+	double elapsed = 0.0;
+
+	while (elapsed < _duration)
+	{
+		for (int count = 0; count < 64; count++)
+		{
+			function();
+		}
+
+		calls += 64;
+		end = std::chrono::steady_clock::now();
+		elapsed = std::chrono::duration<double>(end - start).count();
+	}
+
+	Result result;
+	result.name = name;
+	result.implementation = implementation;
+	result.samples_per_second = static_cast<double>(calls) * samples_per_call / elapsed;
+
+	_results.push_back(result);
+}
+
+ov::String PcmBenchmark::GetReportString() const
+{
+	ov::String report;
+
+	report.AppendFormat("PCM benchmark (frames of %d stereo samples, %.1fs per case, SIMD level in use: %s)\n",
+						FRAME_SAMPLES, _duration, ov::pcm::StringFromSimdLevel(ov::pcm::GetSimdLevel()));
+
+	// Grouped by the conversion, in the order of the first result
+	std::vector<ov::String> names;
+
+	for (auto &result : _results)
+	{
+		if (std::find(names.begin(), names.end(), result.name) == names.end())
+		{
+			names.push_back(result.name);
+		}
+	}
+
+	for (auto &name : names)
+	{
+		double swr_samples_per_second = 0.0;
+
+		for (auto &result : _results)
+		{
+			if ((result.name == name) && (result.implementation == "libswresample"))
+			{
+				swr_samples_per_second = result.samples_per_second;
+			}
+		}
+
+		report.AppendFormat("\n\t%s\n", name.CStr());
+
+		for (auto &result : _results)
+		{
+			if (result.name != name)
+			{
+				continue;
+			}
+
+			report.AppendFormat("\t\t%-24s %10.1f Msamples/s", result.implementation.CStr(), result.samples_per_second / 1000000.0);
+
+			if (swr_samples_per_second > 0.0)
+			{
+				report.AppendFormat(" (%.2fx of libswresample)", result.samples_per_second / swr_samples_per_second);
+			}
+
+			report.AppendFormat("\n");
+		}
+	}
+
+	return report;
+}
@@ -0,0 +1,41 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by agent
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <functional>
+#include <vector>
+
+// Microbenchmarks of the PCM conversions used by the audio transcoding
+//
+// Each conversion is measured with the kernels of ov::pcm (every SIMD level supported by the CPU)
+// and with libswresample, using stereo frames of 1024 samples.
+class PcmBenchmark
+{
+public:
+	// duration: seconds to measure each case
+	bool Run(double duration);
+
+	ov::String GetReportString() const;
+
+private:
+	struct Result
+	{
+		ov::String name;
+		ov::String implementation;
+		// Samples (of a channel) per second
+		double samples_per_second = 0.0;
+	};
+
+	void Measure(const ov::String &name, const ov::String &implementation, int samples_per_call, const std::function<void()> &function);
+
+	double _duration = 1.0;
+	std::vector<Result> _results;
+};
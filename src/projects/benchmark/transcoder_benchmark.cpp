@@ -0,0 +1,1246 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by agent
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "transcoder_benchmark.h"
+
+#include <base/info/application.h>
+#include <modules/bitstream/aac/aac_converter.h>
+#include <modules/bitstream/aac/audio_specific_config.h>
+#include <modules/ffmpeg/ffmpeg_conv.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <thread>
+
+#include "benchmark_private.h"
+
+// The input is not read ahead more than this from the slowest rendition
+#define MAX_BUFFERED_TIME_US (2 * 1000 * 1000)
+// If the renditions don't make any progress for this time, the benchmark is aborted
+#define STALL_TIMEOUT_MS 10000
+// Used to wait for the last frames at the end of the input
+#define DRAIN_BUFFERED_TIME_US (500 * 1000)
+#define DRAIN_TIMEOUT_MS 3000
+
+#define SYNTHETIC_VIDEO_TRACK_ID 0
+#define SYNTHETIC_AUDIO_TRACK_ID 1
+#define SYNTHETIC_AUDIO_SAMPLES 1024
+
+namespace
+{
+	int64_t NowUSec()
+	{
+		return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	// Supports k/m suffixes (e.g. 2.5m, 128k)
+	bool ParseBitrate(ov::String value, int32_t *bitrate)
+	{
+		value.MakeLower();
+
+		double multiplier = 1.0;
+		if (value.HasSuffix("k"))
+		{
+			multiplier = 1000.0;
+		}
+		else if (value.HasSuffix("m"))
+		{
+			multiplier = 1000.0 * 1000.0;
+		}
+
+		if (multiplier > 1.0)
+		{
+			value = value.Left(value.GetLength() - 1);
+		}
+
+		auto number = ov::Converter::ToDouble(value.CStr());
+		if (number <= 0.0)
+		{
+			return false;
+		}
+
+		*bitrate = static_cast<int32_t>(number * multiplier);
+
+		return true;
+	}
+
+	double ToSeconds(int64_t value, double unit)
+	{
+		return static_cast<double>(value) / unit;
+	}
+}  // namespace
+
+//--------------------------------------------------------------------
+// RenditionConfig
+//--------------------------------------------------------------------
+bool TranscoderBenchmark::RenditionConfig::Parse(cmn::MediaType media_type, const ov::String &value, RenditionConfig *config)
+{
+	auto tokens = value.Split(":");
+
+	config->media_type = media_type;
+
+	if (tokens.size() < 2)
+	{
+		return false;
+	}
+
+	config->codec = tokens[0];
+
+	auto codec_id = cmn::GetCodecIdByName(config->codec);
+
+	switch (media_type)
+	{
+		case cmn::MediaType::Video: {
+			if ((cmn::IsVideoCodec(codec_id) == false) || (tokens.size() < 3) || (tokens.size() > 4))
+			{
+				return false;
+			}
+
+			auto resolution = tokens[1].LowerCaseString().Split("x");
+			if (resolution.size() != 2)
+			{
+				return false;
+			}
+
+			config->width = ov::Converter::ToInt32(resolution[0].CStr());
+			config->height = ov::Converter::ToInt32(resolution[1].CStr());
+
+			if ((config->width < 0) || (config->height < 0) || (ParseBitrate(tokens[2], &config->bitrate) == false))
+			{
+				return false;
+			}
+
+			if (tokens.size() == 4)
+			{
+				config->framerate = ov::Converter::ToDouble(tokens[3].CStr());
+			}
+
+			return (config->framerate >= 0.0);
+		}
+
+		case cmn::MediaType::Audio: {
+			if ((cmn::IsAudioCodec(codec_id) == false) || (tokens.size() > 4))
+			{
+				return false;
+			}
+
+			if (ParseBitrate(tokens[1], &config->bitrate) == false)
+			{
+				return false;
+			}
+
+			if (tokens.size() >= 3)
+			{
+				config->samplerate = ov::Converter::ToInt32(tokens[2].CStr());
+			}
+
+			if (tokens.size() == 4)
+			{
+				config->channel = ov::Converter::ToInt32(tokens[3].CStr());
+			}
+
+			return (config->samplerate >= 0) && (config->channel >= 0) && (config->channel <= 2);
+		}
+
+		default:
+			break;
+	}
+
+	return false;
+}
+
+ov::String TranscoderBenchmark::RenditionConfig::ToString() const
+{
+	if (media_type == cmn::MediaType::Video)
+	{
+		return ov::String::FormatString("%s %dx%d %.0fkbps%s",
+										codec.CStr(), width, height, bitrate / 1000.0,
+										(framerate > 0.0) ? ov::String::FormatString(" %.2ffps", framerate).CStr() : "");
+	}
+
+	return ov::String::FormatString("%s %.0fkbps%s%s",
+									codec.CStr(), bitrate / 1000.0,
+									(samplerate > 0) ? ov::String::FormatString(" %dHz", samplerate).CStr() : "",
+									(channel > 0) ? ov::String::FormatString(" %dch", channel).CStr() : "");
+}
+
+//--------------------------------------------------------------------
+// LatencyStats
+//--------------------------------------------------------------------
+void TranscoderBenchmark::LatencyStats::Add(int64_t latency)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	_latencies.push_back(latency);
+	_sorted = false;
+}
+
+size_t TranscoderBenchmark::LatencyStats::GetCount() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	return _latencies.size();
+}
+
+int64_t TranscoderBenchmark::LatencyStats::GetPercentile(double percentile) const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	if (_latencies.empty())
+	{
+		return 0LL;
+	}
+
+	if (_sorted == false)
+	{
+		std::sort(_latencies.begin(), _latencies.end());
+		_sorted = true;
+	}
+
+	auto index = static_cast<size_t>(std::ceil(percentile / 100.0 * _latencies.size()));
+	index = std::clamp<size_t>(index, 1, _latencies.size()) - 1;
+
+	return _latencies[index];
+}
+
+ov::String TranscoderBenchmark::LatencyStats::ToString() const
+{
+	if (GetCount() == 0)
+	{
+		return "N/A";
+	}
+
+	return ov::String::FormatString("p50: %.2f, p90: %.2f, p99: %.2f, max: %.2f (ms)",
+									ToSeconds(GetPercentile(50.0), 1000.0),
+									ToSeconds(GetPercentile(90.0), 1000.0),
+									ToSeconds(GetPercentile(99.0), 1000.0),
+									ToSeconds(GetPercentile(100.0), 1000.0));
+}
+
+//--------------------------------------------------------------------
+// PendingTimes
+//--------------------------------------------------------------------
+void TranscoderBenchmark::PendingTimes::Push(int64_t timestamp, int64_t time)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	_times.emplace(timestamp, time);
+}
+
+bool TranscoderBenchmark::PendingTimes::Pop(int64_t timestamp, int64_t *time)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	auto it = _times.upper_bound(timestamp);
+	if (it == _times.begin())
+	{
+		return false;
+	}
+
+	--it;
+	*time = it->second;
+
+	// The matched input is kept, since the next output can be made from the same input (resampler)
+	_times.erase(_times.begin(), it);
+
+	return true;
+}
+
+//--------------------------------------------------------------------
+// TranscoderBenchmark
+//--------------------------------------------------------------------
+TranscoderBenchmark::~TranscoderBenchmark()
+{
+	Stop();
+}
+
+bool TranscoderBenchmark::Run(const Config &config)
+{
+	_config = config;
+
+	_input_stream = std::make_shared<info::Stream>(info::Application::GetInvalidApplication(), StreamSourceType::File);
+	_input_stream->SetName("benchmark");
+
+	_output_stream = std::make_shared<info::Stream>(info::Application::GetInvalidApplication(), StreamSourceType::Transcoder);
+	_output_stream->SetName("benchmark_output");
+	_output_stream->LinkInputStream(_input_stream);
+
+	bool synthetic = _config.input_path.IsEmpty();
+
+	if (synthetic)
+	{
+		if (CreateSyntheticSources() == false)
+		{
+			return false;
+		}
+	}
+	else if ((OpenFile() == false) || (CreateDecoders() == false))
+	{
+		Stop();
+		return false;
+	}
+
+	if (CreateRenditions() == false)
+	{
+		Stop();
+		return false;
+	}
+
+	::getrusage(RUSAGE_SELF, &_start_usage);
+	_elapsed.Start();
+
+	auto max_duration = static_cast<int64_t>(_config.duration * 1000000.0);
+
+	while (true)
+	{
+		bool has_more = synthetic ? FeedSynthetic() : FeedFile();
+		if (has_more == false)
+		{
+			break;
+		}
+
+		if ((_first_timestamp >= 0) && ((_last_timestamp - _first_timestamp) >= max_duration))
+		{
+			break;
+		}
+
+		if (WaitForRenditions(_last_timestamp, MAX_BUFFERED_TIME_US, STALL_TIMEOUT_MS) == false)
+		{
+			Stop();
+			return false;
+		}
+	}
+
+	// The encoders may keep some frames (they are not flushed), so it doesn't wait for the exact end
+	if (WaitForRenditions(_last_timestamp, DRAIN_BUFFERED_TIME_US, DRAIN_TIMEOUT_MS) == false)
+	{
+		logtw("Some renditions did not process the last frames of the input");
+	}
+
+	_elapsed_msec = _elapsed.Elapsed();
+	::getrusage(RUSAGE_SELF, &_end_usage);
+
+	long rss_pages = 0;
+	auto statm = ::fopen("/proc/self/statm", "r");
+	if (statm != nullptr)
+	{
+		if (::fscanf(statm, "%*ld %ld", &rss_pages) != 1)
+		{
+			rss_pages = 0;
+		}
+		::fclose(statm);
+	}
+	_rss = static_cast<int64_t>(rss_pages) * ::sysconf(_SC_PAGESIZE);
+
+	for (auto &[track_id, source] : _sources)
+	{
+		if (source->frame_pool != nullptr)
+		{
+			_frame_pool_stats.AppendFormat("%sTrack(%d) %s", _frame_pool_stats.IsEmpty() ? "" : ", ", track_id, source->frame_pool->GetStatsString().CStr());
+		}
+	}
+
+	Stop();
+
+	return true;
+}
+
+bool TranscoderBenchmark::OpenFile()
+{
+	int err = ::avformat_open_input(&_format_context, _config.input_path.CStr(), nullptr, nullptr);
+	if (err < 0)
+	{
+		logte("Could not open the input file: %s (%s)", _config.input_path.CStr(), ffmpeg::Conv::AVErrorToString(err).CStr());
+		return false;
+	}
+
+	if (::avformat_find_stream_info(_format_context, nullptr) < 0)
+	{
+		logte("Could not find stream information: %s", _config.input_path.CStr());
+		return false;
+	}
+
+	for (uint32_t index = 0; index < _format_context->nb_streams; index++)
+	{
+		auto stream = _format_context->streams[index];
+
+		auto track = std::make_shared<MediaTrack>();
+		if (ffmpeg::Conv::ToMediaTrack(stream, track) == false)
+		{
+			continue;
+		}
+
+		// Only the first track of each media type is used
+		if (_input_stream->GetFirstTrackByType(track->GetMediaType()) != nullptr)
+		{
+			continue;
+		}
+
+		auto source = std::make_shared<Source>();
+		source->track = track;
+
+		const char *bsf_name = nullptr;
+		bool has_extradata = (stream->codecpar->extradata != nullptr) && (stream->codecpar->extradata_size > 0);
+
+		switch (track->GetCodecId())
+		{
+			case cmn::MediaCodecId::H264:
+				// The decoders accept Annex B only (AVCDecoderConfigurationRecord starts with 1)
+				bsf_name = (has_extradata && (stream->codecpar->extradata[0] == 1)) ? "h264_mp4toannexb" : nullptr;
+				break;
+
+			case cmn::MediaCodecId::H265:
+				bsf_name = (has_extradata && (stream->codecpar->extradata[0] == 1)) ? "hevc_mp4toannexb" : nullptr;
+				break;
+
+			case cmn::MediaCodecId::Aac:
+				// Raw AAC is converted to ADTS (it has AudioSpecificConfig in the extradata)
+				if (has_extradata)
+				{
+					source->aac_config = std::make_shared<AudioSpecificConfig>();
+					if (source->aac_config->Parse(std::make_shared<ov::Data>(stream->codecpar->extradata, stream->codecpar->extradata_size)) == false)
+					{
+						logte("Could not parse AudioSpecificConfig of the track %d", track->GetId());
+						return false;
+					}
+				}
+				break;
+
+			case cmn::MediaCodecId::Vp8:
+			case cmn::MediaCodecId::Opus:
+				break;
+
+			default:
+				logtw("The track %d is ignored (%s is not supported by the decoders)", track->GetId(), ::avcodec_get_name(stream->codecpar->codec_id));
+				continue;
+		}
+
+		if (bsf_name != nullptr)
+		{
+			auto bsf = ::av_bsf_get_by_name(bsf_name);
+
+			if ((bsf == nullptr) || (::av_bsf_alloc(bsf, &source->bsf_context) < 0) ||
+				(::avcodec_parameters_copy(source->bsf_context->par_in, stream->codecpar) < 0))
+			{
+				logte("Could not create the bitstream filter: %s", bsf_name);
+				return false;
+			}
+
+			source->bsf_context->time_base_in = stream->time_base;
+
+			if (::av_bsf_init(source->bsf_context) < 0)
+			{
+				logte("Could not initialize the bitstream filter: %s", bsf_name);
+				return false;
+			}
+		}
+
+		track->SetHardwareAccel(false);
+
+		_input_stream->AddTrack(track);
+		_sources[track->GetId()] = source;
+
+		logti("Input track: %s", track->GetInfoString().CStr());
+	}
+
+	if (_sources.empty())
+	{
+		logte("There is no track to transcode in the input file: %s", _config.input_path.CStr());
+		return false;
+	}
+
+	return true;
+}
+
+bool TranscoderBenchmark::CreateSyntheticSources()
+{
+	if ((_config.width > 0) && (_config.height > 0) && (_config.framerate > 0.0))
+	{
+		auto track = std::make_shared<MediaTrack>();
+
+		track->SetId(SYNTHETIC_VIDEO_TRACK_ID);
+		track->SetMediaType(cmn::MediaType::Video);
+		track->SetCodecId(cmn::MediaCodecId::H264);
+		track->SetCodecLibraryId(cmn::MediaCodecLibraryId::DEFAULT);
+		track->SetHardwareAccel(false);
+		track->SetWidth(_config.width);
+		track->SetHeight(_config.height);
+		track->SetColorspace(AV_PIX_FMT_YUV420P);
+		track->SetFrameRateByConfig(_config.framerate);
+		track->SetTimeBase(1, 90000);
+
+		auto source = std::make_shared<Source>();
+		source->track = track;
+
+		_input_stream->AddTrack(track);
+		_sources[track->GetId()] = source;
+	}
+
+	if (_config.samplerate > 0)
+	{
+		auto track = std::make_shared<MediaTrack>();
+
+		track->SetId(SYNTHETIC_AUDIO_TRACK_ID);
+		track->SetMediaType(cmn::MediaType::Audio);
+		track->SetCodecId(cmn::MediaCodecId::Aac);
+		track->SetSampleRate(_config.samplerate);
+		track->GetChannel().SetLayout(cmn::AudioChannel::Layout::LayoutStereo);
+		track->GetSample().SetFormat(cmn::AudioSample::Format::FltP);
+		track->SetTimeBase(1, _config.samplerate);
+
+		auto source = std::make_shared<Source>();
+		source->track = track;
+
+		_input_stream->AddTrack(track);
+		_sources[track->GetId()] = source;
+	}
+
+	return (_sources.empty() == false);
+}
+
+bool TranscoderBenchmark::CreateDecoders()
+{
+	for (auto &[track_id, source] : _sources)
+	{
+		if (source->track->GetMediaType() == cmn::MediaType::Video)
+		{
+			source->frame_pool = std::make_shared<TranscodeFramePool>();
+		}
+
+		source->decoder = TranscodeDecoder::Create(track_id, *_input_stream, source->track, source->frame_pool,
+												   bind(&TranscoderBenchmark::OnDecodedFrame, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
+		if (source->decoder == nullptr)
+		{
+			logte("Could not create the decoder of the track %d", track_id);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool TranscoderBenchmark::CreateRenditions()
+{
+	int32_t rendition_id = 0;
+
+	for (auto &rendition_config : _config.renditions)
+	{
+		std::shared_ptr<Source> source;
+
+		for (auto &[track_id, candidate] : _sources)
+		{
+			if (candidate->track->GetMediaType() == rendition_config.media_type)
+			{
+				source = candidate;
+				break;
+			}
+		}
+
+		if (source == nullptr)
+		{
+			logtw("The rendition is ignored since the input has no %s track: %s", cmn::GetMediaTypeString(rendition_config.media_type).CStr(), rendition_config.ToString().CStr());
+			continue;
+		}
+
+		auto output_track = std::make_shared<MediaTrack>();
+
+		output_track->SetId(rendition_id);
+		output_track->SetMediaType(rendition_config.media_type);
+		output_track->SetVariantName(ov::String::FormatString("rendition_%d", rendition_id));
+		output_track->SetCodecId(cmn::GetCodecIdByName(rendition_config.codec));
+		output_track->SetCodecLibraryId(cmn::GetCodecLibraryIdByName(rendition_config.codec));
+		output_track->SetBitrateByConfig(rendition_config.bitrate);
+		output_track->SetBypass(false);
+
+		if (rendition_config.media_type == cmn::MediaType::Video)
+		{
+			output_track->SetHardwareAccel(false);
+			output_track->SetWidth(rendition_config.width);
+			output_track->SetHeight(rendition_config.height);
+			output_track->SetTimeBase(1, 90000);
+			output_track->SetThreadCount(-1);
+
+			if (rendition_config.framerate > 0.0)
+			{
+				output_track->SetFrameRateByConfig(rendition_config.framerate);
+			}
+		}
+		else
+		{
+			int32_t samplerate = rendition_config.samplerate;
+
+			if ((output_track->GetCodecId() == cmn::MediaCodecId::Opus) && (samplerate != 48000))
+			{
+				// OPUS codec only supports 48000Hz samplerate
+				samplerate = 48000;
+			}
+
+			output_track->SetSampleRate(samplerate);
+			if (samplerate > 0)
+			{
+				output_track->SetTimeBase(1, samplerate);
+			}
+
+			if (rendition_config.channel > 0)
+			{
+				output_track->GetChannel().SetLayout((rendition_config.channel == 1) ? cmn::AudioChannel::Layout::LayoutMono : cmn::AudioChannel::Layout::LayoutStereo);
+			}
+		}
+
+		auto rendition = std::make_shared<Rendition>();
+
+		rendition->id = rendition_id;
+		rendition->config = rendition_config;
+		rendition->source = source;
+		rendition->output_track = output_track;
+
+		_output_stream->AddTrack(output_track);
+		_renditions[rendition_id] = rendition;
+		source->renditions.push_back(rendition);
+
+		rendition_id++;
+	}
+
+	if (_renditions.empty())
+	{
+		logte("There is no rendition to benchmark");
+		return false;
+	}
+
+	return true;
+}
+
+// Same as TranscoderStream::ChangeOutputFormat()
+void TranscoderBenchmark::ChangeOutputFormat(const std::shared_ptr<Source> &source, const MediaFrame *frame)
+{
+	auto &input_track = source->track;
+
+	// Update the input track from the decoded frame
+	if (input_track->GetMediaType() == cmn::MediaType::Video)
+	{
+		input_track->SetWidth(frame->GetWidth());
+		input_track->SetHeight(frame->GetHeight());
+		input_track->SetColorspace(frame->GetFormat());
+	}
+	else
+	{
+		auto channels = const_cast<MediaFrame *>(frame)->GetChannels();
+
+		input_track->SetSampleRate(frame->GetSampleRate());
+		input_track->SetChannel(channels);
+		input_track->GetSample().SetFormat(ffmpeg::Conv::ToAudioSampleFormat(frame->GetFormat()));
+	}
+
+	for (auto &rendition : source->renditions)
+	{
+		auto &output_track = rendition->output_track;
+
+		if (rendition->encoder == nullptr)
+		{
+			// Fill the output track with the format of the input
+			if (output_track->GetMediaType() == cmn::MediaType::Video)
+			{
+				float aspect_ratio = (float)frame->GetWidth() / (float)frame->GetHeight();
+
+				if ((output_track->GetWidth() == 0) && (output_track->GetHeight() == 0))
+				{
+					output_track->SetWidth(frame->GetWidth());
+					output_track->SetHeight(frame->GetHeight());
+				}
+				else if (output_track->GetWidth() == 0)
+				{
+					int32_t width = (int32_t)((float)output_track->GetHeight() * aspect_ratio);
+					output_track->SetWidth((width % 2 == 0) ? width : width + 1);
+				}
+				else if (output_track->GetHeight() == 0)
+				{
+					int32_t height = (int32_t)((float)output_track->GetWidth() / aspect_ratio);
+					output_track->SetHeight((height % 2 == 0) ? height : height + 1);
+				}
+
+				if (output_track->GetFrameRate() == 0.0f)
+				{
+					output_track->SetEstimateFrameRate((input_track->GetFrameRate() > 0.0f) ? input_track->GetFrameRate() : 30.0);
+				}
+			}
+			else
+			{
+				if (output_track->GetSampleRate() == 0)
+				{
+					output_track->SetSampleRate(frame->GetSampleRate());
+					output_track->SetTimeBase(1, frame->GetSampleRate());
+				}
+
+				if (output_track->GetChannel().GetLayout() == cmn::AudioChannel::Layout::LayoutUnknown)
+				{
+					output_track->SetChannel(input_track->GetChannel());
+				}
+			}
+
+			rendition->encoder = TranscodeEncoder::Create(rendition->id, *_output_stream, output_track,
+														  bind(&TranscoderBenchmark::OnEncodedPacket, this, std::placeholders::_1, std::placeholders::_2));
+			if (rendition->encoder == nullptr)
+			{
+				logte("Could not create the encoder of the rendition %d (%s)", rendition->id, rendition->config.ToString().CStr());
+				continue;
+			}
+
+			// The filters convert the frames to the format supported by the encoder
+			if (output_track->GetMediaType() == cmn::MediaType::Video)
+			{
+				output_track->SetColorspace(rendition->encoder->GetSupportedFormat());
+			}
+			else
+			{
+				output_track->GetSample().SetFormat(ffmpeg::Conv::ToAudioSampleFormat(rendition->encoder->GetSupportedFormat()));
+			}
+
+			logti("Rendition %d: %s", rendition->id, output_track->GetInfoString().CStr());
+		}
+
+		if (rendition->filter != nullptr)
+		{
+			rendition->filter->Stop();
+		}
+
+		rendition->filter = std::make_shared<TranscodeFilter>();
+		if (rendition->filter->Configure(rendition->id, _input_stream, input_track, _output_stream, output_track,
+										 bind(&TranscoderBenchmark::OnFilteredFrame, this, std::placeholders::_1, std::placeholders::_2)) == false)
+		{
+			logte("Could not create the filter of the rendition %d (%s)", rendition->id, rendition->config.ToString().CStr());
+			rendition->filter = nullptr;
+		}
+	}
+}
+
+bool TranscoderBenchmark::FeedFile()
+{
+	AVPacket *packet = ::av_packet_alloc();
+
+	int err = ::av_read_frame(_format_context, packet);
+	if (err < 0)
+	{
+		if (err != AVERROR_EOF)
+		{
+			logte("Could not read the input file: %s", ffmpeg::Conv::AVErrorToString(err).CStr());
+		}
+
+		::av_packet_free(&packet);
+		return false;
+	}
+
+	auto source_it = _sources.find(packet->stream_index);
+	if (source_it == _sources.end())
+	{
+		::av_packet_free(&packet);
+		return true;
+	}
+	auto &source = source_it->second;
+
+	cmn::BitstreamFormat bitstream_format = cmn::BitstreamFormat::Unknown;
+	cmn::PacketType packet_type = cmn::PacketType::RAW;
+
+	switch (source->track->GetCodecId())
+	{
+		case cmn::MediaCodecId::H264:
+			bitstream_format = cmn::BitstreamFormat::H264_ANNEXB;
+			packet_type = cmn::PacketType::NALU;
+			break;
+		case cmn::MediaCodecId::H265:
+			bitstream_format = cmn::BitstreamFormat::H265_ANNEXB;
+			packet_type = cmn::PacketType::NALU;
+			break;
+		case cmn::MediaCodecId::Vp8:
+			bitstream_format = cmn::BitstreamFormat::VP8;
+			break;
+		case cmn::MediaCodecId::Aac:
+			bitstream_format = cmn::BitstreamFormat::AAC_ADTS;
+			break;
+		case cmn::MediaCodecId::Opus:
+			bitstream_format = cmn::BitstreamFormat::OPUS;
+			break;
+		default:
+			break;
+	}
+
+	auto send_packet = [&](AVPacket *av_packet) {
+		auto media_packet = ffmpeg::Conv::ToMediaPacket(0, source->track->GetId(), av_packet, source->track->GetMediaType(), bitstream_format, packet_type);
+		if (media_packet == nullptr)
+		{
+			return;
+		}
+
+		if (source->aac_config != nullptr)
+		{
+			auto adts_data = AacConverter::ConvertRawToAdts(media_packet->GetData(), source->aac_config);
+			if (adts_data == nullptr)
+			{
+				logtw("Could not convert raw AAC to ADTS");
+				return;
+			}
+
+			media_packet->SetData(adts_data);
+		}
+
+		SendToDecoder(source, std::move(media_packet));
+	};
+
+	if (source->bsf_context != nullptr)
+	{
+		if (::av_bsf_send_packet(source->bsf_context, packet) == 0)
+		{
+			while (::av_bsf_receive_packet(source->bsf_context, packet) == 0)
+			{
+				send_packet(packet);
+				::av_packet_unref(packet);
+			}
+		}
+	}
+	else
+	{
+		send_packet(packet);
+	}
+
+	::av_packet_free(&packet);
+
+	return true;
+}
+
+bool TranscoderBenchmark::FeedSynthetic()
+{
+	// Feed the track that is behind the others
+	std::shared_ptr<Source> source;
+	int64_t timestamp = 0;
+
+	for (auto &[track_id, candidate] : _sources)
+	{
+		auto &track = candidate->track;
+
+		int64_t candidate_timestamp = (track->GetMediaType() == cmn::MediaType::Video)
+										  ? static_cast<int64_t>(candidate->next_index * 1000000.0 / _config.framerate)
+										  : candidate->next_index * SYNTHETIC_AUDIO_SAMPLES * 1000000LL / track->GetSampleRate();
+
+		if ((source == nullptr) || (candidate_timestamp < timestamp))
+		{
+			source = candidate;
+			timestamp = candidate_timestamp;
+		}
+	}
+
+	auto frame = MakeSyntheticFrame(source, source->next_index);
+	if (frame == nullptr)
+	{
+		return false;
+	}
+
+	if (source->next_index == 0)
+	{
+		ChangeOutputFormat(source, frame.get());
+	}
+
+	source->next_index++;
+
+	auto frame_timestamp = ToMicroseconds(frame->GetPts(), source->track->GetTimeBase());
+	if (_first_timestamp < 0)
+	{
+		_first_timestamp = frame_timestamp;
+	}
+	_last_timestamp = std::max(_last_timestamp, frame_timestamp);
+
+	source->frame_count++;
+
+	SpreadToFilters(source, frame);
+
+	return true;
+}
+
+std::shared_ptr<MediaFrame> TranscoderBenchmark::MakeSyntheticFrame(const std::shared_ptr<Source> &source, int64_t index)
+{
+	auto &track = source->track;
+
+	AVFrame *frame = ::av_frame_alloc();
+	if (frame == nullptr)
+	{
+		return nullptr;
+	}
+
+	if (track->GetMediaType() == cmn::MediaType::Video)
+	{
+		frame->format = AV_PIX_FMT_YUV420P;
+		frame->width = track->GetWidth();
+		frame->height = track->GetHeight();
+		frame->pts = static_cast<int64_t>(index * 90000.0 / _config.framerate);
+		frame->pkt_duration = static_cast<int64_t>(90000.0 / _config.framerate);
+
+		if (::av_frame_get_buffer(frame, 32) < 0)
+		{
+			::av_frame_free(&frame);
+			return nullptr;
+		}
+
+		// Moving gradient with noise, so the encoders can't skip the blocks
+		uint32_t seed = static_cast<uint32_t>(index) * 2654435761U + 1U;
+
+		for (int y = 0; y < frame->height; y++)
+		{
+			uint8_t *row = frame->data[0] + y * frame->linesize[0];
+
+			for (int x = 0; x < frame->width; x++)
+			{
+				seed = seed * 1664525U + 1013904223U;
+				row[x] = static_cast<uint8_t>(x + y + index * 4) ^ static_cast<uint8_t>(seed >> 29);
+			}
+		}
+
+		for (int plane = 1; plane < 3; plane++)
+		{
+			for (int y = 0; y < frame->height / 2; y++)
+			{
+				uint8_t *row = frame->data[plane] + y * frame->linesize[plane];
+
+				for (int x = 0; x < frame->width / 2; x++)
+				{
+					row[x] = static_cast<uint8_t>((plane == 1) ? (x + index) : (y - index));
+				}
+			}
+		}
+	}
+	else
+	{
+		frame->format = AV_SAMPLE_FMT_FLTP;
+		frame->nb_samples = SYNTHETIC_AUDIO_SAMPLES;
+		frame->sample_rate = track->GetSampleRate();
+		frame->channel_layout = AV_CH_LAYOUT_STEREO;
+		frame->channels = 2;
+		frame->pts = index * SYNTHETIC_AUDIO_SAMPLES;
+		frame->pkt_duration = SYNTHETIC_AUDIO_SAMPLES;
+
+		if (::av_frame_get_buffer(frame, 0) < 0)
+		{
+			::av_frame_free(&frame);
+			return nullptr;
+		}
+
+		// 440Hz (left), 660Hz (right)
+		for (int channel = 0; channel < 2; channel++)
+		{
+			auto samples = reinterpret_cast<float *>(frame->data[channel]);
+			double frequency = (channel == 0) ? 440.0 : 660.0;
+
+			for (int i = 0; i < frame->nb_samples; i++)
+			{
+				double t = static_cast<double>(frame->pts + i) / frame->sample_rate;
+				samples[i] = static_cast<float>(0.5 * std::sin(2.0 * M_PI * frequency * t));
+			}
+		}
+	}
+
+	auto media_frame = ffmpeg::Conv::ToMediaFrame(track->GetMediaType(), frame);
+	::av_frame_free(&frame);
+
+	if (media_frame != nullptr)
+	{
+		media_frame->SetTrackId(track->GetId());
+	}
+
+	return media_frame;
+}
+
+bool TranscoderBenchmark::WaitForRenditions(int64_t timestamp, int64_t max_buffered_time, int64_t stall_timeout)
+{
+	int64_t last_progress = -1;
+	ov::StopWatch stall_watch;
+	stall_watch.Start();
+
+	while (true)
+	{
+		// Timestamp of the slowest rendition
+		int64_t progress = std::numeric_limits<int64_t>::max();
+
+		for (auto &[rendition_id, rendition] : _renditions)
+		{
+			if (rendition->encoder == nullptr)
+			{
+				// Not created yet (waiting for the first decoded frame), or failed to create
+				progress = std::min(progress, (rendition->source->frame_count > 0) ? timestamp : _first_timestamp);
+				continue;
+			}
+
+			int64_t last_timestamp = rendition->last_timestamp;
+			progress = std::min(progress, (last_timestamp >= 0) ? last_timestamp : _first_timestamp);
+		}
+
+		if ((timestamp - progress) <= max_buffered_time)
+		{
+			return true;
+		}
+
+		if (progress != last_progress)
+		{
+			last_progress = progress;
+			stall_watch.Update();
+		}
+		else if (stall_watch.IsElapsed(stall_timeout))
+		{
+			for (auto &[rendition_id, rendition] : _renditions)
+			{
+				logte("Rendition %d (%s) is stalled. Encoded frames: %llu, Last timestamp: %.3fs",
+					  rendition_id, rendition->config.ToString().CStr(),
+					  rendition->frame_count.load(), ToSeconds(rendition->last_timestamp - _first_timestamp, 1000000.0));
+			}
+
+			return false;
+		}
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+}
+
+void TranscoderBenchmark::Stop()
+{
+	// Stop the threads from the producers to the consumers
+	for (auto &[track_id, source] : _sources)
+	{
+		if (source->decoder != nullptr)
+		{
+			source->decoder->Stop();
+		}
+	}
+
+	for (auto &[rendition_id, rendition] : _renditions)
+	{
+		if (rendition->filter != nullptr)
+		{
+			rendition->filter->Stop();
+		}
+	}
+
+	for (auto &[rendition_id, rendition] : _renditions)
+	{
+		if (rendition->encoder != nullptr)
+		{
+			rendition->encoder->Stop();
+		}
+	}
+
+	for (auto &[track_id, source] : _sources)
+	{
+		OV_SAFE_FUNC(source->bsf_context, nullptr, ::av_bsf_free, &);
+	}
+
+	OV_SAFE_FUNC(_format_context, nullptr, ::avformat_close_input, &);
+}
+
+void TranscoderBenchmark::SendToDecoder(const std::shared_ptr<Source> &source, std::shared_ptr<MediaPacket> packet)
+{
+	auto timestamp = ToMicroseconds(packet->GetPts(), source->track->GetTimeBase());
+
+	if (_first_timestamp < 0)
+	{
+		_first_timestamp = timestamp;
+	}
+	_last_timestamp = std::max(_last_timestamp, timestamp);
+
+	source->decode_pending.Push(timestamp, NowUSec());
+	source->decoder->SendBuffer(std::move(packet));
+}
+
+void TranscoderBenchmark::SpreadToFilters(const std::shared_ptr<Source> &source, const std::shared_ptr<MediaFrame> &frame)
+{
+	auto timestamp = ToMicroseconds(frame->GetPts(), source->track->GetTimeBase());
+
+	for (auto &rendition : source->renditions)
+	{
+		if (rendition->filter == nullptr)
+		{
+			continue;
+		}
+
+		auto frame_clone = frame->CloneFrame();
+		if (frame_clone == nullptr)
+		{
+			continue;
+		}
+
+		rendition->filter_pending.Push(timestamp, NowUSec());
+		rendition->filter->SendBuffer(std::move(frame_clone));
+	}
+}
+
+void TranscoderBenchmark::OnDecodedFrame(TranscodeResult result, int32_t decoder_id, std::shared_ptr<MediaFrame> frame)
+{
+	auto source_it = _sources.find(decoder_id);
+	if ((frame == nullptr) || (source_it == _sources.end()))
+	{
+		return;
+	}
+	auto &source = source_it->second;
+
+	switch (result)
+	{
+		case TranscodeResult::FormatChanged:
+			ChangeOutputFormat(source, frame.get());
+			[[fallthrough]];
+
+		case TranscodeResult::DataReady: {
+			int64_t time = 0;
+			if (source->decode_pending.Pop(ToMicroseconds(frame->GetPts(), source->track->GetTimeBase()), &time))
+			{
+				source->decode_latency.Add(NowUSec() - time);
+			}
+
+			source->frame_count++;
+			source->decoder_cpu_time = GetThreadCpuTime();
+
+			SpreadToFilters(source, frame);
+		}
+		break;
+
+		default:
+			// The filler frames are not used in the benchmark
+			break;
+	}
+}
+
+void TranscoderBenchmark::OnFilteredFrame(int32_t filter_id, std::shared_ptr<MediaFrame> frame)
+{
+	auto rendition_it = _renditions.find(filter_id);
+	if ((frame == nullptr) || (rendition_it == _renditions.end()))
+	{
+		return;
+	}
+	auto &rendition = rendition_it->second;
+
+	auto now = NowUSec();
+	auto timestamp = ToMicroseconds(frame->GetPts(), rendition->output_track->GetTimeBase());
+
+	int64_t time = 0;
+	if (rendition->filter_pending.Pop(timestamp, &time))
+	{
+		rendition->filter_latency.Add(now - time);
+	}
+
+	rendition->filter_cpu_time = GetThreadCpuTime();
+
+	rendition->encode_pending.Push(timestamp, now);
+
+	frame->SetTrackId(rendition->output_track->GetId());
+	rendition->encoder->SendBuffer(std::move(frame));
+}
+
+void TranscoderBenchmark::OnEncodedPacket(int32_t encoder_id, std::shared_ptr<MediaPacket> packet)
+{
+	auto rendition_it = _renditions.find(encoder_id);
+	if ((packet == nullptr) || (rendition_it == _renditions.end()))
+	{
+		return;
+	}
+	auto &rendition = rendition_it->second;
+
+	auto timestamp = ToMicroseconds(packet->GetPts(), rendition->output_track->GetTimeBase());
+
+	int64_t time = 0;
+	if (rendition->encode_pending.Pop(timestamp, &time))
+	{
+		rendition->encode_latency.Add(NowUSec() - time);
+	}
+
+	rendition->frame_count++;
+	rendition->total_bytes += packet->GetDataLength();
+	rendition->last_timestamp = std::max(rendition->last_timestamp.load(), timestamp);
+	rendition->encoder_cpu_time = GetThreadCpuTime();
+}
+
+int64_t TranscoderBenchmark::ToMicroseconds(int64_t timestamp, const cmn::Timebase &timebase)
+{
+	return static_cast<int64_t>(static_cast<double>(timestamp) * timebase.GetExpr() * 1000000.0);
+}
+
+// CPU time of the calling thread (nanoseconds)
+int64_t TranscoderBenchmark::GetThreadCpuTime()
+{
+	struct timespec ts;
+
+	if (::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0)
+	{
+		return 0LL;
+	}
+
+	return static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+}
+
+ov::String TranscoderBenchmark::GetReportString() const
+{
+	ov::String report;
+
+	auto to_seconds = [](const struct timeval &tv) -> double {
+		return static_cast<double>(tv.tv_sec) + static_cast<double>(tv.tv_usec) / 1000000.0;
+	};
+
+	double elapsed = ToSeconds(_elapsed_msec, 1000.0);
+	double media_duration = ToSeconds(_last_timestamp - _first_timestamp, 1000000.0);
+	double user_time = to_seconds(_end_usage.ru_utime) - to_seconds(_start_usage.ru_utime);
+	double system_time = to_seconds(_end_usage.ru_stime) - to_seconds(_start_usage.ru_stime);
+
+	report.AppendFormat("Transcoder benchmark\n");
+
+	if (_config.input_path.IsEmpty())
+	{
+		report.AppendFormat("\tInput: synthetic (%dx%d, %.2ffps, %dHz stereo)\n", _config.width, _config.height, _config.framerate, _config.samplerate);
+	}
+	else
+	{
+		report.AppendFormat("\tInput: %s\n", _config.input_path.CStr());
+	}
+
+	report.AppendFormat("\tMedia duration: %.3fs, Elapsed: %.3fs (%.2fx realtime)\n",
+						media_duration, elapsed, (elapsed > 0.0) ? (media_duration / elapsed) : 0.0);
+	report.AppendFormat("\tProcess CPU: %.3fs (user: %.3fs, system: %.3fs, %.1f%% of a core)\n",
+						user_time + system_time, user_time, system_time, (elapsed > 0.0) ? ((user_time + system_time) * 100.0 / elapsed) : 0.0);
+	report.AppendFormat("\tMemory: RSS %.1f MB, Peak RSS %.1f MB\n",
+						ToSeconds(_rss, 1024.0 * 1024.0), ToSeconds(_end_usage.ru_maxrss, 1024.0));
+
+	if (_frame_pool_stats.IsEmpty() == false)
+	{
+		report.AppendFormat("\tFrame pool: %s\n", _frame_pool_stats.CStr());
+	}
+
+	for (auto &[track_id, source] : _sources)
+	{
+		report.AppendFormat("\n\tInput track %d (%s)\n", track_id, source->track->GetInfoString().CStr());
+		report.AppendFormat("\t\tFrames: %llu (%.2f fps)\n", source->frame_count.load(), (elapsed > 0.0) ? (source->frame_count / elapsed) : 0.0);
+
+		if (source->decoder != nullptr)
+		{
+			report.AppendFormat("\t\tDecoder CPU: %.3fs\n", ToSeconds(source->decoder_cpu_time, 1000000000.0));
+			report.AppendFormat("\t\tDecode latency: %s\n", source->decode_latency.ToString().CStr());
+		}
+	}
+
+	for (auto &[rendition_id, rendition] : _renditions)
+	{
+		double filter_cpu = ToSeconds(rendition->filter_cpu_time, 1000000000.0);
+		double encoder_cpu = ToSeconds(rendition->encoder_cpu_time, 1000000000.0);
+
+		report.AppendFormat("\n\tRendition %d (%s)%s\n", rendition_id, rendition->config.ToString().CStr(),
+							(rendition->encoder == nullptr) ? " - FAILED" : "");
+		report.AppendFormat("\t\tFrames: %llu (%.2f fps), Bitrate: %.0fkbps\n",
+							rendition->frame_count.load(), (elapsed > 0.0) ? (rendition->frame_count / elapsed) : 0.0,
+							(media_duration > 0.0) ? (rendition->total_bytes * 8.0 / media_duration / 1000.0) : 0.0);
+		// The threads created by the codec libraries (e.g. slice threads) are counted only in the process CPU
+		report.AppendFormat("\t\tCPU: %.3fs (filter: %.3fs, encoder: %.3fs, %.1f%% of a core)\n",
+							filter_cpu + encoder_cpu, filter_cpu, encoder_cpu, (elapsed > 0.0) ? ((filter_cpu + encoder_cpu) * 100.0 / elapsed) : 0.0);
+		report.AppendFormat("\t\tFilter latency: %s\n", rendition->filter_latency.ToString().CStr());
+		report.AppendFormat("\t\tEncode latency: %s\n", rendition->encode_latency.ToString().CStr());
+	}
+
+	return report;
+}
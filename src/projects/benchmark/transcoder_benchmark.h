@@ -0,0 +1,220 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by agent
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/info/stream.h>
+#include <base/ovlibrary/ovlibrary.h>
+#include <transcoder/transcoder_decoder.h>
+#include <transcoder/transcoder_encoder.h>
+#include <transcoder/transcoder_filter.h>
+#include <transcoder/transcoder_frame_pool.h>
+#include <sys/resource.h>
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+extern "C"
+{
+#include <libavcodec/bsf.h>
+}
+
+class AudioSpecificConfig;
+
+// Measures the throughput of the transcoder without network
+//
+// The renditions are made in the same way as TranscoderStream: Decoder > Filter(Rescaler/Resampler) > Encoder.
+// The input is read from a local file (like the file provider) or generated (synthetic frames, no decoder),
+// and is processed as fast as possible.
+class TranscoderBenchmark
+{
+public:
+	struct RenditionConfig
+	{
+		cmn::MediaType media_type = cmn::MediaType::Unknown;
+		// Same as <Codec> of the output profile (h264, h264_openh264, vp8, aac, opus, ...)
+		ov::String codec;
+		int32_t bitrate = 0;
+
+		// Video (0: same as the input)
+		int32_t width = 0;
+		int32_t height = 0;
+		double framerate = 0.0;
+
+		// Audio (0: same as the input)
+		int32_t samplerate = 0;
+		int32_t channel = 0;
+
+		// video: <codec>:<width>x<height>:<bitrate>[:<framerate>]
+		// audio: <codec>:<bitrate>[:<samplerate>[:<channel>]]
+		static bool Parse(cmn::MediaType media_type, const ov::String &value, RenditionConfig *config);
+		ov::String ToString() const;
+	};
+
+	struct Config
+	{
+		// If it is empty, the synthetic frames are used
+		ov::String input_path;
+		// Duration of the input to process (seconds)
+		double duration = 30.0;
+
+		// Synthetic input
+		int32_t width = 1920;
+		int32_t height = 1080;
+		double framerate = 30.0;
+		int32_t samplerate = 48000;
+
+		std::vector<RenditionConfig> renditions;
+	};
+
+public:
+	TranscoderBenchmark() = default;
+	~TranscoderBenchmark();
+
+	bool Run(const Config &config);
+
+	ov::String GetReportString() const;
+
+private:
+	// Latencies of a stage (microseconds)
+	class LatencyStats
+	{
+	public:
+		void Add(int64_t latency);
+
+		size_t GetCount() const;
+		// percentile: 0 ~ 100
+		int64_t GetPercentile(double percentile) const;
+		ov::String ToString() const;
+
+	private:
+		mutable std::mutex _mutex;
+		mutable std::vector<int64_t> _latencies;
+		mutable bool _sorted = true;
+	};
+
+	// The time when the frames are sent to a stage, by the timestamp of the frame (microseconds)
+	//
+	// The stages can drop (fps filter), split or merge (resampler) the frames, so the output is matched with
+	// the last input whose timestamp is not greater than the output.
+	class PendingTimes
+	{
+	public:
+		void Push(int64_t timestamp, int64_t time);
+		bool Pop(int64_t timestamp, int64_t *time);
+
+	private:
+		std::mutex _mutex;
+		std::map<int64_t, int64_t> _times;
+	};
+
+	struct Rendition;
+
+	// A track of the input
+	struct Source
+	{
+		std::shared_ptr<MediaTrack> track;
+		// nullptr if the input is synthetic
+		std::shared_ptr<TranscodeDecoder> decoder;
+		std::shared_ptr<TranscodeFramePool> frame_pool;
+
+		// Used by the file input
+		AVBSFContext *bsf_context = nullptr;
+		std::shared_ptr<AudioSpecificConfig> aac_config;
+
+		// Used by the synthetic input
+		int64_t next_index = 0;
+
+		// The filters/encoders of the renditions are created from the first frame (in the thread of the decoder)
+		std::vector<std::shared_ptr<Rendition>> renditions;
+
+		PendingTimes decode_pending;
+		LatencyStats decode_latency;
+		std::atomic<uint64_t> frame_count{0};
+		std::atomic<int64_t> decoder_cpu_time{0};
+	};
+
+	struct Rendition
+	{
+		int32_t id = 0;
+		RenditionConfig config;
+
+		std::shared_ptr<Source> source;
+		std::shared_ptr<MediaTrack> output_track;
+		std::shared_ptr<TranscodeEncoder> encoder;
+		std::shared_ptr<TranscodeFilter> filter;
+
+		PendingTimes filter_pending;
+		PendingTimes encode_pending;
+		LatencyStats filter_latency;
+		LatencyStats encode_latency;
+
+		std::atomic<uint64_t> frame_count{0};
+		std::atomic<uint64_t> total_bytes{0};
+		// Timestamp of the last encoded packet (microseconds)
+		std::atomic<int64_t> last_timestamp{-1};
+
+		// CPU time of the threads of the filter/encoder (nanoseconds)
+		std::atomic<int64_t> filter_cpu_time{0};
+		std::atomic<int64_t> encoder_cpu_time{0};
+	};
+
+	bool OpenFile();
+	bool CreateSyntheticSources();
+	bool CreateDecoders();
+	bool CreateRenditions();
+	// Creates the encoders/filters of the renditions using the format of the frame
+	void ChangeOutputFormat(const std::shared_ptr<Source> &source, const MediaFrame *frame);
+
+	// Returns false if there is no more input
+	bool FeedFile();
+	bool FeedSynthetic();
+	std::shared_ptr<MediaFrame> MakeSyntheticFrame(const std::shared_ptr<Source> &source, int64_t index);
+
+	// Waits until the renditions catch up with the input
+	bool WaitForRenditions(int64_t timestamp, int64_t max_buffered_time, int64_t stall_timeout);
+	void Stop();
+
+	void SendToDecoder(const std::shared_ptr<Source> &source, std::shared_ptr<MediaPacket> packet);
+	void SpreadToFilters(const std::shared_ptr<Source> &source, const std::shared_ptr<MediaFrame> &frame);
+
+	void OnDecodedFrame(TranscodeResult result, int32_t decoder_id, std::shared_ptr<MediaFrame> frame);
+	void OnFilteredFrame(int32_t filter_id, std::shared_ptr<MediaFrame> frame);
+	void OnEncodedPacket(int32_t encoder_id, std::shared_ptr<MediaPacket> packet);
+
+	static int64_t ToMicroseconds(int64_t timestamp, const cmn::Timebase &timebase);
+	static int64_t GetThreadCpuTime();
+
+	Config _config;
+
+	std::shared_ptr<info::Stream> _input_stream;
+	std::shared_ptr<info::Stream> _output_stream;
+
+	AVFormatContext *_format_context = nullptr;
+
+	// TRACK_ID (== DECODER_ID), Source
+	std::map<int32_t, std::shared_ptr<Source>> _sources;
+	// RENDITION_ID (== FILTER_ID == ENCODER_ID), Rendition
+	std::map<int32_t, std::shared_ptr<Rendition>> _renditions;
+
+	// Timestamp of the first/last input (microseconds)
+	int64_t _first_timestamp = -1;
+	int64_t _last_timestamp = -1;
+
+	ov::StopWatch _elapsed;
+	int64_t _elapsed_msec = 0;
+
+	struct rusage _start_usage = {};
+	struct rusage _end_usage = {};
+	// Resident set size at the end of the benchmark (bytes)
+	int64_t _rss = 0;
+	ov::String _frame_pool_stats;
+};
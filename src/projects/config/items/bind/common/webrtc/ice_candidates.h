@@ -24,6 +24,8 @@ namespace cfg
 
 				int _tcp_relay_worker_count{};
 				int _ice_worker_count{};
+				// Each ICE worker has its own socket (SO_REUSEPORT) and is pinned to a CPU
+				bool _sharded_ice_workers = false;
 				bool _tcp_force = false;
 
 			public:
@@ -34,6 +36,7 @@ namespace cfg
 
 				CFG_DECLARE_CONST_REF_GETTER_OF(GetTcpRelayWorkerCount, _tcp_relay_worker_count);
 				CFG_DECLARE_CONST_REF_GETTER_OF(GetIceWorkerCount, _ice_worker_count);
+				CFG_DECLARE_CONST_REF_GETTER_OF(UseShardedIceWorkers, _sharded_ice_workers);
 				CFG_DECLARE_CONST_REF_GETTER_OF(IsTcpForce, _tcp_force)
 
 			protected:
@@ -46,6 +49,7 @@ namespace cfg
 
 					Register<Optional>("TcpRelayWorkerCount", &_tcp_relay_worker_count);
 					Register<Optional>("IceWorkerCount", &_ice_worker_count);
+					Register<Optional>("ShardedIceWorkers", &_sharded_ice_workers);
 					Register<Optional>("TcpForce", &_tcp_force);
 				}
 			};
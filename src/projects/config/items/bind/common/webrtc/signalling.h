@@ -21,6 +21,8 @@ namespace cfg
 				cmn::SingularPort _tls_port;
 
 				int _worker_count{};
+				// Each worker has its own listener (SO_REUSEPORT) and is pinned to a CPU
+				bool _sharded_workers = false;
 
 			public:
 				explicit Signalling(const char *port)
@@ -38,6 +40,7 @@ namespace cfg
 				CFG_DECLARE_CONST_REF_GETTER_OF(GetTlsPort, _tls_port);
 
 				CFG_DECLARE_CONST_REF_GETTER_OF(GetWorkerCount, _worker_count);
+				CFG_DECLARE_CONST_REF_GETTER_OF(UseShardedWorkers, _sharded_workers);
 
 			protected:
 				void MakeList() override
@@ -46,6 +49,7 @@ namespace cfg
 					Register<Optional>({"TLSPort", "tlsPort"}, &_tls_port);
 
 					Register<Optional>("WorkerCount", &_worker_count);
+					Register<Optional>("ShardedWorkers", &_sharded_workers);
 				}
 			};
 		}  // namespace cmm
@@ -16,6 +16,7 @@
 #include "managers/managers.h"
 #include "alert/alert.h"
 #include "modules/modules.h"
+#include "threads/threads.h"
 #include "virtual_hosts/virtual_hosts.h"
 
 namespace cfg
@@ -52,6 +53,8 @@ namespace cfg
 
 		an::Analytics _analytics;
 
+		thr::Threads _threads;
+
 		vhost::VirtualHosts _virtual_hosts;
 
 	public:
@@ -77,6 +80,8 @@ namespace cfg
 
 		CFG_DECLARE_CONST_REF_GETTER_OF(GetAnalytics, _analytics)
 
+		CFG_DECLARE_CONST_REF_GETTER_OF(GetThreads, _threads)
+
 		CFG_DECLARE_CONST_REF_GETTER_OF(GetVirtualHostList, _virtual_hosts.GetVirtualHostList())
 
 		ov::String GetID() const
@@ -148,6 +153,7 @@ namespace cfg
 			Register<Optional>("Managers", &_managers);
 			Register<Optional>("Alert", &_alert);
 			Register<Optional>("Analytics", &_analytics);
+			Register<Optional>("Threads", &_threads);
 
 			Register<Optional>("VirtualHosts", &_virtual_hosts);
 		}
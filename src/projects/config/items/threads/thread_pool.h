@@ -0,0 +1,152 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by agent
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+namespace cfg
+{
+	namespace thr
+	{
+		struct ThreadPool : public Item
+		{
+		protected:
+			// One of OV_THREAD_POOL_* (SocketPool, MediaRouter, AppWorker, StreamWorker, SegmentWorker, StreamMotor, Decoder, Encoder, Transcoder)
+			ov::String _name;
+
+			ov::String _thread_name;
+
+			// "0-3,8,10-11"
+			ov::String _cpus_string;
+			std::vector<int> _cpu_list;
+
+			int _numa_node = -1;
+
+			bool _pin_each_thread = false;
+
+			ov::String _priority_string;
+			ov::ThreadPriority _priority = ov::ThreadPriority::Normal;
+
+			int _count = 0;
+
+		public:
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetName, _name)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetThreadName, _thread_name)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetCpuList, _cpu_list)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetNumaNode, _numa_node)
+			CFG_DECLARE_CONST_REF_GETTER_OF(IsPinEachThread, _pin_each_thread)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetPriority, _priority)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetCount, _count)
+
+			// CPUs of <NumaNode> are intersected with <CPUs> if both are specified
+			ov::ThreadPoolTopology ToThreadPoolTopology() const
+			{
+				ov::ThreadPoolTopology topology;
+
+				topology.thread_name = _thread_name;
+				topology.cpu_list = _cpu_list;
+				topology.pin_each_thread = _pin_each_thread;
+				topology.priority = _priority;
+				topology.thread_count = _count;
+
+				if (_numa_node >= 0)
+				{
+					topology.cpu_list = GetNumaNodeCpuList();
+				}
+
+				return topology;
+			}
+
+		protected:
+			// CPUs of <NumaNode> (only the ones in <CPUs> if specified)
+			std::vector<int> GetNumaNodeCpuList() const
+			{
+				auto node_cpu_list = ov::ThreadTopology::GetNumaNodeCpuList(_numa_node);
+
+				if (_cpu_list.empty())
+				{
+					return node_cpu_list;
+				}
+
+				std::vector<int> cpu_list;
+
+				for (auto cpu_index : _cpu_list)
+				{
+					if (std::find(node_cpu_list.begin(), node_cpu_list.end(), cpu_index) != node_cpu_list.end())
+					{
+						cpu_list.push_back(cpu_index);
+					}
+				}
+
+				return cpu_list;
+			}
+
+			void MakeList() override
+			{
+				Register("Name", &_name, nullptr, [=]() -> std::shared_ptr<ConfigError> {
+					static const char *pool_names[] = {
+						OV_THREAD_POOL_SOCKET_POOL,
+						OV_THREAD_POOL_MEDIA_ROUTER,
+						OV_THREAD_POOL_APP_WORKER,
+						OV_THREAD_POOL_STREAM_WORKER,
+						OV_THREAD_POOL_SEGMENT_WORKER,
+						OV_THREAD_POOL_STREAM_MOTOR,
+						OV_THREAD_POOL_DECODER,
+						OV_THREAD_POOL_ENCODER,
+						OV_THREAD_POOL_TRANSCODER};
+
+					for (auto pool_name : pool_names)
+					{
+						if (_name == pool_name)
+						{
+							return nullptr;
+						}
+					}
+
+					return CreateConfigErrorPtr("Unknown thread pool: %s", _name.CStr());
+				});
+				Register<Optional>("ThreadName", &_thread_name);
+				Register<Optional>("CPUs", &_cpus_string, nullptr, [=]() -> std::shared_ptr<ConfigError> {
+					return ov::ThreadTopology::ParseCpuList(_cpus_string, &_cpu_list)
+							   ? nullptr
+							   : CreateConfigErrorPtr("Invalid CPU list: %s (ex: 0-3,8,10-11)", _cpus_string.CStr());
+				});
+				// <CPUs> is registered first, so _cpu_list is already parsed here
+				Register<Optional>("NumaNode", &_numa_node, nullptr, [=]() -> std::shared_ptr<ConfigError> {
+					if (ov::ThreadTopology::GetNumaNodeCpuList(_numa_node).empty())
+					{
+						return CreateConfigErrorPtr("NUMA node %d is not available on this host", _numa_node);
+					}
+
+					// An empty CPU list means "all CPUs", so the pool would silently be unpinned
+					if (GetNumaNodeCpuList().empty())
+					{
+						return CreateConfigErrorPtr("No CPU of <CPUs> %s belongs to NUMA node %d", _cpus_string.CStr(), _numa_node);
+					}
+
+					return nullptr;
+				});
+				Register<Optional>("PinEachThread", &_pin_each_thread);
+				Register<Optional>("Priority", &_priority_string, nullptr, [=]() -> std::shared_ptr<ConfigError> {
+					for (auto priority : {ov::ThreadPriority::Normal, ov::ThreadPriority::Batch, ov::ThreadPriority::Idle, ov::ThreadPriority::Realtime})
+					{
+						if (_priority_string.UpperCaseString() == ov::String(ov::ThreadTopology::StringFromPriority(priority)).UpperCaseString())
+						{
+							_priority = priority;
+							return nullptr;
+						}
+					}
+
+					return CreateConfigErrorPtr("Unknown priority: %s (Normal, Batch, Idle or Realtime)", _priority_string.CStr());
+				});
+				Register<Optional>("Count", &_count, nullptr, [=]() -> std::shared_ptr<ConfigError> {
+					return (_count > 0) ? nullptr : CreateConfigErrorPtr("Count must be greater than 0");
+				});
+			}
+		};
+	}  // namespace thr
+}  // namespace cfg
@@ -0,0 +1,32 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by agent
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "thread_pool.h"
+
+namespace cfg
+{
+	namespace thr
+	{
+		struct Threads : public Item
+		{
+		protected:
+			std::vector<ThreadPool> _pool_list;
+
+		public:
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetPoolList, _pool_list)
+
+		protected:
+			void MakeList() override
+			{
+				Register<Optional>("Pool", &_pool_list);
+			}
+		};
+	}  // namespace thr
+}  // namespace cfg
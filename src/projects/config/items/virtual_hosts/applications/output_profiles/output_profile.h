@@ -24,12 +24,14 @@ namespace cfg
 				protected:
 					ov::String _name;
 					ov::String _output_stream_name;
+					bool _on_demand = false;
 					Encodes _encodes;
 					std::vector<Playlist> _playlists;
 
 				public:
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetName, _name)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetOutputStreamName, _output_stream_name)
+					CFG_DECLARE_CONST_REF_GETTER_OF(IsOnDemand, _on_demand)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetEncodes, _encodes)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetPlaylists, _playlists)
 
@@ -38,6 +40,7 @@ namespace cfg
 					{
 						Register("Name", &_name);
 						Register("OutputStreamName", &_output_stream_name);
+						Register<Optional>("OnDemand", &_on_demand);
 						Register<Optional>("Encodes", &_encodes);
 
 						Register<Optional>({"Playlist", "playlists"}, &_playlists, nullptr,
@@ -22,16 +22,45 @@ namespace cfg
 				{
 				protected:
 					bool _hwaccel = false;
+					bool _cascade_scaling = false;
+					// Priority of the decoders/filters/encoders on the Transcoder thread pool (High, Normal or Low)
+					ov::String _priority = "Normal";
+					// Lowers the complexity/frame rate of the S/W video encoders while they can't keep up with the input
+					bool _adaptive_encoding = false;
+					// Shares the decoded frames with the other applications which transcode the same origin stream (see TranscoderFrameBus)
+					bool _share_decoded_frames = false;
+					// Converts the audio with the native resampler (PcmResampler) instead of aresample=async of FFmpeg
+					bool _native_resampler = false;
 					std::vector<OutputProfile> _output_profiles;
 
 				public:
 					CFG_DECLARE_CONST_REF_GETTER_OF(IsHardwareAcceleration, _hwaccel);
+					CFG_DECLARE_CONST_REF_GETTER_OF(IsCascadeScaling, _cascade_scaling);
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetPriority, _priority);
+					CFG_DECLARE_CONST_REF_GETTER_OF(IsAdaptiveEncoding, _adaptive_encoding);
+					CFG_DECLARE_CONST_REF_GETTER_OF(IsShareDecodedFrames, _share_decoded_frames);
+					CFG_DECLARE_CONST_REF_GETTER_OF(IsNativeResampler, _native_resampler);
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetOutputProfileList, _output_profiles);
 
 				protected:
 					void MakeList() override
 					{
 						Register<Optional>("HardwareAcceleration", &_hwaccel);
+						Register<Optional>("CascadeScaling", &_cascade_scaling);
+						Register<Optional>("Priority", &_priority, nullptr, [=]() -> std::shared_ptr<ConfigError> {
+							for (auto priority : {"High", "Normal", "Low"})
+							{
+								if (_priority.UpperCaseString() == ov::String(priority).UpperCaseString())
+								{
+									return nullptr;
+								}
+							}
+
+							return CreateConfigErrorPtr("Unknown priority: %s (High, Normal or Low)", _priority.CStr());
+						});
+						Register<Optional>("AdaptiveEncoding", &_adaptive_encoding);
+						Register<Optional>("ShareDecodedFrames", &_share_decoded_frames);
+						Register<Optional>("NativeResampler", &_native_resampler);
 						Register<Optional>("OutputProfile", &_output_profiles);
 					}
 				};
@@ -36,6 +36,68 @@ namespace cfg
 					}
 				};
 
+				struct Pacing : public Item
+				{
+				protected:
+					bool _enabled = true;
+					// Multiple of the estimated bandwidth
+					double _factor = 2.5;
+					int _burst_ms = 40;
+					int _max_queue_delay_ms = 2000;
+
+				public:
+					CFG_DECLARE_CONST_REF_GETTER_OF(IsEnabled, _enabled)
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetFactor, _factor)
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetBurstMs, _burst_ms)
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetMaxQueueDelayMs, _max_queue_delay_ms)
+
+				protected:
+					void MakeList() override
+					{
+						Register<Optional>("Enable", &_enabled);
+						Register<Optional>("Factor", &_factor);
+						Register<Optional>("Burst", &_burst_ms);
+						Register<Optional>("MaxQueueDelay", &_max_queue_delay_ms);
+					}
+				};
+
+				struct FecProtection : public Item
+				{
+				protected:
+					ov::String _mask_type_string = "Random";
+					UlpfecMaskType _mask_type = UlpfecMaskType::Random;
+					// Percentage of the FEC packets to the media packets
+					int _max_protection = 50;
+
+				public:
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetMaskType, _mask_type)
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetMaxProtection, _max_protection)
+
+				protected:
+					void MakeList() override
+					{
+						Register<Optional>("MaskType", &_mask_type_string, nullptr, [=]() -> std::shared_ptr<ConfigError> {
+							if (_mask_type_string.UpperCaseString() == "RANDOM")
+							{
+								_mask_type = UlpfecMaskType::Random;
+							}
+							else if (_mask_type_string.UpperCaseString() == "BURSTY")
+							{
+								_mask_type = UlpfecMaskType::Bursty;
+							}
+							else
+							{
+								return CreateConfigErrorPtr("Invalid value for MaskType. Valid values are 'Random' or 'Bursty'");
+							}
+
+							return nullptr;
+						});
+						Register<Optional>("MaxProtection", &_max_protection, nullptr, [=]() -> std::shared_ptr<ConfigError> {
+							return ((_max_protection > 0) && (_max_protection <= 100)) ? nullptr : CreateConfigErrorPtr("MaxProtection must be between 1 and 100");
+						});
+					}
+				};
+
 				struct WebrtcPublisher : public Publisher
 				{
 					PublisherType GetType() const override
@@ -46,9 +108,11 @@ namespace cfg
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetTimeout, _timeout)
 					CFG_DECLARE_CONST_REF_GETTER_OF(IsRtxEnabled, _rtx)
 					CFG_DECLARE_CONST_REF_GETTER_OF(IsUlpfecEnalbed, _ulpfec)
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetFecProtection, _fec_protection)
 					CFG_DECLARE_CONST_REF_GETTER_OF(IsJitterBufferEnabled, _jitter_buffer)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetPlayoutDelay, _playout_delay)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetBandwidthEstimationType, _bandwidth_estimation_type)
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetPacing, _pacing)
 
 				protected:
 					void MakeList() override
@@ -59,7 +123,9 @@ namespace cfg
 						Register<Optional>("JitterBuffer", &_jitter_buffer);
 						Register<Optional>("Rtx", &_rtx);
 						Register<Optional>("Ulpfec", &_ulpfec);
+						Register<Optional>("FecProtection", &_fec_protection);
 						Register<Optional>("PlayoutDelay", &_playout_delay);
+						Register<Optional>("Pacing", &_pacing);
 						Register<Optional>("BandwidthEstimation", &_bwe,	
 							[=]() -> std::shared_ptr<ConfigError> {
 								return nullptr;
@@ -92,6 +158,8 @@ namespace cfg
 
 					WebRtcBandwidthEstimationType _bandwidth_estimation_type = WebRtcBandwidthEstimationType::REMB;
 					PlayoutDelay _playout_delay;
+					Pacing _pacing;
+					FecProtection _fec_protection;
 				};
 			}  // namespace pub
 		} // namespace app
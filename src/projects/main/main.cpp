@@ -108,6 +108,27 @@ int main(int argc, char *argv[])
 
 	logti("This host supports %s", ov::ipv6::Checker::GetInstance()->ToString().CStr());
 
+	// Apply the thread topology before creating the modules, since the modules create their threads at startup
+	for (const auto &pool : server_config->GetThreads().GetPoolList())
+	{
+		auto topology = pool.ToThreadPoolTopology();
+
+		std::vector<ov::String> cpu_list;
+		for (auto cpu_index : topology.cpu_list)
+		{
+			cpu_list.push_back(ov::Converter::ToString(cpu_index));
+		}
+
+		logti("Thread pool %s: CPUs (%s), PinEachThread: %s, Priority: %s, Count: %d",
+			  pool.GetName().CStr(),
+			  cpu_list.empty() ? "all" : ov::String::Join(cpu_list, ",").CStr(),
+			  ov::Converter::ToString(topology.pin_each_thread).CStr(),
+			  ov::ThreadTopology::StringFromPriority(topology.priority),
+			  topology.thread_count);
+
+		ov::ThreadTopology::GetInstance()->SetPool(pool.GetName(), topology);
+	}
+
 	bool succeeded = true;
 
 	INIT_EXTERNAL_MODULE("FFmpeg", InitializeFFmpeg);
@@ -46,10 +46,19 @@ std::shared_ptr<MediaRouteApplication> MediaRouteApplication::Create(const info:
 MediaRouteApplication::MediaRouteApplication(const info::Application &application_info)
 	: _application_info(application_info)
 {
-	_max_worker_thread_count = std::min(std::max((uint32_t)_application_info.GetConfig().GetPublishers().GetAppWorkerCount(), (uint32_t)MIN_APPLICATION_WORKER_COUNT), (uint32_t)MAX_APPLICATION_WORKER_COUNT);
+	bool is_configured = false;
+	int worker_count = _application_info.GetConfig().GetPublishers().GetAppWorkerCount(&is_configured);
+	if (is_configured == false)
+	{
+		worker_count = ov::ThreadTopology::GetInstance()->GetThreadCount(OV_THREAD_POOL_MEDIA_ROUTER, worker_count);
+	}
+
+	_max_worker_thread_count = std::min(std::max((uint32_t)worker_count, (uint32_t)MIN_APPLICATION_WORKER_COUNT), (uint32_t)MAX_APPLICATION_WORKER_COUNT);
 
 	logti("[%s(%u)] Created Mediarouter application. worker(%d)", _application_info.GetName().CStr(), _application_info.GetId(), _max_worker_thread_count);
 
+	// The indicators are not in the ring mode (ov::ManagedQueueType::MpscRing): the packet is already pushed to the stream
+	// when the indicator is enqueued, so a dropped indicator would leave the packet in the stream until the next one
 	for (uint32_t worker_id = 0; worker_id < _max_worker_thread_count; worker_id++)
 	{
 		{
@@ -81,6 +90,7 @@ bool MediaRouteApplication::Start()
 		{
 			auto inbound_thread = std::thread(&MediaRouteApplication::InboundWorkerThread, this, worker_id);
 			pthread_setname_np(inbound_thread.native_handle(), "InboundWorker");
+			ov::ThreadTopology::GetInstance()->Apply(OV_THREAD_POOL_MEDIA_ROUTER, inbound_thread.native_handle(), worker_id);
 			_inbound_threads.push_back(std::move(inbound_thread));
 		}
 		catch (const std::system_error &e)
@@ -97,6 +107,8 @@ bool MediaRouteApplication::Start()
 		{
 			auto outbound_thread = std::thread(&MediaRouteApplication::OutboundWorkerThread, this, worker_id);
 			pthread_setname_np(outbound_thread.native_handle(), "OutboundWorker");
+			// Outbound workers follow the inbound workers, so they don't share a CPU when PinEachThread is set
+			ov::ThreadTopology::GetInstance()->Apply(OV_THREAD_POOL_MEDIA_ROUTER, outbound_thread.native_handle(), _max_worker_thread_count + worker_id);
 			_outbound_threads.push_back(std::move(outbound_thread));
 		}
 		catch (const std::system_error &e)
@@ -747,49 +759,60 @@ void MediaRouteApplication::InboundWorkerThread(uint32_t worker_id)
 {
 	logtd("Created Inbound worker thread #%d", worker_id);
 
+	std::vector<std::shared_ptr<MediaRouteStream>> streams;
+	streams.reserve(MANAGED_QUEUE_DEFAULT_BATCH_SIZE);
+
 	while (!_kill_flag)
 	{
-		auto msg = _inbound_stream_indicator[worker_id]->Dequeue(ov::Infinite);
-		if (msg.has_value() == false)
+		if (_inbound_stream_indicator[worker_id]->DequeueBatch(streams, MANAGED_QUEUE_DEFAULT_BATCH_SIZE, ov::Infinite) == 0)
 		{
 			// It may be called due to a normal stop signal.
 			continue;
 		}
-		auto stream = msg.value();
-		if (stream == nullptr)
-		{
-			logtw("Not found stream info");
-			continue;
-		}
 
-		// StreamDeliver media packet to Publisher(observer) of Transcoder(observer)
-		auto media_packet = stream->Pop();
-		if (media_packet == nullptr)
-		{
-			continue;
-		}
+		std::shared_lock<std::shared_mutex> lock(_observers_lock);
 
-		// When the inbound stream is finished parsing track information,
-		// Notify the Observer that the stream is parsed
-		if (stream->IsStreamPrepared() == false && stream->AreAllTracksReady() == true)
+		for (auto &stream : streams)
 		{
-			NotifyStreamPrepared(stream);
-		}
+			if (stream == nullptr)
+			{
+				logtw("Not found stream info");
+				continue;
+			}
 
-		std::shared_lock<std::shared_mutex> lock(_observers_lock);
-		for (const auto &observer : _observers)
-		{
-			auto observer_type = observer->GetObserverType();
+			// StreamDeliver media packet to Publisher(observer) of Transcoder(observer)
+			auto media_packet = stream->Pop();
+			if (media_packet == nullptr)
+			{
+				continue;
+			}
 
-			if (observer_type == MediaRouteApplicationObserver::ObserverType::Transcoder)
+			// When the inbound stream is finished parsing track information,
+			// Notify the Observer that the stream is parsed
+			if (stream->IsStreamPrepared() == false && stream->AreAllTracksReady() == true)
 			{
-				// Get Stream Info
-				auto stream_info = stream->GetStream();
+				// NotifyStreamPrepared() takes _observers_lock by itself
+				lock.unlock();
+				NotifyStreamPrepared(stream);
+				lock.lock();
+			}
+
+			// Get Stream Info
+			auto stream_info = stream->GetStream();
+
+			for (const auto &observer : _observers)
+			{
+				auto observer_type = observer->GetObserverType();
 
-				// observer->OnSendFrame(stream_info, std::move(media_packet->ClonePacket()));
-				observer->OnSendFrame(stream_info, media_packet);
+				if (observer_type == MediaRouteApplicationObserver::ObserverType::Transcoder)
+				{
+					// observer->OnSendFrame(stream_info, std::move(media_packet->ClonePacket()));
+					observer->OnSendFrame(stream_info, media_packet);
+				}
 			}
 		}
+
+		streams.clear();
 	}
 
 	logtd("Inbound worker thread #%d has been stopped", worker_id);
@@ -799,46 +822,57 @@ void MediaRouteApplication::OutboundWorkerThread(uint32_t worker_id)
 {
 	logtd("Created outbound worker thread #%d", worker_id);
 
+	std::vector<std::shared_ptr<MediaRouteStream>> streams;
+	streams.reserve(MANAGED_QUEUE_DEFAULT_BATCH_SIZE);
+
 	while (!_kill_flag)
 	{
-		auto msg = _outbound_stream_indicator[worker_id]->Dequeue(ov::Infinite);
-		if (msg.has_value() == false)
+		if (_outbound_stream_indicator[worker_id]->DequeueBatch(streams, MANAGED_QUEUE_DEFAULT_BATCH_SIZE, ov::Infinite) == 0)
 		{
 			// It may be called due to a normal stop signal.
 			continue;
 		}
-		auto stream = msg.value();
-		if (stream == nullptr)
-		{
-			logtw("Not found stream info");
-			continue;
-		}
 
-		// StreamDeliver media packet to Publisher(observer) of Transcoder(observer)
-		auto media_packet = stream->Pop();
-		if (media_packet == nullptr)
-		{
-			continue;
-		}
+		std::shared_lock<std::shared_mutex> lock(_observers_lock);
 
-		if (stream->IsStreamPrepared() == false && stream->AreAllTracksReady() == true)
+		for (auto &stream : streams)
 		{
-			NotifyStreamPrepared(stream);
-		}
+			if (stream == nullptr)
+			{
+				logtw("Not found stream info");
+				continue;
+			}
 
-		std::shared_lock<std::shared_mutex> lock(_observers_lock);
-		for (const auto &observer : _observers)
-		{
-			auto observer_type = observer->GetObserverType();
+			// StreamDeliver media packet to Publisher(observer) of Transcoder(observer)
+			auto media_packet = stream->Pop();
+			if (media_packet == nullptr)
+			{
+				continue;
+			}
+
+			if (stream->IsStreamPrepared() == false && stream->AreAllTracksReady() == true)
+			{
+				// NotifyStreamPrepared() takes _observers_lock by itself
+				lock.unlock();
+				NotifyStreamPrepared(stream);
+				lock.lock();
+			}
+
+			// Get Stream Info
+			auto stream_info = stream->GetStream();
 
-			if (observer_type == MediaRouteApplicationObserver::ObserverType::Publisher)
+			for (const auto &observer : _observers)
 			{
-				// Get Stream Info
-				auto stream_info = stream->GetStream();
+				auto observer_type = observer->GetObserverType();
 
-				observer->OnSendFrame(stream_info, media_packet);
+				if (observer_type == MediaRouteApplicationObserver::ObserverType::Publisher)
+				{
+					observer->OnSendFrame(stream_info, media_packet);
+				}
 			}
 		}
+
+		streams.clear();
 	}
 
 	logtd("Outbound worker thread #%d has been stopped", worker_id);
@@ -313,7 +313,7 @@ namespace bmff
 				return nullptr;
 			}
 
-			auto new_packet = std::make_shared<MediaPacket>(*media_packet);
+			auto new_packet = MediaPacket::Create(*media_packet);
 			new_packet->SetData(converted_data);
 			new_packet->SetBitstreamFormat(cmn::BitstreamFormat::H264_AVCC);
 			new_packet->SetPacketType(cmn::PacketType::NALU);
@@ -329,7 +329,7 @@ namespace bmff
 				return nullptr;
 			}
 
-			auto new_packet = std::make_shared<MediaPacket>(*media_packet);
+			auto new_packet = MediaPacket::Create(*media_packet);
 			new_packet->SetData(converted_data);
 			new_packet->SetBitstreamFormat(cmn::BitstreamFormat::HVCC);
 			new_packet->SetPacketType(cmn::PacketType::NALU);
@@ -345,7 +345,7 @@ namespace bmff
 				return nullptr;
 			}
 
-			auto new_packet = std::make_shared<MediaPacket>(*media_packet);
+			auto new_packet = MediaPacket::Create(*media_packet);
 			new_packet->SetData(raw_data);
 			new_packet->SetBitstreamFormat(cmn::BitstreamFormat::AAC_RAW);
 			new_packet->SetPacketType(cmn::PacketType::RAW);
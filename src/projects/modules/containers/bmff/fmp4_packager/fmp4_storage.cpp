@@ -78,6 +78,30 @@ namespace bmff
 		return nullptr;
 	}
 
+	ov::String FMP4Storage::GetMediaSegmentFilePath(uint32_t segment_number) const
+	{
+		if (_config.dvr_enabled == false)
+		{
+			return "";
+		}
+
+		{
+			std::shared_lock<std::shared_mutex> lock(_segments_lock);
+
+			if (_segments.empty() || (segment_number >= _segments.begin()->first))
+			{
+				return "";
+			}
+		}
+
+		if (_dvr_info.GetSegmentInfo(segment_number).IsAvailable() == false)
+		{
+			return "";
+		}
+
+		return GetSegmentFilePath(segment_number);
+	}
+
 	std::shared_ptr<FMP4Segment> FMP4Storage::GetLastSegment() const
 	{
 		std::shared_lock<std::shared_mutex> lock(_segments_lock);
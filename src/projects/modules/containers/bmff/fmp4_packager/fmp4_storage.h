@@ -40,6 +40,8 @@ namespace bmff
 
 		std::shared_ptr<ov::Data> GetInitializationSection() const;
 		std::shared_ptr<FMP4Segment> GetMediaSegment(uint32_t segment_number) const;
+		// Returns the path of the DVR file if the segment is no longer in memory (otherwise, empty string)
+		ov::String GetMediaSegmentFilePath(uint32_t segment_number) const;
 		std::shared_ptr<FMP4Segment> GetLastSegment() const;
 		std::shared_ptr<FMP4Chunk> GetMediaChunk(uint32_t segment_number, uint32_t chunk_number) const;
 
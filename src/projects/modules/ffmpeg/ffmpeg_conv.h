@@ -370,7 +370,7 @@ namespace ffmpeg
 			switch (media_type)
 			{
 				case cmn::MediaType::Video: {
-					auto media_frame = std::make_shared<MediaFrame>();
+					auto media_frame = MediaFrame::Create();
 
 					media_frame->SetMediaType(media_type);
 					media_frame->SetWidth(frame->width);
@@ -387,7 +387,7 @@ namespace ffmpeg
 				}
 				break;
 				case cmn::MediaType::Audio: {
-					auto media_frame = std::make_shared<MediaFrame>();
+					auto media_frame = MediaFrame::Create();
 
 					media_frame->SetMediaType(media_type);
 					media_frame->SetBytesPerSample(::av_get_bytes_per_sample(static_cast<AVSampleFormat>(frame->format)));
@@ -475,7 +475,7 @@ namespace ffmpeg
 
 		static std::shared_ptr<MediaPacket> ToMediaPacket(AVPacket* src, cmn::MediaType media_type, cmn::BitstreamFormat format, cmn::PacketType packet_type)
 		{
-			auto packet_buffer = std::make_shared<MediaPacket>(
+			auto packet_buffer = MediaPacket::Create(
 				0,
 				media_type,
 				0,
@@ -499,7 +499,7 @@ namespace ffmpeg
 
 		static std::shared_ptr<MediaPacket> ToMediaPacket(uint32_t msid, int32_t track_id, AVPacket* src, cmn::MediaType media_type, cmn::BitstreamFormat format, cmn::PacketType packet_type)
 		{
-			auto packet_buffer = std::make_shared<MediaPacket>(
+			auto packet_buffer = MediaPacket::Create(
 				msid,
 				media_type,
 				track_id,
@@ -55,6 +55,11 @@ namespace http
 				return _chunked_transfer;
 			}
 
+			bool Http1Response::IsSendFileSupported() const
+			{
+				return (IsTlsEnabled() == false) && (_chunked_transfer == false);
+			}
+
 			int32_t Http1Response::SendHeader()
 			{
 				std::shared_ptr<ov::Data> response = std::make_shared<ov::Data>(65535);
@@ -90,6 +95,14 @@ namespace http
 
 				stream.Append("\r\n", 2);
 
+				if (_chunked_transfer == false)
+				{
+					logtd("Header is pending:\n%s", response->Dump(response->GetLength()).CStr());
+
+					_pending_header = response;
+					return response->GetLength();
+				}
+
 				if (Send(response))
 				{
 					logtd("Header is sent:\n%s", response->Dump(response->GetLength()).CStr());
@@ -107,6 +120,53 @@ namespace http
 				logtd("Trying to send datas...");
 
 				uint32_t sent_bytes = 0;
+
+				if (_chunked_transfer == false)
+				{
+					// Header + payload are written with one syscall, and the payload is not copied
+					std::vector<std::shared_ptr<const ov::Data>> data_list;
+					data_list.reserve(GetResponseDataList().size() + 1);
+
+					if (_pending_header != nullptr)
+					{
+						data_list.push_back(_pending_header);
+						_pending_header = nullptr;
+					}
+
+					for (const auto &data : GetResponseDataList())
+					{
+						data_list.push_back(data);
+						sent_bytes += data->GetLength();
+					}
+
+					if ((data_list.empty() == false) && (SendShared(data_list) == false))
+					{
+						logte("Could not send data : %u bytes", sent_bytes);
+						ResetResponseData();
+						return -1;
+					}
+
+					auto file = GetResponseFile();
+
+					if (file != nullptr)
+					{
+						if (SendFile(file) == false)
+						{
+							logte("Could not send file : %zu bytes", file->GetLength());
+							ResetResponseData();
+							return -1;
+						}
+
+						sent_bytes += file->GetLength();
+					}
+
+					ResetResponseData();
+
+					logtd("All datas are sent...");
+
+					return sent_bytes;
+				}
+
 				for (const auto &data : GetResponseDataList())
 				{
 					if (_chunked_transfer)
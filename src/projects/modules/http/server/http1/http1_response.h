@@ -29,11 +29,17 @@ namespace http
 				bool SendChunkedData(const std::shared_ptr<const ov::Data> &data);
 				bool IsChunkedTransfer() const;
 
+			protected:
+				bool IsSendFileSupported() const override;
+
 			private:
 				int32_t SendHeader() override;
 				int32_t SendPayload() override;
 
 				bool _chunked_transfer = false;
+
+				// If the content length is known, the header is kept until SendPayload() to send it with the payload at once
+				std::shared_ptr<const ov::Data> _pending_header;
 			};
 		}
 	}
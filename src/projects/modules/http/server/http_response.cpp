@@ -39,6 +39,7 @@ namespace http
 			_is_header_sent = http_response->_is_header_sent;
 			_response_header = http_response->_response_header;
 			_response_data_list = http_response->_response_data_list;
+			_response_file = http_response->_response_file;
 			_response_data_size = http_response->_response_data_size;
 			_default_value = http_response->_default_value;
 			_created_time = http_response->_created_time;
@@ -163,6 +164,21 @@ namespace http
 			return true;
 		}
 
+		bool HttpResponse::AppendSharedData(const std::shared_ptr<const ov::Data> &data)
+		{
+			if (data == nullptr)
+			{
+				return false;
+			}
+
+			std::lock_guard<decltype(_response_mutex)> lock(_response_mutex);
+
+			_response_data_list.push_back(data);
+			_response_data_size += data->GetLength();
+
+			return true;
+		}
+
 		bool HttpResponse::AppendString(const ov::String &string)
 		{
 			return AppendData(string.ToData(false));
@@ -170,8 +186,41 @@ namespace http
 
 		bool HttpResponse::AppendFile(const ov::String &filename)
 		{
-			OV_ASSERT(false, "Not implemented");
-			return false;
+			std::lock_guard<decltype(_response_mutex)> lock(_response_mutex);
+
+			if (_response_file != nullptr)
+			{
+				logtw("Only one file can be appended: %s", filename.CStr());
+				return false;
+			}
+
+			if (IsSendFileSupported())
+			{
+				auto file = ov::SocketFile::Open(filename);
+
+				if (file == nullptr)
+				{
+					return false;
+				}
+
+				_response_file = file;
+				_response_data_size += file->GetLength();
+
+				return true;
+			}
+
+			auto data = ov::LoadFromFile(filename);
+
+			if (data == nullptr)
+			{
+				logtw("Could not load file: %s", filename.CStr());
+				return false;
+			}
+
+			_response_data_list.push_back(data);
+			_response_data_size += data->GetLength();
+
+			return true;
 		}
 
 		bool HttpResponse::IsHeaderSent() const
@@ -179,6 +228,11 @@ namespace http
 			return _is_header_sent;
 		}
 
+		bool HttpResponse::IsTlsEnabled() const
+		{
+			return (_tls_data != nullptr);
+		}
+
 		// Get Response Data Size
 		size_t HttpResponse::GetResponseDataSize() const
 		{
@@ -191,6 +245,11 @@ namespace http
 			return _response_data_list;
 		}
 
+		const std::shared_ptr<const ov::SocketFile> &HttpResponse::GetResponseFile() const
+		{
+			return _response_file;
+		}
+
 		// Get Response Header
 		const std::unordered_map<ov::String, std::vector<ov::String>, ov::CaseInsensitiveHash, ov::CaseInsensitiveEqual> &HttpResponse::GetResponseHeaderList() const
 		{
@@ -200,6 +259,7 @@ namespace http
 		void HttpResponse::ResetResponseData()
 		{
 			_response_data_list.clear();
+			_response_file = nullptr;
 			_response_data_size = 0ULL;
 		}
 
@@ -280,28 +340,58 @@ namespace http
 				return false;
 			}
 
+			if (_tls_data == nullptr)
+			{
+				// The socket makes a copy of the data
+				return _client_socket->Send(data);
+			}
+
 			std::shared_ptr<const ov::Data> send_data;
 
+			if (_tls_data->Encrypt(data, &send_data) == false)
+			{
+				logte("Failed to encrypt data: %s", _client_socket->ToString().CStr());
+				return false;
+			}
+
+			if ((send_data == nullptr) || send_data->IsEmpty())
+			{
+				// There is no data to send
+				return true;
+			}
+
+			// The encrypted data is not referenced by anyone else
+			return _client_socket->SendShared(send_data);
+		}
+
+		bool HttpResponse::SendShared(const std::vector<std::shared_ptr<const ov::Data>> &data_list)
+		{
 			if (_tls_data == nullptr)
 			{
-				send_data = data->Clone();
+				return _client_socket->SendShared(data_list);
 			}
-			else
+
+			for (const auto &data : data_list)
 			{
-				if (_tls_data->Encrypt(data, &send_data) == false)
+				if (Send(data) == false)
 				{
-					logte("Failed to encrypt data: %s", _client_socket->ToString().CStr());
 					return false;
 				}
+			}
 
-				if ((send_data == nullptr) || send_data->IsEmpty())
-				{
-					// There is no data to send
-					return true;
-				}
+			return true;
+		}
+
+		bool HttpResponse::SendFile(const std::shared_ptr<const ov::SocketFile> &file)
+		{
+			if (_tls_data != nullptr)
+			{
+				// AppendFile() doesn't keep the file if TLS is used
+				OV_ASSERT2(_tls_data == nullptr);
+				return false;
 			}
 
-			return _client_socket->Send(send_data);
+			return _client_socket->SendFile(file, 0, file->GetLength());
 		}
 
 		bool HttpResponse::Close()
@@ -49,7 +49,12 @@ namespace http
 			// Enqueue the data into the queue (This data will be sent when SendResponse() is called)
 			// Can be used for response with content-length
 			bool AppendData(const std::shared_ptr<const ov::Data> &data);
+			// Unlike AppendData(), the data is not copied, so it MUST NOT be modified after calling this API
+			// (ex: chunks/segments of bmff::FMP4Storage that are shared by all clients)
+			bool AppendSharedData(const std::shared_ptr<const ov::Data> &data);
 			bool AppendString(const ov::String &string);
+			// The file is sent after the data appended by AppendData().
+			// If the response supports it (plain HTTP/1.1), the file is sent using sendfile(), otherwise it is read into memory.
 			bool AppendFile(const ov::String &filename);
 
 			int32_t Response();
@@ -69,9 +74,12 @@ namespace http
 
 		protected:
 			bool IsHeaderSent() const;
+			bool IsTlsEnabled() const;
 			
 			// Get Response Data List
 			const std::vector<std::shared_ptr<const ov::Data>> &GetResponseDataList() const;
+			// Get Response File (appended by AppendFile(), sent after the data list)
+			const std::shared_ptr<const ov::SocketFile> &GetResponseFile() const;
 			// Get Response Header
 			const std::unordered_map<ov::String, std::vector<ov::String>, ov::CaseInsensitiveHash, ov::CaseInsensitiveEqual> &GetResponseHeaderList() const;
 			void ResetResponseData();
@@ -84,6 +92,16 @@ namespace http
 			}
 			virtual bool Send(const void *data, size_t length);
 			virtual bool Send(const std::shared_ptr<const ov::Data> &data);
+			// Sends the items without copying them (they are written at once if possible)
+			// If TLS is used, the items are encrypted into new buffers instead (single copy)
+			bool SendShared(const std::vector<std::shared_ptr<const ov::Data>> &data_list);
+			bool SendFile(const std::shared_ptr<const ov::SocketFile> &file);
+
+			// Whether AppendFile() can keep the file to send it with sendfile()
+			virtual bool IsSendFileSupported() const
+			{
+				return false;
+			}
 			
 		private:
 			virtual int32_t SendHeader();
@@ -114,6 +132,7 @@ namespace http
 			// So _response_header is a map of case insentitive header key and value
 			std::unordered_map<ov::String, std::vector<ov::String>, ov::CaseInsensitiveHash, ov::CaseInsensitiveEqual> _response_header;
 			std::vector<std::shared_ptr<const ov::Data>> _response_data_list;
+			std::shared_ptr<const ov::SocketFile> _response_file;
 			size_t _response_data_size = 0;
 
 			std::vector<ov::String> _default_value{};
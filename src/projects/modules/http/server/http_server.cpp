@@ -31,7 +31,7 @@ namespace http
 			OV_ASSERT(_physical_port == nullptr, "%s: Physical port: %s", _server_name.CStr(), _physical_port->ToString().CStr());
 		}
 
-		bool HttpServer::Start(const ov::SocketAddress &address, int worker_count, bool enable_http2)
+		bool HttpServer::Start(const ov::SocketAddress &address, int worker_count, bool sharded, bool enable_http2)
 		{
 			auto lock_guard = std::lock_guard(_physical_port_mutex);
 
@@ -45,7 +45,7 @@ namespace http
 
 			auto manager = PhysicalPortManager::GetInstance();
 
-			auto physical_port = manager->CreatePort(_server_short_name, ov::SocketType::Tcp, address, worker_count);
+			auto physical_port = manager->CreatePort(_server_short_name, ov::SocketType::Tcp, address, worker_count, sharded);
 
 			if (physical_port != nullptr)
 			{
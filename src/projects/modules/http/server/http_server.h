@@ -45,7 +45,7 @@ namespace http
 			HttpServer(const char *server_name, const char *server_short_name);
 			~HttpServer() override;
 
-			virtual bool Start(const ov::SocketAddress &address, int worker_count, bool enable_http2);
+			virtual bool Start(const ov::SocketAddress &address, int worker_count, bool sharded, bool enable_http2);
 			virtual bool Stop();
 
 			bool IsRunning() const;
@@ -16,7 +16,7 @@ namespace http
 {
 	namespace svr
 	{
-		std::shared_ptr<HttpServer> HttpServerManager::CreateHttpServer(const char *server_name, const char *server_short_name, const ov::SocketAddress &address, int worker_count)
+		std::shared_ptr<HttpServer> HttpServerManager::CreateHttpServer(const char *server_name, const char *server_short_name, const ov::SocketAddress &address, int worker_count, bool sharded)
 		{
 			std::shared_ptr<HttpServer> http_server = nullptr;
 
@@ -62,7 +62,7 @@ namespace http
 					// Create a new HTTP server
 					http_server = std::make_shared<HttpServer>(server_name, server_short_name);
 
-					if (http_server->Start(address, worker_count, http2_enabled))
+					if (http_server->Start(address, worker_count, sharded, http2_enabled))
 					{
 						_http_servers[address] = http_server;
 					}
@@ -115,7 +115,7 @@ namespace http
 			return true;
 		}
 
-		std::shared_ptr<HttpsServer> HttpServerManager::CreateHttpsServer(const char *server_name, const char *server_short_name, const ov::SocketAddress &address, const std::shared_ptr<const info::Certificate> &certificate, bool disable_http2_force, int worker_count)
+		std::shared_ptr<HttpsServer> HttpServerManager::CreateHttpsServer(const char *server_name, const char *server_short_name, const ov::SocketAddress &address, const std::shared_ptr<const info::Certificate> &certificate, bool disable_http2_force, int worker_count, bool sharded)
 		{
 			std::shared_ptr<HttpsServer> https_server = nullptr;
 			auto module_config = cfg::ConfigManager::GetInstance()->GetServer()->GetModules();
@@ -155,7 +155,7 @@ namespace http
 				// Create a new HTTP server
 				https_server = std::make_shared<HttpsServer>(server_name, server_short_name);
 
-				if (https_server->Start(address, worker_count, http2_enabled))
+				if (https_server->Start(address, worker_count, sharded, http2_enabled))
 				{
 					_http_servers[address] = https_server;
 				}
@@ -183,9 +183,9 @@ namespace http
 			return https_server;
 		}
 
-		std::shared_ptr<HttpsServer> HttpServerManager::CreateHttpsServer(const char *server_name, const char *server_short_name, const ov::SocketAddress &address, bool disable_http2_force, int worker_count)
+		std::shared_ptr<HttpsServer> HttpServerManager::CreateHttpsServer(const char *server_name, const char *server_short_name, const ov::SocketAddress &address, bool disable_http2_force, int worker_count, bool sharded)
 		{
-			return CreateHttpsServer(server_name, server_short_name, address, nullptr, disable_http2_force, worker_count);
+			return CreateHttpsServer(server_name, server_short_name, address, nullptr, disable_http2_force, worker_count, sharded);
 		}
 
 		template <typename T>
@@ -254,7 +254,8 @@ namespace http
 			std::shared_ptr<const info::Certificate> certificate,
 			bool disable_http2_force,
 			HttpServerCreationCallback creation_callback,
-			int worker_count)
+			int worker_count,
+			bool sharded)
 		{
 			http_server_list->clear();
 			https_server_list->clear();
@@ -268,7 +269,7 @@ namespace http
 							this,
 							false, http_server_list, server_ip_list, port,
 							[=](const ov::SocketAddress &address) -> std::shared_ptr<HttpServer> {
-								return CreateHttpServer(server_name, server_short_name, address, worker_count);
+								return CreateHttpServer(server_name, server_short_name, address, worker_count, sharded);
 							},
 							[&](const ov::SocketAddress &address, bool is_https, const std::shared_ptr<HttpServer> &http_server) {
 								address_string_list.emplace_back(address.ToString());
@@ -290,7 +291,7 @@ namespace http
 							this,
 							true, https_server_list, server_ip_list, tls_port,
 							[=](const ov::SocketAddress &address) -> std::shared_ptr<HttpsServer> {
-								return CreateHttpsServer(server_name, server_short_name, address, certificate, disable_http2_force, worker_count);
+								return CreateHttpsServer(server_name, server_short_name, address, certificate, disable_http2_force, worker_count, sharded);
 							},
 							[&](const ov::SocketAddress &address, bool is_https, const std::shared_ptr<HttpServer> &http_server) {
 								tls_address_string_list.emplace_back(address.ToString());
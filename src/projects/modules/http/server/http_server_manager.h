@@ -23,13 +23,13 @@ namespace http
 			using HttpServerCreationCallback = std::function<void(const ov::SocketAddress &address, bool is_https, const std::shared_ptr<HttpServer> &http_server)>;
 
 		public:
-			std::shared_ptr<HttpServer> CreateHttpServer(const char *server_name, const char *server_short_name, const ov::SocketAddress &address, int worker_count = HTTP_SERVER_USE_DEFAULT_COUNT);
+			std::shared_ptr<HttpServer> CreateHttpServer(const char *server_name, const char *server_short_name, const ov::SocketAddress &address, int worker_count = HTTP_SERVER_USE_DEFAULT_COUNT, bool sharded = false);
 
 			bool AppendCertificate(const ov::SocketAddress &address, const std::shared_ptr<const info::Certificate> &certificate);
 			bool RemoveCertificate(const ov::SocketAddress &address, const std::shared_ptr<const info::Certificate> &certificate);
 
-			std::shared_ptr<HttpsServer> CreateHttpsServer(const char *server_name, const char *server_short_name, const ov::SocketAddress &address, const std::shared_ptr<const info::Certificate> &certificate, bool disable_http2_force, int worker_count);
-			std::shared_ptr<HttpsServer> CreateHttpsServer(const char *server_name, const char *server_short_name, const ov::SocketAddress &address, bool disable_http2_force, int worker_count = HTTP_SERVER_USE_DEFAULT_COUNT);
+			std::shared_ptr<HttpsServer> CreateHttpsServer(const char *server_name, const char *server_short_name, const ov::SocketAddress &address, const std::shared_ptr<const info::Certificate> &certificate, bool disable_http2_force, int worker_count, bool sharded = false);
+			std::shared_ptr<HttpsServer> CreateHttpsServer(const char *server_name, const char *server_short_name, const ov::SocketAddress &address, bool disable_http2_force, int worker_count = HTTP_SERVER_USE_DEFAULT_COUNT, bool sharded = false);
 
 			bool CreateServers(
 				const char *server_name, const char *server_short_name,
@@ -41,7 +41,8 @@ namespace http
 				std::shared_ptr<const info::Certificate> certificate,
 				bool disable_http2_force,
 				HttpServerCreationCallback creation_callback = nullptr,
-				int worker_count = HTTP_SERVER_USE_DEFAULT_COUNT);
+				int worker_count = HTTP_SERVER_USE_DEFAULT_COUNT,
+				bool sharded = false);
 
 			std::shared_ptr<HttpsServer> GetHttpsServer(const ov::SocketAddress &address);
 			bool ReleaseServer(const std::shared_ptr<HttpServer> &http_server);
@@ -41,7 +41,7 @@ IcePort::~IcePort()
 	Close();
 }
 
-bool IcePort::CreateIceCandidates(const char *server_name, const cfg::Server &server_config, const RtcIceCandidateList &ice_candidate_list, int ice_worker_count)
+bool IcePort::CreateIceCandidates(const char *server_name, const cfg::Server &server_config, const RtcIceCandidateList &ice_candidate_list, int ice_worker_count, bool sharded)
 {
 	std::lock_guard<std::recursive_mutex> lock_guard(_physical_port_list_mutex);
 
@@ -88,7 +88,7 @@ bool IcePort::CreateIceCandidates(const char *server_name, const cfg::Server &se
 				}
 
 				// Create an ICE port using candidate information
-				auto physical_port = CreatePhysicalPort(ice_address, socket_type, ice_worker_count);
+				auto physical_port = CreatePhysicalPort(ice_address, socket_type, ice_worker_count, sharded);
 				if (physical_port == nullptr)
 				{
 					logte("Could not create physical port for %s/%s", ice_address.ToString().CStr(), transport.CStr());
@@ -192,9 +192,9 @@ bool IcePort::CreateTurnServer(const ov::SocketAddress &address, ov::SocketType
 	return true;
 }
 
-std::shared_ptr<PhysicalPort> IcePort::CreatePhysicalPort(const ov::SocketAddress &address, ov::SocketType type, int worker_count)
+std::shared_ptr<PhysicalPort> IcePort::CreatePhysicalPort(const ov::SocketAddress &address, ov::SocketType type, int worker_count, bool sharded)
 {
-	auto physical_port = PhysicalPortManager::GetInstance()->CreatePort("ICE", type, address, worker_count);
+	auto physical_port = PhysicalPortManager::GetInstance()->CreatePort("ICE", type, address, worker_count, sharded);
 	if (physical_port != nullptr)
 	{
 		if (physical_port->AddObserver(this))
@@ -239,13 +239,11 @@ bool IcePort::Close()
 
 ov::String IcePort::GenerateUfrag()
 {
-	std::shared_lock<std::shared_mutex> lock(_ice_sessions_with_ufrag_lock);
-
 	while (true)
 	{
 		ov::String ufrag = ov::Random::GenerateString(6);
 
-		if (_ice_sessions_with_ufrag.find(ufrag) == _ice_sessions_with_ufrag.end())
+		if (_ice_sessions_with_ufrag.Contains(ufrag) == false)
 		{
 			logtd("Generated ufrag: %s", ufrag.CStr());
 
@@ -256,77 +254,41 @@ ov::String IcePort::GenerateUfrag()
 
 bool IcePort::AddIceSession(session_id_t session_id, const std::shared_ptr<IceSession> &ice_session)
 {
-	std::lock_guard<std::shared_mutex> lock_guard(_ice_sessions_with_id_lock);
-	auto item = _ice_seesions_with_id.find(session_id);
-	if (item == _ice_seesions_with_id.end())
-	{
-		_ice_seesions_with_id.emplace(session_id, ice_session);
-		return true;
-	}
-
-	return false;
+	return _ice_seesions_with_id.Insert(session_id, ice_session);
 }
 
 bool IcePort::AddIceSession(const ov::String &local_ufrag, const std::shared_ptr<IceSession> &ice_session)
 {
-	std::lock_guard<std::shared_mutex> lock_guard(_ice_sessions_with_ufrag_lock);
-	auto item = _ice_sessions_with_ufrag.find(local_ufrag);
-	if (item == _ice_sessions_with_ufrag.end())
-	{
-		_ice_sessions_with_ufrag.emplace(local_ufrag, ice_session);
-		return true;
-	}
-
-	return false;
+	return _ice_sessions_with_ufrag.Insert(local_ufrag, ice_session);
 }
 
 bool IcePort::AddIceSession(const ov::SocketAddressPair &address_pair, const std::shared_ptr<IceSession> &ice_session)
 {
-	std::lock_guard<std::shared_mutex> lock_guard(_ice_sessions_with_address_pair_lock);
-	auto item = _ice_sessions_with_address_pair.find(address_pair);
-	if (item == _ice_sessions_with_address_pair.end())
-	{
-		_ice_sessions_with_address_pair.emplace(address_pair, ice_session);
-		return true;
-	}
-
-	return false;
+	return _ice_sessions_with_address_pair.Insert(address_pair, ice_session);
 }
 
 std::shared_ptr<IceSession> IcePort::FindIceSession(session_id_t session_id)
 {
-	std::shared_lock<std::shared_mutex> lock_guard(_ice_sessions_with_address_pair_lock);
-	auto item = _ice_seesions_with_id.find(session_id);
-	if (item != _ice_seesions_with_id.end())
-	{
-		return item->second;
-	}
+	std::shared_ptr<IceSession> ice_session;
+	_ice_seesions_with_id.Find(session_id, &ice_session);
 
-	return nullptr;
+	return ice_session;
 }
 
 std::shared_ptr<IceSession> IcePort::FindIceSession(const ov::String &local_ufrag)
 {
-	std::shared_lock<std::shared_mutex> lock_guard(_ice_sessions_with_ufrag_lock);
-	auto item = _ice_sessions_with_ufrag.find(local_ufrag);
-	if (item != _ice_sessions_with_ufrag.end())
-	{
-		return item->second;
-	}
+	std::shared_ptr<IceSession> ice_session;
+	_ice_sessions_with_ufrag.Find(local_ufrag, &ice_session);
 
-	return nullptr;
+	return ice_session;
 }
 
 std::shared_ptr<IceSession> IcePort::FindIceSession(const ov::SocketAddressPair &socket_address_pair)
 {
-	std::shared_lock<std::shared_mutex> lock_guard(_ice_sessions_with_address_pair_lock);
-	auto item = _ice_sessions_with_address_pair.find(socket_address_pair);
-	if (item != _ice_sessions_with_address_pair.end())
-	{
-		return item->second;
-	}
+	std::shared_ptr<IceSession> ice_session;
+	_ice_sessions_with_address_pair.Find(socket_address_pair, &ice_session);
 
-	return nullptr;
+	return ice_session;
 }
 
 session_id_t IcePort::IssueUniqueSessionId()
@@ -397,29 +359,20 @@ bool IcePort::RemoveSession(session_id_t session_id)
 	size_t ice_sessions_with_address_pair_size = 0;
 
 	// Remove from _ice_sessions_with_id
-	{
-		std::lock_guard<std::shared_mutex> lock_guard(_ice_sessions_with_id_lock);
-		_ice_seesions_with_id.erase(session_id);
-		ice_sessions_with_id_size = _ice_seesions_with_id.size();
-	}
+	_ice_seesions_with_id.Erase(session_id);
+	ice_sessions_with_id_size = _ice_seesions_with_id.GetCount();
 
 	// Remove from _ice_sessions_with_ufrag
-	{
-		std::lock_guard<std::shared_mutex> lock_guard(_ice_sessions_with_ufrag_lock);
-		_ice_sessions_with_ufrag.erase(ice_session->GetLocalUfrag());
-		ice_sessions_with_ufrag_size = _ice_sessions_with_ufrag.size();
-	}
+	_ice_sessions_with_ufrag.Erase(ice_session->GetLocalUfrag());
+	ice_sessions_with_ufrag_size = _ice_sessions_with_ufrag.GetCount();
 
 	// Remove from _ice_sessions_with_address_pair if it exists
+	auto connected_candidate_pair = ice_session->GetConnectedCandidatePair();
+	if (connected_candidate_pair != nullptr)
 	{
-		std::lock_guard<std::shared_mutex> lock_guard(_ice_sessions_with_address_pair_lock);
-		auto connected_candidate_pair = ice_session->GetConnectedCandidatePair();
-		if (connected_candidate_pair != nullptr)
-		{
-			_ice_sessions_with_address_pair.erase(connected_candidate_pair->GetAddressPair());
-		}
-		ice_sessions_with_address_pair_size = _ice_sessions_with_address_pair.size();
+		_ice_sessions_with_address_pair.Erase(connected_candidate_pair->GetAddressPair());
 	}
+	ice_sessions_with_address_pair_size = _ice_sessions_with_address_pair.GetCount();
 
 	{
 		// Close only TCP (TURN)
@@ -500,18 +453,12 @@ void IcePort::CheckTimedOut()
 
 	// Collect terminated sessions for thread safety
 	std::vector<std::shared_ptr<IceSession>> terminated_session_list;
-	{
-		std::shared_lock<std::shared_mutex> lock_guard(_ice_sessions_with_id_lock);
-
-		for (const auto &item : _ice_seesions_with_id)
+	_ice_seesions_with_id.ForEach([&](session_id_t session_id, const std::shared_ptr<IceSession> &session) {
+		if (session->IsExpired() || session->GetState() == IceConnectionState::Disconnecting)
 		{
-			auto session = item.second;
-			if (session->IsExpired() || session->GetState() == IceConnectionState::Disconnecting)
-			{
-				terminated_session_list.push_back(session);
-			}
+			terminated_session_list.push_back(session);
 		}
-	}
+	});
 
 	// Remove terminated sessions and notify
 	for (auto &terminated_session : terminated_session_list)
@@ -592,6 +539,8 @@ bool IcePort::Send(session_id_t session_id, const std::shared_ptr<const ov::Data
 		return false;
 	}
 
+	// If the caller opened an ov::SocketSendBatch (ex: pub::StreamWorker), the datagram is queued
+	// and sent together with the other sessions' datagrams using sendmmsg()
 	return remote->SendFromTo(connected_candidate_pair->GetAddressPair(), send_data);
 }
 
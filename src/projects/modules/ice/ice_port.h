@@ -43,7 +43,7 @@ public:
 	~IcePort() override;
 
 	bool CreateTurnServer(const ov::SocketAddress &address, ov::SocketType socket_type, int tcp_relay_worker_count);
-	bool CreateIceCandidates(const char *server_name, const cfg::Server &server_config, const RtcIceCandidateList &ice_candidate_list, int ice_worker_count);
+	bool CreateIceCandidates(const char *server_name, const cfg::Server &server_config, const RtcIceCandidateList &ice_candidate_list, int ice_worker_count, bool sharded);
 	bool Close();
 
 	ov::String GenerateUfrag();
@@ -63,7 +63,7 @@ public:
 	ov::String ToString() const;
 
 protected:
-	std::shared_ptr<PhysicalPort> CreatePhysicalPort(const ov::SocketAddress &address, ov::SocketType type, int ice_worker_count);
+	std::shared_ptr<PhysicalPort> CreatePhysicalPort(const ov::SocketAddress &address, ov::SocketType type, int ice_worker_count, bool sharded = false);
 
 	bool ParseIceCandidate(const ov::String &ice_candidate, std::vector<ov::String> *ip_list, ov::SocketType *socket_type, int *start_port, int *end_port);
 
@@ -205,20 +205,20 @@ private:
 	std::vector<std::shared_ptr<PhysicalPort>> _physical_port_list;
 	std::recursive_mutex _physical_port_list_mutex;
 
+	// The session tables are looked up for every packet sent and received, and are modified only when a session is
+	// added or removed, so the lookups don't take a lock (see ov::RcuHashMap).
+
 	// Mapping table containing related information until STUN binding.
 	// Once binding is complete, there is no need because it can be found by destination ip & port.
 	// key: offer ufrag
-	std::shared_mutex _ice_sessions_with_ufrag_lock;
-	std::map<const ov::String, std::shared_ptr<IceSession>> _ice_sessions_with_ufrag;
+	ov::RcuHashMap<ov::String, std::shared_ptr<IceSession>> _ice_sessions_with_ufrag;
 	
 	// Find IceSession with connected CandidatePair, used when receiving TURN channel data and application data
 	// key: SocketAddressPair
-	std::shared_mutex _ice_sessions_with_address_pair_lock;
-	std::map<ov::SocketAddressPair, std::shared_ptr<IceSession>> _ice_sessions_with_address_pair;
+	ov::RcuHashMap<ov::SocketAddressPair, std::shared_ptr<IceSession>, std::hash<ov::SocketAddressPair>, ov::SocketAddressPair::AddressEqual> _ice_sessions_with_address_pair;
 	
 	// Find IceSession with peer's session id, used for sending application data 
-	std::shared_mutex _ice_sessions_with_id_lock;
-	std::map<session_id_t, std::shared_ptr<IceSession>> _ice_seesions_with_id;
+	ov::RcuHashMap<session_id_t, std::shared_ptr<IceSession>> _ice_seesions_with_id;
 
 	// Insert item when send stun binding request
 	// Remove item when receive stun binding response or timed out
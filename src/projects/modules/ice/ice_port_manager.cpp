@@ -62,8 +62,9 @@ bool IcePortManager::CreateIceCandidates(
 	bool is_parsed;
 	auto ice_worker_count = ice_candidates_config.GetIceWorkerCount(&is_parsed);
 	ice_worker_count = is_parsed ? ice_worker_count : PHYSICAL_PORT_USE_DEFAULT_COUNT;
+	auto sharded = ice_candidates_config.UseShardedIceWorkers();
 
-	if (_ice_port->CreateIceCandidates(server_name, server_config, ice_candidate_list, ice_worker_count) == false)
+	if (_ice_port->CreateIceCandidates(server_name, server_config, ice_candidate_list, ice_worker_count, sharded) == false)
 	{
 		Release(observer);
 
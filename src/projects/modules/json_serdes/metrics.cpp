@@ -87,4 +87,54 @@ namespace serdes
 
 		return value;
 	}
+
+	Json::Value JsonFromMemoryPoolStats(const ov::MemoryPool::Stats &stats)
+	{
+		Json::Value value;
+
+		// 0 means the blocks larger than the biggest size class
+		SetInt64(value, "blockSize", stats.block_size);
+		SetInt64(value, "hit", stats.hit_count);
+		SetInt64(value, "miss", stats.miss_count);
+		SetInt64(value, "usedBytes", stats.used_bytes);
+		SetInt64(value, "footprintBytes", stats.footprint_bytes);
+
+		return value;
+	}
+
+	Json::Value JsonFromSocketPool(const std::shared_ptr<const ov::SocketPool> &socket_pool)
+	{
+		if (socket_pool == nullptr)
+		{
+			return Json::nullValue;
+		}
+
+		Json::Value value;
+
+		SetString(value, "name", socket_pool->GetName(), Optional::False);
+		SetString(value, "type", ov::StringFromSocketType(socket_pool->GetType()), Optional::False);
+		SetBool(value, "sharded", socket_pool->IsSharded());
+
+		Json::Value workers(Json::ValueType::arrayValue);
+
+		for (const auto &stats : socket_pool->GetWorkerStats())
+		{
+			Json::Value worker;
+
+			SetInt(worker, "index", stats.index);
+			// -1 means the worker is not pinned
+			SetInt(worker, "cpu", stats.cpu_index);
+			SetInt(worker, "sockets", stats.socket_count);
+			SetInt64(worker, "events", stats.event_count);
+			SetInt64(worker, "eventsPerSecond", stats.events_per_second);
+			SetInt64(worker, "busyTimeUs", stats.busy_time_us);
+			SetFloat(worker, "busyRatio", static_cast<float>(stats.busy_ratio));
+
+			workers.append(worker);
+		}
+
+		value["workers"] = workers;
+
+		return value;
+	}
 }  // namespace serdes
\ No newline at end of file
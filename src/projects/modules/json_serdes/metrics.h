@@ -8,6 +8,7 @@
 //==============================================================================
 #pragma once
 
+#include <base/ovsocket/ovsocket.h>
 #include <monitoring/monitoring.h>
 
 namespace serdes
@@ -15,4 +16,6 @@ namespace serdes
 	Json::Value JsonFromMetrics(const std::shared_ptr<const mon::CommonMetrics> &metrics);
 	Json::Value JsonFromStreamMetrics(const std::shared_ptr<const mon::StreamMetrics> &metrics);
 	Json::Value JsonFromQueueMetrics(const std::shared_ptr<const mon::QueueMetrics> &metrics);
+	Json::Value JsonFromMemoryPoolStats(const ov::MemoryPool::Stats &stats);
+	Json::Value JsonFromSocketPool(const std::shared_ptr<const ov::SocketPool> &socket_pool);
 }  // namespace serdes
\ No newline at end of file
@@ -15,15 +15,31 @@
 #include <optional>
 #include <queue>
 #include <shared_mutex>
+#include <vector>
 
 #include "base/info/managed_queue.h"
 #include "base/ovlibrary/ovlibrary.h"
+#include "ring_buffer.h"
 
 #define MANAGED_QUEUE_METRICS_UPDATE_INTERVAL_IN_MSEC 1000
 #define MANAGED_QUEUE_LOG_INTERVAL_IN_MSEC 5000
+#define MANAGED_QUEUE_RING_DEFAULT_CAPACITY 4096
+// In ring mode, the waiting time is measured for one of every N items
+#define MANAGED_QUEUE_LATENCY_SAMPLING_INTERVAL 64
+// Default number of items that a consumer takes at once with DequeueBatch()
+#define MANAGED_QUEUE_DEFAULT_BATCH_SIZE 64
 
 namespace ov
 {
+	enum class ManagedQueueType : uint8_t
+	{
+		// Mutex-protected linked list (unbounded)
+		LinkedList,
+		// Bounded lock-free multi-producer/single-consumer ring.
+		// Items are dropped (and counted) when the ring is full.
+		MpscRing,
+	};
+
 	template <typename T>
 	class ManagedQueue : public info::ManagedQueue
 	{
@@ -50,7 +66,12 @@ namespace ov
 			: ManagedQueue(nullptr) {}
 
 		ManagedQueue(std::shared_ptr<info::ManagedQueue::URN> urn, size_t threshold = 0, int log_interval_in_msec = MANAGED_QUEUE_LOG_INTERVAL_IN_MSEC)
+			: ManagedQueue(ManagedQueueType::LinkedList, 0, urn, threshold, log_interval_in_msec) {}
+
+		// ring_capacity is only used when type is ManagedQueueType::MpscRing (0 means the default capacity)
+		ManagedQueue(ManagedQueueType type, size_t ring_capacity, std::shared_ptr<info::ManagedQueue::URN> urn, size_t threshold = 0, int log_interval_in_msec = MANAGED_QUEUE_LOG_INTERVAL_IN_MSEC)
 			: info::ManagedQueue(threshold),
+			  _type(type),
 			  _stats_metric_interval(MANAGED_QUEUE_METRICS_UPDATE_INTERVAL_IN_MSEC),
 			  _log_interval(log_interval_in_msec),
 			  _front_node(nullptr),
@@ -59,6 +80,11 @@ namespace ov
 		{
 			info::ManagedQueue::SetUrn(urn, Demangle(typeid(T).name()).CStr());
 
+			if (_type == ManagedQueueType::MpscRing)
+			{
+				_ring = std::make_unique<RingBuffer<T>>((ring_capacity > 0) ? ring_capacity : MANAGED_QUEUE_RING_DEFAULT_CAPACITY);
+			}
+
 			_timer.Start();
 
 			// Register to the server metrics
@@ -90,8 +116,19 @@ namespace ov
 			MonitorInstance->GetServerMetrics()->OnQueueUpdated(*this, true);
 		}
 
+		ManagedQueueType GetType() const
+		{
+			return _type;
+		}
+
 		void Enqueue(const T& item)
 		{
+			if (_ring != nullptr)
+			{
+				EnqueueRing(item);
+				return;
+			}
+
 			auto lock_guard = std::lock_guard(_mutex);
 
 			EnqueueInternal(new ManagedQueueNode(item));
@@ -99,6 +136,12 @@ namespace ov
 
 		void Enqueue(T&& item)
 		{
+			if (_ring != nullptr)
+			{
+				EnqueueRing(std::move(item));
+				return;
+			}
+
 			auto lock_guard = std::lock_guard(_mutex);
 
 			EnqueueInternal(new ManagedQueueNode(std::move(item)));
@@ -135,6 +178,11 @@ namespace ov
 
 		std::optional<T> Front(int timeout = Infinite)
 		{
+			if (_ring != nullptr)
+			{
+				return FrontRing(timeout);
+			}
+
 			auto unique_lock = std::unique_lock(_mutex);
 
 			if (_stop)
@@ -159,8 +207,16 @@ namespace ov
 			return _front_node->data;
 		}
 
+		// Not supported in ring mode: the newest item may be taken by the consumer while it is copied
 		std::optional<T> Back(int timeout = Infinite)
 		{
+			if (_ring != nullptr)
+			{
+				OV_ASSERT(false, "Back() is not supported in ring mode");
+				logc(LOG_TAG, "[%u] Back() is not supported in ring mode", GetId());
+				return {};
+			}
+
 			auto unique_lock = std::unique_lock(_mutex);
 
 			if (_stop)
@@ -187,6 +243,11 @@ namespace ov
 
 		std::optional<T> Dequeue(int timeout = Infinite)
 		{
+			if (_ring != nullptr)
+			{
+				return DequeueRing(timeout);
+			}
+
 			auto unique_lock = std::unique_lock(_mutex);
 
 			if (_stop)
@@ -236,8 +297,90 @@ namespace ov
 			return value;
 		}
 
+		// Moves up to max_items items into the items vector (which is cleared first) in a single critical section.
+		// Waits until at least one item is available, the queue is stopped, WakeUp() is called or timed out.
+		// Returns the number of dequeued items.
+		size_t DequeueBatch(std::vector<T>& items, size_t max_items = MANAGED_QUEUE_DEFAULT_BATCH_SIZE, int timeout = Infinite)
+		{
+			items.clear();
+
+			if (max_items == 0)
+			{
+				return 0;
+			}
+
+			if (_ring != nullptr)
+			{
+				return DequeueBatchRing(items, max_items, timeout);
+			}
+
+			auto unique_lock = std::unique_lock(_mutex);
+
+			if (_stop)
+			{
+				return 0;  // Stop is requested
+			}
+
+			if (_size == 0)
+			{
+				std::chrono::system_clock::time_point expire = (timeout == Infinite) ? std::chrono::system_clock::time_point::max() : std::chrono::system_clock::now() + std::chrono::milliseconds(timeout);
+
+				auto result = _condition.wait_until(unique_lock, expire, [this]() -> bool {
+					return (((_size == 0) == false) || _stop || _wake_requested);
+				});
+
+				if (!result || _stop)
+				{
+					return 0;  // timed out / Stop is requested
+				}
+			}
+
+			_wake_requested = false;
+
+			if (_size == 0)
+			{
+				return 0;  // Woken up by WakeUp()
+			}
+
+			// Measure the waiting time of the oldest item only
+			if (_front_node->_start != std::chrono::high_resolution_clock::time_point::max())
+			{
+				auto current = std::chrono::high_resolution_clock::now();
+				_waiting_time_in_us = _waiting_time_in_us * 0.9 + std::chrono::duration_cast<std::chrono::microseconds>(current - _front_node->_start).count() * 0.1;
+			}
+
+			while ((_front_node != nullptr) && (items.size() < max_items))
+			{
+				ManagedQueueNode* node = _front_node;
+				_front_node = _front_node->next;
+
+				items.push_back(std::move(node->data));
+
+				delete node;
+			}
+
+			if (_front_node == nullptr)
+			{
+				_rear_node = nullptr;
+			}
+
+			_size -= items.size();
+
+			// Update statistics of output message count
+			_output_message_count += items.size();
+
+			UpdateMetrics();
+
+			return items.size();
+		}
+
 		bool IsEmpty() const
 		{
+			if (_ring != nullptr)
+			{
+				return _ring->IsEmpty();
+			}
+
 			auto lock_guard = std::lock_guard(_mutex);
 
 			return (_size == 0);
@@ -246,6 +389,14 @@ namespace ov
 		// Cleared all items in the queue
 		void Clear()
 		{
+			if (_ring != nullptr)
+			{
+				// The items are taken with CAS, so this can be called from any thread.
+				// _size is only updated by the consumer (UpdateMetrics()), and catches up at the next dequeue.
+				_ring->Clear();
+				return;
+			}
+
 			auto lock_guard = std::lock_guard(_mutex);
 
 			while (_front_node != nullptr)
@@ -264,13 +415,43 @@ namespace ov
 
 		size_t Size() const
 		{
+			if (_ring != nullptr)
+			{
+				return _ring->GetSize();
+			}
+
 			auto lock_guard = std::lock_guard(_mutex);
 
 			return _size;
 		}
 
+		// Wakes the consumer waiting in DequeueBatch() up without an item (DequeueBatch() returns 0 if the queue is empty),
+		// so that it can handle the events of another source (ex: a separate message queue)
+		void WakeUp()
+		{
+			if (_ring != nullptr)
+			{
+				_wake_requested = true;
+				_waiter.Notify();
+				return;
+			}
+
+			auto lock_guard = std::lock_guard(_mutex);
+
+			_wake_requested = true;
+
+			_condition.notify_all();
+		}
+
 		void Stop()
 		{
+			if (_ring != nullptr)
+			{
+				_stop = true;
+				_waiter.NotifyAll();
+				return;
+			}
+
 			auto lock_guard = std::lock_guard(_mutex);
 
 			_stop = true;
@@ -284,17 +465,186 @@ namespace ov
 		}
 
 	protected:
+		template <typename U>
+		void EnqueueRing(U&& item)
+		{
+			// Only a sample of items carries the enqueue time to avoid calling now() per item
+			auto sequence = _ring_input_count.fetch_add(1, std::memory_order_relaxed);
+			int64_t enqueue_time_in_us = ((sequence % MANAGED_QUEUE_LATENCY_SAMPLING_INTERVAL) == 0) ? GetSteadyTimeInUs() : 0;
+
+			if (_ring->TryPush(std::forward<U>(item), enqueue_time_in_us) == false)
+			{
+				_ring_drop_count.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+
+			_waiter.Notify();
+		}
+
+		// Wait until an item is available, the queue is stopped or timed out.
+		// Returns false if there is nothing to dequeue.
+		bool WaitRing(int timeout)
+		{
+			auto expire = (timeout == Infinite) ? std::chrono::steady_clock::time_point::max() : std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
+
+			while (true)
+			{
+				if (_stop)
+				{
+					return false;
+				}
+
+				if (_ring->IsEmpty() == false)
+				{
+					return true;
+				}
+
+				if (_wake_requested.exchange(false))
+				{
+					// Woken up by WakeUp()
+					return false;
+				}
+
+				int remaining = Infinite;
+				if (timeout != Infinite)
+				{
+					remaining = std::chrono::duration_cast<std::chrono::milliseconds>(expire - std::chrono::steady_clock::now()).count();
+					if (remaining <= 0)
+					{
+						return false;
+					}
+				}
+
+				auto token = _waiter.PrepareWait();
+
+				if ((_ring->IsEmpty() == false) || _stop || _wake_requested)
+				{
+					_waiter.CancelWait();
+					continue;
+				}
+
+				_waiter.Wait(token, remaining);
+			}
+		}
+
+		std::optional<T> FrontRing(int timeout)
+		{
+			if (WaitRing(timeout) == false)
+			{
+				return {};
+			}
+
+			return _ring->Peek();
+		}
+
+		std::optional<T> DequeueRing(int timeout)
+		{
+			while (WaitRing(timeout))
+			{
+				int64_t enqueue_time_in_us = 0;
+				auto value = _ring->TryPop(&enqueue_time_in_us);
+
+				if (value.has_value() == false)
+				{
+					// Taken by Clear() from another thread
+					continue;
+				}
+
+				_output_message_count++;
+
+				if (enqueue_time_in_us > 0)
+				{
+					_waiting_time_in_us = _waiting_time_in_us * 0.9 + (GetSteadyTimeInUs() - enqueue_time_in_us) * 0.1;
+				}
+
+				UpdateMetrics();
+
+				return value;
+			}
+
+			return {};
+		}
+
+		size_t DequeueBatchRing(std::vector<T>& items, size_t max_items, int timeout)
+		{
+			while (WaitRing(timeout))
+			{
+				while (items.size() < max_items)
+				{
+					int64_t enqueue_time_in_us = 0;
+					auto value = _ring->TryPop(&enqueue_time_in_us);
+
+					if (value.has_value() == false)
+					{
+						break;
+					}
+
+					if (enqueue_time_in_us > 0)
+					{
+						_waiting_time_in_us = _waiting_time_in_us * 0.9 + (GetSteadyTimeInUs() - enqueue_time_in_us) * 0.1;
+					}
+
+					items.push_back(std::move(value.value()));
+				}
+
+				if (items.empty())
+				{
+					// Taken by Clear() from another thread
+					continue;
+				}
+
+				_output_message_count += items.size();
+
+				UpdateMetrics();
+
+				break;
+			}
+
+			return items.size();
+		}
+
+		static int64_t GetSteadyTimeInUs()
+		{
+			return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+		}
+
 		// Update statistical metrics and send data to monitoring module.
+		// In ring mode, this is only called from the consumer thread.
 		void UpdateMetrics()
 		{
+			bool report_empty = (_size == 0);
+
+			if (_ring != nullptr)
+			{
+				_size = _ring->GetSize();
+				_drop_message_count = _ring_drop_count.load(std::memory_order_relaxed);
+
+				// Avoid reporting to the monitoring module every time the consumer catches up
+				report_empty = (_size == 0) && (_last_reported_size != 0);
+			}
+
 			// Update the peak statistics
 			if (_peak < _size)
 			{
 				_peak = _size;
 			}
 
-			if ((_timer.IsElapsed(_stats_metric_interval) && _timer.Update()) || (_size == 0))
+			if ((_timer.IsElapsed(_stats_metric_interval) && _timer.Update()) || report_empty)
 			{
+				if (_ring != nullptr)
+				{
+					_input_message_count = _ring_input_count.exchange(0, std::memory_order_relaxed);
+
+					if (_drop_message_count != _last_logged_drop_count)
+					{
+						auto shared_lock = std::shared_lock(_name_mutex);
+						logw(LOG_TAG, "[%u] %s ring is full, items are dropped: capacity: %zu, total dropped: %llu", GetId(), (_urn != nullptr) ? _urn->ToString().CStr() : "", _ring->GetCapacity(), static_cast<unsigned long long>(_drop_message_count));
+						_last_logged_drop_count = _drop_message_count;
+					}
+				}
+
+				_last_reported_size = _size;
+
 				// Update statistics of message per second
 				_input_message_per_second = _input_message_count;
 				_output_message_per_second = _output_message_count;
@@ -323,6 +673,8 @@ namespace ov
 		}
 
 	private:
+		ManagedQueueType _type = ManagedQueueType::LinkedList;
+
 		StopWatch _timer;
 
 		int _stats_metric_interval = 0;
@@ -339,7 +691,17 @@ namespace ov
 		std::condition_variable _condition;
 
 		// Stop flag
-		bool _stop;
+		std::atomic<bool> _stop;
+		// Set by WakeUp()
+		std::atomic<bool> _wake_requested{false};
+
+		// Ring mode (ManagedQueueType::MpscRing)
+		std::unique_ptr<RingBuffer<T>> _ring;
+		QueueWaiter _waiter;
+		std::atomic<size_t> _ring_input_count{0};
+		std::atomic<uint64_t> _ring_drop_count{0};
+		uint64_t _last_logged_drop_count = 0;
+		size_t _last_reported_size = 0;
 	};
 
 }  // namespace ov
\ No newline at end of file
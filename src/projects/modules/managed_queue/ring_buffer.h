@@ -0,0 +1,334 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by agent
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#if defined(__linux__)
+#	include <linux/futex.h>
+#	include <sys/syscall.h>
+#	include <time.h>
+#	include <unistd.h>
+#else
+#	include <condition_variable>
+#	include <mutex>
+#endif
+
+namespace ov
+{
+	// Bounded lock-free ring buffer (Dmitry Vyukov's sequence-per-slot algorithm).
+	//
+	// It is designed for many producers and one consumer, but the pop side is
+	// also CAS-protected so that Clear() from another thread (ex: Stop() of a worker)
+	// does not break the buffer. Slots are allocated once and reused.
+	template <typename T>
+	class RingBuffer
+	{
+	public:
+		explicit RingBuffer(size_t capacity)
+		{
+			_capacity = RoundUpToPowerOfTwo(std::max<size_t>(capacity, 2));
+			_mask = _capacity - 1;
+
+			_slots = new Slot[_capacity];
+			for (size_t index = 0; index < _capacity; index++)
+			{
+				_slots[index].sequence.store(index, std::memory_order_relaxed);
+			}
+		}
+
+		~RingBuffer()
+		{
+			Clear();
+
+			delete[] _slots;
+		}
+
+		RingBuffer(const RingBuffer &) = delete;
+		RingBuffer &operator=(const RingBuffer &) = delete;
+
+		size_t GetCapacity() const
+		{
+			return _capacity;
+		}
+
+		// Returns false if the buffer is full
+		template <typename U>
+		bool TryPush(U &&item, int64_t enqueue_time_in_us = 0)
+		{
+			Slot *slot = nullptr;
+			size_t position = _push_position.load(std::memory_order_relaxed);
+
+			while (true)
+			{
+				slot = &_slots[position & _mask];
+
+				size_t sequence = slot->sequence.load(std::memory_order_acquire);
+				intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+				if (diff == 0)
+				{
+					if (_push_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					{
+						break;
+					}
+				}
+				else if (diff < 0)
+				{
+					// Full
+					return false;
+				}
+				else
+				{
+					position = _push_position.load(std::memory_order_relaxed);
+				}
+			}
+
+			new (slot->Storage()) T(std::forward<U>(item));
+			slot->enqueue_time_in_us = enqueue_time_in_us;
+			slot->sequence.store(position + 1, std::memory_order_release);
+
+			return true;
+		}
+
+		// enqueue_time_in_us is set to the value given at TryPush() (0 if not sampled)
+		std::optional<T> TryPop(int64_t *enqueue_time_in_us = nullptr)
+		{
+			Slot *slot = nullptr;
+			size_t position = _pop_position.load(std::memory_order_relaxed);
+
+			while (true)
+			{
+				slot = &_slots[position & _mask];
+
+				size_t sequence = slot->sequence.load(std::memory_order_acquire);
+				intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+
+				if (diff == 0)
+				{
+					if (_pop_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					{
+						break;
+					}
+				}
+				else if (diff < 0)
+				{
+					// Empty
+					return std::nullopt;
+				}
+				else
+				{
+					position = _pop_position.load(std::memory_order_relaxed);
+				}
+			}
+
+			T *stored = std::launder(reinterpret_cast<T *>(slot->Storage()));
+			std::optional<T> value(std::move(*stored));
+			stored->~T();
+
+			if (enqueue_time_in_us != nullptr)
+			{
+				*enqueue_time_in_us = slot->enqueue_time_in_us;
+			}
+
+			slot->sequence.store(position + _mask + 1, std::memory_order_release);
+
+			return value;
+		}
+
+		// Copy of the oldest item without removing it.
+		// Only valid when called from the (single) consumer thread.
+		std::optional<T> Peek() const
+		{
+			size_t position = _pop_position.load(std::memory_order_relaxed);
+			const Slot *slot = &_slots[position & _mask];
+
+			if (slot->sequence.load(std::memory_order_acquire) != (position + 1))
+			{
+				return std::nullopt;
+			}
+
+			return *std::launder(reinterpret_cast<const T *>(slot->Storage()));
+		}
+
+		// Approximate number of items
+		size_t GetSize() const
+		{
+			size_t push_position = _push_position.load(std::memory_order_relaxed);
+			size_t pop_position = _pop_position.load(std::memory_order_relaxed);
+
+			return (push_position > pop_position) ? (push_position - pop_position) : 0;
+		}
+
+		bool IsEmpty() const
+		{
+			return GetSize() == 0;
+		}
+
+		size_t Clear()
+		{
+			size_t count = 0;
+
+			while (TryPop().has_value())
+			{
+				count++;
+			}
+
+			return count;
+		}
+
+	private:
+		struct Slot
+		{
+			std::atomic<size_t> sequence;
+			int64_t enqueue_time_in_us = 0;
+			typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+
+			void *Storage()
+			{
+				return &storage;
+			}
+
+			const void *Storage() const
+			{
+				return &storage;
+			}
+		};
+
+		static size_t RoundUpToPowerOfTwo(size_t value)
+		{
+			size_t result = 1;
+
+			while (result < value)
+			{
+				result <<= 1;
+			}
+
+			return result;
+		}
+
+		size_t _capacity = 0;
+		size_t _mask = 0;
+		Slot *_slots = nullptr;
+
+		// Keep producers and consumer on different cache lines
+		alignas(64) std::atomic<size_t> _push_position{0};
+		alignas(64) std::atomic<size_t> _pop_position{0};
+	};
+
+	// Lightweight wakeup primitive for a single waiting consumer.
+	//
+	// Producers only enter the kernel when the consumer is actually parked, so
+	// a burst of N enqueues costs at most one wakeup instead of N notify_all() calls.
+	class QueueWaiter
+	{
+	public:
+		// Returns a token that must be passed to Wait(). Take it *before*
+		// checking the condition to avoid lost wakeups.
+		uint32_t PrepareWait()
+		{
+			_waiting.store(true, std::memory_order_seq_cst);
+			return _sequence.load(std::memory_order_seq_cst);
+		}
+
+		void CancelWait()
+		{
+			_waiting.store(false, std::memory_order_relaxed);
+		}
+
+		// Returns false on timeout
+		bool Wait(uint32_t token, int timeout_in_msec)
+		{
+			bool result = true;
+
+#if defined(__linux__)
+			struct timespec timeout;
+			struct timespec *timeout_ptr = nullptr;
+
+			if (timeout_in_msec >= 0)
+			{
+				timeout.tv_sec = timeout_in_msec / 1000;
+				timeout.tv_nsec = (timeout_in_msec % 1000) * 1000000L;
+				timeout_ptr = &timeout;
+			}
+
+			auto ret = ::syscall(SYS_futex, reinterpret_cast<uint32_t *>(&_sequence), FUTEX_WAIT_PRIVATE, token, timeout_ptr, nullptr, 0);
+			if ((ret == -1) && (errno == ETIMEDOUT))
+			{
+				result = false;
+			}
+#else
+			auto lock = std::unique_lock(_mutex);
+			auto predicate = [this, token]() -> bool {
+				return _sequence.load(std::memory_order_acquire) != token;
+			};
+
+			if (timeout_in_msec < 0)
+			{
+				_condition.wait(lock, predicate);
+			}
+			else
+			{
+				result = _condition.wait_for(lock, std::chrono::milliseconds(timeout_in_msec), predicate);
+			}
+#endif
+
+			_waiting.store(false, std::memory_order_relaxed);
+
+			return result;
+		}
+
+		void Notify()
+		{
+			_sequence.fetch_add(1, std::memory_order_seq_cst);
+
+			if (_waiting.load(std::memory_order_seq_cst))
+			{
+				Wake();
+			}
+		}
+
+		// Wakes the consumer unconditionally (used for Stop())
+		void NotifyAll()
+		{
+			_sequence.fetch_add(1, std::memory_order_seq_cst);
+			Wake();
+		}
+
+	private:
+		void Wake()
+		{
+#if defined(__linux__)
+			::syscall(SYS_futex, reinterpret_cast<uint32_t *>(&_sequence), FUTEX_WAKE_PRIVATE, INT32_MAX, nullptr, nullptr, 0);
+#else
+			auto lock = std::lock_guard(_mutex);
+			_condition.notify_all();
+#endif
+		}
+
+		static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "futex requires a plain 32-bit word");
+
+		std::atomic<uint32_t> _sequence{0};
+		std::atomic<bool> _waiting{false};
+
+#if !defined(__linux__)
+		std::mutex _mutex;
+		std::condition_variable _condition;
+#endif
+	};
+}  // namespace ov
@@ -74,6 +74,7 @@ bool PhysicalPort::Create(const char *name,
 						  ov::SocketType type,
 						  const ov::SocketAddress &address,
 						  int worker_count,
+						  bool sharded,
 						  int send_buffer_size,
 						  int recv_buffer_size,
 						  const OnSocketCreated on_socket_created)
@@ -86,10 +87,17 @@ bool PhysicalPort::Create(const char *name,
 
 	_name = name;
 
-	logtd("Trying to start physical port [%s] on %s/%s (worker: %d, send_buffer_size: %d, recv_buffer_size: %d)...",
+	if (sharded && (type == ov::SocketType::Srt))
+	{
+		// SRT multiplexes all connections of a port over one UDP socket, so it cannot have a listener per worker
+		logtw("Sharded workers are not supported for SRT - physical port [%s] will use a single listener", name);
+		sharded = false;
+	}
+
+	logtd("Trying to start physical port [%s] on %s/%s (worker: %d%s, send_buffer_size: %d, recv_buffer_size: %d)...",
 		  name,
 		  address.ToString().CStr(), ov::StringFromSocketType(type),
-		  worker_count, send_buffer_size, recv_buffer_size);
+		  worker_count, sharded ? " (sharded)" : "", send_buffer_size, recv_buffer_size);
 
 	bool result = false;
 
@@ -97,11 +105,11 @@ bool PhysicalPort::Create(const char *name,
 	{
 		case ov::SocketType::Srt:
 		case ov::SocketType::Tcp:
-			result = CreateServerSocket(name, type, address, worker_count, send_buffer_size, recv_buffer_size, on_socket_created);
+			result = CreateServerSocket(name, type, address, worker_count, sharded, send_buffer_size, recv_buffer_size, on_socket_created);
 			break;
 
 		case ov::SocketType::Udp:
-			result = CreateDatagramSocket(name, type, address, worker_count, on_socket_created);
+			result = CreateDatagramSocket(name, type, address, worker_count, sharded, on_socket_created);
 			break;
 
 		case ov::SocketType::Unknown:
@@ -112,11 +120,46 @@ bool PhysicalPort::Create(const char *name,
 	return result;
 }
 
+template <typename Tsocket, typename... Targuments>
+std::shared_ptr<Tsocket> PhysicalPort::AllocSocket(int worker_index, const ov::SocketAddress &address, const OnSocketCreated &on_socket_created, Targuments... args)
+{
+	auto socket = (worker_index >= 0)
+					  ? _socket_pool->AllocSocketOnWorker<Tsocket>(worker_index, address.GetFamily(), args...)
+					  : _socket_pool->AllocSocket<Tsocket>(address.GetFamily(), args...);
+
+	if (socket == nullptr)
+	{
+		return nullptr;
+	}
+
+	// SO_REUSEPORT must be set before bind() so that the listeners of all workers can share the address
+	if ((worker_index >= 0) && (socket->template SetSockOpt<int>(SO_REUSEPORT, 1) == false))
+	{
+		logte("Could not set SO_REUSEPORT option to %s", socket->ToString().CStr());
+	}
+	else
+	{
+		const std::shared_ptr<ov::Error> error = (on_socket_created != nullptr) ? on_socket_created(socket) : nullptr;
+
+		if (error == nullptr)
+		{
+			return socket;
+		}
+
+		logte("An error occurred while initializing socket: %s", error->What());
+	}
+
+	_socket_pool->ReleaseSocket(socket);
+
+	return nullptr;
+}
+
 bool PhysicalPort::CreateServerSocket(
 	const char *name,
 	ov::SocketType type,
 	const ov::SocketAddress &address,
 	int worker_count,
+	bool sharded,
 	int send_buffer_size,
 	int recv_buffer_size,
 	const OnSocketCreated on_socket_created)
@@ -125,33 +168,47 @@ bool PhysicalPort::CreateServerSocket(
 
 	if (_socket_pool != nullptr)
 	{
-		if (_socket_pool->Initialize(worker_count))
+		if (_socket_pool->Initialize(worker_count, sharded))
 		{
-			auto socket = _socket_pool->AllocSocket<ov::ServerSocket>(address.GetFamily(), _socket_pool);
+			auto listener_count = sharded ? worker_count : 1;
+			std::vector<std::shared_ptr<ov::ServerSocket>> socket_list;
 
-			if (socket != nullptr)
+			for (int index = 0; index < listener_count; index++)
 			{
-				const std::shared_ptr<ov::Error> error = (on_socket_created != nullptr) ? on_socket_created(socket) : nullptr;
+				auto socket = AllocSocket<ov::ServerSocket>(sharded ? index : -1, address, on_socket_created, _socket_pool);
 
-				if (error != nullptr)
+				if (socket == nullptr)
 				{
-					logte("An error occurred while initializing socket: %s", error->What());
+					break;
 				}
-				else if (socket->Prepare(
-							 address,
-							 std::bind(&PhysicalPort::OnClientConnectionStateChanged, this,
-									   std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-							 std::bind(&PhysicalPort::OnClientData, this,
-									   std::placeholders::_1, std::placeholders::_2),
-							 send_buffer_size, recv_buffer_size, 4096))
-				{
-					_type = type;
-					_server_socket = socket;
-					_address = address;
 
-					return true;
+				if (socket->Prepare(
+						address,
+						std::bind(&PhysicalPort::OnClientConnectionStateChanged, this,
+								  std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
+						std::bind(&PhysicalPort::OnClientData, this,
+								  std::placeholders::_1, std::placeholders::_2),
+						send_buffer_size, recv_buffer_size, 4096) == false)
+				{
+					_socket_pool->ReleaseSocket(socket);
+					break;
 				}
 
+				socket_list.push_back(socket);
+			}
+
+			if ((listener_count > 0) && (static_cast<int>(socket_list.size()) == listener_count))
+			{
+				_type = type;
+				_server_socket = socket_list[0];
+				_shard_socket_list.assign(socket_list.begin() + 1, socket_list.end());
+				_address = address;
+
+				return true;
+			}
+
+			for (auto &socket : socket_list)
+			{
 				_socket_pool->ReleaseSocket(socket);
 			}
 
@@ -171,36 +228,54 @@ bool PhysicalPort::CreateDatagramSocket(
 	ov::SocketType type,
 	const ov::SocketAddress &address,
 	int worker_count,
+	bool sharded,
 	const OnSocketCreated on_socket_created)
 {
 	_socket_pool = ov::SocketPool::Create(GetSocketPoolName(type, name, address), type);
 
 	if (_socket_pool != nullptr)
 	{
-		if (_socket_pool->Initialize(worker_count))
+		if (_socket_pool->Initialize(worker_count, sharded))
 		{
-			auto socket = _socket_pool->AllocSocket<ov::DatagramSocket>(address.GetFamily());
+			// The kernel distributes datagrams to the sockets by the hash of the 4-tuple,
+			// so the datagrams of a peer are always received by the same worker
+			auto socket_count = sharded ? worker_count : 1;
+			std::vector<std::shared_ptr<ov::DatagramSocket>> socket_list;
 
-			if (socket != nullptr)
+			for (int index = 0; index < socket_count; index++)
 			{
-				const std::shared_ptr<ov::Error> error = (on_socket_created != nullptr) ? on_socket_created(socket) : nullptr;
+				auto socket = AllocSocket<ov::DatagramSocket>(sharded ? index : -1, address, on_socket_created);
 
-				if (error != nullptr)
+				if (socket == nullptr)
 				{
-					logte("An error occurred while initializing socket: %s", error->What());
+					break;
 				}
-				else if (socket->Prepare(
-							 address,
-							 std::bind(&PhysicalPort::OnDatagram, this,
-									   std::placeholders::_1, std::placeholders::_2, std::placeholders::_3)))
-				{
-					_type = type;
-					_datagram_socket = socket;
-					_address = address;
 
-					return true;
+				if (socket->Prepare(
+						address,
+						ov::DatagramBatchCallback(
+							std::bind(&PhysicalPort::OnDatagrams, this,
+									  std::placeholders::_1, std::placeholders::_2))) == false)
+				{
+					_socket_pool->ReleaseSocket(socket);
+					break;
 				}
 
+				socket_list.push_back(socket);
+			}
+
+			if ((socket_count > 0) && (static_cast<int>(socket_list.size()) == socket_count))
+			{
+				_type = type;
+				_datagram_socket = socket_list[0];
+				_shard_socket_list.assign(socket_list.begin() + 1, socket_list.end());
+				_address = address;
+
+				return true;
+			}
+
+			for (auto &socket : socket_list)
+			{
 				_socket_pool->ReleaseSocket(socket);
 			}
 
@@ -283,12 +358,12 @@ void PhysicalPort::OnClientData(const std::shared_ptr<ov::ClientSocket> &client,
 	}
 }
 
-void PhysicalPort::OnDatagram(const std::shared_ptr<ov::DatagramSocket> &client, const ov::SocketAddressPair &address_pair, const std::shared_ptr<ov::Data> &data)
+void PhysicalPort::OnDatagrams(const std::shared_ptr<ov::DatagramSocket> &client, const std::vector<ov::Datagram> &datagrams)
 {
 	// Notify observers
 	for (auto &observer : _observer_list)
 	{
-		observer->OnDatagramReceived(client, address_pair, data);
+		observer->OnDatagramsReceived(client, datagrams);
 	}
 }
 
@@ -304,6 +379,12 @@ bool PhysicalPort::Close()
 		_datagram_socket = nullptr;
 	}
 
+	for (auto &shard_socket : _shard_socket_list)
+	{
+		_socket_pool->ReleaseSocket(shard_socket);
+	}
+	_shard_socket_list.clear();
+
 	_socket_pool->Uninitialize();
 	_socket_pool = nullptr;
 
@@ -390,6 +471,11 @@ ov::String PhysicalPort::ToString() const
 		description.AppendFormat(", socket: %s", _server_socket->ToString().CStr());
 	}
 
+	if (_shard_socket_list.empty() == false)
+	{
+		description.AppendFormat(", shards: %zu", _shard_socket_list.size() + 1);
+	}
+
 	description.Append('>');
 
 	return description;
@@ -36,10 +36,12 @@ public:
 
 	virtual ~PhysicalPort();
 
+	// If sharded is true, each worker has its own listener bound to the address (SO_REUSEPORT) and is pinned to a CPU
 	bool Create(const char *name,
 				ov::SocketType type,
 				const ov::SocketAddress &address,
 				int worker_count,
+				bool sharded,
 				int send_buffer_size,
 				int recv_buffer_size,
 				const OnSocketCreated on_socket_created);
@@ -81,6 +83,11 @@ public:
 		return _socket_pool->GetWorkerCount();
 	}
 
+	bool IsSharded() const
+	{
+		return _socket_pool->IsSharded();
+	}
+
 	bool AddObserver(PhysicalPortObserver *observer);
 
 	bool RemoveObserver(PhysicalPortObserver *observer);
@@ -92,6 +99,7 @@ protected:
 							ov::SocketType type,
 							const ov::SocketAddress &address,
 							int worker_count,
+							bool sharded,
 							int send_buffer_size,
 							int recv_buffer_size,
 							const OnSocketCreated on_socket_created);
@@ -100,14 +108,20 @@ protected:
 							  ov::SocketType type,
 							  const ov::SocketAddress &address,
 							  int worker_count,
+							  bool sharded,
 							  const OnSocketCreated on_socket_created);
 
+	// Allocates a socket to the worker (or the idle worker if worker_index is -1)
+	// If the socket is for a shard, SO_REUSEPORT is enabled before calling on_socket_created
+	template <typename Tsocket, typename... Targuments>
+	std::shared_ptr<Tsocket> AllocSocket(int worker_index, const ov::SocketAddress &address, const OnSocketCreated &on_socket_created, Targuments... args);
+
 	// For TCP physical port
 	void OnClientConnectionStateChanged(const std::shared_ptr<ov::ClientSocket> &client, ov::SocketConnectionState state, const std::shared_ptr<ov::Error> &error);
 	void OnClientData(const std::shared_ptr<ov::ClientSocket> &client, const std::shared_ptr<const ov::Data> &data);
 
 	// For UDP physical port
-	void OnDatagram(const std::shared_ptr<ov::DatagramSocket> &client, const ov::SocketAddressPair &address_pair, const std::shared_ptr<ov::Data> &data);
+	void OnDatagrams(const std::shared_ptr<ov::DatagramSocket> &client, const std::vector<ov::Datagram> &datagrams);
 
 	ov::String _name;
 	std::shared_ptr<ov::SocketPool> _socket_pool;
@@ -115,8 +129,10 @@ protected:
 	ov::SocketType _type = ov::SocketType::Unknown;
 	ov::SocketAddress _address;
 
+	// In sharded mode, these are the sockets of the first worker, and the rest are stored in _shard_socket_list
 	std::shared_ptr<ov::ServerSocket> _server_socket;
 	std::shared_ptr<ov::DatagramSocket> _datagram_socket;
+	std::vector<std::shared_ptr<ov::Socket>> _shard_socket_list;
 
 	std::atomic<int> _ref_count{0};
 
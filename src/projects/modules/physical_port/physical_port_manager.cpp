@@ -22,6 +22,7 @@ std::shared_ptr<PhysicalPort> PhysicalPortManager::CreatePort(const char *name,
 															  ov::SocketType type,
 															  const ov::SocketAddress &address,
 															  int worker_count,
+															  bool sharded,
 															  int send_buffer_size,
 															  int recv_buffer_size,
 															  const PhysicalPort::OnSocketCreated on_socket_created)
@@ -34,14 +35,14 @@ std::shared_ptr<PhysicalPort> PhysicalPortManager::CreatePort(const char *name,
 
 	if (worker_count == PHYSICAL_PORT_USE_DEFAULT_COUNT)
 	{
-		worker_count = PHYSICAL_PORT_DEFAULT_WORKER_COUNT;
+		worker_count = ov::ThreadTopology::GetInstance()->GetThreadCount(OV_THREAD_POOL_SOCKET_POOL, PHYSICAL_PORT_DEFAULT_WORKER_COUNT);
 	}
 
 	if (item == _port_list.end())
 	{
 		port = std::make_shared<PhysicalPort>(PhysicalPort::PrivateToken{nullptr});
 
-		if (port->Create(name, type, address, worker_count, send_buffer_size, recv_buffer_size, on_socket_created))
+		if (port->Create(name, type, address, worker_count, sharded, send_buffer_size, recv_buffer_size, on_socket_created))
 		{
 			_port_list[key] = port;
 		}
@@ -64,6 +65,12 @@ std::shared_ptr<PhysicalPort> PhysicalPortManager::CreatePort(const char *name,
 			logtw("The number of workers in the existing socket pool differs from the number of workers passed by the argument: socket pool: %d, argument: %d",
 				  port->GetWorkerCount(), worker_count);
 		}
+
+		if ((port->IsSharded() != sharded) && (type != ov::SocketType::Srt))
+		{
+			logtw("The sharding mode of the existing socket pool differs from the argument: socket pool: %s, argument: %s",
+				  ov::Converter::ToString(port->IsSharded()).CStr(), ov::Converter::ToString(sharded).CStr());
+		}
 	}
 
 	return port;
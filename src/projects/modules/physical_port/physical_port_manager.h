@@ -24,10 +24,12 @@ public:
 	virtual ~PhysicalPortManager();
 
 	// name is up to 9 characters including null
+	// If sharded is true, each worker has its own listener (SO_REUSEPORT) and is pinned to a CPU
 	std::shared_ptr<PhysicalPort> CreatePort(const char *name,
 											 ov::SocketType type,
 											 const ov::SocketAddress &address,
 											 int worker_count = PHYSICAL_PORT_USE_DEFAULT_COUNT,
+											 bool sharded = false,
 											 int send_buffer_size = 0,
 											 int recv_buffer_size = 0,
 											 const PhysicalPort::OnSocketCreated on_socket_created = nullptr);
@@ -12,6 +12,7 @@
 #include <base/ovsocket/ovsocket.h>
 
 #include <memory>
+#include <vector>
 
 class PhysicalPort;
 
@@ -48,6 +49,17 @@ public:
 	// Called when the packet is received (Only used when UDP)
 	virtual void OnDatagramReceived(const std::shared_ptr<ov::Socket> &remote, const ov::SocketAddressPair &address_pair, const std::shared_ptr<const ov::Data> &data) {}
 
+	// Called with the datagrams read at once by recvmmsg() (Only used when UDP)
+	// A buffer is reused by the socket only after every reference to it is released,
+	// so it is safe to keep the data for later use.
+	virtual void OnDatagramsReceived(const std::shared_ptr<ov::Socket> &remote, const std::vector<ov::Datagram> &datagrams)
+	{
+		for (const auto &datagram : datagrams)
+		{
+			OnDatagramReceived(remote, datagram.address_pair, datagram.data);
+		}
+	}
+
 	// Called when the client is disconnected
 	virtual void OnDisconnected(const std::shared_ptr<ov::Socket> &remote, PhysicalPortDisconnectReason reason, const std::shared_ptr<const ov::Error> &error) {}
 
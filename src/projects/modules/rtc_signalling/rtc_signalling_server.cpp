@@ -195,7 +195,7 @@ bool RtcSignallingServer::Start(
 	const std::vector<ov::String> &ip_list,
 	bool is_port_configured, uint16_t port,
 	bool is_tls_port_configured, uint16_t tls_port,
-	int worker_count, std::shared_ptr<http::svr::ws::Interceptor> interceptor)
+	int worker_count, bool sharded, std::shared_ptr<http::svr::ws::Interceptor> interceptor)
 {
 	if ((_http_server_list.empty() == false) || (_https_server_list.empty() == false))
 	{
@@ -227,7 +227,7 @@ bool RtcSignallingServer::Start(
 			[&](const ov::SocketAddress &address, bool is_https, const std::shared_ptr<http::svr::HttpServer> &http_server) {
 				http_server->AddInterceptor(interceptor);
 			},
-			worker_count))
+			worker_count, sharded))
 	{
 		if (PrepareForTCPRelay() && PrepareForExternalIceServer())
 		{
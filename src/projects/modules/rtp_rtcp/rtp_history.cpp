@@ -1,64 +1,130 @@
 #include "rtp_history.h"
 
+#include <string.h>
+
+#include <thread>
+
+#define OV_LOG_TAG "RtpRtcp"
+
+// The reader gives up if the slot is being written again and again
+#define MAX_READ_RETRIES	4
+
+// Copies the bytes to the atomic words of the slot
+static void StoreWords(std::atomic<uint64_t> *words, const uint8_t *data, size_t length)
+{
+	for (size_t offset = 0; offset < length; offset += sizeof(uint64_t))
+	{
+		uint64_t word = 0;
+		::memcpy(&word, data + offset, std::min(sizeof(uint64_t), length - offset));
+
+		words[offset / sizeof(uint64_t)].store(word, std::memory_order_relaxed);
+	}
+}
+
+// Copies the atomic words of the slot to the bytes
+static void LoadWords(const std::atomic<uint64_t> *words, uint8_t *data, size_t length)
+{
+	for (size_t offset = 0; offset < length; offset += sizeof(uint64_t))
+	{
+		auto word = words[offset / sizeof(uint64_t)].load(std::memory_order_relaxed);
+
+		::memcpy(data + offset, &word, std::min(sizeof(uint64_t), length - offset));
+	}
+}
+
 RtpHistory::RtpHistory(uint8_t origin_payload_type, uint8_t rtx_payload_type, uint32_t rtx_ssrc, uint32_t max_history_size)
 {
 	_origin_paylod_type = origin_payload_type;
 	_rtx_paylod_type = rtx_payload_type;
 	_rtx_ssrc = rtx_ssrc;
-	_max_history_size = max_history_size;
 
-	_history.reserve(_max_history_size);
+	// Round up to the power of two, so the index is the lower bits of the sequence number
+	// (and the ring doesn't jump when the sequence number wraps around)
+	uint32_t slot_count = 1;
+	while ((slot_count < max_history_size) && (slot_count < 0x10000))
+	{
+		slot_count <<= 1;
+	}
+
+	_slots = std::make_unique<Slot[]>(slot_count);
+	_index_mask = slot_count - 1;
 }
 
-// Converting to RtxRtpPacket
 bool RtpHistory::StoreRtpPacket(const std::shared_ptr<RtpPacket> &packet)
 {
-	std::lock_guard<std::shared_mutex> guard(_history_lock);
+	auto data = packet->GetData();
+	if ((data == nullptr) || (data->GetLength() > RTP_DEFAULT_MAX_PACKET_SIZE))
+	{
+		logtw("Could not store the RTP packet (%zu bytes) for RTX", (data != nullptr) ? data->GetLength() : 0);
+		return false;
+	}
+
+	std::lock_guard<std::mutex> guard(_store_lock);
+
+	auto &slot = _slots[GetIndex(packet->SequenceNumber())];
+
+	auto version = slot._version.load(std::memory_order_relaxed);
+	slot._version.store(version + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
 
-	_history[GetIndex(packet->SequenceNumber())] = packet;
+	slot._sequence_number.store(packet->SequenceNumber(), std::memory_order_relaxed);
+	slot._created_time_ms.store(ov::Clock::NowMSec(), std::memory_order_relaxed);
+	slot._length.store(data->GetLength(), std::memory_order_relaxed);
+	StoreWords(slot._data, data->GetDataAs<uint8_t>(), data->GetLength());
+
+	slot._version.store(version + 2, std::memory_order_release);
 
 	return true;
 }
 
 std::shared_ptr<RtxRtpPacket> RtpHistory::GetRtxRtpPacket(uint16_t seq_no)
 {
-	auto index = GetIndex(seq_no);
-	// First, look in the cache
-	std::shared_lock<std::shared_mutex> cache_read_guard(_history_cache_lock);
-	auto cache_item = _history_cache.find(index);
-	if(cache_item != _history_cache.end())
+	auto &slot = _slots[GetIndex(seq_no)];
+	auto data = std::make_shared<ov::Data>(RTP_DEFAULT_MAX_PACKET_SIZE);
+
+	for (int retry = 0; retry < MAX_READ_RETRIES; retry++)
 	{
-		// Found!
-		auto rtx_packet = cache_item->second;
-		
-		if(rtx_packet->GetOriginalSequenceNumber() == seq_no)// && ov::Clock::GetElapsedMiliSecondsFromNow(rtx_packet->GetCreatedTime()) < VALID_TIME_MS_STORED_RTP_PACKET)
+		auto version = slot._version.load(std::memory_order_acquire);
+		if ((version & 1) != 0)
 		{
-			return rtx_packet;
+			// Being written - if it is overwritten by another packet, the requested one is gone
+			if (slot._sequence_number.load(std::memory_order_relaxed) != seq_no)
+			{
+				return nullptr;
+			}
+
+			// Let the writer finish
+			std::this_thread::yield();
+			continue;
 		}
-	}
-	cache_read_guard.unlock();
 
-	// find in rtp history
-	std::shared_lock<std::shared_mutex> history_guard(_history_lock);
-	auto rtp_item = _history.find(index);
-	if(rtp_item != _history.end())
-	{
-		auto rtp_packet = rtp_item->second;
-		history_guard.unlock();
+		auto sequence_number = slot._sequence_number.load(std::memory_order_relaxed);
+		auto created_time_ms = slot._created_time_ms.load(std::memory_order_relaxed);
+		auto length = std::min<size_t>(slot._length.load(std::memory_order_relaxed), RTP_DEFAULT_MAX_PACKET_SIZE);
+
+		data->SetLength(length);
+		LoadWords(slot._data, data->GetWritableDataAs<uint8_t>(), length);
 
-		// now, I consider all requests are valid because webrtc player doesn't ask for too old packet anyway 
-		//auto elapsed_ms = ov::Clock::GetElapsedMiliSecondsFromNow(rtp_packet->GetCreatedTime());
-		//if(elapsed_ms < VALID_TIME_MS_STORED_RTP_PACKET)
-		if(rtp_packet->SequenceNumber() == seq_no)
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (slot._version.load(std::memory_order_relaxed) != version)
 		{
-			// Create Rtx Packet and store it
-			auto rtx_packet = std::make_shared<RtxRtpPacket>(GetRtxSsrc(), GetRtxPayloadType(), *rtp_packet);
+			// Overwritten while copying
+			continue;
+		}
 
-			std::lock_guard<std::shared_mutex> cache_write_guard(_history_cache_lock);
-			_history_cache[index] = rtx_packet;
-			
-			return rtx_packet;
+		if ((version == 0) || (sequence_number != seq_no) ||
+			(ov::Clock::NowMSec() - created_time_ms > VALID_TIME_MS_STORED_RTP_PACKET))
+		{
+			return nullptr;
 		}
+
+		RtpPacket rtp_packet;
+		if (rtp_packet.Parse(data) == false)
+		{
+			return nullptr;
+		}
+
+		return std::make_shared<RtxRtpPacket>(GetRtxSsrc(), GetRtxPayloadType(), rtp_packet);
 	}
 
 	return nullptr;
@@ -79,7 +145,7 @@ uint8_t RtpHistory::GetRtxPayloadType()
 	return _rtx_paylod_type;
 }
 
-uint16_t RtpHistory::GetIndex(uint16_t seq_no)
+uint16_t RtpHistory::GetIndex(uint16_t seq_no) const
 {
-	return seq_no % _max_history_size;
-}
\ No newline at end of file
+	return seq_no & _index_mask;
+}
@@ -1,6 +1,11 @@
 #pragma once
 
 #include <base/ovlibrary/ovlibrary.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+
 #include "rtx_rtp_packet.h"
 
 // WebRTC-Native-Code uses 9600 value
@@ -8,13 +13,23 @@
 // Stored RTP packet is only valid for 3 second after being created
 #define VALID_TIME_MS_STORED_RTP_PACKET	3000
 
+// History of the RTP packets of a stream for the retransmission (RTX)
+//
+// The packets are stored inline in a ring of power-of-two size indexed by the sequence number.
+// The stream is the only writer, and thousands of sessions read the packets requested by NACK,
+// so each slot is protected by a sequence lock: the version of the slot is odd while it is written,
+// and the reader retries if the version is changed while it copies the packet. The readers never block the writer.
+// The payload is copied with relaxed atomic words, so a torn read is discarded by the version check instead of being a data race.
+//
+// The RtxRtpPacket is built for every request (the sequence number of the RTX is different for each session),
+// so it can be modified by the session without copying.
 class RtpHistory
 {
 public:
 	RtpHistory(uint8_t origin_payload_type, uint8_t rtx_payload_type, uint32_t rtx_ssrc, uint32_t max_history_size = DEFAULT_MAX_HISTORY_CAPACITY);
 
-	// Converting to RtxRtpPacket
 	bool StoreRtpPacket(const std::shared_ptr<RtpPacket> &packet);
+	// Returns nullptr if the packet has been overwritten or expired
 	std::shared_ptr<RtxRtpPacket> GetRtxRtpPacket(uint16_t seq_no);
 
 	uint8_t	GetOriginPayloadType();
@@ -22,31 +37,28 @@ public:
 	uint8_t GetRtxPayloadType();
 
 private:
-	uint16_t GetIndex(uint16_t seq_no);
-	
-	// This map maps a hash(made with "origin sequence number" % max_history_size) and an RtpPacket.
-	// And this map never erases items for performance reason. 
-
-	// Yes, this map will have a collision once per max_history_size. 
-	// However, the default value of 9600 is a very large value, and collision packets 
-	// with 9600 sequence number differences are very old packets. 
-	// Since RTP packets have a creation time, old packets may not be used. 
-	// This can avoid collision. Therefore, set max_history_size to a large value as possible.
-	std::shared_mutex	_history_lock;
-	std::unordered_map<uint16_t, std::shared_ptr<RtpPacket>> _history;
-
-	// Creating RtxRtpPacket requires computing resources, but not all of them are used
-	// (only for packets requested by the session with NACK). 
-	// Therefore, it is unnecessary to create all packets with RtxRtpPacket in advance. 
-	// It is also wasteful to create another RtxRtpPacket once created. 
-	// When GetRtxRtpPacket() is called, it first looks for a packet in the cache and 
-	// checks if it is valid (by creation time). 
-	// If it is not valid, a new RtxRtpPacket is created, cached, and returned.
-	std::shared_mutex	_history_cache_lock;
-	std::unordered_map<uint16_t, std::shared_ptr<RtxRtpPacket>> _history_cache;
+	struct Slot
+	{
+		// Odd while the slot is written
+		std::atomic<uint32_t> _version{0};
+
+		// The fields are read while they are written, so they are atomics (relaxed, ordered by _version)
+		std::atomic<uint16_t> _sequence_number{0};
+		std::atomic<uint64_t> _created_time_ms{0};
+		std::atomic<size_t> _length{0};
+		std::atomic<uint64_t> _data[(RTP_DEFAULT_MAX_PACKET_SIZE + sizeof(uint64_t) - 1) / sizeof(uint64_t)];
+	};
+
+	uint16_t GetIndex(uint16_t seq_no) const;
+
+	std::unique_ptr<Slot[]> _slots;
+	// The number of slots (power of two) - 1
+	uint32_t _index_mask;
+
+	// Serializes the writers (there is usually only one)
+	std::mutex _store_lock;
 
 	uint8_t		_origin_paylod_type;
 	uint32_t	_rtx_ssrc;
 	uint8_t		_rtx_paylod_type;
-	uint32_t	_max_history_size;
-};
\ No newline at end of file
+};
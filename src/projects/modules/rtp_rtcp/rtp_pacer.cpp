@@ -0,0 +1,336 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by agent
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "rtp_pacer.h"
+
+#include <math.h>
+
+#include <algorithm>
+
+#define OV_LOG_TAG "Pacer"
+
+// The budget can hold at least a packet (MTU), even if the burst is too small at a low bitrate
+#define MIN_BUDGET_BYTES			1500
+
+// The queue is processed at this interval while probing (to send the padding)
+#define PADDING_INTERVAL_MS			5
+
+// Wait at least 1ms (the timeout of the worker is in milliseconds)
+#define MIN_PROCESS_DELAY_MS		1
+
+// Window to measure the incoming bitrate
+#define INCOMING_BITRATE_WINDOW_US	1000000
+
+RtpPacer::RtpPacer(int64_t estimated_bitrate, double factor, int64_t burst_ms, int64_t max_queue_delay_ms)
+	: _estimated_bitrate(estimated_bitrate),
+	  _factor(factor),
+	  _burst_ms(burst_ms),
+	  _max_queue_delay_us(max_queue_delay_ms * 1000)
+{
+	// The first burst is allowed
+	_media_budget_bytes = GetMaxBudgetBytes(GetPacingBitrate());
+}
+
+void RtpPacer::SetEstimatedBitrate(int64_t bitrate)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	_estimated_bitrate = bitrate;
+}
+
+void RtpPacer::StartProbe(int64_t bitrate, int64_t duration_ms, int64_t now_us)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	UpdateBudget(now_us);
+
+	_probe_bitrate = bitrate;
+	_probe_end_us = now_us + (duration_ms * 1000);
+	_padding_budget_bytes = 0.0;
+
+	logtd("Probe is started (bitrate: %lld, duration: %lldms)", bitrate, duration_ms);
+}
+
+void RtpPacer::StopProbe()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	_probe_bitrate = 0;
+	_probe_end_us = -1;
+	_padding_budget_bytes = 0.0;
+}
+
+bool RtpPacer::IsProbing(int64_t now_us) const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	return (_probe_bitrate > 0) && (now_us < _probe_end_us);
+}
+
+void RtpPacer::Enqueue(const std::shared_ptr<RtpPacket> &rtp_packet, uint16_t sequence_number, int64_t now_us)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	Packet packet;
+	packet.rtp_packet = rtp_packet;
+	packet.sequence_number = sequence_number;
+	packet.enqueue_time_us = now_us;
+
+	UpdateIncomingBitrate(rtp_packet->GetData()->GetLength(), now_us);
+
+	if (rtp_packet->IsVideoPacket())
+	{
+		_queued_video_bytes += rtp_packet->GetData()->GetLength();
+		_video_queue.push_back(std::move(packet));
+	}
+	else
+	{
+		_audio_queue.push_back(std::move(packet));
+	}
+}
+
+bool RtpPacer::Dequeue(int64_t now_us, Packet &packet)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	std::deque<Packet> *queue = nullptr;
+
+	if (_audio_queue.empty() == false)
+	{
+		queue = &_audio_queue;
+	}
+	else if (_video_queue.empty() == false)
+	{
+		UpdateBudget(now_us);
+
+		if (_media_budget_bytes <= 0.0)
+		{
+			return false;
+		}
+
+		queue = &_video_queue;
+		_queued_video_bytes -= std::min(_queued_video_bytes, _video_queue.front().rtp_packet->GetData()->GetLength());
+	}
+	else
+	{
+		return false;
+	}
+
+	packet = std::move(queue->front());
+	queue->pop_front();
+
+	auto queue_delay_us = now_us - packet.enqueue_time_us;
+
+	_sent_packets++;
+	_total_queue_delay_us += queue_delay_us;
+	_max_sent_queue_delay_us = std::max(_max_sent_queue_delay_us, queue_delay_us);
+
+	if (queue_delay_us > 0)
+	{
+		_delayed_packets++;
+	}
+
+	return true;
+}
+
+void RtpPacer::OnPacketSent(size_t bytes, int64_t now_us)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	UpdateBudget(now_us);
+	SpendBudget(bytes);
+}
+
+void RtpPacer::OnPaddingSent(size_t bytes, int64_t now_us)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	UpdateBudget(now_us);
+	SpendBudget(bytes);
+
+	_padding_bytes += bytes;
+}
+
+size_t RtpPacer::GetPaddingBytes(int64_t now_us)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	if ((_probe_bitrate <= 0) || (now_us >= _probe_end_us))
+	{
+		return 0;
+	}
+
+	// The media has priority over the padding
+	if (_video_queue.empty() == false)
+	{
+		return 0;
+	}
+
+	UpdateBudget(now_us);
+
+	if ((_media_budget_bytes <= 0.0) || (_padding_budget_bytes <= 0.0))
+	{
+		return 0;
+	}
+
+	return static_cast<size_t>(std::min(_media_budget_bytes, _padding_budget_bytes));
+}
+
+int64_t RtpPacer::GetNextProcessDelayMs(int64_t now_us)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	if (_audio_queue.empty() == false)
+	{
+		return 0;
+	}
+
+	if (_video_queue.empty())
+	{
+		if ((_probe_bitrate > 0) && (now_us < _probe_end_us))
+		{
+			return PADDING_INTERVAL_MS;
+		}
+
+		return -1;
+	}
+
+	UpdateBudget(now_us);
+
+	if (_media_budget_bytes > 0.0)
+	{
+		return 0;
+	}
+
+	auto target_bitrate = GetTargetBitrate(now_us);
+	if (target_bitrate <= 0)
+	{
+		return MIN_PROCESS_DELAY_MS;
+	}
+
+	// Time to earn the budget back
+	auto delay_ms = static_cast<int64_t>(::ceil(-_media_budget_bytes * 8.0 * 1000.0 / static_cast<double>(target_bitrate)));
+
+	return std::max<int64_t>(delay_ms, MIN_PROCESS_DELAY_MS);
+}
+
+RtpPacer::Stats RtpPacer::GetStats(int64_t now_us) const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	Stats stats;
+
+	stats.estimated_bitrate = _estimated_bitrate;
+	stats.incoming_bitrate = _incoming_bitrate;
+	stats.pacing_bitrate = GetPacingBitrate();
+	stats.target_bitrate = GetTargetBitrate(now_us);
+
+	stats.queued_packets = _audio_queue.size() + _video_queue.size();
+	stats.queued_bytes = _queued_video_bytes;
+
+	if (_video_queue.empty() == false)
+	{
+		stats.oldest_queue_delay_us = now_us - _video_queue.front().enqueue_time_us;
+	}
+
+	stats.average_queue_delay_us = (_sent_packets > 0) ? (_total_queue_delay_us / static_cast<int64_t>(_sent_packets)) : 0;
+	stats.max_queue_delay_us = _max_sent_queue_delay_us;
+
+	stats.sent_packets = _sent_packets;
+	stats.delayed_packets = _delayed_packets;
+	stats.padding_bytes = _padding_bytes;
+
+	stats.probe_bitrate = ((_probe_bitrate > 0) && (now_us < _probe_end_us)) ? _probe_bitrate : 0;
+
+	return stats;
+}
+
+void RtpPacer::UpdateBudget(int64_t now_us)
+{
+	if (_last_update_us < 0)
+	{
+		_last_update_us = now_us;
+		return;
+	}
+
+	auto elapsed_us = now_us - _last_update_us;
+	if (elapsed_us <= 0)
+	{
+		return;
+	}
+
+	_last_update_us = now_us;
+
+	auto target_bitrate = GetTargetBitrate(now_us);
+	_media_budget_bytes = std::min(_media_budget_bytes + (static_cast<double>(target_bitrate) * elapsed_us / 8000000.0),
+								   static_cast<double>(GetMaxBudgetBytes(target_bitrate)));
+
+	if ((_probe_bitrate > 0) && (now_us < _probe_end_us))
+	{
+		_padding_budget_bytes = std::min(_padding_budget_bytes + (static_cast<double>(_probe_bitrate) * elapsed_us / 8000000.0),
+										 static_cast<double>(GetMaxBudgetBytes(_probe_bitrate)));
+	}
+	else
+	{
+		_probe_bitrate = 0;
+		_padding_budget_bytes = 0.0;
+	}
+}
+
+void RtpPacer::UpdateIncomingBitrate(size_t bytes, int64_t now_us)
+{
+	if (_incoming_window_start_us < 0)
+	{
+		_incoming_window_start_us = now_us;
+	}
+
+	auto elapsed_us = now_us - _incoming_window_start_us;
+	if (elapsed_us >= INCOMING_BITRATE_WINDOW_US)
+	{
+		_incoming_bitrate = static_cast<int64_t>(_incoming_window_bytes) * 8 * 1000000 / elapsed_us;
+
+		_incoming_window_start_us = now_us;
+		_incoming_window_bytes = 0;
+	}
+
+	_incoming_window_bytes += bytes;
+}
+
+int64_t RtpPacer::GetPacingBitrate() const
+{
+	return static_cast<int64_t>(std::max(_estimated_bitrate, _incoming_bitrate) * _factor);
+}
+
+int64_t RtpPacer::GetTargetBitrate(int64_t now_us) const
+{
+	auto pacing_bitrate = GetPacingBitrate();
+
+	if (_video_queue.empty())
+	{
+		return pacing_bitrate;
+	}
+
+	// Drain the queue before the oldest packet waits longer than the max queue delay
+	auto time_left_us = std::max<int64_t>(_max_queue_delay_us - (now_us - _video_queue.front().enqueue_time_us), 1000);
+	auto drain_bitrate = static_cast<int64_t>(_queued_video_bytes) * 8 * 1000000 / time_left_us;
+
+	return std::max(pacing_bitrate, drain_bitrate);
+}
+
+size_t RtpPacer::GetMaxBudgetBytes(int64_t bitrate) const
+{
+	return std::max<size_t>(static_cast<size_t>(bitrate * _burst_ms / 8000), MIN_BUDGET_BYTES);
+}
+
+void RtpPacer::SpendBudget(size_t bytes)
+{
+	_media_budget_bytes -= bytes;
+
+	// The media sent while probing is a part of the probe, and the padding over the budget is taken from the next budget
+	_padding_budget_bytes = std::max(_padding_budget_bytes - bytes, -static_cast<double>(GetMaxBudgetBytes(_probe_bitrate)));
+}
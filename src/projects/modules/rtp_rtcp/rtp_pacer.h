@@ -0,0 +1,135 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by agent
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <deque>
+#include <mutex>
+
+#include "rtp_packet.h"
+
+// Token bucket pacer of the RTP packets sent to a peer
+//
+// The packets of a key frame are packetized at once, and sending them as a burst overflows the buffers of the network
+// (especially mobile) and causes the loss. The pacer holds the video packets back and sends them at the pacing bitrate
+// (a multiple of the estimated bandwidth). Up to <burst> of the pacing bitrate can be sent at once after the pacer is idle.
+// The pacer is not the congestion control (that is done by switching the renditions), so the pacing bitrate is never
+// lower than the multiple of the incoming bitrate, not to build up the latency.
+//
+// - Audio packets are not held back (they are small and late audio is noticeable), but they are taken from the budget
+// - The queue is drained faster than the pacing bitrate so that no packet waits longer than <max queue delay>
+// - While probing, padding is requested to fill the gap between the sent bitrate and the probe bitrate
+//
+// The pacer doesn't send the packets. The owner enqueues the packets, and sends the packets dequeued from the pacer.
+// All times are given by the caller (in microseconds).
+class RtpPacer
+{
+public:
+	struct Packet
+	{
+		std::shared_ptr<RtpPacket> rtp_packet;
+		// Sequence number of the session
+		uint16_t sequence_number = 0;
+		int64_t enqueue_time_us = 0;
+	};
+
+	struct Stats
+	{
+		int64_t estimated_bitrate = 0;
+		int64_t incoming_bitrate = 0;
+		// factor * max(estimated bitrate, incoming bitrate)
+		int64_t pacing_bitrate = 0;
+		// Pacing bitrate raised to drain the queue within the max queue delay
+		int64_t target_bitrate = 0;
+
+		size_t queued_packets = 0;
+		size_t queued_bytes = 0;
+		// Waiting time of the oldest packet in the queue
+		int64_t oldest_queue_delay_us = 0;
+
+		// Queue delay of the sent packets
+		int64_t average_queue_delay_us = 0;
+		int64_t max_queue_delay_us = 0;
+
+		uint64_t sent_packets = 0;
+		// Packets that waited in the queue
+		uint64_t delayed_packets = 0;
+		uint64_t padding_bytes = 0;
+
+		// 0 if not probing
+		int64_t probe_bitrate = 0;
+	};
+
+	// factor: Multiple of the estimated bitrate to send at
+	// burst_ms: Bytes that can be sent at once (in milliseconds of the pacing bitrate)
+	RtpPacer(int64_t estimated_bitrate, double factor, int64_t burst_ms, int64_t max_queue_delay_ms);
+
+	void SetEstimatedBitrate(int64_t bitrate);
+
+	// Requests the padding up to <bitrate> for <duration_ms>
+	void StartProbe(int64_t bitrate, int64_t duration_ms, int64_t now_us);
+	void StopProbe();
+	bool IsProbing(int64_t now_us) const;
+
+	void Enqueue(const std::shared_ptr<RtpPacket> &rtp_packet, uint16_t sequence_number, int64_t now_us);
+	// Returns false if no packet can be sent now
+	bool Dequeue(int64_t now_us, Packet &packet);
+
+	// All bytes sent to the peer (media, retransmission and padding) must be reported
+	void OnPacketSent(size_t bytes, int64_t now_us);
+	void OnPaddingSent(size_t bytes, int64_t now_us);
+
+	// Bytes of the padding to send now (0 if not probing)
+	size_t GetPaddingBytes(int64_t now_us);
+
+	// Returns the time until the pacer needs to be processed again in milliseconds, or -1 if there is nothing to send
+	int64_t GetNextProcessDelayMs(int64_t now_us);
+
+	Stats GetStats(int64_t now_us) const;
+
+private:
+	void UpdateBudget(int64_t now_us);
+	void UpdateIncomingBitrate(size_t bytes, int64_t now_us);
+	int64_t GetPacingBitrate() const;
+	int64_t GetTargetBitrate(int64_t now_us) const;
+	size_t GetMaxBudgetBytes(int64_t bitrate) const;
+	void SpendBudget(size_t bytes);
+
+	mutable std::mutex _mutex;
+
+	int64_t _estimated_bitrate;
+	double _factor;
+	int64_t _burst_ms;
+	int64_t _max_queue_delay_us;
+
+	std::deque<Packet> _audio_queue;
+	std::deque<Packet> _video_queue;
+	size_t _queued_video_bytes = 0;
+
+	// Bytes that can be sent now (negative after a packet larger than the budget is sent)
+	double _media_budget_bytes = 0.0;
+	// Bytes of the padding that can be sent now
+	double _padding_budget_bytes = 0.0;
+	int64_t _last_update_us = -1;
+
+	// Bytes enqueued in the current window
+	int64_t _incoming_window_start_us = -1;
+	size_t _incoming_window_bytes = 0;
+	int64_t _incoming_bitrate = 0;
+
+	int64_t _probe_bitrate = 0;
+	int64_t _probe_end_us = -1;
+
+	uint64_t _sent_packets = 0;
+	uint64_t _delayed_packets = 0;
+	int64_t _total_queue_delay_us = 0;
+	int64_t _max_sent_queue_delay_us = 0;
+	uint64_t _padding_bytes = 0;
+};
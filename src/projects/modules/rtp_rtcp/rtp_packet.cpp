@@ -161,6 +161,7 @@ bool RtpPacket::Parse(const std::shared_ptr<const ov::Data> &data)
 		}
 
 		_payload_offset = extension_offset + _extension_size;
+		_extension_type = (extension_profile == ONE_BYTE_EXTENSION_ID) ? RtpHeaderExtension::HeaderType::ONE_BYTE_HEADER : RtpHeaderExtension::HeaderType::TWO_BYTE_HEADER;
 
 		while(extension_offset < _payload_offset)
 		{
@@ -173,6 +174,8 @@ bool RtpPacket::Parse(const std::shared_ptr<const ov::Data> &data)
 
 			uint8_t id = 0;
 			uint8_t len = 0;
+			// Same as the offset recorded by SetExtensions(), so the value of a parsed packet can be rewritten
+			auto element_offset = extension_offset;
 
 			// One Byte Header
 			if(extension_profile == ONE_BYTE_EXTENSION_ID)
@@ -193,6 +196,7 @@ bool RtpPacket::Parse(const std::shared_ptr<const ov::Data> &data)
 			}
 
 			_extensions.emplace(id, ov::Data(&buffer[extension_offset], len, true));
+			_extension_buffer_offset[id] = element_offset;
 			extension_offset += len;
 		}
 	}
@@ -218,6 +222,48 @@ std::shared_ptr<ov::Data> RtpPacket::GetData() const
 	return _data;
 }
 
+bool RtpPacket::CopyTo(const std::shared_ptr<ov::Data> &destination, uint16_t sequence_number) const
+{
+	if (destination == nullptr || _data == nullptr)
+	{
+		return false;
+	}
+
+	auto length = _data->GetLength();
+	if (length < FIXED_HEADER_SIZE)
+	{
+		return false;
+	}
+
+	// The capacity of the destination is kept, so it doesn't reallocate if it is reused
+	if (destination->SetLength(length) == false)
+	{
+		return false;
+	}
+
+	auto buffer = destination->GetWritableDataAs<uint8_t>();
+	if (buffer == nullptr)
+	{
+		return false;
+	}
+
+	::memcpy(buffer, _data->GetData(), length);
+	ByteWriter<uint16_t>::WriteBigEndian(&buffer[2], sequence_number);
+
+	return true;
+}
+
+off_t RtpPacket::ExtensionOffset(uint8_t id) const
+{
+	auto it = _extension_buffer_offset.find(id);
+	if (it == _extension_buffer_offset.end())
+	{
+		return -1;
+	}
+
+	return it->second;
+}
+
 // Getter
 bool RtpPacket::Marker() const
 {
@@ -89,6 +89,13 @@ public:
 	// Data
 	std::shared_ptr<ov::Data> GetData() const;
 
+	// Writes this packet into the destination with the given sequence number.
+	// This packet is never modified, so that one packet can be shared by many sessions
+	// and only the destination (usually a reusable per-thread buffer) is written.
+	bool		CopyTo(const std::shared_ptr<ov::Data> &destination, uint16_t sequence_number) const;
+	// Offset of the extension element in Buffer() (-1 if the extension doesn't exist)
+	off_t		ExtensionOffset(uint8_t id) const;
+
 	// Created time
 	std::chrono::system_clock::time_point GetCreatedTime();
 
@@ -114,6 +114,11 @@ void RtpPacketizer::SetUlpfec(uint8_t red_payload_type, uint8_t ulpfec_payload_t
 	_ulpfec_payload_type = ulpfec_payload_type;
 }
 
+void RtpPacketizer::SetUlpfecProtection(uint8_t protection_factor, UlpfecMaskType mask_type)
+{
+	_ulpfec_generator.SetProtection(protection_factor, mask_type);
+}
+
 bool RtpPacketizer::Packetize(FrameType frame_type,
                                    uint32_t rtp_timestamp,
 								   uint64_t ntp_timestamp,
@@ -249,6 +254,8 @@ bool RtpPacketizer::GenerateRedAndFecPackets(std::shared_ptr<RtpPacket> packet)
 
 		// RED packet is for only video 
 		red_fec_packet->SetVideoPacket(true);
+		// Sessions select the packets of a rendition by the track
+		red_fec_packet->SetTrackId(_track_id);
 
 		// Timestamp is same as last packet
 		red_fec_packet->SetTimestamp(packet->Timestamp());
@@ -94,6 +94,11 @@ bool RtpRtcp::Stop()
 }
 
 bool RtpRtcp::SendRtpPacket(const std::shared_ptr<RtpPacket> &rtp_packet)
+{
+	return SendRtpPacket(rtp_packet, rtp_packet->GetData());
+}
+
+bool RtpRtcp::SendRtpPacket(const std::shared_ptr<RtpPacket> &rtp_packet, const std::shared_ptr<ov::Data> &wire_data)
 {
 	std::shared_lock<std::shared_mutex> lock(_state_lock);
 	// nothing to do before node start
@@ -149,7 +154,7 @@ bool RtpRtcp::SendRtpPacket(const std::shared_ptr<RtpPacket> &rtp_packet)
 
 	// Send RTP
 	_last_sent_rtp_packet = rtp_packet;
-	return SendDataToNextNode(NodeType::Rtp, rtp_packet->GetData());
+	return SendDataToNextNode(NodeType::Rtp, wire_data);
 }
 
 bool RtpRtcp::SendPLI(uint32_t media_ssrc)
@@ -35,6 +35,9 @@ public:
 	bool Stop() override;
 
 	bool SendRtpPacket(const std::shared_ptr<RtpPacket> &packet);
+	// Sends wire_data which is built from the packet (ex: the shared packet with a session-specific header).
+	// The packet is only used for the statistics, and the wire_data is encrypted in place by SRTP.
+	bool SendRtpPacket(const std::shared_ptr<RtpPacket> &packet, const std::shared_ptr<ov::Data> &wire_data);
 	bool SendPLI(uint32_t media_ssrc);
 	bool SendFIR(uint32_t media_ssrc);
 
@@ -0,0 +1,588 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by agent
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "send_side_bandwidth_estimator.h"
+
+#include <math.h>
+
+#include <algorithm>
+
+#define OV_LOG_TAG "BWE"
+
+// About 4 seconds of the packets at 2000 packets/s
+#define SENT_PACKET_HISTORY_SIZE 8192
+
+// Packets sent within 5ms are a group
+#define SEND_GROUP_INTERVAL_US 5000
+// The trendline is reset if no group is received for 3 seconds (ex: the stream is paused)
+#define MAX_RECEIVE_DELTA_MS 3000.0
+
+// Trendline filter
+#define TRENDLINE_WINDOW_SIZE 20
+#define TRENDLINE_SMOOTHING_COEFFICIENT 0.9
+#define TRENDLINE_THRESHOLD_GAIN 4.0
+#define TRENDLINE_MAX_DELTA_COUNT 60
+
+// Overuse detector (ms)
+#define OVERUSE_TIME_THRESHOLD_MS 10.0
+#define INITIAL_THRESHOLD 12.5
+#define MIN_THRESHOLD 6.0
+#define MAX_THRESHOLD 600.0
+#define THRESHOLD_GAIN_UP 0.0087
+#define THRESHOLD_GAIN_DOWN 0.039
+#define MAX_THRESHOLD_ADAPT_OFFSET 15.0
+
+// Acknowledged bitrate
+#define ACKNOWLEDGED_WINDOW_US 500000
+#define MIN_ACKNOWLEDGED_SPAN_US 100000
+
+// AIMD
+#define DECREASE_FACTOR 0.85
+#define INCREASE_FACTOR_PER_SECOND 1.08
+// The estimate is not increased over 1.5 times of the acknowledged bitrate + 10kbps
+#define MAX_INCREASE_RATIO_OF_ACKNOWLEDGED 1.5
+#define MIN_INCREASE_BITRATE 1000
+#define MIN_DECREASE_INTERVAL_US 300000
+
+// Loss-based
+#define LOW_LOSS_RATIO 0.02
+#define HIGH_LOSS_RATIO 0.10
+#define LOSS_INCREASE_FACTOR 1.05
+
+SendSideBandwidthEstimator::SendSideBandwidthEstimator(int64_t initial_bitrate, int64_t min_bitrate, int64_t max_bitrate)
+	: _min_bitrate(min_bitrate),
+	  _max_bitrate(std::max(min_bitrate, max_bitrate)),
+	  _sent_packets(SENT_PACKET_HISTORY_SIZE),
+	  _threshold(INITIAL_THRESHOLD)
+{
+	_delay_based_bitrate = std::clamp(initial_bitrate, _min_bitrate, _max_bitrate);
+	// The loss-based estimate doesn't limit the estimate until the packets are lost
+	_loss_based_bitrate = _max_bitrate;
+	_estimated_bitrate = _delay_based_bitrate;
+}
+
+int64_t SendSideBandwidthEstimator::UnwrapSequenceNumber(uint16_t sequence_number, int64_t &last_unwrapped) const
+{
+	if (last_unwrapped < 0)
+	{
+		last_unwrapped = sequence_number;
+		return last_unwrapped;
+	}
+
+	auto delta = static_cast<int16_t>(sequence_number - static_cast<uint16_t>(last_unwrapped & 0xFFFF));
+	auto unwrapped = last_unwrapped + delta;
+
+	if (unwrapped > last_unwrapped)
+	{
+		last_unwrapped = unwrapped;
+	}
+
+	return unwrapped;
+}
+
+void SendSideBandwidthEstimator::OnPacketSent(uint16_t wide_sequence_number, size_t bytes, int64_t send_time_us)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	auto sequence_number = UnwrapSequenceNumber(wide_sequence_number, _last_sent_sequence_number);
+	if (sequence_number < 0)
+	{
+		return;
+	}
+
+	auto &sent_packet = _sent_packets[sequence_number % SENT_PACKET_HISTORY_SIZE];
+
+	sent_packet.sequence_number = sequence_number;
+	sent_packet.bytes = bytes;
+	sent_packet.send_time_us = send_time_us;
+}
+
+void SendSideBandwidthEstimator::OnTransportCc(const std::shared_ptr<TransportCc> &transport_cc, int64_t now_us)
+{
+	std::vector<PacketFeedback> feedbacks;
+	int64_t receive_time_us = 0;
+
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		// 24-bit reference time in multiples of 64ms
+		auto reference_time = static_cast<int64_t>(transport_cc->GetReferenceTime() & 0xFFFFFF);
+
+		if (_last_reference_time < 0)
+		{
+			_unwrapped_reference_time = reference_time;
+		}
+		else
+		{
+			auto delta = (reference_time - _last_reference_time) & 0xFFFFFF;
+			// Sign extension of the 24-bit delta
+			if (delta & 0x800000)
+			{
+				delta -= 0x1000000;
+			}
+
+			_unwrapped_reference_time += delta;
+		}
+
+		_last_reference_time = reference_time;
+		receive_time_us = _unwrapped_reference_time * 64000;
+	}
+
+	feedbacks.reserve(transport_cc->GetPacketStatusCount());
+
+	for (size_t index = 0; index < transport_cc->GetPacketStatusCount(); index++)
+	{
+		auto packet_status = transport_cc->GetPacketFeedbackInfo(index);
+		if (packet_status == nullptr)
+		{
+			continue;
+		}
+
+		PacketFeedback feedback;
+		feedback.wide_sequence_number = packet_status->_wide_sequence_number;
+		feedback.received = packet_status->_received;
+
+		if (feedback.received)
+		{
+			// Each delta is relative to the previous received packet (the first one is relative to the reference time), 250us unit
+			receive_time_us += static_cast<int64_t>(packet_status->_received_delta) * 250;
+			feedback.receive_time_us = receive_time_us;
+		}
+
+		feedbacks.push_back(feedback);
+	}
+
+	OnPacketFeedbacks(feedbacks, now_us);
+}
+
+void SendSideBandwidthEstimator::OnPacketFeedbacks(const std::vector<PacketFeedback> &feedbacks, int64_t now_us)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	_feedback_count++;
+
+	for (const auto &feedback : feedbacks)
+	{
+		auto sequence_number = UnwrapSequenceNumber(feedback.wide_sequence_number, _last_feedback_sequence_number);
+
+		if ((sequence_number < 0) || (feedback.received == false))
+		{
+			// The lost packets are handled by the receiver report
+			continue;
+		}
+
+		auto &sent_packet = _sent_packets[sequence_number % SENT_PACKET_HISTORY_SIZE];
+		if (sent_packet.sequence_number != sequence_number)
+		{
+			// Too old, or not sent by this estimator
+			continue;
+		}
+
+		OnPacketReceived(sent_packet, feedback.receive_time_us);
+	}
+
+	UpdateDelayBasedBitrate(now_us);
+	UpdateEstimate();
+}
+
+void SendSideBandwidthEstimator::OnPacketReceived(const SentPacket &sent_packet, int64_t receive_time_us)
+{
+	UpdateAcknowledgedBitrate(sent_packet.bytes, receive_time_us);
+
+	if (_current_group.IsValid() == false)
+	{
+		_current_group.first_send_time_us = sent_packet.send_time_us;
+		_current_group.last_send_time_us = sent_packet.send_time_us;
+		_current_group.last_receive_time_us = receive_time_us;
+		return;
+	}
+
+	if (sent_packet.send_time_us < _current_group.first_send_time_us)
+	{
+		// Reordered packet of the previous group
+		return;
+	}
+
+	if ((sent_packet.send_time_us - _current_group.first_send_time_us) <= SEND_GROUP_INTERVAL_US)
+	{
+		_current_group.last_send_time_us = std::max(_current_group.last_send_time_us, sent_packet.send_time_us);
+		_current_group.last_receive_time_us = std::max(_current_group.last_receive_time_us, receive_time_us);
+		return;
+	}
+
+	// The current group is completed
+	if (_previous_group.IsValid())
+	{
+		auto send_delta_ms = (_current_group.last_send_time_us - _previous_group.last_send_time_us) / 1000.0;
+		auto receive_delta_ms = (_current_group.last_receive_time_us - _previous_group.last_receive_time_us) / 1000.0;
+
+		if (receive_delta_ms > MAX_RECEIVE_DELTA_MS)
+		{
+			ResetTrendline();
+		}
+		else if (receive_delta_ms >= 0.0)
+		{
+			UpdateTrendline(receive_delta_ms, send_delta_ms, _current_group.last_receive_time_us);
+			DetectOveruse(send_delta_ms, _current_group.last_receive_time_us);
+		}
+	}
+
+	_previous_group = _current_group;
+
+	_current_group.first_send_time_us = sent_packet.send_time_us;
+	_current_group.last_send_time_us = sent_packet.send_time_us;
+	_current_group.last_receive_time_us = receive_time_us;
+}
+
+void SendSideBandwidthEstimator::UpdateTrendline(double receive_delta_ms, double send_delta_ms, int64_t receive_time_us)
+{
+	auto delta_ms = receive_delta_ms - send_delta_ms;
+
+	_delta_count = std::min(_delta_count + 1, 1000);
+
+	if (_first_receive_time_us < 0)
+	{
+		_first_receive_time_us = receive_time_us;
+	}
+
+	_accumulated_delay_ms += delta_ms;
+	_smoothed_delay_ms = (TRENDLINE_SMOOTHING_COEFFICIENT * _smoothed_delay_ms) + ((1.0 - TRENDLINE_SMOOTHING_COEFFICIENT) * _accumulated_delay_ms);
+
+	_delay_samples.emplace_back((receive_time_us - _first_receive_time_us) / 1000.0, _smoothed_delay_ms);
+
+	if (_delay_samples.size() > TRENDLINE_WINDOW_SIZE)
+	{
+		_delay_samples.pop_front();
+	}
+
+	if (_delay_samples.size() < TRENDLINE_WINDOW_SIZE)
+	{
+		return;
+	}
+
+	// Slope of the linear regression
+	double mean_x = 0.0;
+	double mean_y = 0.0;
+
+	for (const auto &[x, y] : _delay_samples)
+	{
+		mean_x += x;
+		mean_y += y;
+	}
+
+	mean_x /= _delay_samples.size();
+	mean_y /= _delay_samples.size();
+
+	double numerator = 0.0;
+	double denominator = 0.0;
+
+	for (const auto &[x, y] : _delay_samples)
+	{
+		numerator += (x - mean_x) * (y - mean_y);
+		denominator += (x - mean_x) * (x - mean_x);
+	}
+
+	if (denominator != 0.0)
+	{
+		_trend = numerator / denominator;
+	}
+}
+
+void SendSideBandwidthEstimator::DetectOveruse(double send_delta_ms, int64_t receive_time_us)
+{
+	if (_delta_count < 2)
+	{
+		return;
+	}
+
+	auto modified_trend = std::min(_delta_count, TRENDLINE_MAX_DELTA_COUNT) * _trend * TRENDLINE_THRESHOLD_GAIN;
+	_modified_trend = modified_trend;
+
+	if (modified_trend > _threshold)
+	{
+		if (_overuse_time_ms < 0.0)
+		{
+			// Initialize the timer, assuming that we've been over-using half of the time since the previous sample
+			_overuse_time_ms = send_delta_ms / 2.0;
+		}
+		else
+		{
+			_overuse_time_ms += send_delta_ms;
+		}
+
+		_overuse_counter++;
+
+		if ((_overuse_time_ms > OVERUSE_TIME_THRESHOLD_MS) && (_overuse_counter > 1) && (_trend >= _previous_trend))
+		{
+			_overuse_time_ms = 0.0;
+			_overuse_counter = 0;
+
+			if (_delay_state != DelayState::Overusing)
+			{
+				_overuse_count++;
+				logtd("Overuse detected (trend: %.2f, threshold: %.2f, estimate: %lld)", modified_trend, _threshold, _estimated_bitrate);
+			}
+
+			_delay_state = DelayState::Overusing;
+		}
+	}
+	else if (modified_trend < -_threshold)
+	{
+		_overuse_time_ms = -1.0;
+		_overuse_counter = 0;
+		_delay_state = DelayState::Underusing;
+	}
+	else
+	{
+		_overuse_time_ms = -1.0;
+		_overuse_counter = 0;
+		_delay_state = DelayState::Normal;
+	}
+
+	_previous_trend = _trend;
+
+	UpdateThreshold(modified_trend, receive_time_us);
+}
+
+void SendSideBandwidthEstimator::UpdateThreshold(double modified_trend, int64_t receive_time_us)
+{
+	if (_last_threshold_update_us < 0)
+	{
+		_last_threshold_update_us = receive_time_us;
+	}
+
+	auto absolute_trend = ::fabs(modified_trend);
+
+	// Don't adapt to the spikes (ex: a key frame)
+	if (absolute_trend > (_threshold + MAX_THRESHOLD_ADAPT_OFFSET))
+	{
+		_last_threshold_update_us = receive_time_us;
+		return;
+	}
+
+	auto gain = (absolute_trend < _threshold) ? THRESHOLD_GAIN_DOWN : THRESHOLD_GAIN_UP;
+	auto elapsed_ms = std::clamp((receive_time_us - _last_threshold_update_us) / 1000.0, 0.0, 100.0);
+
+	_threshold = std::clamp(_threshold + (gain * (absolute_trend - _threshold) * elapsed_ms), MIN_THRESHOLD, MAX_THRESHOLD);
+	_last_threshold_update_us = receive_time_us;
+}
+
+void SendSideBandwidthEstimator::ResetTrendline()
+{
+	_first_receive_time_us = -1;
+	_accumulated_delay_ms = 0.0;
+	_smoothed_delay_ms = 0.0;
+	_delay_samples.clear();
+	_delta_count = 0;
+	_trend = 0.0;
+	_previous_trend = 0.0;
+
+	_modified_trend = 0.0;
+	_overuse_time_ms = -1.0;
+	_overuse_counter = 0;
+	_delay_state = DelayState::Normal;
+}
+
+void SendSideBandwidthEstimator::UpdateAcknowledgedBitrate(size_t bytes, int64_t receive_time_us)
+{
+	_received_packets.emplace_back(receive_time_us, bytes);
+	_received_bytes_in_window += bytes;
+
+	while ((_received_packets.empty() == false) && (_received_packets.front().first < (receive_time_us - ACKNOWLEDGED_WINDOW_US)))
+	{
+		_received_bytes_in_window -= _received_packets.front().second;
+		_received_packets.pop_front();
+	}
+
+	auto span_us = _received_packets.back().first - _received_packets.front().first;
+
+	if (span_us >= MIN_ACKNOWLEDGED_SPAN_US)
+	{
+		// The bytes of the first packet were received before the span
+		_acknowledged_bitrate = static_cast<int64_t>((_received_bytes_in_window - _received_packets.front().second) * 8 * 1000000.0 / span_us);
+	}
+}
+
+void SendSideBandwidthEstimator::UpdateDelayBasedBitrate(int64_t now_us)
+{
+	if (_last_rate_update_us < 0)
+	{
+		_last_rate_update_us = now_us;
+	}
+
+	auto elapsed_seconds = std::clamp((now_us - _last_rate_update_us) / 1000000.0, 0.0, 1.0);
+	_last_rate_update_us = now_us;
+
+	switch (_delay_state)
+	{
+		case DelayState::Normal:
+			if (_rate_control_state == RateControlState::Hold)
+			{
+				_rate_control_state = RateControlState::Increase;
+			}
+			else if (_rate_control_state == RateControlState::Decrease)
+			{
+				// The delay has already recovered, so a decrease postponed by MIN_DECREASE_INTERVAL_US is not applied
+				_rate_control_state = RateControlState::Hold;
+			}
+			break;
+
+		case DelayState::Overusing:
+			_rate_control_state = RateControlState::Decrease;
+			break;
+
+		case DelayState::Underusing:
+			// The queues are being drained
+			_rate_control_state = RateControlState::Hold;
+			break;
+	}
+
+	switch (_rate_control_state)
+	{
+		case RateControlState::Increase: {
+			auto bitrate = static_cast<int64_t>(_delay_based_bitrate * ::pow(INCREASE_FACTOR_PER_SECOND, elapsed_seconds)) + MIN_INCREASE_BITRATE;
+
+			if (_acknowledged_bitrate > 0)
+			{
+				// Don't go too far from what is actually delivered
+				auto limit = static_cast<int64_t>(_acknowledged_bitrate * MAX_INCREASE_RATIO_OF_ACKNOWLEDGED) + 10000;
+				bitrate = std::min(bitrate, std::max(limit, _delay_based_bitrate));
+			}
+
+			_delay_based_bitrate = bitrate;
+			break;
+		}
+
+		case RateControlState::Decrease:
+			if ((_last_decrease_us < 0) || ((now_us - _last_decrease_us) >= MIN_DECREASE_INTERVAL_US))
+			{
+				auto base_bitrate = (_acknowledged_bitrate > 0) ? _acknowledged_bitrate : _delay_based_bitrate;
+
+				_delay_based_bitrate = std::min(_delay_based_bitrate, static_cast<int64_t>(base_bitrate * DECREASE_FACTOR));
+				_last_decrease_us = now_us;
+				_rate_control_state = RateControlState::Hold;
+			}
+			break;
+
+		case RateControlState::Hold:
+			break;
+	}
+
+	_delay_based_bitrate = std::clamp(_delay_based_bitrate, _min_bitrate, _max_bitrate);
+}
+
+void SendSideBandwidthEstimator::OnReceiverReport(uint8_t fraction_lost, int64_t now_us)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	_fraction_lost = fraction_lost / 256.0;
+
+	if (_fraction_lost > HIGH_LOSS_RATIO)
+	{
+		_loss_based_bitrate = static_cast<int64_t>(std::min(_loss_based_bitrate, _estimated_bitrate) * (1.0 - (0.5 * _fraction_lost)));
+	}
+	else if (_fraction_lost < LOW_LOSS_RATIO)
+	{
+		_loss_based_bitrate = static_cast<int64_t>(_loss_based_bitrate * LOSS_INCREASE_FACTOR) + MIN_INCREASE_BITRATE;
+	}
+
+	_loss_based_bitrate = std::clamp(_loss_based_bitrate, _min_bitrate, _max_bitrate);
+
+	UpdateEstimate();
+}
+
+void SendSideBandwidthEstimator::OnRemb(int64_t bitrate, int64_t now_us)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	_remb_bitrate = bitrate;
+
+	UpdateEstimate();
+}
+
+void SendSideBandwidthEstimator::UpdateEstimate()
+{
+	auto bitrate = std::min(_delay_based_bitrate, _loss_based_bitrate);
+
+	if (_remb_bitrate > 0)
+	{
+		bitrate = std::min(bitrate, _remb_bitrate);
+	}
+
+	_estimated_bitrate = std::clamp(bitrate, _min_bitrate, _max_bitrate);
+}
+
+int64_t SendSideBandwidthEstimator::GetEstimatedBitrate() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	return _estimated_bitrate;
+}
+
+SendSideBandwidthEstimator::DelayState SendSideBandwidthEstimator::GetDelayState() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	return _delay_state;
+}
+
+SendSideBandwidthEstimator::Stats SendSideBandwidthEstimator::GetStats() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	Stats stats;
+
+	stats.estimated_bitrate = _estimated_bitrate;
+	stats.delay_based_bitrate = _delay_based_bitrate;
+	stats.loss_based_bitrate = _loss_based_bitrate;
+	stats.remb_bitrate = _remb_bitrate;
+	stats.acknowledged_bitrate = _acknowledged_bitrate;
+	stats.delay_state = _delay_state;
+	stats.rate_control_state = _rate_control_state;
+	stats.trend = _modified_trend;
+	stats.threshold = _threshold;
+	stats.fraction_lost = _fraction_lost;
+	stats.feedback_count = _feedback_count;
+	stats.overuse_count = _overuse_count;
+
+	return stats;
+}
+
+const char *SendSideBandwidthEstimator::StringFromDelayState(DelayState state)
+{
+	switch (state)
+	{
+		case DelayState::Normal:
+			return "Normal";
+
+		case DelayState::Overusing:
+			return "Overusing";
+
+		case DelayState::Underusing:
+			return "Underusing";
+	}
+
+	return "Unknown";
+}
+
+const char *SendSideBandwidthEstimator::StringFromRateControlState(RateControlState state)
+{
+	switch (state)
+	{
+		case RateControlState::Hold:
+			return "Hold";
+
+		case RateControlState::Increase:
+			return "Increase";
+
+		case RateControlState::Decrease:
+			return "Decrease";
+	}
+
+	return "Unknown";
+}
@@ -0,0 +1,192 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by agent
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <deque>
+#include <mutex>
+#include <vector>
+
+#include "rtcp_info/transport_cc.h"
+
+// Send-side bandwidth estimation based on Google Congestion Control
+// https://datatracker.ietf.org/doc/html/draft-ietf-rmcat-gcc-02
+//
+// - Delay-based: the packets are grouped by the send time, and the trend of the queuing delay
+//   (difference of the arrival/send intervals of the groups) is found by the linear regression of
+//   the accumulated delay (trendline filter). The trend is compared with an adaptive threshold to detect
+//   the overuse, and the rate is controlled by AIMD (-15% of the acknowledged bitrate on the overuse, +8%/s otherwise)
+// - Loss-based: fraction lost of the receiver report (-loss/2 over 10%, +5% under 2%)
+// - REMB of the receiver caps the estimate
+//
+// All times are given by the caller (in microseconds), so the feedback recorded from a session can be replayed
+// (see benchmark/bwe_trace_replay.h).
+class SendSideBandwidthEstimator
+{
+public:
+	// Result of a packet reported by transport-cc
+	struct PacketFeedback
+	{
+		uint16_t wide_sequence_number = 0;
+		bool received = false;
+		// On the clock of the receiver (only the differences are meaningful)
+		int64_t receive_time_us = 0;
+	};
+
+	enum class DelayState : uint8_t
+	{
+		Normal,
+		Overusing,
+		Underusing
+	};
+
+	enum class RateControlState : uint8_t
+	{
+		Hold,
+		Increase,
+		Decrease
+	};
+
+	struct Stats
+	{
+		int64_t estimated_bitrate = 0;
+
+		int64_t delay_based_bitrate = 0;
+		int64_t loss_based_bitrate = 0;
+		// 0 if REMB is not received
+		int64_t remb_bitrate = 0;
+		// 0 if not enough packets are acknowledged
+		int64_t acknowledged_bitrate = 0;
+
+		DelayState delay_state = DelayState::Normal;
+		RateControlState rate_control_state = RateControlState::Hold;
+
+		// Modified trend and the adaptive threshold of the overuse detector (ms)
+		double trend = 0.0;
+		double threshold = 0.0;
+
+		// 0.0 ~ 1.0
+		double fraction_lost = 0.0;
+
+		uint64_t feedback_count = 0;
+		uint64_t overuse_count = 0;
+	};
+
+	SendSideBandwidthEstimator(int64_t initial_bitrate, int64_t min_bitrate, int64_t max_bitrate);
+
+	void OnPacketSent(uint16_t wide_sequence_number, size_t bytes, int64_t send_time_us);
+
+	// Converts the feedback to PacketFeedbacks, and calls OnPacketFeedbacks()
+	void OnTransportCc(const std::shared_ptr<TransportCc> &transport_cc, int64_t now_us);
+	// feedbacks must be in the order of the wide sequence number
+	void OnPacketFeedbacks(const std::vector<PacketFeedback> &feedbacks, int64_t now_us);
+
+	// fraction_lost: 8-bit fixed point number of the report block
+	void OnReceiverReport(uint8_t fraction_lost, int64_t now_us);
+	void OnRemb(int64_t bitrate, int64_t now_us);
+
+	int64_t GetEstimatedBitrate() const;
+	DelayState GetDelayState() const;
+	Stats GetStats() const;
+
+	static const char *StringFromDelayState(DelayState state);
+	static const char *StringFromRateControlState(RateControlState state);
+
+private:
+	struct SentPacket
+	{
+		// Wide sequence number extended to 64 bits
+		int64_t sequence_number = -1;
+		size_t bytes = 0;
+		int64_t send_time_us = 0;
+	};
+
+	// Packets sent within a burst (SEND_GROUP_INTERVAL_US)
+	struct PacketGroup
+	{
+		int64_t first_send_time_us = -1;
+		int64_t last_send_time_us = -1;
+		int64_t last_receive_time_us = -1;
+
+		bool IsValid() const
+		{
+			return first_send_time_us >= 0;
+		}
+	};
+
+	int64_t UnwrapSequenceNumber(uint16_t sequence_number, int64_t &last_unwrapped) const;
+
+	void OnPacketReceived(const SentPacket &sent_packet, int64_t receive_time_us);
+	void UpdateTrendline(double receive_delta_ms, double send_delta_ms, int64_t receive_time_us);
+	void DetectOveruse(double send_delta_ms, int64_t receive_time_us);
+	void UpdateThreshold(double modified_trend, int64_t receive_time_us);
+	void ResetTrendline();
+
+	void UpdateAcknowledgedBitrate(size_t bytes, int64_t receive_time_us);
+	void UpdateDelayBasedBitrate(int64_t now_us);
+	void UpdateEstimate();
+
+	mutable std::mutex _mutex;
+
+	int64_t _min_bitrate;
+	int64_t _max_bitrate;
+
+	// Sent packets (sequence number % size)
+	std::vector<SentPacket> _sent_packets;
+	int64_t _last_sent_sequence_number = -1;
+	int64_t _last_feedback_sequence_number = -1;
+
+	// Reference time of the last feedback (24 bits, wraps around every 12 days)
+	int64_t _last_reference_time = -1;
+	int64_t _unwrapped_reference_time = 0;
+
+	// Trendline filter
+	PacketGroup _current_group;
+	PacketGroup _previous_group;
+	int64_t _first_receive_time_us = -1;
+	double _accumulated_delay_ms = 0.0;
+	double _smoothed_delay_ms = 0.0;
+	// (receive time (ms), smoothed delay (ms))
+	std::deque<std::pair<double, double>> _delay_samples;
+	int _delta_count = 0;
+	double _trend = 0.0;
+	double _previous_trend = 0.0;
+
+	// Overuse detector
+	double _modified_trend = 0.0;
+	double _threshold;
+	int64_t _last_threshold_update_us = -1;
+	double _overuse_time_ms = -1.0;
+	int _overuse_counter = 0;
+	DelayState _delay_state = DelayState::Normal;
+
+	// Acknowledged bitrate (received bytes in the last window)
+	// (receive time, bytes)
+	std::deque<std::pair<int64_t, size_t>> _received_packets;
+	size_t _received_bytes_in_window = 0;
+	int64_t _acknowledged_bitrate = 0;
+
+	// AIMD
+	RateControlState _rate_control_state = RateControlState::Hold;
+	int64_t _delay_based_bitrate;
+	int64_t _last_rate_update_us = -1;
+	int64_t _last_decrease_us = -1;
+
+	// Loss-based
+	int64_t _loss_based_bitrate;
+	double _fraction_lost = 0.0;
+
+	int64_t _remb_bitrate = 0;
+
+	int64_t _estimated_bitrate;
+
+	uint64_t _feedback_count = 0;
+	uint64_t _overuse_count = 0;
+};
@@ -3,6 +3,8 @@
 
 #include <string.h>
 
+#include <algorithm>
+
 constexpr size_t 	kFecHeaderSize					= 10;
 constexpr size_t 	kMaskSizeLbitClear				= 2;
 constexpr size_t	kMaskSizeLbitSet				= 6;
@@ -11,30 +13,41 @@ constexpr size_t	kFecLevelHeaderSizeLbitSet		= 2 + kMaskSizeLbitSet;
 constexpr size_t 	kUlpfecMaxMediaPacketsLbitClear	= 16;
 constexpr size_t 	kUlpfecMaxMediaPacketsLbitSet	= 48;
 
-constexpr size_t    kMediaPacketNumMakeFec          = 7; 
-
 UlpfecGenerator::UlpfecGenerator()
 {
-	_high_level = false;
 }
 
 UlpfecGenerator::~UlpfecGenerator()
 {
 }
 
-void UlpfecGenerator::SetHighRateProtection(bool high_level)
+void UlpfecGenerator::SetProtection(uint8_t protection_factor, UlpfecMaskType mask_type)
 {
-	_high_level = high_level;
+	_protection_factor = protection_factor;
+	_mask_type = mask_type;
 }
 
 bool UlpfecGenerator::AddRtpPacketAndGenerateFec(std::shared_ptr<RedRtpPacket> packet)
 {
-	auto copy_packet = std::make_shared<RedRtpPacket>(*packet);
-	_media_packets.push_back(copy_packet);
+	if(_frame_started == false)
+	{
+		// The protection is not changed in the middle of a frame
+		_frame_protection_factor = _protection_factor;
+		_frame_mask_type = _mask_type;
+		_frame_started = true;
+	}
+
+	// Nothing to protect, so the packet is not copied
+	if(_frame_protection_factor > 0)
+	{
+		auto copy_packet = std::make_shared<RedRtpPacket>(*packet);
+		_media_packets.push_back(copy_packet);
+	}
 
-	if(copy_packet->Marker())
+	if(packet->Marker())
 	{
 		Encode();
+		_frame_started = false;
 	}
 
 	return true;
@@ -60,105 +73,87 @@ bool UlpfecGenerator::NextPacket(RtpPacket *packet)
 
 bool UlpfecGenerator::Encode()
 {
-	size_t media_size = _media_packets.size();
-	//uint32_t rate = static_cast<uint32_t>(kMediaPacketNumMakeFec / (_high_level?2:1));
-	uint32_t fec_packet_count = static_cast<uint32_t>(std::ceil((float)media_size / (float)kMediaPacketNumMakeFec));
-	uint32_t media_packet_idx = 0;
-	size_t mask_len = 0;
-
-	size_t fec_header_size = kFecHeaderSize;
-	if(_media_packets.size() <= kUlpfecMaxMediaPacketsLbitClear)
-	{
-		fec_header_size += kFecLevelHeaderSizeLbitClear;
-		mask_len = kMaskSizeLbitClear;
-	}
-	else
-	{
-		fec_header_size += kFecLevelHeaderSizeLbitSet;
-		mask_len = kMaskSizeLbitSet;
-	}
+	// The sequence numbers of the media packets of a frame are contiguous,
+	// so a block can be expressed by the sequence number base and the mask.
+	// The blocks are evenly sized, not to leave a few packets in the last block.
+	size_t block_count = (_media_packets.size() + kUlpfecMaxMediaPacketsLbitSet - 1) / kUlpfecMaxMediaPacketsLbitSet;
 
-	for(uint32_t i=0; i<fec_packet_count; i++)
+	for(size_t first_index = 0, block = 0; block < block_count; block++)
 	{
-		uint16_t sn_base = 0;
-		bool first_media_packet;
-		uint8_t mask[6];
-		int selected_media_count;
+		size_t block_size = (_media_packets.size() - first_index) / (block_count - block);
 
-		first_media_packet = true;
+		EncodeBlock(first_index, block_size);
+		first_index += block_size;
+	}
 
-		// TODO(Getroot): A more efficient algorithm should be used like random mask or bursty mask.
-		auto fec_packet = std::make_shared<ov::Data>();
-		fec_packet->SetLength(fec_header_size);
-		auto fec_buffer = fec_packet->GetWritableDataAs<uint8_t>();
+	// clear media packet
+	_media_packets.clear();
 
-		// Initialize
-		memset(mask, 0, sizeof(mask));
-		first_media_packet = true;
-		selected_media_count = (media_size-media_packet_idx) / (fec_packet_count - i);
+	return true;
+}
 
-		for(int j=0; j<selected_media_count; j++)
-		{
-			auto media_packet = _media_packets[media_packet_idx];
+void UlpfecGenerator::EncodeBlock(size_t first_index, size_t media_count)
+{
+	// Same as WebRTC: rounded, but at least one FEC packet is generated if protection is needed
+	size_t fec_count = (media_count * _frame_protection_factor + (1 << 7)) >> 8;
+	fec_count = std::clamp<size_t>(fec_count, 1, media_count);
 
-			size_t fec_packet_length = fec_header_size + media_packet->PayloadSize();
+	bool l_bit = media_count > kUlpfecMaxMediaPacketsLbitClear;
+	size_t fec_header_size = kFecHeaderSize + (l_bit ? kFecLevelHeaderSizeLbitSet : kFecLevelHeaderSizeLbitClear);
+	uint16_t sn_base = _media_packets[first_index]->SequenceNumber();
 
-			if(fec_packet->GetLength() < fec_packet_length)
-			{
-				fec_packet->SetLength(fec_packet_length);
-				fec_buffer = fec_packet->GetWritableDataAs<uint8_t>();
-			}
+	auto masks = MakeMasks(media_count, fec_count);
 
-			if(first_media_packet)
+	for(auto mask : masks)
+	{
+		size_t max_payload_size = 0;
+		for(size_t i = 0; i < media_count; i++)
+		{
+			if(mask & (1ULL << i))
 			{
-				// Write P, X, CC fields.
-				// Bits 0, 1 are overwritten in FinalizeFecHeaders.
-				fec_buffer[0] = media_packet->Buffer()[0];
-
-				// The media_packet is red packet. So buffer[1] of RTP header has red payload type.
-				// We should use media payload type in the red header.
-				// M, and PT recovery
-				fec_buffer[1] = media_packet->Buffer()[media_packet->HeadersSize() - 1];
-				if(media_packet->Marker())
-				{
-					fec_buffer[1] |= 0x80;
-				}
-				else
-				{
-					fec_buffer[1] &= 0x7F;
-				}
-
-				// SN Base
-				ByteWriter<uint16_t>::WriteBigEndian(&fec_buffer[2], media_packet->SequenceNumber());
-				// Write timestamp recovery field.
-				ByteWriter<uint32_t>::WriteBigEndian(&fec_buffer[4], media_packet->Timestamp());
-				// Write length recovery field.
-				ByteWriter<uint16_t>::WriteBigEndian(&fec_buffer[8], (uint16_t)media_packet->PayloadSize());
-				// Write Payload.
-				memcpy(&fec_buffer[fec_header_size], media_packet->Payload(), media_packet->PayloadSize());
-
-				sn_base = media_packet->SequenceNumber();
-
-				first_media_packet = false;
+				max_payload_size = std::max(max_payload_size, _media_packets[first_index + i]->PayloadSize());
 			}
-			else
+		}
+
+		// The shorter packets are padded with zeros
+		auto fec_packet = std::make_shared<ov::Data>(fec_header_size + max_payload_size);
+		fec_packet->SetLength(fec_header_size + max_payload_size);
+		auto fec_buffer = fec_packet->GetWritableDataAs<uint8_t>();
+		memset(fec_buffer, 0, fec_packet->GetLength());
+
+		for(size_t i = 0; i < media_count; i++)
+		{
+			if(mask & (1ULL << i))
 			{
-				XorFecPacket(fec_buffer, fec_header_size, media_packet.get());
+				XorFecPacket(fec_buffer, fec_header_size, _media_packets[first_index + i].get());
 			}
-
-			uint16_t diff = media_packet->SequenceNumber() - sn_base;
-			mask[diff / 8] |= 1 << (7 - (diff % 8));
-			media_packet_idx++;
 		}
 
-		FinalizeFecHeader(fec_buffer, fec_packet->GetLength() - fec_header_size, mask, mask_len);
+		FinalizeFecHeader(fec_buffer, max_payload_size, sn_base, mask, l_bit);
 
 		_generated_fec_packets.push(fec_packet);
 	}
-	// clear media packet
-	_media_packets.clear();
+}
 
-	return true;
+std::vector<uint64_t> UlpfecGenerator::MakeMasks(size_t media_count, size_t fec_count) const
+{
+	std::vector<uint64_t> masks(fec_count, 0);
+
+	for(size_t i = 0; i < media_count; i++)
+	{
+		auto group = i % fec_count;
+		masks[group] |= 1ULL << i;
+
+		if(_frame_mask_type == UlpfecMaskType::Random && fec_count >= 3)
+		{
+			// The media packets of the same group are spread over the other FEC packets,
+			// so the second loss in a group is recovered from its other FEC packet
+			auto other = (group + 1 + ((i / fec_count) % (fec_count - 1))) % fec_count;
+			masks[other] |= 1ULL << i;
+		}
+	}
+
+	return masks;
 }
 
 void UlpfecGenerator::XorFecPacket(uint8_t *fec_packet, size_t fec_header_len, RedRtpPacket *media_packet)
@@ -201,13 +196,13 @@ void UlpfecGenerator::XorFecPacket(uint8_t *fec_packet, size_t fec_header_len, R
 	}
 }
 
-void UlpfecGenerator::FinalizeFecHeader(uint8_t *fec_packet, const size_t fec_payload_len, const uint8_t *mask, const size_t mask_len)
+void UlpfecGenerator::FinalizeFecHeader(uint8_t *fec_packet, const size_t fec_payload_len, uint16_t sn_base, uint64_t mask, bool l_bit)
 {
 	// Set E bit to zero.
 	fec_packet[0] &= 0x7f;
 
 	// Set L bit
-	if(_media_packets.size() <= kUlpfecMaxMediaPacketsLbitClear)
+	if(l_bit == false)
 	{
 		// Clear L bit
 		fec_packet[0] &= 0xbf;
@@ -218,11 +213,26 @@ void UlpfecGenerator::FinalizeFecHeader(uint8_t *fec_packet, const size_t fec_pa
 		fec_packet[0] |= 0x40;
 	}
 
+	// SN Base
+	ByteWriter<uint16_t>::WriteBigEndian(&fec_packet[2], sn_base);
+
 	// FEC Level header
 
 	// Protection Length
 	ByteWriter<uint16_t>::WriteBigEndian(&fec_packet[10], static_cast<uint16_t>(fec_payload_len));
 
-	// Mask
-	memcpy(&fec_packet[12], mask, mask_len);
-}
\ No newline at end of file
+	// Mask (bit 0 of the mask is the MSB of the first byte, which is the packet of the SN base)
+	size_t mask_len = l_bit ? kMaskSizeLbitSet : kMaskSizeLbitClear;
+	for(size_t i = 0; i < mask_len; i++)
+	{
+		uint8_t mask_byte = 0;
+		for(size_t bit = 0; bit < 8; bit++)
+		{
+			if(mask & (1ULL << (i * 8 + bit)))
+			{
+				mask_byte |= 1 << (7 - bit);
+			}
+		}
+		fec_packet[12 + i] = mask_byte;
+	}
+}
@@ -34,11 +34,19 @@
 */
 
 /*
- *	The current version of OME protects all contiguous media packets with one FEC packet,
- *  and one media packet only protects with one FEC packet.
- *  Fec packets is generated by a frame.
- *  Current version generates only one fec packet, near future we will apply bursty mask model.
- *  The session determines whether the FEC PACKET is sent according to the network status (using RTCP RR).
+ *	The media packets of a frame are protected in blocks of up to 48 packets (the size of the long mask).
+ *	Each block is protected by round(media packets * protection factor / 256) FEC packets (at least one),
+ *	and the masks are arranged by the mask type.
+ *
+ *	- Bursty : FEC packet j protects the media packets i with i % k == j (interleaved)
+ *	           Any run of up to k consecutive losses is recovered.
+ *	- Random : Interleaved as Bursty, and each media packet is also protected by another FEC packet
+ *	           selected by i / k, so two losses in the same interleaved group can be recovered.
+ *	           (Falls back to Bursty if k < 3, because every FEC packet would protect all the media packets)
+ *
+ *	The FEC packets of a frame are generated after its last (marker) packet.
+ *	The protection factor is set by the stream according to the loss reported by the sessions (using RTCP RR),
+ *	and the session determines whether the FEC packets are sent.
  */
 
 class UlpfecGenerator
@@ -47,7 +55,9 @@ public:
 	UlpfecGenerator();
 	~UlpfecGenerator();
 
-	void SetHighRateProtection(bool high_level);
+	// protection_factor: FEC packets per 256 media packets (0: no FEC packet is generated)
+	// It is applied from the next frame.
+	void SetProtection(uint8_t protection_factor, UlpfecMaskType mask_type);
 	// Because RTP is already being sent out, we execute ulpfec using the newly created red packet.
 	// I used this technique to reduce the copying and improve performance.
 	bool AddRtpPacketAndGenerateFec(std::shared_ptr<RedRtpPacket> packet);
@@ -56,10 +66,19 @@ public:
 
 private:
 	bool Encode();
+	void EncodeBlock(size_t first_index, size_t media_count);
+	// Returns the masks of the FEC packets (bit i: i-th media packet of the block)
+	std::vector<uint64_t> MakeMasks(size_t media_count, size_t fec_count) const;
 	void XorFecPacket(uint8_t *fec_packet, size_t fec_header_len, RedRtpPacket *packet);
-	void FinalizeFecHeader(uint8_t *fec_packet, const size_t fec_payload_len, const uint8_t *mask, const size_t mask_len);
+	void FinalizeFecHeader(uint8_t *fec_packet, const size_t fec_payload_len, uint16_t sn_base, uint64_t mask, bool l_bit);
 
 	std::queue<std::shared_ptr<ov::Data>>	    _generated_fec_packets;
 	std::vector<std::shared_ptr<RedRtpPacket>>	_media_packets;
-	bool                                        _high_level;
+
+	uint8_t										_protection_factor = 0;
+	UlpfecMaskType								_mask_type = UlpfecMaskType::Random;
+	// Latched at the first packet of a frame
+	uint8_t										_frame_protection_factor = 0;
+	UlpfecMaskType								_frame_mask_type = UlpfecMaskType::Random;
+	bool										_frame_started = false;
 };
\ No newline at end of file
@@ -157,7 +157,7 @@ bool WhipServer::Start(
 	const std::vector<ov::String> &ip_list,
 	bool is_port_configured, uint16_t port,
 	bool is_tls_port_configured, uint16_t tls_port,
-	int worker_count)
+	int worker_count, bool sharded)
 {
 	if ((_http_server_list.empty() == false) || (_https_server_list.empty() == false))
 	{
@@ -193,7 +193,7 @@ bool WhipServer::Start(
 			[&](const ov::SocketAddress &address, bool is_https, const std::shared_ptr<http::svr::HttpServer> &http_server) {
 				http_server->AddInterceptor(interceptor);
 			},
-			worker_count))
+			worker_count, sharded))
 	{
 		if (PrepareForTCPRelay() && PrepareForExternalIceServer())
 		{
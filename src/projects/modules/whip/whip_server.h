@@ -24,7 +24,7 @@ public:
 		const std::vector<ov::String> &ip_list,
 		bool is_port_configured, uint16_t port,
 		bool is_tls_port_configured, uint16_t tls_port,
-		int worker_count);
+		int worker_count, bool sharded);
 	bool Stop();
 
 	bool InsertCertificate(const std::shared_ptr<const info::Certificate> &certificate);
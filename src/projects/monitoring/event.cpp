@@ -44,6 +44,7 @@ namespace mon
 			// NotificationEventType
 			case EventType::Info:
 			case EventType::Error:
+			case EventType::EncoderLoadChanged:
 				_category = EventCategory::NotificationEventType;
 				break;
 			// StatisticsEventType
@@ -108,6 +109,8 @@ namespace mon
 				return "Info";
 			case EventType::Error:
 				return "Error";
+			case EventType::EncoderLoadChanged:
+				return "EncoderLoadChanged";
 			// StatisticsEventType
 			case EventType::ServerStat:
 				return "ServerStat";
@@ -182,6 +185,30 @@ namespace mon
 			FillServerStatistics(json_server_stat);
 		}
 
+		if (_extra_data.empty() == false)
+		{
+			Json::Value &json_extra_data = json_data["extraData"];
+
+			for (auto &extra_data : _extra_data)
+			{
+				auto &json_value = json_extra_data[extra_data.first.CStr()];
+
+				std::visit([&json_value](auto &&value) {
+					using T = std::decay_t<decltype(value)>;
+
+					if constexpr (std::is_same_v<T, ov::String>)
+					{
+						json_value = value.CStr();
+					}
+					else
+					{
+						json_value = value;
+					}
+				},
+						   extra_data.second);
+			}
+		}
+
 		Json::StreamWriterBuilder builder;
 		/* 
 			Default StreamWriterBuilder settings
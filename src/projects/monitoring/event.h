@@ -22,6 +22,7 @@ namespace mon
 		PushStarted, PushStopped,
 		// NotificationEventType
 		Info, Error,
+		EncoderLoadChanged,
 		// StatisticsEventType
 		ServerStat
 	};
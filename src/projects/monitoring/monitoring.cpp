@@ -409,4 +409,28 @@ namespace mon
 		stream_metric->OnSessionsDisconnected(type, number_of_sessions);
 	}
 
+	void Monitoring::OnEncoderLoadChanged(const info::Stream &stream_info, const ov::String &message, const std::map<ov::String, ExtraValueType> &extra_data)
+	{
+		if(IsAnalyticsOn() == false)
+		{
+			return;
+		}
+
+		auto stream_metric = GetStreamMetrics(stream_info);
+		if(stream_metric == nullptr)
+		{
+			return;
+		}
+
+		auto event = Event(EventType::EncoderLoadChanged, _server_metric);
+		event.SetExtraMetric(stream_metric);
+		event.SetMessage(message);
+
+		for(auto &[key, value] : extra_data)
+		{
+			event.AddExtraData(key, value);
+		}
+
+		_logger.Write(event);
+	}
 }  // namespace mon
\ No newline at end of file
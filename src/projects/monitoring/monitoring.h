@@ -58,6 +58,9 @@ namespace mon
 		void OnSessionDisconnected(const info::Stream &stream_info, PublisherType type);
 		void OnSessionsDisconnected(const info::Stream &stream_info, PublisherType type, uint64_t number_of_sessions);
 
+		// Called when the transcoder lowers/restores the quality of an encoder to follow the CPU load
+		void OnEncoderLoadChanged(const info::Stream &stream_info, const ov::String &message, const std::map<ov::String, ExtraValueType> &extra_data);
+
 	private:
 		ov::DelayQueue _timer{"MonLogTimer"};
 		std::shared_ptr<ServerMetrics> _server_metric = nullptr;
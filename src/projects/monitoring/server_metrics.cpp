@@ -200,6 +200,11 @@ namespace mon
 		return _queues;
 	}
 
+	std::vector<ov::MemoryPool::Stats> ServerMetrics::GetMemoryPoolStats() const
+	{
+		return ov::MemoryPool::GetStats();
+	}
+
 	std::shared_ptr<QueueMetrics> ServerMetrics::GetQueueMetrics(const info::ManagedQueue &queue_info)
 	{
 		std::shared_lock<std::shared_mutex> lock(_queue_map_guard);
@@ -45,5 +45,10 @@ namespace mon
 	protected:
 		std::shared_mutex _queue_map_guard;
 		std::map<uint32_t, std::shared_ptr<QueueMetrics>> _queues;
+
+	// Memory pool metrics
+	public:
+		// Hit/miss/footprint of each size class of ov::MemoryPool (ov::Data, MediaPacket, ...)
+		std::vector<ov::MemoryPool::Stats> GetMemoryPoolStats() const;
 	};
 }
\ No newline at end of file
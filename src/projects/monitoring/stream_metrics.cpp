@@ -20,6 +20,18 @@ namespace mon
 									"\tElapsed time to subscribe to origin server : %llu ms\n",
 									GetOriginConnectionTimeMSec(), GetOriginSubscribeTimeMSec());
 		}
+		if (IsOnDemandTranscoding())
+		{
+			out_str.Append("\n\tOn-demand transcoding :\n");
+
+			for (auto &[rendition_name, state] : GetRenditionTranscodingStates())
+			{
+				out_str.AppendFormat("\t\t%s : %s (active: %lld ms, idle: %lld ms, resumed: %u)\n",
+									 rendition_name.CStr(), state.idle ? "Idle" : "Active",
+									 state.active_time_msec, state.idle_time_msec, state.resume_count);
+			}
+		}
+
 		out_str.Append("\n");
 		out_str.Append(CommonMetrics::GetInfoString());
 
@@ -63,6 +75,80 @@ namespace mon
 		UpdateDate();
 	}
 
+	void StreamMetrics::SetRenditionIdle(const ov::String &rendition_name, bool idle)
+	{
+		std::lock_guard lock_guard(_transcoding_state_mutex);
+
+		auto now = ov::Clock::NowMSec();
+
+		auto record_it = _rendition_transcoding_records.find(rendition_name);
+		if (record_it == _rendition_transcoding_records.end())
+		{
+			// First report from the transcoder (the rendition is active since the stream is created)
+			RenditionTranscodingRecord record;
+			record.state_time_msec = std::chrono::duration_cast<std::chrono::milliseconds>(CommonMetrics::GetCreatedTime().time_since_epoch()).count();
+
+			record_it = _rendition_transcoding_records.emplace(rendition_name, record).first;
+		}
+
+		auto &record = record_it->second;
+
+		if (record.state.idle == idle)
+		{
+			return;
+		}
+
+		auto elapsed = static_cast<int64_t>(now - record.state_time_msec);
+
+		if (record.state.idle)
+		{
+			record.state.idle_time_msec += elapsed;
+			record.state.resume_count++;
+		}
+		else
+		{
+			record.state.active_time_msec += elapsed;
+		}
+
+		record.state.idle = idle;
+		record.state_time_msec = now;
+
+		UpdateDate();
+	}
+
+	bool StreamMetrics::IsOnDemandTranscoding() const
+	{
+		std::lock_guard lock_guard(_transcoding_state_mutex);
+		return _rendition_transcoding_records.empty() == false;
+	}
+
+	std::map<ov::String, StreamMetrics::RenditionTranscodingState> StreamMetrics::GetRenditionTranscodingStates() const
+	{
+		std::lock_guard lock_guard(_transcoding_state_mutex);
+
+		std::map<ov::String, RenditionTranscodingState> states;
+		auto now = ov::Clock::NowMSec();
+
+		for (auto &[rendition_name, record] : _rendition_transcoding_records)
+		{
+			auto state = record.state;
+			auto elapsed = static_cast<int64_t>(now - record.state_time_msec);
+
+			if (state.idle)
+			{
+				state.idle_time_msec += elapsed;
+			}
+			else
+			{
+				state.active_time_msec += elapsed;
+			}
+
+			states.emplace(rendition_name, state);
+		}
+
+		return states;
+	}
+
 	void StreamMetrics::IncreaseBytesIn(uint64_t value)
 	{
 		CommonMetrics::IncreaseBytesIn(value);
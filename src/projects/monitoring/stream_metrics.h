@@ -47,6 +47,20 @@ namespace mon
 		void SetOriginConnectionTimeMSec(int64_t value);
 		void SetOriginSubscribeTimeMSec(int64_t value);
 
+		// On-demand transcoding: the renditions of the output stream are encoded only while it has subscribers
+		struct RenditionTranscodingState
+		{
+			bool idle = false;
+			// Including the time of the current state
+			int64_t active_time_msec = 0;
+			int64_t idle_time_msec = 0;
+			uint32_t resume_count = 0;
+		};
+		void SetRenditionIdle(const ov::String &rendition_name, bool idle);
+		bool IsOnDemandTranscoding() const;
+		// [RENDITION_NAME, RenditionTranscodingState]
+		std::map<ov::String, RenditionTranscodingState> GetRenditionTranscodingStates() const;
+
 		// Overriding from CommonMetrics 
 		void IncreaseBytesIn(uint64_t value) override;
 		void IncreaseBytesOut(PublisherType type, uint64_t value) override;
@@ -58,6 +72,18 @@ namespace mon
 		std::atomic<int64_t> _connection_time_to_origin_msec = 0;
 		std::atomic<int64_t> _subscribe_time_from_origin_msec = 0;
 
+		// Related to on-demand transcoding, From Transcoder
+		struct RenditionTranscodingRecord
+		{
+			// The times are accumulated until state_time_msec
+			RenditionTranscodingState state;
+			// The time when the state was changed last
+			uint64_t state_time_msec = 0;
+		};
+		mutable std::mutex _transcoding_state_mutex;
+		// [RENDITION_NAME, RenditionTranscodingRecord]
+		std::map<ov::String, RenditionTranscodingRecord> _rendition_transcoding_records;
+
 		// If this stream is from Provider(input stream) it has multiple output streams
 		std::vector<std::shared_ptr<StreamMetrics>> _output_stream_metrics;
 
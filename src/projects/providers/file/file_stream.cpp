@@ -275,7 +275,7 @@ namespace pvd
 			if (codec_id == cmn::MediaCodecId::H264)
 			{
 				// @extradata == AVCDecoderConfigurationRecord
-				auto media_packet = std::make_shared<MediaPacket>(
+				auto media_packet = MediaPacket::Create(
 					GetMsid(),
 					media_type,
 					track->GetId(),
@@ -290,7 +290,7 @@ namespace pvd
 			else if (codec_id == cmn::MediaCodecId::Aac)
 			{
 				// @extradata == AudioSpecificConfig
-				auto media_packet = std::make_shared<MediaPacket>(
+				auto media_packet = MediaPacket::Create(
 					GetMsid(),
 					media_type,
 					track->GetId(),
@@ -145,7 +145,7 @@ namespace pvd
 					}
 
 					auto data = std::make_shared<ov::Data>(es->Payload(), es->PayloadLength());
-					auto media_packet = std::make_shared<MediaPacket>(GetMsid(),
+					auto media_packet = MediaPacket::Create(GetMsid(),
 																	  cmn::MediaType::Video,
 																	  es->PID(),
 																	  data,
@@ -161,7 +161,7 @@ namespace pvd
 					auto payload_length = es->PayloadLength();
 				
 					auto data = std::make_shared<ov::Data>(payload, payload_length);
-					auto media_packet = std::make_shared<MediaPacket>(GetMsid(),
+					auto media_packet = MediaPacket::Create(GetMsid(),
 																	  cmn::MediaType::Audio,
 																	  es->PID(),
 																	  data,
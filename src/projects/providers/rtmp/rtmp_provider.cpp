@@ -86,6 +86,7 @@ namespace pvd
 		bool is_configured;
 		auto worker_count = rtmp_config.GetWorkerCount(&is_configured);
 		worker_count = is_configured ? worker_count : PHYSICAL_PORT_USE_DEFAULT_COUNT;
+		auto sharded = rtmp_config.UseShardedWorkers();
 
 		std::vector<ov::SocketAddress> rtmp_address_list;
 
@@ -113,7 +114,7 @@ namespace pvd
 
 		for (const auto &rtmp_address : rtmp_address_list)
 		{
-			auto physical_port = port_manager->CreatePort("RTMP", ov::SocketType::Tcp, rtmp_address, worker_count);
+			auto physical_port = port_manager->CreatePort("RTMP", ov::SocketType::Tcp, rtmp_address, worker_count, sharded);
 
 			if (physical_port == nullptr)
 			{
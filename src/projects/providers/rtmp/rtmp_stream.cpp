@@ -1480,7 +1480,7 @@ namespace pvd
 			}
 
 			auto data = std::make_shared<ov::Data>(flv_video.Payload(), flv_video.PayloadLength());
-			auto video_frame = std::make_shared<MediaPacket>(GetMsid(),
+			auto video_frame = MediaPacket::Create(GetMsid(),
 															 cmn::MediaType::Video,
 															 RTMP_VIDEO_TRACK_ID,
 															 data,
@@ -1655,7 +1655,7 @@ namespace pvd
 			}
 
 			auto data = std::make_shared<ov::Data>(flv_audio.Payload(), flv_audio.PayloadLength());
-			auto frame = std::make_shared<MediaPacket>(GetMsid(),
+			auto frame = MediaPacket::Create(GetMsid(),
 													   cmn::MediaType::Audio,
 													   RTMP_AUDIO_TRACK_ID,
 													   data,
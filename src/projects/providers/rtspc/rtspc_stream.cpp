@@ -1048,7 +1048,7 @@ namespace pvd
 		logtd("Channel(%d) Payload Type(%d) Ssrc(%u) Timestamp(%u) PTS(%lld) Time scale(%f) Adjust Timestamp(%f)",
 			  channel, first_rtp_packet->PayloadType(), first_rtp_packet->Ssrc(), first_rtp_packet->Timestamp(), adjusted_timestamp, track->GetTimeBase().GetExpr(), static_cast<double>(adjusted_timestamp) * track->GetTimeBase().GetExpr());
 
-		auto frame = std::make_shared<MediaPacket>(GetMsid(),
+		auto frame = MediaPacket::Create(GetMsid(),
 												   track->GetMediaType(),
 												   track->GetId(),
 												   bitstream,
@@ -1062,7 +1062,7 @@ namespace pvd
 		// Send SPS/PPS if stream is H264
 		if (_sent_sequence_header == false && track->GetCodecId() == cmn::MediaCodecId::H264 && _h264_extradata_nalu != nullptr)
 		{
-			auto media_packet = std::make_shared<MediaPacket>(GetMsid(),
+			auto media_packet = MediaPacket::Create(GetMsid(),
 															  track->GetMediaType(),
 															  track->GetId(),
 															  _h264_extradata_nalu,
@@ -63,6 +63,8 @@ namespace pvd
 		bool is_configured;
 		auto worker_count = srt_bind_config.GetWorkerCount(&is_configured);
 		worker_count = is_configured ? worker_count : PHYSICAL_PORT_USE_DEFAULT_COUNT;
+		// SRT cannot have a listener per worker, so PhysicalPort falls back to a single listener
+		auto sharded = srt_bind_config.UseShardedWorkers();
 
 		bool is_port_configured;
 		auto &port_config = srt_bind_config.GetPort(&is_port_configured);
@@ -93,7 +95,7 @@ namespace pvd
 		for (const auto &address : address_list)
 		{
 			auto physical_port = physical_port_manager->CreatePort(
-				"SRT", ov::SocketType::Srt, address, worker_count, 0, 0,
+				"SRT", ov::SocketType::Srt, address, worker_count, sharded, 0, 0,
 				[=](const std::shared_ptr<ov::Socket> &socket) -> std::shared_ptr<ov::Error> {
 					return SrtOptionProcessor::SetOptions(socket, srt_bind_config.GetOptions());
 				});
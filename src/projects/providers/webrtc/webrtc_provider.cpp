@@ -42,6 +42,7 @@ namespace pvd
 		bool is_configured;
 		auto worker_count = signalling_config.GetWorkerCount(&is_configured);
 		worker_count = is_configured ? worker_count : HTTP_SERVER_USE_DEFAULT_COUNT;
+		auto sharded = signalling_config.UseShardedWorkers();
 
 		bool is_port_configured;
 		auto &port_config = signalling_config.GetPort(&is_port_configured);
@@ -70,7 +71,7 @@ namespace pvd
 					ip_list,
 					is_port_configured, port_config.GetPort(),
 					is_tls_port_configured, tls_port_config.GetPort(),
-					worker_count, std::make_shared<WebRtcProviderSignallingInterceptor>()) == false)
+					worker_count, sharded, std::make_shared<WebRtcProviderSignallingInterceptor>()) == false)
 			{
 				break;
 			}
@@ -82,7 +83,7 @@ namespace pvd
 					ip_list,
 					is_port_configured, port_config.GetPort(),
 					is_tls_port_configured, tls_port_config.GetPort(),
-					worker_count) == false)
+					worker_count, sharded) == false)
 			{
 				break;
 			}
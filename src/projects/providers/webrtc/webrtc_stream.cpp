@@ -413,7 +413,7 @@ namespace pvd
 		logtp("Payload Type(%d) Timestamp(%u) PTS(%u) Time scale(%f) Adjust Timestamp(%f)",
 			  first_rtp_packet->PayloadType(), first_rtp_packet->Timestamp(), adjusted_timestamp, track->GetTimeBase().GetExpr(), static_cast<double>(adjusted_timestamp) * track->GetTimeBase().GetExpr());
 
-		auto frame = std::make_shared<MediaPacket>(GetMsid(),
+		auto frame = MediaPacket::Create(GetMsid(),
 												   track->GetMediaType(),
 												   track->GetId(),
 												   bitstream,
@@ -427,7 +427,7 @@ namespace pvd
 		// This may not work since almost WebRTC browser sends SRS/PPS in-band
 		if (_sent_sequence_header == false && track->GetCodecId() == cmn::MediaCodecId::H264 && _h264_extradata_nalu != nullptr)
 		{
-			auto media_packet = std::make_shared<MediaPacket>(GetMsid(),	
+			auto media_packet = MediaPacket::Create(GetMsid(),	
 																track->GetMediaType(), 
 																track->GetId(), 
 																_h264_extradata_nalu,
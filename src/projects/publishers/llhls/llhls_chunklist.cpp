@@ -12,6 +12,9 @@
 #include <base/ovcrypto/base_64.h>
 #include <base/ovlibrary/zip.h>
 
+// Characters that cannot be in the URL, replaced by the query string of each request
+#define CHUNKLIST_QUERY_STRING_PLACEHOLDER "\x01QS\x01"
+
 LLHlsChunklist::LLHlsChunklist(const ov::String &url, const std::shared_ptr<const MediaTrack> &track, uint32_t target_duration, double part_target_duration, const ov::String &map_uri)
 {
 	_url = url;
@@ -35,6 +38,8 @@ void LLHlsChunklist::SetRenditions(const std::map<int32_t, std::shared_ptr<LLHls
 	// lock
 	std::lock_guard<std::shared_mutex> lock(_renditions_guard);
 	_renditions = renditions;
+
+	InvalidateCache();
 }
 
 void LLHlsChunklist::EnableCenc(const bmff::CencProperty &cenc_property)
@@ -111,7 +116,7 @@ bool LLHlsChunklist::AppendSegmentInfo(const SegmentInfo &info)
 
 	segment->SetCompleted();
 
-	UpdateCacheForDefaultChunklist();
+	InvalidateCache();
 	if (is_new_segment)
 	{
 		_last_segment_sequence = info.GetSequence();
@@ -149,7 +154,7 @@ bool LLHlsChunklist::AppendPartialSegmentInfo(uint32_t segment_sequence, const S
 
 	segment->InsertPartialSegmentInfo(std::make_shared<SegmentInfo>(info));
 	
-	UpdateCacheForDefaultChunklist();
+	InvalidateCache();
 	_last_partial_segment_sequence = info.GetSequence();
 
 	return true;
@@ -177,25 +182,81 @@ bool LLHlsChunklist::RemoveSegmentInfo(uint32_t segment_sequence)
 
 	_segments.erase(segment_sequence);
 
+	InvalidateCache();
+
 	return true;
 }
 
-void LLHlsChunklist::UpdateCacheForDefaultChunklist()
+void LLHlsChunklist::InvalidateCache()
 {
-	ov::String chunklist = MakeChunklist("", false, false);
+	// The rendered chunklists are released when they are requested next time
+	_version++;
+}
+
+uint64_t LLHlsChunklist::GetCacheVersion() const
+{
+	// The rendered chunklist has #EXT-X-RENDITION-REPORT (LAST-MSN/LAST-PART) of the other renditions,
+	// so it is also outdated when any of them is changed. Each version only increases, so does the sum.
+	uint64_t version = _version.load();
+
+	std::shared_lock<std::shared_mutex> rendition_lock(_renditions_guard);
+	for (const auto &[track_id, rendition] : _renditions)
 	{
-		// lock 
-		std::lock_guard<std::shared_mutex> lock(_cached_default_chunklist_guard);
-		_cached_default_chunklist = chunklist;
+		if ((rendition == nullptr) || (track_id == static_cast<int32_t>(_track->GetId())))
+		{
+			continue;
+		}
+
+		version += rendition->_version.load();
 	}
 
+	return version;
+}
+
+void LLHlsChunklist::ResetCacheIfNeeded() const
+{
+	auto version = GetCacheVersion();
+
+	if (_cache_version != version)
 	{
-		// lock 
-		std::lock_guard<std::shared_mutex> lock(_cached_default_chunklist_gzip_guard);
-		_cached_default_chunklist_gzip = ov::Zip::CompressGzip(chunklist.ToData(false));
+		_rendered_chunklists.clear();
+		_compressed_chunklists.clear();
+
+		_cache_version = version;
 	}
 }
 
+std::shared_ptr<LLHlsChunklist::RenderedChunklist> LLHlsChunklist::GetRenderedChunklist(bool has_query_string, bool skip, bool legacy) const
+{
+	std::shared_ptr<RenderedChunklist> rendered_chunklist;
+
+	{
+		std::lock_guard<std::mutex> lock(_cache_guard);
+
+		ResetCacheIfNeeded();
+
+		auto &item = _rendered_chunklists[{has_query_string, skip, legacy}];
+		if (item == nullptr)
+		{
+			item = std::make_shared<RenderedChunklist>();
+		}
+
+		rendered_chunklist = item;
+	}
+
+	// Other requests for the same variant wait here until the first one renders it
+	std::call_once(rendered_chunklist->once_flag, [&]() {
+		rendered_chunklist->chunklist = MakeChunklist(has_query_string ? CHUNKLIST_QUERY_STRING_PLACEHOLDER : "", skip, legacy);
+
+		if (has_query_string == false)
+		{
+			rendered_chunklist->data = rendered_chunklist->chunklist.ToData(false);
+		}
+	});
+
+	return rendered_chunklist;
+}
+
 bool LLHlsChunklist::SaveOldSegmentInfo(std::shared_ptr<SegmentInfo> &segment_info)
 {
 	if (_keep_old_segments == false)
@@ -472,23 +533,59 @@ ov::String LLHlsChunklist::ToString(const ov::String &query_string, bool skip, b
 		return "";
 	}
 
-	if (query_string.IsEmpty() && skip == false && legacy == false && vod == false && vod_start_segment_number == 0 && !_cached_default_chunklist.IsEmpty())
+	if ((vod == true) || (vod_start_segment_number != 0))
+	{
+		return MakeChunklist(query_string, skip, legacy, vod, vod_start_segment_number);
+	}
+
+	auto rendered_chunklist = GetRenderedChunklist(query_string.IsEmpty() == false, skip, legacy);
+
+	if (query_string.IsEmpty())
+	{
+		return rendered_chunklist->chunklist;
+	}
+
+	return rendered_chunklist->chunklist.Replace(CHUNKLIST_QUERY_STRING_PLACEHOLDER, query_string);
+}
+
+std::shared_ptr<const ov::Data> LLHlsChunklist::ToData(const ov::String &query_string, bool skip, bool legacy) const
+{
+	if (query_string.IsEmpty())
 	{
-		// return cached chunklist for default chunklist
-		std::shared_lock<std::shared_mutex> lock(_cached_default_chunklist_guard);
-		return _cached_default_chunklist;
+		return GetRenderedChunklist(false, skip, legacy)->data;
 	}
 
-	return MakeChunklist(query_string, skip, legacy, vod, vod_start_segment_number);
+	return ToString(query_string, skip, legacy).ToData(false);
 }
 
 std::shared_ptr<const ov::Data> LLHlsChunklist::ToGzipData(const ov::String &query_string, bool skip, bool legacy) const
 {
-	if (query_string.IsEmpty() && skip == false && legacy == false && _cached_default_chunklist_gzip != nullptr)
+	if (query_string.IsEmpty() == false)
 	{
-		std::shared_lock<std::shared_mutex> lock(_cached_default_chunklist_gzip_guard);
-		return _cached_default_chunklist_gzip;
+		// Each session has its own query string (session=<id>_<key>), so it can't be shared with other requests
+		return ov::Zip::CompressGzip(ToString(query_string, skip, legacy).ToData(false));
 	}
 
-	return ov::Zip::CompressGzip(ToString(query_string, skip, legacy).ToData(false));
+	std::shared_ptr<CompressedChunklist> compressed_chunklist;
+
+	{
+		std::lock_guard<std::mutex> lock(_cache_guard);
+
+		ResetCacheIfNeeded();
+
+		auto &item = _compressed_chunklists[{skip, legacy}];
+		if (item == nullptr)
+		{
+			item = std::make_shared<CompressedChunklist>();
+		}
+
+		compressed_chunklist = item;
+	}
+
+	// Compressed only once for each version, and other requests wait for it
+	std::call_once(compressed_chunklist->once_flag, [&]() {
+		compressed_chunklist->data = ov::Zip::CompressGzip(ToString(query_string, skip, legacy).ToData(false));
+	});
+
+	return compressed_chunklist->data;
 }
@@ -182,6 +182,8 @@ public:
 	bool RemoveSegmentInfo(uint32_t segment_sequence);
 
 	ov::String ToString(const ov::String &query_string, bool skip, bool legacy, bool vod = false, uint32_t vod_start_segment_number = 0) const;
+	// The returned data is shared by the requests for the same variant, so it MUST NOT be modified
+	std::shared_ptr<const ov::Data> ToData(const ov::String &query_string, bool skip, bool legacy) const;
 	std::shared_ptr<const ov::Data> ToGzipData(const ov::String &query_string, bool skip, bool legacy) const;
 
 	std::shared_ptr<SegmentInfo> GetSegmentInfo(uint32_t segment_sequence) const;
@@ -221,13 +223,41 @@ private:
 	std::map<int32_t, std::shared_ptr<LLHlsChunklist>> _renditions;
 	mutable std::shared_mutex _renditions_guard;
 
-	ov::String _cached_default_chunklist;
-	mutable std::shared_mutex _cached_default_chunklist_guard;
-
-	std::shared_ptr<ov::Data> _cached_default_chunklist_gzip;
-	mutable std::shared_mutex _cached_default_chunklist_gzip_guard;
-
 	bmff::CencProperty _cenc_property;
 
-	void UpdateCacheForDefaultChunklist();
+	// Rendered chunklists for the current version of the segments (of this chunklist and the other renditions)
+	//
+	// Blocking reloads parked on the same part are released at the same time. The first request renders
+	// (and compresses) each variant once, and the others wait for it and share the result.
+	struct RenderedChunklist
+	{
+		std::once_flag once_flag;
+		// The query string is rendered as a placeholder, and replaced for each request
+		ov::String chunklist;
+		// Only available for the chunklist without the query string
+		std::shared_ptr<const ov::Data> data;
+	};
+
+	struct CompressedChunklist
+	{
+		std::once_flag once_flag;
+		std::shared_ptr<const ov::Data> data;
+	};
+
+	// Called whenever the segments are changed
+	void InvalidateCache();
+	// Version of this chunklist and the other renditions
+	uint64_t GetCacheVersion() const;
+	// _cache_guard MUST be held
+	void ResetCacheIfNeeded() const;
+	std::shared_ptr<RenderedChunklist> GetRenderedChunklist(bool has_query_string, bool skip, bool legacy) const;
+
+	std::atomic<uint64_t> _version = 0;
+
+	mutable std::mutex _cache_guard;
+	mutable uint64_t _cache_version = 0;
+	// [has_query_string, skip, legacy]
+	mutable std::map<std::tuple<bool, bool, bool>, std::shared_ptr<RenderedChunklist>> _rendered_chunklists;
+	// [skip, legacy] - Only the chunklist without the query string is cached, since the query string carries the session of each player
+	mutable std::map<std::tuple<bool, bool>, std::shared_ptr<CompressedChunklist>> _compressed_chunklists;
 };
\ No newline at end of file
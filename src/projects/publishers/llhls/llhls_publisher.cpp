@@ -36,7 +36,8 @@ bool LLHlsPublisher::PrepareHttpServers(
 	const std::vector<ov::String> &ip_list,
 	const bool is_port_configured, const uint16_t port,
 	const bool is_tls_port_configured, const uint16_t tls_port,
-	const int worker_count)
+	const int worker_count,
+	const bool sharded)
 {
 	auto http_server_manager = http::svr::HttpServerManager::GetInstance();
 
@@ -53,7 +54,7 @@ bool LLHlsPublisher::PrepareHttpServers(
 			[&](const ov::SocketAddress &address, bool is_https, const std::shared_ptr<http::svr::HttpServer> &http_server) {
 				http_server->AddInterceptor(CreateInterceptor());
 			},
-			worker_count))
+			worker_count, sharded))
 	{
 		std::lock_guard lock_guard{_http_server_list_mutex};
 		_http_server_list = std::move(http_server_list);
@@ -89,6 +90,7 @@ bool LLHlsPublisher::Start()
 	bool is_configured = false;
 	auto worker_count = llhls_bind_config.GetWorkerCount(&is_configured);
 	worker_count = is_configured ? worker_count : HTTP_SERVER_USE_DEFAULT_COUNT;
+	auto sharded = llhls_bind_config.UseShardedWorkers();
 
 	bool is_port_configured;
 	auto &port_config = llhls_bind_config.GetPort(&is_port_configured);
@@ -106,7 +108,7 @@ bool LLHlsPublisher::Start()
 			   server_config.GetIPList(),
 			   is_port_configured, port_config.GetPort(),
 			   is_tls_port_configured, tls_port_config.GetPort(),
-			   worker_count) &&
+			   worker_count, sharded) &&
 		   Publisher::Start();
 }
 
@@ -29,7 +29,8 @@ protected:
 		const std::vector<ov::String> &ip_list,
 		const bool is_port_configured, const uint16_t port,
 		const bool is_tls_port_configured, const uint16_t tls_port,
-		const int worker_count);
+		const int worker_count,
+		const bool sharded);
 
 private:
 	bool Start() override;
@@ -576,7 +576,8 @@ void LLHlsSession::ResponseChunklist(const std::shared_ptr<http::svr::HttpExchan
 			}
 		}
 
-		response->AppendData(chunklist);
+		// The chunklist can be shared by the requests parked on the same part
+		response->AppendSharedData(chunklist);
 
 		// If a client uses previously cached llhls.m3u8 and requests chunklist
 		if (_number_of_players == 0)
@@ -649,7 +650,7 @@ void LLHlsSession::ResponseInitializationSegment(const std::shared_ptr<http::svr
 			response->SetHeader("Cache-Control", cache_control);
 		}
 
-		response->AppendData(initialization_segment);
+		response->AppendSharedData(initialization_segment);
 	}
 	else
 	{
@@ -670,6 +671,22 @@ void LLHlsSession::ResponseSegment(const std::shared_ptr<http::svr::HttpExchange
 
 	auto response = exchange->GetResponse();
 
+	// Segments that have been moved to the DVR storage are sent from the file directly
+	auto file_path = llhls_stream->GetSegmentFilePath(track_id, segment_number);
+	if ((file_path.IsEmpty() == false) && response->AppendFile(file_path))
+	{
+		response->SetStatusCode(http::StatusCode::OK);
+		response->SetHeader("Content-Type", (GetStream()->GetTrack(track_id)->GetMediaType() == cmn::MediaType::Video) ? "video/mp4" : "audio/mp4");
+
+		if (_segment_max_age >= 0)
+		{
+			response->SetHeader("Cache-Control", (_segment_max_age == 0) ? ov::String("no-cache, no-store") : ov::String::FormatString("max-age=%d", _segment_max_age));
+		}
+
+		ResponseData(exchange);
+		return;
+	}
+
 	// Get the segment
 	auto [result, segment] = llhls_stream->GetSegment(track_id, segment_number);
 	if (result == LLHlsStream::RequestResult::Success)
@@ -700,7 +717,7 @@ void LLHlsSession::ResponseSegment(const std::shared_ptr<http::svr::HttpExchange
 			response->SetHeader("Cache-Control", cache_control);
 		}
 
-		response->AppendData(segment);
+		response->AppendSharedData(segment);
 	}
 	else
 	{
@@ -751,7 +768,7 @@ void LLHlsSession::ResponsePartialSegment(const std::shared_ptr<http::svr::HttpE
 			response->SetHeader("Cache-Control", cache_control);
 		}
 
-		response->AppendData(partial_segment);
+		response->AppendSharedData(partial_segment);
 	}
 	else if (result == LLHlsStream::RequestResult::Accepted && holdIfAccepted == true)
 	{
@@ -726,7 +726,7 @@ std::tuple<LLHlsStream::RequestResult, std::shared_ptr<const ov::Data>> LLHlsStr
 		return {RequestResult::Success, chunklist->ToGzipData(query_string, skip, legacy)};
 	}
 
-	return {RequestResult::Success, chunklist->ToString(query_string, skip, legacy).ToData(false)};
+	return {RequestResult::Success, chunklist->ToData(query_string, skip, legacy)};
 }
 
 std::tuple<LLHlsStream::RequestResult, std::shared_ptr<ov::Data>> LLHlsStream::GetInitializationSegment(const int32_t &track_id) const
@@ -757,9 +757,26 @@ std::tuple<LLHlsStream::RequestResult, std::shared_ptr<ov::Data>> LLHlsStream::G
 		return {RequestResult::NotFound, nullptr};
 	}
 
+	if (segment->IsCompleted() == false)
+	{
+		// The data of the segment is still growing, so a snapshot is returned (the response doesn't copy the data)
+		return {RequestResult::Success, segment->GetData()->Clone()};
+	}
+
 	return {RequestResult::Success, segment->GetData()};
 }
 
+ov::String LLHlsStream::GetSegmentFilePath(const int32_t &track_id, const int64_t &segment_number) const
+{
+	auto storage = GetStorage(track_id);
+	if (storage == nullptr)
+	{
+		return "";
+	}
+
+	return storage->GetMediaSegmentFilePath(segment_number);
+}
+
 std::tuple<LLHlsStream::RequestResult, std::shared_ptr<ov::Data>> LLHlsStream::GetChunk(const int32_t &track_id, const int64_t &segment_number, const int64_t &chunk_number) const
 {
 	logtd("LLHlsStream(%s) - GetChunk(%d, %ld, %ld)", GetName().CStr(), track_id, segment_number, chunk_number);
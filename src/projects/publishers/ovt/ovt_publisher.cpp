@@ -63,6 +63,7 @@ bool OvtPublisher::Start()
 
 	auto worker_count = ovt_config.GetWorkerCount(&is_configured);
 	worker_count = is_configured ? worker_count : PHYSICAL_PORT_USE_DEFAULT_COUNT;
+	auto sharded = ovt_config.UseShardedWorkers();
 
 	bool result = true;
 	std::vector<std::shared_ptr<PhysicalPort>> server_port_list;
@@ -70,7 +71,7 @@ bool OvtPublisher::Start()
 
 	for (auto &address : address_list)
 	{
-		auto server_port = PhysicalPortManager::GetInstance()->CreatePort("OvtPub", port_config.GetSocketType(), address, worker_count);
+		auto server_port = PhysicalPortManager::GetInstance()->CreatePort("OvtPub", port_config.GetSocketType(), address, worker_count, sharded);
 
 		if (server_port == nullptr)
 		{
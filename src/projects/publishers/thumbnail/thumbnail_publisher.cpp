@@ -37,7 +37,8 @@ bool ThumbnailPublisher::PrepareHttpServers(
 	const std::vector<ov::String> &ip_list,
 	const bool is_port_configured, const uint16_t port,
 	const bool is_tls_port_configured, const uint16_t tls_port,
-	const int worker_count)
+	const int worker_count,
+	const bool sharded)
 {
 	auto http_server_manager = http::svr::HttpServerManager::GetInstance();
 
@@ -55,7 +56,7 @@ bool ThumbnailPublisher::PrepareHttpServers(
 			[&](const ov::SocketAddress &address, bool is_https, const std::shared_ptr<http::svr::HttpServer> &http_server) {
 				http_server->AddInterceptor(CreateInterceptor());
 			},
-			worker_count))
+			worker_count, sharded))
 	{
 		_http_server_list = std::move(http_server_list);
 		_https_server_list = std::move(https_server_list);
@@ -83,6 +84,7 @@ bool ThumbnailPublisher::Start()
 	bool is_configured = false;
 	auto worker_count = thumbnail_bind_config.GetWorkerCount(&is_configured);
 	worker_count = is_configured ? worker_count : HTTP_SERVER_USE_DEFAULT_COUNT;
+	auto sharded = thumbnail_bind_config.UseShardedWorkers();
 
 	bool is_port_configured;
 	auto &port_config = thumbnail_bind_config.GetPort(&is_port_configured);
@@ -100,7 +102,7 @@ bool ThumbnailPublisher::Start()
 			   server_config.GetIPList(),
 			   is_port_configured, port_config.GetPort(),
 			   is_tls_port_configured, tls_port_config.GetPort(),
-			   worker_count) &&
+			   worker_count, sharded) &&
 		   Publisher::Start();
 }
 
@@ -17,9 +17,67 @@
 #include "modules/rtp_rtcp/rtcp_info/nack.h"
 #include "modules/rtp_rtcp/rtcp_info/transport_cc.h"
 #include "modules/rtp_rtcp/rtcp_info/remb.h"
+#include "base/ovlibrary/byte_io.h"
 
 #include <utility>
 
+// RTP packet + SRTP auth tag
+#define RTC_SESSION_SEND_BUFFER_CAPACITY	2048
+
+// Bandwidth estimation
+#define BWE_MIN_BITRATE						50000
+#define BWE_MAX_BITRATE						100000000
+#define BWE_DEFAULT_INITIAL_BITRATE			1000000
+
+// Auto ABR (evaluated once a second)
+// The rendition goes lower if the estimate is under 90% of the current rendition for 2 seconds (immediately on the overuse),
+#define ABR_LOWER_MARGIN					0.9
+#define ABR_LOWER_EVALUATIONS				2
+// and goes higher if the estimate is over 115% of the higher rendition for 5 seconds.
+#define ABR_HIGHER_MARGIN					1.15
+#define ABR_HIGHER_EVALUATIONS				5
+// The estimate can't grow much beyond the sending bitrate, so a higher rendition is also probed
+// if there is no overuse (and the loss is under 2%) for 10 seconds, and the estimate is limited by the sending bitrate.
+#define ABR_PROBE_STABLE_DURATION_MS		10000
+#define ABR_PROBE_MAX_FRACTION_LOST			0.02
+#define ABR_PROBE_HEADROOM					1.3
+// A switch to a higher rendition is reverted if the estimator detects the overuse within 5 seconds,
+#define ABR_PROBE_DURATION_MS				5000
+// and the rendition isn't probed again for 10 -> 20 -> 40 ... 160 seconds
+#define ABR_PROBE_BACKOFF_MS				10000
+#define ABR_MAX_PROBE_BACKOFF_MS			160000
+#define ABR_MAX_SWITCH_HISTORY				32
+
+// Before probing a higher rendition, the padding is sent up to its bitrate (with the margin to switch) for this duration,
+// so that the estimate can grow over the bitrate of the current rendition. A padding probe that fails is backed off
+// like a failed switch (ABR_PROBE_BACKOFF_MS)
+#define ABR_PADDING_PROBE_DURATION_MS		3000
+// Redundant retransmissions sent as the padding at once
+#define PACING_MAX_PADDING_PACKETS			16
+
+// ULPFEC is sent to the session while the smoothed loss of the video is over 2%, until it goes under 0.5%
+// (RR is received about once a second)
+#define ULPFEC_START_FRACTION_LOST			0.02
+#define ULPFEC_STOP_FRACTION_LOST			0.005
+#define ULPFEC_LOSS_SMOOTHING_FACTOR		0.3
+
+// The packets from the stream are shared by all sessions, so each session writes its own header into
+// this buffer, and SRTP encrypts it in place. Since the sending path is synchronous
+// (the socket keeps a copy-on-write reference only if it has to queue the data,
+// and ov::SocketSendBatch copies the datagram into its own buffer),
+// one buffer per StreamWorker thread is enough.
+static const std::shared_ptr<ov::Data> &GetSendBuffer()
+{
+	thread_local auto send_buffer = std::make_shared<ov::Data>(RTC_SESSION_SEND_BUFFER_CAPACITY);
+
+	return send_buffer;
+}
+
+static int64_t GetNowUs()
+{
+	return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
 std::shared_ptr<RtcSession> RtcSession::Create(const std::shared_ptr<WebRtcPublisher> &publisher,
 											   const std::shared_ptr<pub::Application> &application,
                                                const std::shared_ptr<pub::Stream> &stream,
@@ -134,6 +192,9 @@ bool RtcSession::Start()
 				if(payload->GetCodec() == PayloadAttr::SupportCodec::RED)
 				{	
 					_red_enabled = true;
+
+					// FEC packets are sent in RED
+					_ulpfec_enabled = peer_media_desc->GetPayload(static_cast<uint8_t>(FixedRtcPayloadType::ULPFEC_PAYLOAD_TYPE)) != nullptr;
 				}
 			}
 
@@ -162,7 +223,16 @@ bool RtcSession::Start()
 	_auto_abr = _playlist->IsWebRtcAutoAbr();
 
 	_current_rendition = _playlist->GetFirstRendition();
-	RecordAutoSelectedRendition(_current_rendition, true);
+
+	auto initial_bitrate = static_cast<int64_t>(_current_rendition->GetBitrates());
+	_bandwidth_estimator = std::make_shared<SendSideBandwidthEstimator>(initial_bitrate > 0 ? initial_bitrate : BWE_DEFAULT_INITIAL_BITRATE, BWE_MIN_BITRATE, BWE_MAX_BITRATE);
+	_stable_since_time = std::chrono::steady_clock::now();
+
+	auto &pacing_config = std::static_pointer_cast<RtcStream>(GetStream())->GetPacingConfig();
+	if (pacing_config.IsEnabled())
+	{
+		_pacer = std::make_shared<RtpPacer>(_bandwidth_estimator->GetEstimatedBitrate(), pacing_config.GetFactor(), pacing_config.GetBurstMs(), pacing_config.GetMaxQueueDelayMs());
+	}
 
 	auto current_video_track = _current_rendition->GetVideoTrack();
 	auto current_audio_track = _current_rendition->GetAudioTrack();
@@ -225,6 +295,11 @@ bool RtcSession::Stop()
 		_srtp_transport->Stop();
 	}
 
+	if(_ulpfec_requested == true)
+	{
+		std::static_pointer_cast<RtcStream>(GetStream())->OnUlpfecLossReported(GetId(), 0.0);
+	}
+
 	// TODO(Getroot): Doesn't need this?
 	//_ws_session->Close();
 
@@ -262,7 +337,7 @@ bool RtcSession::RequestChangeRendition(const ov::String &rendition_name)
 		return false;
 	}
 
-	std::lock_guard<std::shared_mutex> lock(_change_rendition_lock);
+	std::unique_lock<std::shared_mutex> lock(_change_rendition_lock);
 
 	if (rendition == _current_rendition)
 	{
@@ -271,6 +346,11 @@ bool RtcSession::RequestChangeRendition(const ov::String &rendition_name)
 	}
 
 	_next_rendition = rendition;
+	auto current_rendition = _current_rendition;
+
+	lock.unlock();
+
+	RecordRenditionSwitch(current_rendition, rendition, _bandwidth_estimator->GetEstimatedBitrate(), "Requested");
 
 	return true;
 }
@@ -298,8 +378,8 @@ bool RtcSession::RequestChangeRendition(SwitchOver switch_over)
 
 	if (next_rendition != nullptr)
 	{
-		logtd("Change rendition - EstimatedBandwidth(%f) CurrentRendition(%s - %lld) NextRendition(%s - %lld)", 
-		_estimated_bitrates, _current_rendition->GetName().CStr(), _current_rendition->GetBitrates(), next_rendition->GetName().CStr(), next_rendition->GetBitrates());
+		logtd("Change rendition - EstimatedBandwidth(%lld) CurrentRendition(%s - %lld) NextRendition(%s - %lld)", 
+		_bandwidth_estimator->GetEstimatedBitrate(), _current_rendition->GetName().CStr(), _current_rendition->GetBitrates(), next_rendition->GetName().CStr(), next_rendition->GetBitrates());
 
 		_next_rendition = next_rendition;
 	}
@@ -526,69 +606,293 @@ void RtcSession::SendOutgoingData(const std::any &packet)
 		return;
 	}
 
-	// RTP Session must be copied and sent because data is altered due to SRTP.
-	auto copy_packet = std::make_shared<RtpPacket>(*session_packet);
+	if (session_packet->IsVideoPacket())
+	{
+		if (session_packet->IsUlpfec())
+		{
+			// The FEC packets of a frame follow its media packets, so the sequence number base can be
+			// converted by the distance from the FEC packet, unless some of them are dropped
+			if ((_ulpfec_enabled == false) || (_ulpfec_forwarding == false))
+			{
+				return;
+			}
+		}
+		else
+		{
+			_ulpfec_forwarding = _ulpfec_requested;
+		}
+	}
+
+	auto sequence_number = session_packet->IsVideoPacket() ? _video_rtp_sequence_number++ : _audio_rtp_sequence_number++;
+
+	if (_pacer != nullptr)
+	{
+		// Sent by SendPacedData() after the packets of the batch are processed
+		_pacer->Enqueue(session_packet, sequence_number, GetNowUs());
+		_has_paced_data = true;
+		return;
+	}
+
+	SendMediaPacket(session_packet, sequence_number);
+}
 
-	if (copy_packet->IsVideoPacket())
+int64_t RtcSession::SendPacedData()
+{
+	std::shared_lock<std::shared_mutex> lock(_start_stop_lock);
+
+	if ((_pacer == nullptr) || (pub::Session::GetState() != SessionState::Started))
 	{
-		copy_packet->SetSequenceNumber(_video_rtp_sequence_number++);
+		_has_paced_data = false;
+		return -1;
 	}
-	else
+
+	auto now_us = GetNowUs();
+
+	RtpPacer::Packet packet;
+	while (_pacer->Dequeue(now_us, packet))
 	{
-		copy_packet->SetSequenceNumber(_audio_rtp_sequence_number++);
+		SendMediaPacket(packet.rtp_packet, packet.sequence_number);
+	}
+
+	auto padding_bytes = _pacer->GetPaddingBytes(now_us);
+	if (padding_bytes > 0)
+	{
+		SendPadding(padding_bytes);
+	}
+
+	auto delay = _pacer->GetNextProcessDelayMs(GetNowUs());
+	if (delay < 0)
+	{
+		_has_paced_data = false;
+	}
+
+	return delay;
+}
+
+bool RtcSession::HasPacedData() const
+{
+	return _has_paced_data;
+}
+
+void RtcSession::SendMediaPacket(const std::shared_ptr<RtpPacket> &session_packet, uint16_t sequence_number)
+{
+	// session_packet is shared by all sessions and must not be modified.
+	// The session-specific header is written into the send buffer, which is altered by SRTP.
+	auto &send_buffer = GetSendBuffer();
+
+	if (session_packet->CopyTo(send_buffer, sequence_number) == false)
+	{
+		logte("Could not build RTP packet for session(%u)", GetId());
+		return;
+	}
+
+	if (session_packet->IsUlpfec())
+	{
+		SetUlpfecSequenceNumberBase(session_packet, send_buffer, sequence_number);
+		_ulpfec_sent_packets++;
 	}
 
 	// Set transport-wide sequence number
-	SetTransportWideSequenceNumber(copy_packet, _wide_sequence_number);
-	SetAbsSendTime(copy_packet, ov::Clock::NowMSec());
+	auto has_wide_sequence_number = SetTransportWideSequenceNumber(session_packet, send_buffer, _wide_sequence_number);
+	SetAbsSendTime(session_packet, send_buffer, ov::Clock::NowMSec());
 
 	// rtp_rtcp -> srtp -> dtls -> Edge Node(RtcSession)
 
 	// Packet loss simulation codes
 	// if (ov::Random::GenerateUInt32(1, 33) != 10)
 	{
-		_rtp_rtcp->SendRtpPacket(copy_packet);
+		_rtp_rtcp->SendRtpPacket(session_packet, send_buffer);
 	}
 
-	RecordRtpSent(copy_packet, session_packet->SequenceNumber(), _wide_sequence_number);
+	// The length includes the SRTP auth tag
+	auto sent_bytes = send_buffer->GetLength();
+
+	RecordRtpSent(session_packet, sequence_number, _wide_sequence_number, sent_bytes);
+
+	auto now_us = GetNowUs();
+
+	if (has_wide_sequence_number)
+	{
+		_bandwidth_estimator->OnPacketSent(_wide_sequence_number, sent_bytes, now_us);
+	}
+
+	if (_pacer != nullptr)
+	{
+		_pacer->OnPacketSent(sent_bytes, now_us);
+	}
 
 	_wide_sequence_number ++;
 
-	MonitorInstance->IncreaseBytesOut(*GetStream(), PublisherType::Webrtc, copy_packet->GetData()->GetLength());
+	MonitorInstance->IncreaseBytesOut(*GetStream(), PublisherType::Webrtc, sent_bytes);
+}
+
+size_t RtcSession::SendPadding(size_t bytes)
+{
+	if (_rtx_enabled == false)
+	{
+		return 0;
+	}
+
+	auto stream = std::static_pointer_cast<RtcStream>(GetStream());
+	if (stream == nullptr)
+	{
+		return 0;
+	}
+
+	// The player discards them as the duplicates, but they are counted by transport-cc
+	size_t sent_bytes = 0;
+	uint16_t sequence_number = _video_rtp_sequence_number;
+
+	for (int count = 0; (count < PACING_MAX_PADDING_PACKETS) && (sent_bytes < bytes); count++)
+	{
+		sequence_number--;
+
+		auto sent_log = TraceRtpSentByVideoSeqNo(sequence_number);
+		if ((sent_log == nullptr) || (sent_log->_sequence_number != sequence_number))
+		{
+			break;
+		}
+
+		if (sent_log->_ulpfec == true)
+		{
+			continue;
+		}
+
+		auto rtx_packet = stream->GetRtxRtpPacket(sent_log->_track_id, sent_log->_payload_type, sent_log->_origin_sequence_number);
+		if (rtx_packet == nullptr)
+		{
+			break;
+		}
+
+		// Built for this request, so it can be modified
+		rtx_packet->SetSequenceNumber(_rtx_sequence_number++);
+		rtx_packet->SetOriginalSequenceNumber(sent_log->_sequence_number);
+
+		// The padding is useless without the transport-wide sequence number
+		if (SetTransportWideSequenceNumber(rtx_packet, rtx_packet->GetData(), _wide_sequence_number) == false)
+		{
+			break;
+		}
+
+		SetAbsSendTime(rtx_packet, rtx_packet->GetData(), ov::Clock::NowMSec());
+
+		if (_rtp_rtcp->SendRtpPacket(rtx_packet) == false)
+		{
+			break;
+		}
+
+		auto packet_bytes = rtx_packet->GetData()->GetLength();
+		auto now_us = GetNowUs();
+
+		_bandwidth_estimator->OnPacketSent(_wide_sequence_number, packet_bytes, now_us);
+		_pacer->OnPaddingSent(packet_bytes, now_us);
+
+		_wide_sequence_number ++;
+		sent_bytes += packet_bytes;
+
+		MonitorInstance->IncreaseBytesOut(*GetStream(), PublisherType::Webrtc, packet_bytes);
+	}
+
+	return sent_bytes;
+}
+
+void RtcSession::UpdatePacingBitrate()
+{
+	if (_pacer != nullptr)
+	{
+		_pacer->SetEstimatedBitrate(_bandwidth_estimator->GetEstimatedBitrate());
+	}
 }
 
-bool RtcSession::SetTransportWideSequenceNumber(const std::shared_ptr<RtpPacket> &rtp_packet, uint16_t wide_sequence_number)
+bool RtcSession::SetTransportWideSequenceNumber(const std::shared_ptr<const RtpPacket> &rtp_packet, const std::shared_ptr<ov::Data> &wire_data, uint16_t wide_sequence_number)
 {
-	auto extension_buffer = rtp_packet->Extension(RTP_HEADER_EXTENSION_TRANSPORT_CC_ID);
-	if (extension_buffer == nullptr)
+	auto extension_offset = rtp_packet->ExtensionOffset(RTP_HEADER_EXTENSION_TRANSPORT_CC_ID);
+	if (extension_offset < 0)
 	{
 		return false;
 	}
 
 	auto payload_offset = rtp_packet->GetExtensionType() == RtpHeaderExtension::HeaderType::ONE_BYTE_HEADER ? 1 : 2;
-	
-	ByteWriter<uint16_t>::WriteBigEndian(extension_buffer + payload_offset, wide_sequence_number);
+	if (static_cast<size_t>(extension_offset + payload_offset + 2) > wire_data->GetLength())
+	{
+		return false;
+	}
+
+	ByteWriter<uint16_t>::WriteBigEndian(wire_data->GetWritableDataAs<uint8_t>() + extension_offset + payload_offset, wide_sequence_number);
 
 	return true;
 }
 
-bool RtcSession::SetAbsSendTime(const std::shared_ptr<RtpPacket> &rtp_packet, uint64_t time_ms)
+bool RtcSession::SetUlpfecSequenceNumberBase(const std::shared_ptr<const RtpPacket> &rtp_packet, const std::shared_ptr<ov::Data> &wire_data, uint16_t sequence_number)
 {
-	auto extension_buffer = rtp_packet->Extension(RTP_HEADER_EXTENSION_ABS_SEND_TIME_ID);
-	if (extension_buffer == nullptr)
+	// The payload of the FEC packet starts with the RED header, and the SN base is at 2 of the FEC header
+	auto sn_base_offset = static_cast<size_t>(rtp_packet->Payload() - rtp_packet->Buffer()) + RED_HEADER_SIZE + 2;
+	if (sn_base_offset + 2 > wire_data->GetLength())
+	{
+		return false;
+	}
+
+	auto buffer = wire_data->GetWritableDataAs<uint8_t>();
+
+	// The protected media packets and the FEC packet have the same distance in the session
+	uint16_t distance = rtp_packet->SequenceNumber() - ByteReader<uint16_t>::ReadBigEndian(buffer + sn_base_offset);
+	ByteWriter<uint16_t>::WriteBigEndian(buffer + sn_base_offset, sequence_number - distance);
+
+	return true;
+}
+
+void RtcSession::UpdateUlpfecProtection(uint8_t fraction_lost)
+{
+	if (_ulpfec_enabled == false)
+	{
+		return;
+	}
+
+	auto stream = std::static_pointer_cast<RtcStream>(GetStream());
+	if (stream == nullptr)
+	{
+		return;
+	}
+
+	auto smoothed_fraction_lost = (_video_fraction_lost * (1.0 - ULPFEC_LOSS_SMOOTHING_FACTOR)) + ((fraction_lost / 256.0) * ULPFEC_LOSS_SMOOTHING_FACTOR);
+	_video_fraction_lost = smoothed_fraction_lost;
+
+	if ((_ulpfec_requested == false) && (smoothed_fraction_lost >= ULPFEC_START_FRACTION_LOST))
+	{
+		logtd("ULPFEC is requested by session(%u) - fraction lost: %.3f", GetId(), smoothed_fraction_lost);
+		_ulpfec_requested = true;
+	}
+	else if ((_ulpfec_requested == true) && (smoothed_fraction_lost < ULPFEC_STOP_FRACTION_LOST))
+	{
+		logtd("ULPFEC is no longer requested by session(%u) - fraction lost: %.3f", GetId(), smoothed_fraction_lost);
+		_ulpfec_requested = false;
+	}
+
+	// The stream generates the FEC packets for the worst loss of the sessions that requested
+	stream->OnUlpfecLossReported(GetId(), _ulpfec_requested ? smoothed_fraction_lost : 0.0);
+}
+
+bool RtcSession::SetAbsSendTime(const std::shared_ptr<const RtpPacket> &rtp_packet, const std::shared_ptr<ov::Data> &wire_data, uint64_t time_ms)
+{
+	auto extension_offset = rtp_packet->ExtensionOffset(RTP_HEADER_EXTENSION_ABS_SEND_TIME_ID);
+	if (extension_offset < 0)
 	{
 		return false;
 	}
 
 	auto payload_offset = rtp_packet->GetExtensionType() == RtpHeaderExtension::HeaderType::ONE_BYTE_HEADER ? 1 : 2;
+	if (static_cast<size_t>(extension_offset + payload_offset + 3) > wire_data->GetLength())
+	{
+		return false;
+	}
 
 	auto abs_send_time = RtpHeaderExtensionAbsSendTime::MsToAbsSendTime(time_ms);
-	ByteWriter<uint24_t>::WriteBigEndian(extension_buffer + payload_offset, abs_send_time);
+	ByteWriter<uint24_t>::WriteBigEndian(wire_data->GetWritableDataAs<uint8_t>() + extension_offset + payload_offset, abs_send_time);
 
 	return true;
 }
 
-bool RtcSession::RecordRtpSent(const std::shared_ptr<const RtpPacket> &rtp_packet, uint16_t origin_sequence_number, uint16_t wide_sequence_number)
+bool RtcSession::RecordRtpSent(const std::shared_ptr<const RtpPacket> &rtp_packet, uint16_t sequence_number, uint16_t wide_sequence_number, size_t sent_bytes)
 {
 	if (rtp_packet == nullptr)
 	{
@@ -596,20 +900,22 @@ bool RtcSession::RecordRtpSent(const std::shared_ptr<const RtpPacket> &rtp_packe
 	}
 
 	auto sent_log = std::make_shared<RtpSentLog>();
-	sent_log->_sequence_number = rtp_packet->SequenceNumber();
+	sent_log->_sequence_number = sequence_number;
 	sent_log->_wide_sequence_number = wide_sequence_number;
 	sent_log->_track_id = rtp_packet->GetTrackId();
 	sent_log->_payload_type = rtp_packet->PayloadType();
-	sent_log->_origin_sequence_number = origin_sequence_number;
+	// rtp_packet is the packet of the stream, so its sequence number is the origin
+	sent_log->_origin_sequence_number = rtp_packet->SequenceNumber();
 	sent_log->_timestamp = rtp_packet->Timestamp();
 	sent_log->_marker = rtp_packet->Marker();
 	sent_log->_ssrc = rtp_packet->Ssrc();
 
-	sent_log->_sent_bytes = rtp_packet->GetData()->GetLength();
+	sent_log->_sent_bytes = sent_bytes;
 	sent_log->_sent_time = std::chrono::system_clock::now();
 
+	sent_log->_ulpfec = rtp_packet->IsUlpfec();
+
 	auto video_rtp_key = sent_log->_sequence_number % MAX_RTP_RECORDS;
-	auto wide_rtp_key = sent_log->_wide_sequence_number % MAX_RTP_RECORDS;
 
 	std::lock_guard<std::shared_mutex> lock(_rtp_record_map_lock);
 
@@ -617,7 +923,6 @@ bool RtcSession::RecordRtpSent(const std::shared_ptr<const RtpPacket> &rtp_packe
 	{
 		_video_rtp_sent_record_map[video_rtp_key] = sent_log;
 	}
-	_wide_rtp_sent_record_map[wide_rtp_key] = sent_log;
 
 	return true;
 }
@@ -636,21 +941,6 @@ std::shared_ptr<RtcSession::RtpSentLog> RtcSession::TraceRtpSentByVideoSeqNo(uin
 	return it->second;
 }
 
-// Get RTP Sent Log from RTP History
-std::shared_ptr<RtcSession::RtpSentLog> RtcSession::TraceRtpSentByWideSeqNo(uint16_t wide_sequence_number)
-{
-	std::shared_lock<std::shared_mutex> lock(_rtp_record_map_lock);
-
-	auto key = wide_sequence_number % MAX_RTP_RECORDS;
-	auto it = _wide_rtp_sent_record_map.find(key);
-	if (it == _wide_rtp_sent_record_map.end())
-	{
-		return nullptr;
-	}
-
-	return it->second;
-}
-
 void RtcSession::OnRtpFrameReceived(const std::vector<std::shared_ptr<RtpPacket>> &rtp_packets)
 {
 	// No player sends RTP packet
@@ -704,6 +994,37 @@ bool RtcSession::ProcessReceiverReport(const std::shared_ptr<RtcpInfo> &rtcp_inf
 
 	//rr->DebugPrint();
 
+	// The worst loss of the streams of this session
+	std::optional<uint8_t> fraction_lost;
+	std::optional<uint8_t> video_fraction_lost;
+
+	for (size_t index = 0; index < rr->GetReportBlockCount(); index++)
+	{
+		auto report_block = rr->GetReportBlock(index);
+		if ((report_block == nullptr) || ((report_block->GetSrcSsrc() != _video_ssrc) && (report_block->GetSrcSsrc() != _audio_ssrc)))
+		{
+			continue;
+		}
+
+		fraction_lost = std::max(fraction_lost.value_or(0), report_block->GetFractionLost());
+
+		if (report_block->GetSrcSsrc() == _video_ssrc)
+		{
+			video_fraction_lost = report_block->GetFractionLost();
+		}
+	}
+
+	if (video_fraction_lost.has_value())
+	{
+		UpdateUlpfecProtection(video_fraction_lost.value());
+	}
+
+	if (fraction_lost.has_value())
+	{
+		_bandwidth_estimator->OnReceiverReport(fraction_lost.value(), GetNowUs());
+		UpdatePacingBitrate();
+	}
+
 	return true;
 }
 
@@ -731,7 +1052,8 @@ bool RtcSession::ProcessNACK(const std::shared_ptr<RtcpInfo> &rtcp_info)
 	{
 		auto seq_no = nack->GetLostId(i);
 		auto sent_log = TraceRtpSentByVideoSeqNo(seq_no);
-		if (sent_log == nullptr)
+		// The retransmitted FEC packet would have the sequence number base of the stream
+		if ((sent_log == nullptr) || (sent_log->_ulpfec == true))
 		{
 			continue;
 		}
@@ -741,10 +1063,19 @@ bool RtcSession::ProcessNACK(const std::shared_ptr<RtcpInfo> &rtcp_info)
 		auto rtx_packet = stream->GetRtxRtpPacket(sent_log->_track_id, sent_log->_payload_type, sent_log->_origin_sequence_number);
 		if(rtx_packet != nullptr)
 		{
-			auto copy_rtx_packet = std::make_shared<RtxRtpPacket>(*rtx_packet);
-			copy_rtx_packet->SetSequenceNumber(_rtx_sequence_number++);
-			copy_rtx_packet->SetOriginalSequenceNumber(sent_log->_sequence_number);
-			return _rtp_rtcp->SendRtpPacket(copy_rtx_packet);
+			// Built for this request, so it can be modified
+			rtx_packet->SetSequenceNumber(_rtx_sequence_number++);
+			rtx_packet->SetOriginalSequenceNumber(sent_log->_sequence_number);
+
+			auto result = _rtp_rtcp->SendRtpPacket(rtx_packet);
+
+			// Retransmissions are not paced, but they take the budget of the pacer
+			if (_pacer != nullptr)
+			{
+				_pacer->OnPacketSent(rtx_packet->GetData()->GetLength(), GetNowUs());
+			}
+
+			return result;
 		}
 	}
 
@@ -761,76 +1092,13 @@ bool RtcSession::ProcessTransportCc(const std::shared_ptr<RtcpInfo> &rtcp_info)
 		return false;
 	}
 
-	uint64_t sent_bytes = 0;
-	int64_t sent_duration = 0;
-
-	// For debug
-	// logtd("TransportCC - SenderSsrc(%u) MediaSsrc(%u) PacketStatusCount(%u)", transport_cc->GetSenderSsrc(), transport_cc->GetMediaSsrc(), transport_cc->GetPacketStatusCount());
-
-	// for (size_t i = 0; i < transport_cc->GetPacketStatusCount(); i++)
-	// {
-	// 	auto packet_status = transport_cc->GetPacketFeedbackInfo(i);
-	// 	auto sent_log = TraceRtpSentByWideSeqNo(packet_status->_wide_sequence_number);
-	// 	if (sent_log == nullptr)
-	// 	{
-	// 		logte("TransportCC - No sent log found for seqno(%u)", packet_status->_wide_sequence_number);
-	// 		continue;
-	// 	}
-
-	// 	logtd("%s", sent_log->ToString().CStr());
-	// }
-
-	// return true;
-
-	for (size_t i = 1; i < transport_cc->GetPacketStatusCount(); i++)
-	{
-		auto packet_status = transport_cc->GetPacketFeedbackInfo(i);
-		auto sent_log = TraceRtpSentByWideSeqNo(packet_status->_wide_sequence_number);
-		if (sent_log == nullptr)
-		{
-			logte("TransportCC - No sent log found for seqno(%u)", packet_status->_wide_sequence_number);
-			continue;
-		}
-		auto prev_sent_log = TraceRtpSentByWideSeqNo(packet_status->_wide_sequence_number - 1);
-		if (prev_sent_log == nullptr)
-		{
-			logtd("TransportCC - No prev sent log found for seqno(%u)", packet_status->_wide_sequence_number - 1);
-			continue;
-		}
-
-		// Calc delta of sent_log and prev_sent_log
-		int32_t sent_delta_time = (std::chrono::duration_cast<std::chrono::microseconds>(sent_log->_sent_time - prev_sent_log->_sent_time).count()) / 250; 
+	_bandwidth_estimator->OnTransportCc(transport_cc, GetNowUs());
+	UpdatePacingBitrate();
 
-		auto duration = packet_status->_received_delta - sent_delta_time;
-		if (duration <= 0)
-		{
-			//duration = 1;
-		}
-
-		sent_bytes += sent_log->_sent_bytes;
-		sent_duration += duration;
-
-		logtd("WideSeqNo(%u) Refer(%u) RecvDelta(%u) SentDelta(%u) SentBytes(%u) Duration(%d)", packet_status->_wide_sequence_number, transport_cc->GetReferenceTime(), packet_status->_received_delta, sent_delta_time, sent_log->_sent_bytes, duration);
-	}
-
-	if (sent_bytes > 0)
+	if (_bitrate_estimate_watch.IsElapsed(1000) == true)
 	{
-		double sent_seconds = static_cast<double>(sent_duration) / 4000.0;
-
-		_total_sent_seconds += sent_seconds;
-		_total_sent_bytes += sent_bytes;
-		_estimated_bitrates = static_cast<double>((_total_sent_bytes * 8)) / _total_sent_seconds;
-
-		if (_bitrate_estimate_watch.IsElapsed(1000) == true)
-		{
-			_bitrate_estimate_watch.Update();
-			ChangeRenditionIfNeeded();
-
-			logtd("Estimated Bandwidth(%f) TotalSentBytes(%u) TotalSentSeconds(%f)", static_cast<double>(_total_sent_bytes * 8) / _total_sent_seconds, _total_sent_bytes, _total_sent_seconds);
-
-			_total_sent_seconds = 0;
-			_total_sent_bytes = 0;
-		}
+		_bitrate_estimate_watch.Update();
+		ChangeRenditionIfNeeded();
 	}
 
 	return true;
@@ -842,8 +1110,8 @@ bool RtcSession::ProcessRemb(const std::shared_ptr<RtcpInfo> &rtcp_info)
 
 	logtd("REMB Estimated Bandwidth(%lld)", remb->GetBitrateBps());
 
-	_previous_estimated_bitrate = _estimated_bitrates;
-	_estimated_bitrates = remb->GetBitrateBps();
+	_bandwidth_estimator->OnRemb(remb->GetBitrateBps(), GetNowUs());
+	UpdatePacingBitrate();
 
 	if (_bitrate_estimate_watch.IsElapsed(1000) == true)
 	{
@@ -861,124 +1129,344 @@ void RtcSession::ChangeRenditionIfNeeded()
 		return;
 	}
 
-	auto current_rendition_bitrates = _current_rendition->GetBitrates();
+	std::shared_lock<std::shared_mutex> change_lock(_change_rendition_lock);
+	auto current_rendition = _current_rendition;
+	auto changing = (_next_rendition != nullptr);
+	change_lock.unlock();
 
-	// If the estimated bitrates are not high enough (10%) then the playback may not be smooth, so go for the lower bitrates.
-	if (1.1 * _estimated_bitrates <= current_rendition_bitrates)
+	if (changing)
 	{
-		auto lower = _playlist->GetNextLowerBitrateRendition(_current_rendition);
-		if (lower != nullptr && IsNextRenditionGoodChoice(lower) == true)
+		// Waiting for the key frame of the next rendition
+		return;
+	}
+
+	auto stats = _bandwidth_estimator->GetStats();
+	auto estimated_bitrate = stats.estimated_bitrate;
+	auto overusing = (stats.delay_state == SendSideBandwidthEstimator::DelayState::Overusing);
+	auto now = std::chrono::steady_clock::now();
+
+	if ((stats.overuse_count != _last_overuse_count) || (stats.fraction_lost > ABR_PROBE_MAX_FRACTION_LOST))
+	{
+		_last_overuse_count = stats.overuse_count;
+		_stable_since_time = now;
+	}
+
+	auto current_bitrates = static_cast<int64_t>(current_rendition->GetBitrates());
+	if (current_bitrates == 0)
+	{
+		// The bitrate of the rendition is unknown
+		return;
+	}
+
+	if (_padding_probe_rendition != nullptr)
+	{
+		if (overusing || (stats.fraction_lost > ABR_PROBE_MAX_FRACTION_LOST))
+		{
+			// The link can't carry the padding, so it is stopped before it hurts the media
+			logtd("ChangeRenditionIfNeeded - The padding probe for %s caused the overuse or the loss", _padding_probe_rendition->GetName().CStr());
+
+			_pacer->StopProbe();
+			RecordProbeFailure(_padding_probe_rendition);
+			_padding_probe_rendition = nullptr;
+		}
+		else if (_pacer->IsProbing(GetNowUs()) == false)
 		{
-			logtd("ChangeRenditionIfNeeded - Change to low bitrate");
-			if (RequestChangeRendition(SwitchOver::LOWER) == true)
+			if (estimated_bitrate < static_cast<int64_t>(_padding_probe_rendition->GetBitrates() * ABR_HIGHER_MARGIN))
 			{
-				RecordAutoSelectedRendition(lower, false);
+				// The estimate didn't grow with the padding (the link is already at the capacity)
+				logtd("ChangeRenditionIfNeeded - The padding probe for %s didn't raise the estimate (%lld)", _padding_probe_rendition->GetName().CStr(), estimated_bitrate);
+
+				RecordProbeFailure(_padding_probe_rendition);
 			}
+
+			_padding_probe_rendition = nullptr;
 		}
 	}
-	else if (0.75 * _estimated_bitrates > current_rendition_bitrates)
+
+	if (_probe_rendition != nullptr)
 	{
-		// Next higher rendition
-		auto upper = _playlist->GetNextHigherBitrateRendition(_current_rendition);
-		if (upper != nullptr && IsNextRenditionGoodChoice(upper) == true)
+		if (_probe_rendition == current_rendition)
 		{
-			logtd("ChangeRenditionIfNeeded - Change to high bitrate");
-			if (RequestChangeRendition(SwitchOver::HIGHER) == true)
+			if (_probe_start_time.has_value() == false)
+			{
+				_probe_start_time = now;
+			}
+
+			if (overusing || (estimated_bitrate < current_bitrates * ABR_LOWER_MARGIN))
 			{
-				RecordAutoSelectedRendition(upper, true);
+				RecordProbeFailure(current_rendition);
+
+				auto previous_rendition = _probe_previous_rendition;
+
+				{
+					std::lock_guard<std::mutex> lock(_rendition_switch_history_lock);
+					_probe_rendition = nullptr;
+					_probe_previous_rendition = nullptr;
+					_probe_start_time.reset();
+				}
+
+				SwitchRendition(current_rendition, previous_rendition, estimated_bitrate, "ProbeFailed");
+				return;
 			}
+
+			if (std::chrono::duration_cast<std::chrono::milliseconds>(now - _probe_start_time.value()).count() < ABR_PROBE_DURATION_MS)
+			{
+				return;
+			}
+
+			logtd("ChangeRenditionIfNeeded - The rendition (%s) is stable", current_rendition->GetName().CStr());
+			_probe_backoffs.erase(current_rendition->GetName());
 		}
+
+		// The probe is completed, or the rendition is changed by the player
+		std::lock_guard<std::mutex> lock(_rendition_switch_history_lock);
+		_probe_rendition = nullptr;
+		_probe_previous_rendition = nullptr;
+		_probe_start_time.reset();
 	}
-}
 
-bool RtcSession::RecordAutoSelectedRendition(const std::shared_ptr<const RtcRendition> &rendition, bool higher_quality)
-{
-	if (rendition == nullptr)
+	// Go lower
+	auto lower_rendition = _playlist->GetNextLowerBitrateRendition(current_rendition);
+	if ((lower_rendition != nullptr) && (estimated_bitrate < current_bitrates * ABR_LOWER_MARGIN))
 	{
-		return false;
+		_higher_condition_count = 0;
+		_lower_condition_count++;
+
+		if (overusing || (_lower_condition_count >= ABR_LOWER_EVALUATIONS))
+		{
+			SwitchRendition(current_rendition, lower_rendition, estimated_bitrate, overusing ? "Overuse" : "LowBandwidth");
+		}
+
+		return;
 	}
 
-	std::shared_ptr<SelectedRecord> record;
-	auto it = _auto_rendition_selected_records.find(rendition->GetName());
-	if (it == _auto_rendition_selected_records.end())
+	_lower_condition_count = 0;
+
+	// Go higher
+	auto higher_rendition = _playlist->GetNextHigherBitrateRendition(current_rendition);
+	if ((higher_rendition == nullptr) || (higher_rendition->GetBitrates() == 0) || overusing || (IsProbeAllowed(higher_rendition) == false))
 	{
-		record = std::make_shared<SelectedRecord>();
-		record->_rendition_name = rendition->GetName();
-		_auto_rendition_selected_records[rendition->GetName()] = record;
+		_higher_condition_count = 0;
+		return;
 	}
-	else
+
+	if (estimated_bitrate >= static_cast<int64_t>(higher_rendition->GetBitrates()) * ABR_HIGHER_MARGIN)
 	{
-		record = it->second;
+		_higher_condition_count++;
+
+		if (_higher_condition_count >= ABR_HIGHER_EVALUATIONS)
+		{
+			SwitchRendition(current_rendition, higher_rendition, estimated_bitrate, "HighBandwidth");
+		}
+
+		return;
 	}
 
-	record->_selected_count ++;
-	record->_last_selected_time = std::chrono::system_clock::now();
+	_higher_condition_count = 0;
 
-	if (higher_quality == true)
+	// The estimate can't be much higher than the sending bitrate, so the higher rendition is probed if it has been stable
+	auto stable_duration = std::chrono::duration_cast<std::chrono::milliseconds>(now - _stable_since_time).count();
+	if (stable_duration < ABR_PROBE_STABLE_DURATION_MS)
 	{
-		_switched_rendition_to_higher = true;
-		_switched_rendition_to_higher_time = std::chrono::system_clock::now();
+		return;
 	}
-	else
+
+	// The padding needs RTX and transport-cc. If the estimate grows with the padding, it is switched by HighBandwidth.
+	if ((_pacer != nullptr) && _rtx_enabled && (stats.feedback_count > 0))
 	{
-		_switched_rendition_to_higher = false;
+		auto now_us = GetNowUs();
+
+		if (_pacer->IsProbing(now_us) == false)
+		{
+			_pacer->StartProbe(static_cast<int64_t>(higher_rendition->GetBitrates() * ABR_HIGHER_MARGIN), ABR_PADDING_PROBE_DURATION_MS, now_us);
+			_padding_probe_rendition = higher_rendition;
+			_has_paced_data = true;
+
+			// Waits for another stable duration before the next probe
+			_stable_since_time = now;
+		}
+
+		return;
 	}
 
-	return true;
+	if (estimated_bitrate >= current_bitrates * ABR_PROBE_HEADROOM)
+	{
+		SwitchRendition(current_rendition, higher_rendition, estimated_bitrate, "Probe");
+	}
 }
 
-bool RtcSession::IsNextRenditionGoodChoice(const std::shared_ptr<const RtcRendition> &rendition)
+void RtcSession::RecordProbeFailure(const std::shared_ptr<const RtcRendition> &rendition)
 {
-	auto current_bitrates = _current_rendition->GetBitrates();
-	auto next_bitrates = rendition->GetBitrates();
+	auto &backoff = _probe_backoffs[rendition->GetName()];
 
-	// Go lower
-	if (current_bitrates > next_bitrates)
+	backoff._failure_count++;
+	backoff._last_failed_time = std::chrono::steady_clock::now();
+}
+
+bool RtcSession::IsProbeAllowed(const std::shared_ptr<const RtcRendition> &rendition) const
+{
+	auto it = _probe_backoffs.find(rendition->GetName());
+	if (it == _probe_backoffs.end())
 	{
-		if (_previous_estimated_bitrate < _estimated_bitrates)
+		return true;
+	}
+
+	auto &backoff = it->second;
+
+	// 10 -> 20 -> 40 -> 80 -> 160 seconds after the last failure
+	auto backoff_duration = std::min<int64_t>(static_cast<int64_t>(ABR_PROBE_BACKOFF_MS) << std::min<uint32_t>(backoff._failure_count - 1, 4), ABR_MAX_PROBE_BACKOFF_MS);
+	auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - backoff._last_failed_time).count();
+
+	return elapsed >= backoff_duration;
+}
+
+bool RtcSession::SwitchRendition(const std::shared_ptr<const RtcRendition> &from, const std::shared_ptr<const RtcRendition> &to, int64_t estimated_bitrate, const char *reason)
+{
+	if ((from == nullptr) || (to == nullptr))
+	{
+		return false;
+	}
+
+	{
+		std::lock_guard<std::shared_mutex> lock(_change_rendition_lock);
+
+		// Changing
+		if (_next_rendition != nullptr)
 		{
-			// The bandwidth is getting higher, so let's wait
 			return false;
 		}
 
-		if (_switched_rendition_to_higher == true)
-		{
-			auto elapsed_time = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now() - _switched_rendition_to_higher_time).count();
-			
-			// We have switched to a higher rendition recently, so let's wait
-			if (elapsed_time < 10)
-			{
-				return false;
-			}
-		}
+		_next_rendition = to;
+	}
 
-		// Since the next rendition has lower bitrates, it will run better than it is now.
-		return true;
+	logtd("ChangeRenditionIfNeeded - %s -> %s (Reason: %s, EstimatedBandwidth: %lld)", from->GetName().CStr(), to->GetName().CStr(), reason, estimated_bitrate);
+
+	_lower_condition_count = 0;
+	_higher_condition_count = 0;
+	_stable_since_time = std::chrono::steady_clock::now();
+
+	if (to->GetBitrates() > from->GetBitrates())
+	{
+		// Every switch to a higher rendition is a probe
+		std::lock_guard<std::mutex> lock(_rendition_switch_history_lock);
+		_probe_rendition = to;
+		_probe_previous_rendition = from;
+		_probe_start_time.reset();
 	}
-	// Go higher
-	else 
+
+	RecordRenditionSwitch(from, to, estimated_bitrate, reason);
+
+	return true;
+}
+
+void RtcSession::RecordRenditionSwitch(const std::shared_ptr<const RtcRendition> &from, const std::shared_ptr<const RtcRendition> &to, int64_t estimated_bitrate, const char *reason)
+{
+	RenditionSwitchRecord record;
+
+	record._time = std::chrono::system_clock::now();
+	record._from = (from != nullptr) ? from->GetName() : "";
+	record._to = to->GetName();
+	record._estimated_bitrate = estimated_bitrate;
+	record._reason = reason;
+
+	std::lock_guard<std::mutex> lock(_rendition_switch_history_lock);
+
+	_rendition_switch_history.push_back(record);
+
+	while (_rendition_switch_history.size() > ABR_MAX_SWITCH_HISTORY)
 	{
-		auto it = _auto_rendition_selected_records.find(rendition->GetName());
-		if (it == _auto_rendition_selected_records.end())
-		{
-			// Never experienced it, let's try.
-			return true;
-		}
+		_rendition_switch_history.pop_front();
+	}
+}
 
-		auto record = it->second;
+Json::Value RtcSession::GetBandwidthStats()
+{
+	Json::Value json;
 
-		// get elapsed time from now
-		auto elapsed_time = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now() - record->_last_selected_time).count();
+	json["id"] = GetId();
+	json["autoAbr"] = _auto_abr;
 
-		if (elapsed_time > 10 * ( /*1 <<*/ record->_selected_count))
-		{
-			// 10 -> 20 -> 30 -> 40 seconds after it can be selected again
-			// It has been long enough since the last time we selected this rendition.
-			return true;
-		}
+	std::shared_lock<std::shared_mutex> change_lock(_change_rendition_lock);
+	auto current_rendition = _current_rendition;
+	change_lock.unlock();
+
+	json["rendition"] = (current_rendition != nullptr) ? Json::Value(current_rendition->GetName().CStr()) : Json::Value(Json::nullValue);
+
+	if (_bandwidth_estimator != nullptr)
+	{
+		auto stats = _bandwidth_estimator->GetStats();
+		Json::Value json_estimator;
+
+		json_estimator["estimatedBitrate"] = static_cast<Json::Int64>(stats.estimated_bitrate);
+		json_estimator["delayBasedBitrate"] = static_cast<Json::Int64>(stats.delay_based_bitrate);
+		json_estimator["lossBasedBitrate"] = static_cast<Json::Int64>(stats.loss_based_bitrate);
+		json_estimator["rembBitrate"] = static_cast<Json::Int64>(stats.remb_bitrate);
+		json_estimator["acknowledgedBitrate"] = static_cast<Json::Int64>(stats.acknowledged_bitrate);
+		json_estimator["delayState"] = SendSideBandwidthEstimator::StringFromDelayState(stats.delay_state);
+		json_estimator["rateControlState"] = SendSideBandwidthEstimator::StringFromRateControlState(stats.rate_control_state);
+		json_estimator["trend"] = stats.trend;
+		json_estimator["threshold"] = stats.threshold;
+		json_estimator["fractionLost"] = stats.fraction_lost;
+		json_estimator["feedbackCount"] = static_cast<Json::UInt64>(stats.feedback_count);
+		json_estimator["overuseCount"] = static_cast<Json::UInt64>(stats.overuse_count);
+
+		json["bandwidthEstimation"] = json_estimator;
 	}
 
-	return false;
+	if (_pacer != nullptr)
+	{
+		auto stats = _pacer->GetStats(GetNowUs());
+		Json::Value json_pacer;
+
+		json_pacer["pacingBitrate"] = static_cast<Json::Int64>(stats.pacing_bitrate);
+		json_pacer["targetBitrate"] = static_cast<Json::Int64>(stats.target_bitrate);
+		json_pacer["incomingBitrate"] = static_cast<Json::Int64>(stats.incoming_bitrate);
+		json_pacer["queuedPackets"] = static_cast<Json::UInt64>(stats.queued_packets);
+		json_pacer["queuedBytes"] = static_cast<Json::UInt64>(stats.queued_bytes);
+		json_pacer["queueDelay"] = static_cast<Json::Int64>(stats.oldest_queue_delay_us / 1000);
+		json_pacer["averageQueueDelay"] = static_cast<double>(stats.average_queue_delay_us) / 1000.0;
+		json_pacer["maxQueueDelay"] = static_cast<Json::Int64>(stats.max_queue_delay_us / 1000);
+		json_pacer["sentPackets"] = static_cast<Json::UInt64>(stats.sent_packets);
+		json_pacer["delayedPackets"] = static_cast<Json::UInt64>(stats.delayed_packets);
+		json_pacer["paddingBytes"] = static_cast<Json::UInt64>(stats.padding_bytes);
+		json_pacer["probeBitrate"] = static_cast<Json::Int64>(stats.probe_bitrate);
+
+		json["pacer"] = json_pacer;
+	}
+
+	if (_ulpfec_enabled == true)
+	{
+		Json::Value json_ulpfec;
+
+		json_ulpfec["requested"] = _ulpfec_requested.load();
+		json_ulpfec["fractionLost"] = _video_fraction_lost.load();
+		json_ulpfec["sentPackets"] = static_cast<Json::UInt64>(_ulpfec_sent_packets);
+
+		json["ulpfec"] = json_ulpfec;
+	}
+
+	std::lock_guard<std::mutex> lock(_rendition_switch_history_lock);
+
+	json["probingRendition"] = (_probe_rendition != nullptr) ? Json::Value(_probe_rendition->GetName().CStr()) : Json::Value(Json::nullValue);
+
+	Json::Value json_history(Json::ValueType::arrayValue);
+
+	for (const auto &record : _rendition_switch_history)
+	{
+		Json::Value json_record;
+
+		json_record["time"] = ov::Converter::ToISO8601String(record._time).CStr();
+		json_record["from"] = record._from.CStr();
+		json_record["to"] = record._to.CStr();
+		json_record["estimatedBitrate"] = static_cast<Json::Int64>(record._estimated_bitrate);
+		json_record["reason"] = record._reason.CStr();
+
+		json_history.append(json_record);
+	}
+
+	json["renditionSwitches"] = json_history;
+
+	return json;
 }
 
 // ov::Node Interface
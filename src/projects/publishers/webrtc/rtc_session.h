@@ -7,6 +7,9 @@
 //
 //==============================================================================
 #pragma once
+#include <atomic>
+#include <deque>
+#include <optional>
 #include <unordered_set>
 #include <monitoring/monitoring.h>
 #include <modules/http/server/web_socket/web_socket_session.h>
@@ -17,6 +20,8 @@
 #include "modules/ice/ice_port.h"
 #include "modules/rtp_rtcp/rtp_rtcp.h"
 #include "modules/rtp_rtcp/rtp_packetizer_interface.h"
+#include "modules/rtp_rtcp/send_side_bandwidth_estimator.h"
+#include "modules/rtp_rtcp/rtp_pacer.h"
 #include "modules/dtls_srtp/dtls_transport.h"
 
 #include "rtc_playlist.h"
@@ -83,6 +88,8 @@ public:
 	// pub::Session Interface
 	void SendOutgoingData(const std::any &packet) override;
 	void OnMessageReceived(const std::any &message) override;
+	int64_t SendPacedData() override;
+	bool HasPacedData() const override;
 	
 	// RtpRtcp Interface
 	void OnRtpFrameReceived(const std::vector<std::shared_ptr<RtpPacket>> &rtp_packets) override;
@@ -97,6 +104,9 @@ public:
 		return _ice_session_id;
 	}
 
+	// Bandwidth estimate, and the history of the rendition switches
+	Json::Value GetBandwidthStats();
+
 private:
 	bool ProcessReceiverReport(const std::shared_ptr<RtcpInfo> &rtcp_info);
 	bool ProcessNACK(const std::shared_ptr<RtcpInfo> &rtcp_info);
@@ -104,6 +114,10 @@ private:
 	bool ProcessRemb(const std::shared_ptr<RtcpInfo> &rtcp_info);
 	bool IsSelectedPacket(const std::shared_ptr<const RtpPacket> &rtp_packet);
 
+	void SendMediaPacket(const std::shared_ptr<RtpPacket> &rtp_packet, uint16_t sequence_number);
+	// Sends the redundant retransmissions (RTX) of the latest video packets as the padding
+	size_t SendPadding(size_t bytes);
+
 	uint8_t GetOriginPayloadTypeFromRedRtpPacket(const std::shared_ptr<const RedRtpPacket> &red_rtp_packet);
 
 	void ChangeRendition();
@@ -131,7 +145,8 @@ private:
 	bool								_red_enabled = false;
 	bool								_rtx_enabled = false;
 
-	uint16_t							_rtx_sequence_number = 1;
+	// Increased by both the worker (padding) and the RTCP (NACK) threads
+	std::atomic<uint16_t>				_rtx_sequence_number{1};
 	uint64_t							_session_expired_time = 0;
 
 	std::shared_mutex					_start_stop_lock;
@@ -167,6 +182,9 @@ private:
 		uint32_t _sent_bytes = 0;
 		std::chrono::system_clock::time_point _sent_time;
 
+		// The FEC packets are not retransmitted
+		bool _ulpfec = false;
+
 		ov::String ToString()
 		{
 			return ov::String::FormatString("WideSeq(%d) SSRC(%u) Seq(%d) Track(%d) PT(%d) Timestamp(%u) Marker(%s) OriginSeq(%d) SentBytes(%u)", 
@@ -174,50 +192,87 @@ private:
 		}
 	};
 
-	bool RecordRtpSent(const std::shared_ptr<const RtpPacket> &rtp_packet, uint16_t origin_sequence_number, uint16_t wide_sequence_number);
+	bool RecordRtpSent(const std::shared_ptr<const RtpPacket> &rtp_packet, uint16_t sequence_number, uint16_t wide_sequence_number, size_t sent_bytes);
 
 	std::shared_mutex _rtp_record_map_lock;
 	// For NACK
 	// video sequence number % MAX_RTP_RECORDS : RtpSentRecord
 	std::unordered_map<uint16_t, std::shared_ptr<RtpSentLog>> _video_rtp_sent_record_map;
-	// For TRANSPORT-CC
-	// wide sequence number % MAX_RTP_RECORDS : RtpSentRecord
-	std::unordered_map<uint16_t, std::shared_ptr<RtpSentLog>> _wide_rtp_sent_record_map;
 
 	std::shared_ptr<RtpSentLog> TraceRtpSentByVideoSeqNo(uint16_t sequence_number);
-	std::shared_ptr<RtpSentLog> TraceRtpSentByWideSeqNo(uint16_t wide_sequence_number);
-
-	bool SetTransportWideSequenceNumber(const std::shared_ptr<RtpPacket> &rtp_packet, uint16_t wide_sequence_number);
-	bool SetAbsSendTime(const std::shared_ptr<RtpPacket> &rtp_packet, uint64_t time_ms);
 
-	// For Estimated bitrate
-	double _total_sent_seconds = 0;
-	uint64_t _total_sent_bytes = 0;
-	double _estimated_bitrates = 0;
+	// rtp_packet provides the layout of the header extensions, and the value is written into wire_data
+	bool SetTransportWideSequenceNumber(const std::shared_ptr<const RtpPacket> &rtp_packet, const std::shared_ptr<ov::Data> &wire_data, uint16_t wide_sequence_number);
+	bool SetAbsSendTime(const std::shared_ptr<const RtpPacket> &rtp_packet, const std::shared_ptr<ov::Data> &wire_data, uint64_t time_ms);
+	// The sequence number base of the ULPFEC packet is in the sequence numbers of the stream, so it is rewritten
+	bool SetUlpfecSequenceNumberBase(const std::shared_ptr<const RtpPacket> &rtp_packet, const std::shared_ptr<ov::Data> &wire_data, uint16_t sequence_number);
+
+	// ULPFEC is sent only while the loss is observed
+	bool _ulpfec_enabled = false;
+	// Smoothed fraction lost of the video (from the receiver reports)
+	std::atomic<double> _video_fraction_lost{0.0};
+	// Requested by the RTCP thread
+	std::atomic<bool> _ulpfec_requested{false};
+	// Latched at each media packet, so the FEC packets of a frame are all sent or all dropped
+	bool _ulpfec_forwarding = false;
+	std::atomic<uint64_t> _ulpfec_sent_packets{0};
+	void UpdateUlpfecProtection(uint8_t fraction_lost);
+
+	// Estimates the bandwidth with transport-cc, receiver report and REMB
+	std::shared_ptr<SendSideBandwidthEstimator> _bandwidth_estimator;
 	ov::StopWatch _bitrate_estimate_watch;
 
+	// Holds the video packets back, and sends them at a multiple of the estimated bitrate (nullptr if the pacing is disabled)
+	std::shared_ptr<RtpPacer> _pacer;
+	// Set when a packet is enqueued to the pacer or the padding is requested, and cleared when the pacer is drained
+	std::atomic<bool> _has_paced_data = false;
+	void UpdatePacingBitrate();
+
 	// Auto switch rendition
 	bool _auto_abr = true;
 	void ChangeRenditionIfNeeded();
-	
-	// true means Don't know yet
-	bool IsNextRenditionGoodChoice(const std::shared_ptr<const RtcRendition> &rendition);
-	bool RecordAutoSelectedRendition(const std::shared_ptr<const RtcRendition> &rendition, bool higher_quality);
-	// Redition Name, boolean
-	struct SelectedRecord
+	bool IsProbeAllowed(const std::shared_ptr<const RtcRendition> &rendition) const;
+	bool SwitchRendition(const std::shared_ptr<const RtcRendition> &from, const std::shared_ptr<const RtcRendition> &to, int64_t estimated_bitrate, const char *reason);
+	void RecordRenditionSwitch(const std::shared_ptr<const RtcRendition> &from, const std::shared_ptr<const RtcRendition> &to, int64_t estimated_bitrate, const char *reason);
+
+	// Consecutive evaluations (once a second) that the estimate is out of the range of the current rendition
+	int _lower_condition_count = 0;
+	int _higher_condition_count = 0;
+
+	// The overuse count of the estimator is not changed since this time (used to probe a higher rendition)
+	uint64_t _last_overuse_count = 0;
+	std::chrono::steady_clock::time_point _stable_since_time;
+
+	// Every switch to a higher rendition is a probe, which is reverted if the estimator detects the overuse in a few seconds
+	std::shared_ptr<const RtcRendition> _probe_rendition = nullptr;
+	std::shared_ptr<const RtcRendition> _probe_previous_rendition = nullptr;
+	// Since the rendition is actually changed (at the key frame)
+	std::optional<std::chrono::steady_clock::time_point> _probe_start_time;
+
+	struct ProbeBackoff
 	{
-		ov::String _rendition_name;
-		uint32_t _selected_count = 0;
-		std::chrono::system_clock::time_point _last_selected_time;
+		uint32_t _failure_count = 0;
+		std::chrono::steady_clock::time_point _last_failed_time;
 	};
+	// rendition name, ProbeBackoff
+	std::map<ov::String, ProbeBackoff> _probe_backoffs;
+	void RecordProbeFailure(const std::shared_ptr<const RtcRendition> &rendition);
 
-	double _previous_estimated_bitrate = 0;
+	// Higher rendition whose bitrate is being probed with the padding. If the padding causes the overuse or the loss,
+	// or the estimate doesn't reach the rendition, it is recorded in _probe_backoffs like a failed switch.
+	std::shared_ptr<const RtcRendition> _padding_probe_rendition = nullptr;
 
-	bool _switched_rendition_to_higher = false;
-	std::chrono::system_clock::time_point _switched_rendition_to_higher_time = {};
-
-	// rendition name, SelectedRecord
-	std::map<ov::String, std::shared_ptr<SelectedRecord>> _auto_rendition_selected_records;
+	struct RenditionSwitchRecord
+	{
+		std::chrono::system_clock::time_point _time;
+		ov::String _from;
+		ov::String _to;
+		int64_t _estimated_bitrate = 0;
+		ov::String _reason;
+	};
+	// Also protects _probe_rendition, which is read by GetBandwidthStats()
+	std::mutex _rendition_switch_history_lock;
+	std::deque<RenditionSwitchRecord> _rendition_switch_history;
 
 	session_id_t _ice_session_id;
 };
\ No newline at end of file
@@ -24,6 +24,13 @@
 
 using namespace cmn;
 
+// The FEC packets are generated 3 times the worst loss of the sessions (e.g. 30% of the media packets for 10% loss),
+// up to <MaxProtection> of <FecProtection>
+#define ULPFEC_PROTECTION_PER_LOSS			3.0
+// The loss reported by a session is ignored after this (the receiver report is sent about once a second)
+#define ULPFEC_LOSS_REPORT_TIMEOUT_MS		5000
+#define ULPFEC_PROTECTION_UPDATE_INTERVAL_MS	1000
+
 /***************************
  SDP Sample
 ****************************
@@ -129,6 +136,9 @@ bool RtcStream::Start()
 	_playout_delay_min = playoutDelay.GetMin();
 	_playout_delay_max = playoutDelay.GetMax();
 
+	_pacing_config = webrtc_config.GetPacing();
+	_fec_protection_config = webrtc_config.GetFecProtection();
+
 	if (webrtc_config.GetBandwidthEstimationType() == WebRtcBandwidthEstimationType::TransportCc)
 	{
 		_transport_cc_enabled = true;
@@ -717,6 +727,11 @@ void RtcStream::PacketizeVideoFrame(const std::shared_ptr<MediaPacket> &media_pa
 		return;
 	}
 
+	if (_ulpfec_enabled == true)
+	{
+		packetizer->SetUlpfecProtection(GetUlpfecProtectionFactor(), _fec_protection_config.GetMaskType());
+	}
+
 	auto frame_type = (media_packet->GetFlag() == MediaPacketFlag::Key) ? FrameType::VideoFrameKey : FrameType::VideoFrameDelta;
 	// video timescale is always 90000hz in WebRTC
 	auto timestamp = ((double)media_packet->GetPts() * media_track->GetTimeBase().GetExpr() * 90000);
@@ -916,6 +931,67 @@ std::shared_ptr<RtpHistory> RtcStream::GetHistory(uint32_t track_id, uint8_t ori
 	return _rtp_history_map[key];
 }
 
+void RtcStream::OnUlpfecLossReported(session_id_t session_id, double fraction_lost)
+{
+	std::lock_guard<std::mutex> lock(_ulpfec_loss_reports_lock);
+
+	auto now_ms = ov::Clock::NowMSec();
+
+	if (fraction_lost > 0.0)
+	{
+		_ulpfec_loss_reports[session_id] = {fraction_lost, now_ms};
+	}
+	else
+	{
+		_ulpfec_loss_reports.erase(session_id);
+	}
+
+	UpdateUlpfecProtectionFactor(now_ms);
+}
+
+uint8_t RtcStream::GetUlpfecProtectionFactor()
+{
+	std::lock_guard<std::mutex> lock(_ulpfec_loss_reports_lock);
+
+	// The reports of the sessions that are gone are expired
+	auto now_ms = ov::Clock::NowMSec();
+	if (now_ms - _ulpfec_protection_updated_time_ms >= ULPFEC_PROTECTION_UPDATE_INTERVAL_MS)
+	{
+		UpdateUlpfecProtectionFactor(now_ms);
+	}
+
+	return _ulpfec_protection_factor;
+}
+
+void RtcStream::UpdateUlpfecProtectionFactor(uint64_t now_ms)
+{
+	double max_fraction_lost = 0.0;
+
+	for (auto it = _ulpfec_loss_reports.begin(); it != _ulpfec_loss_reports.end();)
+	{
+		if (now_ms - it->second._reported_time_ms > ULPFEC_LOSS_REPORT_TIMEOUT_MS)
+		{
+			it = _ulpfec_loss_reports.erase(it);
+			continue;
+		}
+
+		max_fraction_lost = std::max(max_fraction_lost, it->second._fraction_lost);
+		++it;
+	}
+
+	auto max_protection_factor = std::min(_fec_protection_config.GetMaxProtection() * 256 / 100, 255);
+	auto protection_factor = static_cast<uint8_t>(std::min(max_fraction_lost * ULPFEC_PROTECTION_PER_LOSS * 256.0, static_cast<double>(max_protection_factor)));
+
+	if (protection_factor != _ulpfec_protection_factor)
+	{
+		logtd("ULPFEC protection of the stream(%s/%u) is changed: %u -> %u (sessions: %zu, max fraction lost: %.3f)",
+			  GetName().CStr(), GetId(), _ulpfec_protection_factor, protection_factor, _ulpfec_loss_reports.size(), max_fraction_lost);
+	}
+
+	_ulpfec_protection_factor = protection_factor;
+	_ulpfec_protection_updated_time_ms = now_ms;
+}
+
 std::shared_ptr<RtxRtpPacket> RtcStream::GetRtxRtpPacket(uint32_t track_id, uint8_t origin_payload_type, uint16_t origin_sequence_number)
 {
 	if(GetState() != State::STARTED)
@@ -42,6 +42,14 @@ public:
 
 	std::shared_ptr<RtxRtpPacket> GetRtxRtpPacket(uint32_t track_id, uint8_t origin_payload_type, uint16_t origin_sequence_number);
 
+	const cfg::vhost::app::pub::Pacing &GetPacingConfig() const
+	{
+		return _pacing_config;
+	}
+
+	// fraction_lost: Smoothed loss of the video of the session that needs ULPFEC (0: not needed)
+	void OnUlpfecLossReported(session_id_t session_id, double fraction_lost);
+
 	// RtpRtcpPacketizerInterface Implementation
 	bool OnRtpPacketized(std::shared_ptr<RtpPacket> packet) override;
 
@@ -82,6 +90,10 @@ private:
 
 	uint32_t GetSsrc(cmn::MediaType media_type);
 
+	// FEC packets per 256 media packets for the worst loss of the sessions
+	uint8_t GetUlpfecProtectionFactor();
+	void UpdateUlpfecProtectionFactor(uint64_t now_ms);
+
 	// SDP related info
 	ov::String _msid;
 	ov::String _cname;
@@ -109,6 +121,20 @@ private:
 	int _playout_delay_min = 0;
 	int _playout_delay_max = 0;
 
+	cfg::vhost::app::pub::Pacing _pacing_config;
+	cfg::vhost::app::pub::FecProtection _fec_protection_config;
+
+	struct UlpfecLossReport
+	{
+		double _fraction_lost = 0.0;
+		uint64_t _reported_time_ms = 0;
+	};
+	std::mutex _ulpfec_loss_reports_lock;
+	// Session ID : UlpfecLossReport (only the sessions that need ULPFEC)
+	std::map<session_id_t, UlpfecLossReport> _ulpfec_loss_reports;
+	uint8_t _ulpfec_protection_factor = 0;
+	uint64_t _ulpfec_protection_updated_time_ms = 0;
+
 	bool _transport_cc_enabled = false;
 	bool _remb_enabled = false;
 
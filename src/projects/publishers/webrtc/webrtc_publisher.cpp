@@ -46,6 +46,7 @@ bool WebRtcPublisher::StartSignallingServer(const cfg::Server &server_config, co
 	bool is_configured;
 	auto worker_count = signalling_config.GetWorkerCount(&is_configured);
 	worker_count = is_configured ? worker_count : HTTP_SERVER_USE_DEFAULT_COUNT;
+	auto sharded = signalling_config.UseShardedWorkers();
 
 	bool is_port_configured;
 	auto &port_config = signalling_config.GetPort(&is_port_configured);
@@ -68,7 +69,7 @@ bool WebRtcPublisher::StartSignallingServer(const cfg::Server &server_config, co
 			server_config.GetIPList(),
 			is_port_configured, port_config.GetPort(),
 			is_tls_port_configured, tls_port_config.GetPort(),
-			worker_count, interceptor))
+			worker_count, sharded, interceptor))
 	{
 		_signalling_server = std::move(signalling_server);
 
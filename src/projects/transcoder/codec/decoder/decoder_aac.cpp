@@ -50,145 +50,100 @@ bool DecoderAAC::Configure(std::shared_ptr<MediaTrack> context)
 
 	_parser->flags |= PARSER_FLAG_COMPLETE_FRAMES;
 
-	// Generates a thread that reads and encodes frames in the input_buffer queue and places them in the output queue.
-	try
-	{
-		_kill_flag = false;
+	return StartCodec();
+}
 
-		_codec_thread = std::thread(&TranscodeDecoder::CodecThread, this);
-		pthread_setname_np(_codec_thread.native_handle(), ov::String::FormatString("Dec%s", avcodec_get_name(GetCodecID())).CStr());
-	}
-	catch (const std::system_error &e)
+void DecoderAAC::DecodePacket(std::shared_ptr<const MediaPacket> buffer)
+{
+	auto packet_data = buffer->GetData();
+	if ((packet_data == nullptr) || (packet_data->GetLength() == 0))
 	{
-		logte("Failed to start decoder thread");
-		_kill_flag = true;
-		return false;
+		return;
 	}
 
-	return true;
-}
+	size_t offset = 0;
 
-void DecoderAAC::CodecThread()
-{
-	bool no_data_to_encode = false;
-
-	while (!_kill_flag)
+	while ((offset < packet_data->GetLength()) && !_kill_flag)
 	{
 		/////////////////////////////////////////////////////////////////////
 		// Sending a packet to decoder
 		/////////////////////////////////////////////////////////////////////
-		if (_cur_pkt == nullptr && (_input_buffer.IsEmpty() == false || no_data_to_encode == true))
+		_pkt->size = 0;
+
+		int32_t parsed_size = ::av_parser_parse2(
+			_parser,
+			_context,
+			&_pkt->data, &_pkt->size,
+			packet_data->GetDataAs<uint8_t>() + offset,
+			static_cast<int32_t>(packet_data->GetLength() - offset),
+			buffer->GetPts(), buffer->GetPts(),
+			0);
+
+		// Failed to parsing
+		if (parsed_size <= 0)
 		{
-			auto obj = _input_buffer.Dequeue();
-			if (obj.has_value() == false)
-			{
-				continue;
-			}
+			logte("Error while parsing\n");
+			break;
+		}
 
-			no_data_to_encode = false;
-			_cur_pkt = std::move(obj.value());
-			if (_cur_pkt != nullptr)
-			{
-				_cur_data = _cur_pkt->GetData();
-				_pkt_offset = 0;
-			}
+		OV_ASSERT(packet_data->GetLength() >= (offset + parsed_size), "Current data size MUST greater than parsed_size, but data size: %ld, parsed_size: %ld", packet_data->GetLength() - offset, parsed_size);
+		offset += parsed_size;
 
-			if ((_cur_data == nullptr) || (_cur_data->GetLength() == 0))
-			{
-				continue;
-			}
+		if (_pkt->size <= 0)
+		{
+			continue;
 		}
 
-		if (_cur_data != nullptr)
+		_pkt->pts = _parser->pts;
+		_pkt->dts = _parser->dts;
+		_pkt->flags = (_parser->key_frame == 1) ? AV_PKT_FLAG_KEY : 0;
+		if (_pkt->pts != AV_NOPTS_VALUE && _parser->last_pts != AV_NOPTS_VALUE)
 		{
-			if (_pkt_offset < _cur_data->GetLength())
-			{
-				_pkt->size = 0;
-				
-				int32_t parsed_size = ::av_parser_parse2(
-					_parser,
-					_context,
-					&_pkt->data, &_pkt->size,
-					_cur_data->GetDataAs<uint8_t>() + _pkt_offset,
-					static_cast<int32_t>(_cur_data->GetLength() - _pkt_offset),
-					_cur_pkt->GetPts(), _cur_pkt->GetPts(),
-					0);
-
-				// Failed to parsing
-				if (parsed_size <= 0)
-				{
-					logte("Error while parsing\n");
-					_cur_data = nullptr;
-				}
-				else
-				{
-					OV_ASSERT(_cur_data->GetLength() >= (size_t)parsed_size, "Current data size MUST greater than parsed_size, but data size: %ld, parsed_size: %ld", _cur_data->GetLength(), parsed_size);
-					_pkt_offset += parsed_size;
-				}
-
-				if (_pkt->size > 0)
-				{
-					_pkt->pts = _parser->pts;
-					_pkt->dts = _parser->dts;
-					_pkt->flags = (_parser->key_frame == 1) ? AV_PKT_FLAG_KEY : 0;
-					if (_pkt->pts != AV_NOPTS_VALUE && _parser->last_pts != AV_NOPTS_VALUE)
-					{
-						_pkt->duration = _pkt->pts - _parser->last_pts;
-					}
-					else
-					{
-						_pkt->duration = 0;
-					}
-
-					int ret = ::avcodec_send_packet(_context, _pkt);
-					if (ret == AVERROR(EAGAIN))
-					{
-
-					}
-					else if (ret == AVERROR_EOF)
-					{
-						logte("Error sending a packet for decoding : AVERROR_EOF");
-					}
-					else if (ret < 0)
-					{
-						_cur_data = nullptr;
-						char err_msg[1024];
-						av_strerror(ret, err_msg, sizeof(err_msg));
-						logte("An error occurred while sending a packet for decoding. %s ", err_msg);
-					}
-				}
-			}
-
-			if (_cur_data == nullptr || _cur_data->GetLength() <= _pkt_offset)
-			{
-				_cur_pkt = nullptr;
-				_cur_data = nullptr;
-				_pkt_offset = 0;
-			}
+			_pkt->duration = _pkt->pts - _parser->last_pts;
+		}
+		else
+		{
+			_pkt->duration = 0;
 		}
 
-		/////////////////////////////////////////////////////////////////////
-		// Receive a frame from decoder
-		/////////////////////////////////////////////////////////////////////
-		// Check the decoded frame is available
-		int ret = ::avcodec_receive_frame(_context, _frame);
+		int ret = ::avcodec_send_packet(_context, _pkt);
 		if (ret == AVERROR(EAGAIN))
 		{
-			no_data_to_encode = true;
-			continue;
 		}
 		else if (ret == AVERROR_EOF)
 		{
-			logte("Error receiving a packet for decoding : AVERROR_EOF");
-			continue;
+			logte("Error sending a packet for decoding : AVERROR_EOF");
 		}
 		else if (ret < 0)
 		{
-			logte("Error receiving a packet for decoding : %d", ret);
-			continue;
+			char err_msg[1024];
+			av_strerror(ret, err_msg, sizeof(err_msg));
+			logte("An error occurred while sending a packet for decoding. %s ", err_msg);
+			break;
 		}
-		else
+
+		/////////////////////////////////////////////////////////////////////
+		// Receive frames from decoder
+		/////////////////////////////////////////////////////////////////////
+		while (!_kill_flag)
 		{
+			// Check the decoded frame is available
+			ret = ::avcodec_receive_frame(_context, _frame);
+			if (ret == AVERROR(EAGAIN))
+			{
+				break;
+			}
+			else if (ret == AVERROR_EOF)
+			{
+				logte("Error receiving a packet for decoding : AVERROR_EOF");
+				break;
+			}
+			else if (ret < 0)
+			{
+				logte("Error receiving a packet for decoding : %d", ret);
+				break;
+			}
+
 			bool need_to_change_notify = false;
 
 			// Update codec informations if needed
@@ -220,9 +175,8 @@ void DecoderAAC::CodecThread()
 				_frame->pkt_duration = ffmpeg::Conv::GetDurationPerFrame(cmn::MediaType::Audio, GetRefTrack(), _frame);
 			}
 
-
 			// If the decoded audio frame does not have a PTS, Increase frame duration time in PTS of previous frame
-			if(_frame->pts == AV_NOPTS_VALUE)
+			if (_frame->pts == AV_NOPTS_VALUE)
 			{
 				_frame->pts = _last_pkt_pts + _frame->pkt_duration;
 			}
@@ -26,5 +26,5 @@ public:
 
 	bool Configure(std::shared_ptr<MediaTrack> context) override;
 
-    void CodecThread() override;
+	void DecodePacket(std::shared_ptr<const MediaPacket> packet) override;
 };
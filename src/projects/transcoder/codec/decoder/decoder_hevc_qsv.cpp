@@ -57,6 +57,7 @@ bool DecoderHEVCxQSV::Configure(std::shared_ptr<MediaTrack> context)
 
 		_codec_thread = std::thread(&TranscodeDecoder::CodecThread, this);
 		pthread_setname_np(_codec_thread.native_handle(), ov::String::FormatString("Dec%sQsv", avcodec_get_name(GetCodecID())).CStr());
+		ov::ThreadTopology::GetInstance()->Apply(OV_THREAD_POOL_DECODER, _codec_thread.native_handle());
 	}
 	catch (const std::system_error &e)
 	{
@@ -23,14 +23,10 @@ public:
 		return AV_CODEC_ID_OPUS;
 	}
 
-	std::shared_ptr<const MediaPacket> _cur_pkt = nullptr;
-	size_t _pkt_offset = 0;
-	std::shared_ptr<const ov::Data> _cur_data = nullptr;
-
 	int64_t _last_pkt_pts = 0;
 
 	bool Configure(std::shared_ptr<MediaTrack> context) override;
 
-	void CodecThread() override;
+	void DecodePacket(std::shared_ptr<const MediaPacket> packet) override;
 
 };
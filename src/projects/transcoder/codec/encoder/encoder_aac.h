@@ -35,7 +35,7 @@ public:
 
 	bool Configure(std::shared_ptr<MediaTrack> output_context) override;
 
-	void CodecThread() override;
+	void EncodeFrame(std::shared_ptr<const MediaFrame> frame) override;
 
 private:
 	bool SetCodecParams() override;
@@ -137,6 +137,7 @@ bool EncoderAVCxNV::Configure(std::shared_ptr<MediaTrack> context)
 
 		_codec_thread = std::thread(&EncoderAVCxNV::CodecThread, this);
 		pthread_setname_np(_codec_thread.native_handle(), ov::String::FormatString("Enc%sNV", avcodec_get_name(GetCodecID())).CStr());
+		ov::ThreadTopology::GetInstance()->Apply(OV_THREAD_POOL_ENCODER, _codec_thread.native_handle());
 	}
 	catch (const std::system_error &e)
 	{
@@ -26,10 +26,10 @@ bool EncoderAVCxOpenH264::SetCodecParams()
 	// Set KeyFrame Interval
 	_codec_context->gop_size = (GetRefTrack()->GetKeyFrameInterval() == 0) ? (_codec_context->framerate.num / _codec_context->framerate.den) : GetRefTrack()->GetKeyFrameInterval();
 
-	// -1(Default) => FFMIN(FFMAX(4, av_cpu_count() / 3), 8) 
+	// -1(Default) => FFMIN(FFMAX(4, (CPUs of the Encoder pool) / 3), 8)
 	// 0 => Auto
 	// >1 => Set
-	_codec_context->thread_count = GetRefTrack()->GetThreadCount() < 0 ? FFMIN(FFMAX(4, av_cpu_count() / 3), 8) : GetRefTrack()->GetThreadCount();
+	_codec_context->thread_count = GetRefTrack()->GetThreadCount() < 0 ? FFMIN(FFMAX(4, ov::ThreadTopology::GetInstance()->GetCpuCount(OV_THREAD_POOL_ENCODER) / 3), 8) : GetRefTrack()->GetThreadCount();
 	_codec_context->slices = _codec_context->thread_count;
 
 	::av_opt_set(_codec_context->priv_data, "coder", "default", 0);
@@ -68,6 +68,13 @@ bool EncoderAVCxOpenH264::SetCodecParams()
 	// Loop Filter
 	::av_opt_set_int(_codec_context->priv_data, "loopfilter", 1, 0);
 
+	if (IsComplexityReduced())
+	{
+		// OpenH264 has no speed preset, so the deblocking and CABAC (high profile) are disabled instead
+		::av_opt_set_int(_codec_context->priv_data, "loopfilter", 0, 0);
+		::av_opt_set(_codec_context->priv_data, "coder", "cavlc", 0);
+	}
+
 	// Preset
 	auto preset = GetRefTrack()->GetPreset().LowerCaseString();
 	if (preset.IsEmpty() == true)
@@ -141,90 +148,72 @@ bool EncoderAVCxOpenH264::Configure(std::shared_ptr<MediaTrack> context)
 		return false;
 	}
 
-	if (::avcodec_open2(_codec_context, codec, nullptr) < 0)
+	// The threads created by the encoder inherit the CPU affinity of the Encoder pool
+	int result;
 	{
-		logte("Could not open codec: %s (%d)", ::avcodec_get_name(codec_id), codec_id);
-		return false;
+		ov::ThreadTopology::ScopedAffinity scoped_affinity(OV_THREAD_POOL_ENCODER);
+		result = ::avcodec_open2(_codec_context, codec, nullptr);
 	}
 
-	// Generates a thread that reads and encodes frames in the input_buffer queue and places them in the output queue.
-	try
-	{
-		_kill_flag = false;
-
-		_codec_thread = std::thread(&TranscodeEncoder::CodecThread, this);
-		pthread_setname_np(_codec_thread.native_handle(), ov::String::FormatString("Enc%s", avcodec_get_name(GetCodecID())).CStr());
-	}
-	catch (const std::system_error &e)
+	if (result < 0)
 	{
-		logte("Failed to start encoder thread.");
-		_kill_flag = true;
-
+		logte("Could not open codec: %s (%d)", ::avcodec_get_name(codec_id), codec_id);
 		return false;
 	}
 
-	return true;
+	return StartCodec();
 }
 
-void EncoderAVCxOpenH264::CodecThread()
+void EncoderAVCxOpenH264::EncodeFrame(std::shared_ptr<const MediaFrame> media_frame)
 {
-	while (!_kill_flag)
+	///////////////////////////////////////////////////
+	// Request frame encoding to codec
+	///////////////////////////////////////////////////
+	auto av_frame = ffmpeg::Conv::ToAVFrame(cmn::MediaType::Video, media_frame);
+	if (!av_frame)
 	{
-		auto obj = _input_buffer.Dequeue();
-		if (obj.has_value() == false)
-			continue;
+		logte("Could not allocate the video frame data");
+		return;
+	}
 
-		auto media_frame = std::move(obj.value());
+	// AV_Frame.pict_type must be set to AV_PICTURE_TYPE_NONE. This will ensure that the keyframe interval option is applied correctly.
+	av_frame->pict_type = AV_PICTURE_TYPE_NONE;
 
-		///////////////////////////////////////////////////
-		// Request frame encoding to codec
-		///////////////////////////////////////////////////
-		auto av_frame = ffmpeg::Conv::ToAVFrame(cmn::MediaType::Video, media_frame);
-		if (!av_frame)
+	int ret = ::avcodec_send_frame(_codec_context, av_frame);
+	if (ret < 0)
+	{
+		logte("Error sending a frame for encoding : %d", ret);
+	}
+
+	///////////////////////////////////////////////////
+	// The encoded packet is taken from the codec.
+	///////////////////////////////////////////////////
+	while (true)
+	{
+		// Check frame is available
+		int ret = ::avcodec_receive_packet(_codec_context, _packet);
+		if (ret == AVERROR(EAGAIN))
 		{
-			logte("Could not allocate the video frame data");
+			// More packets are needed for encoding.
 			break;
 		}
-
-		// AV_Frame.pict_type must be set to AV_PICTURE_TYPE_NONE. This will ensure that the keyframe interval option is applied correctly.
-		av_frame->pict_type = AV_PICTURE_TYPE_NONE;
-
-		int ret = ::avcodec_send_frame(_codec_context, av_frame);
-		if (ret < 0)
+		else if (ret == AVERROR_EOF && ret < 0)
 		{
-			logte("Error sending a frame for encoding : %d", ret);
+			logte("Error receiving a packet for decoding : %d", ret);
+			break;
 		}
-
-		///////////////////////////////////////////////////
-		// The encoded packet is taken from the codec.
-		///////////////////////////////////////////////////
-		while (true)
+		else
 		{
-			// Check frame is available
-			int ret = ::avcodec_receive_packet(_codec_context, _packet);
-			if (ret == AVERROR(EAGAIN))
+			auto media_packet = ffmpeg::Conv::ToMediaPacket(_packet, cmn::MediaType::Video, cmn::BitstreamFormat::H264_ANNEXB, cmn::PacketType::NALU);
+			if (media_packet == nullptr)
 			{
-				// More packets are needed for encoding.
+				logte("Could not allocate the media packet");
 				break;
 			}
-			else if (ret == AVERROR_EOF && ret < 0)
-			{
-				logte("Error receiving a packet for decoding : %d", ret);
-				break;
-			}
-			else
-			{
-				auto media_packet = ffmpeg::Conv::ToMediaPacket(_packet, cmn::MediaType::Video, cmn::BitstreamFormat::H264_ANNEXB, cmn::PacketType::NALU);
-				if (media_packet == nullptr)
-				{
-					logte("Could not allocate the media packet");
-					break;
-				}
 
-				::av_packet_unref(_packet);
+			::av_packet_unref(_packet);
 
-				SendOutputBuffer(std::move(media_packet));
-			}
+			SendOutputBuffer(std::move(media_packet));
 		}
 	}
 }
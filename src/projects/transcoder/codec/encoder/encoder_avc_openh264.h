@@ -35,7 +35,12 @@ public:
 
 	bool Configure(std::shared_ptr<MediaTrack> context) override;
 
-	void CodecThread() override;
+	void EncodeFrame(std::shared_ptr<const MediaFrame> frame) override;
+
+	bool IsLoadControlSupported() const override
+	{
+		return true;
+	}
 
 private:
 	bool SetCodecParams() override;
@@ -109,6 +109,7 @@ bool EncoderAVCxQSV::Configure(std::shared_ptr<MediaTrack> context)
 
 		_codec_thread = std::thread(&EncoderAVCxQSV::CodecThread, this);
 		pthread_setname_np(_codec_thread.native_handle(), ov::String::FormatString("Enc%sQsv", avcodec_get_name(GetCodecID())).CStr());
+		ov::ThreadTopology::GetInstance()->Apply(OV_THREAD_POOL_ENCODER, _codec_thread.native_handle());
 	}
 	catch (const std::system_error &e)
 	{
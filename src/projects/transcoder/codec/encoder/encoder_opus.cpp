@@ -115,26 +115,10 @@ bool EncoderOPUS::Configure(std::shared_ptr<MediaTrack> context)
 	_format = cmn::AudioSample::Format::None;
 	_current_pts = -1;
 
-	// Generates a thread that reads and encodes frames in the input_buffer queue and places them in the output queue.
-	try
-	{
-		_kill_flag = false;
-
-		_codec_thread = std::thread(&EncoderOPUS::CodecThread, this);
-		pthread_setname_np(_codec_thread.native_handle(), ov::String::FormatString("Enc%s", avcodec_get_name(GetCodecID())).CStr());
-	}
-	catch (const std::system_error &e)
-	{
-		logte("Failed to start encoder thread.");
-		_kill_flag = true;
-
-		return false;
-	}
-
-	return true;
+	return StartCodec();
 }
 
-void EncoderOPUS::CodecThread()
+void EncoderOPUS::EncodeFrame(std::shared_ptr<const MediaFrame> media_frame)
 {
 	// Reference : https://opus-codec.org/docs/opus_api-1.1.3/group__opus__encoder.html#gad2d6bf6a9ffb6674879d7605ed073e25
 	// Number of samples per channel in the input signal. This must be an Opus frame size for the encoder's sampling rate.
@@ -142,90 +126,76 @@ void EncoderOPUS::CodecThread()
 
 	const unsigned int bytes_to_encode = _frame_size * GetRefTrack()->GetChannel().GetCounts() * GetRefTrack()->GetSample().GetSampleSize();
 
-	while (!_kill_flag)
+	OV_ASSERT2(media_frame != nullptr);
+
+	// const MediaFrame *frame = media_frame.get();
+	auto av_frame = ffmpeg::Conv::ToAVFrame(cmn::MediaType::Audio, media_frame);
+	if (!av_frame)
 	{
-		// If there is no data to encode, the data is fetched from the queue.
-		if (_buffer->GetLength() < bytes_to_encode)
-		{
-			auto obj = _input_buffer.Dequeue();
-			if (obj.has_value() == false)
-				continue;
-
-			auto media_frame = std::move(obj.value());
-			OV_ASSERT2(media_frame != nullptr);
-
-			// const MediaFrame *frame = media_frame.get();
-			auto av_frame = ffmpeg::Conv::ToAVFrame(cmn::MediaType::Audio, media_frame);
-			if (!av_frame)
-			{
-				logte("Could not allocate the frame data");
-				break;
-			}
+		logte("Could not allocate the frame data");
+		return;
+	}
 
-			// Store frame informations
-			_format = media_frame->GetFormat<cmn::AudioSample::Format>();
+	// Store frame informations
+	_format = media_frame->GetFormat<cmn::AudioSample::Format>();
 
-			// Update current pts if the first PTS or PTS goes over frame_size.
-			if (_current_pts == -1 || abs(_current_pts - media_frame->GetPts()) > _frame_size)
-			{
-				_current_pts = media_frame->GetPts();
-			}
+	// Update current pts if the first PTS or PTS goes over frame_size.
+	if (_current_pts == -1 || abs(_current_pts - media_frame->GetPts()) > _frame_size)
+	{
+		_current_pts = media_frame->GetPts();
+	}
 
-			// Append frame data into the buffer
-			if (media_frame->GetChannelCount() == 1)
-			{
-				// Just copy data into buffer
-				_buffer->Append(av_frame->data[0], av_frame->linesize[0]);
-			}
-			else if (media_frame->GetChannelCount() >= 2)
-			{
-				// Currently, OME's OPUS encoder supports up to 2 channels
-				switch (_format)
+	// Append frame data into the buffer
+	if (media_frame->GetChannelCount() == 1)
+	{
+		// Just copy data into buffer
+		_buffer->Append(av_frame->data[0], av_frame->linesize[0]);
+	}
+	else if (media_frame->GetChannelCount() >= 2)
+	{
+		// Currently, OME's OPUS encoder supports up to 2 channels
+		switch (_format)
+		{
+			case cmn::AudioSample::Format::S16P:
+			case cmn::AudioSample::Format::FltP: {
+				// Need to interleave if sample type is planar
+				off_t current_offset = _buffer->GetLength();
+
+				// Reserve extra spaces
+				// size_t total_bytes = av_frame->linesize[0] + av_frame->linesize[1];
+				auto total_bytes = static_cast<uint32_t>(media_frame->GetBytesPerSample() * media_frame->GetNbSamples()) * media_frame->GetChannelCount();
+				_buffer->SetLength(current_offset + total_bytes);
+
+				if (_format == cmn::AudioSample::Format::S16P)
+				{
+					// S16P
+					ov::Interleave<int16_t>(_buffer->GetWritableDataAs<uint8_t>() + current_offset, av_frame->data[0], av_frame->data[1], media_frame->GetNbSamples());
+					_format = cmn::AudioSample::Format::S16;
+				}
+				else
 				{
-					case cmn::AudioSample::Format::S16P:
-					case cmn::AudioSample::Format::FltP: {
-						// Need to interleave if sample type is planar
-						off_t current_offset = _buffer->GetLength();
-
-						// Reserve extra spaces
-						// size_t total_bytes = av_frame->linesize[0] + av_frame->linesize[1];
-						auto total_bytes = static_cast<uint32_t>(media_frame->GetBytesPerSample() * media_frame->GetNbSamples()) * media_frame->GetChannelCount();
-						_buffer->SetLength(current_offset + total_bytes);
-
-						if (_format == cmn::AudioSample::Format::S16P)
-						{
-							// S16P
-							ov::Interleave<int16_t>(_buffer->GetWritableDataAs<uint8_t>() + current_offset, av_frame->data[0], av_frame->data[1], media_frame->GetNbSamples());
-							_format = cmn::AudioSample::Format::S16;
-						}
-						else
-						{
-							// FltP
-							ov::Interleave<float>(_buffer->GetWritableDataAs<uint8_t>() + current_offset, av_frame->data[0], av_frame->data[1], media_frame->GetNbSamples());
-							_format = cmn::AudioSample::Format::Flt;
-						}
-						break;
-					}
-
-					case cmn::AudioSample::Format::S16:
-					case cmn::AudioSample::Format::Flt:
-						// Do not need to interleave if sample type is non-planar
-						_buffer->Append(av_frame->data[0], av_frame->linesize[0]);
-						break;
-
-					default:
-						logte("Not supported format: %d", _format);
-						break;
+					// FltP
+					ov::Interleave<float>(_buffer->GetWritableDataAs<uint8_t>() + current_offset, av_frame->data[0], av_frame->data[1], media_frame->GetNbSamples());
+					_format = cmn::AudioSample::Format::Flt;
 				}
+				break;
 			}
-		}
 
-		if (_buffer->GetLength() < bytes_to_encode)
-		{
-			// There is no data to encode
-			// logte("There is no data to encode");
-			continue;
+			case cmn::AudioSample::Format::S16:
+			case cmn::AudioSample::Format::Flt:
+				// Do not need to interleave if sample type is non-planar
+				_buffer->Append(av_frame->data[0], av_frame->linesize[0]);
+				break;
+
+			default:
+				logte("Not supported format: %d", _format);
+				break;
 		}
+	}
+
+	// Encode the buffered samples by <_frame_size> samples
+	while ((_buffer->GetLength() >= bytes_to_encode) && !_kill_flag)
+	{
 		OV_ASSERT2(_current_pts >= 0);
 		OV_ASSERT2(_buffer->GetLength() >= bytes_to_encode);
 
@@ -249,12 +219,19 @@ void EncoderOPUS::CodecThread()
 				break;
 
 			default:
-				continue;
+				logte("Not supported format: %d", _format);
+				_buffer->SetLength(0);
+				return;
 		}
 
 		if (encoded_bytes < 0)
 		{
 			logte("An error occurred while encode data %zu bytes. error:%d", _buffer->GetLength(), encoded_bytes);
+
+			// Drop the samples that could not be encoded
+			auto buffer = _buffer->GetWritableDataAs<uint8_t>();
+			::memmove(buffer, buffer + bytes_to_encode, _buffer->GetLength() - bytes_to_encode);
+			_buffer->SetLength(_buffer->GetLength() - bytes_to_encode);
 			continue;
 		}
 
@@ -268,7 +245,7 @@ void EncoderOPUS::CodecThread()
 
 		int64_t duration = _frame_size;
 
-		auto packet_buffer = std::make_shared<MediaPacket>(0, cmn::MediaType::Audio, 0, encoded, _current_pts, _current_pts, duration, MediaPacketFlag::Key);
+		auto packet_buffer = MediaPacket::Create(0, cmn::MediaType::Audio, 0, encoded, _current_pts, _current_pts, duration, MediaPacketFlag::Key);
 		packet_buffer->SetBitstreamFormat(cmn::BitstreamFormat::OPUS);
 		packet_buffer->SetPacketType(cmn::PacketType::RAW);
 
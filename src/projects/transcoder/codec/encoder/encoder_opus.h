@@ -41,7 +41,7 @@ public:
 
 	// void SendBuffer(std::shared_ptr<const MediaFrame> frame) override;
 
-	void CodecThread() override;
+	void EncodeFrame(std::shared_ptr<const MediaFrame> frame) override;
 
 private:
 	bool SetCodecParams() override;
@@ -62,98 +62,73 @@ bool EncoderPNG::Configure(std::shared_ptr<MediaTrack> context)
 		return false;
 	}
 
-	// Generates a thread that reads and encodes frames in the input_buffer queue and places them in the output queue.
-	try
-	{
-		_kill_flag = false;
+	return StartCodec();
+}
 
-		_codec_thread = std::thread(&EncoderPNG::CodecThread, this);
-		pthread_setname_np(_codec_thread.native_handle(), ov::String::FormatString("Enc%s", avcodec_get_name(GetCodecID())).CStr());
-	}
-	catch (const std::system_error &e)
+void EncoderPNG::EncodeFrame(std::shared_ptr<const MediaFrame> media_frame)
+{
+	///////////////////////////////////////////////////
+	// Request frame encoding to codec
+	///////////////////////////////////////////////////
+	auto av_frame = ffmpeg::Conv::ToAVFrame(cmn::MediaType::Video, media_frame);
+	if(!av_frame)
 	{
-		logte("Failed to start encoder thread.");
-		_kill_flag = true;
+		logte("Could not allocate the frame data");
+		return;
+	}
 
-		return false;
+	int ret = ::avcodec_send_frame(_codec_context, av_frame);
+	if (ret < 0)
+	{
+		logte("Error sending a frame for encoding : %d", ret);
 	}
 
-	return true;
-}
 
-void EncoderPNG::CodecThread()
-{
-	while (!_kill_flag)
+	///////////////////////////////////////////////////
+	// The encoded packet is taken from the codec.
+	///////////////////////////////////////////////////
+	while (true)
 	{
-		auto obj = _input_buffer.Dequeue();
-		if (obj.has_value() == false)
-			continue;
+		// Check frame is available
+		int ret = ::avcodec_receive_packet(_codec_context, _packet);
+		if (ret == AVERROR(EAGAIN))
+		{
+			// More packets are needed for encoding.
 
-		auto media_frame = std::move(obj.value());
+			// logte("Error receiving a packet for decoding : EAGAIN");
 
-		///////////////////////////////////////////////////
-		// Request frame encoding to codec
-		///////////////////////////////////////////////////
-		auto av_frame = ffmpeg::Conv::ToAVFrame(cmn::MediaType::Video, media_frame);
-		if(!av_frame)
-		{
-			logte("Could not allocate the frame data");
 			break;
 		}
-
-		int ret = ::avcodec_send_frame(_codec_context, av_frame);
-		if (ret < 0)
+		else if (ret == AVERROR_EOF && ret < 0)
 		{
-			logte("Error sending a frame for encoding : %d", ret);
+			logte("Error receiving a packet for decoding : %d", ret);
+			break;
 		}
-
-
-		///////////////////////////////////////////////////
-		// The encoded packet is taken from the codec.
-		///////////////////////////////////////////////////
-		while (true)
+		else
 		{
-			// Check frame is available
-			int ret = ::avcodec_receive_packet(_codec_context, _packet);
-			if (ret == AVERROR(EAGAIN))
-			{
-				// More packets are needed for encoding.
+#if 0
+			logte("encoded size(png) : %d", _packet->size);
 
-				// logte("Error receiving a packet for decoding : EAGAIN");
+			std::ofstream writeFile; 
+			writeFile.open("test.png");
 
-				break;
-			}
-			else if (ret == AVERROR_EOF && ret < 0)
+			if (writeFile.is_open())   
 			{
-				logte("Error receiving a packet for decoding : %d", ret);
-				break;
+				writeFile.write((const char*)_packet->data, _packet->size);    
 			}
-			else
-			{
-#if 0
-				logte("encoded size(png) : %d", _packet->size);
-
-				std::ofstream writeFile; 
-				writeFile.open("test.png");
-
-				if (writeFile.is_open())   
-				{
-					writeFile.write((const char*)_packet->data, _packet->size);    
-				}
-				writeFile.close();
+			writeFile.close();
 
 #endif
-				auto media_packet = ffmpeg::Conv::ToMediaPacket(_packet, cmn::MediaType::Video, cmn::BitstreamFormat::PNG, cmn::PacketType::RAW);
-				if (media_packet == nullptr)
-				{
-					logte("Could not allocate the media packet");
-					break;
-				}
+			auto media_packet = ffmpeg::Conv::ToMediaPacket(_packet, cmn::MediaType::Video, cmn::BitstreamFormat::PNG, cmn::PacketType::RAW);
+			if (media_packet == nullptr)
+			{
+				logte("Could not allocate the media packet");
+				break;
+			}
 
-				::av_packet_unref(_packet);
+			::av_packet_unref(_packet);
 
-				SendOutputBuffer(std::move(media_packet));				
-			}
+			SendOutputBuffer(std::move(media_packet));				
 		}
 	}
 }
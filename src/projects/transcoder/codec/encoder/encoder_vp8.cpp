@@ -28,10 +28,10 @@ bool EncoderVP8::SetCodecParams()
 	
 	// VP8 does not support bframe
 
-	// -1(Default) => FFMIN(FFMAX(4, av_cpu_count() / 3), 8) 
+	// -1(Default) => FFMIN(FFMAX(4, (CPUs of the Encoder pool) / 3), 8)
 	// 0 => Auto
 	// >1 => Set
-	_codec_context->thread_count = GetRefTrack()->GetThreadCount() < 0 ? FFMIN(FFMAX(4, av_cpu_count() / 3), 8) : GetRefTrack()->GetThreadCount();
+	_codec_context->thread_count = GetRefTrack()->GetThreadCount() < 0 ? FFMIN(FFMAX(4, ov::ThreadTopology::GetInstance()->GetCpuCount(OV_THREAD_POOL_ENCODER) / 3), 8) : GetRefTrack()->GetThreadCount();
 
 	// Preset
 	auto preset = GetRefTrack()->GetPreset().LowerCaseString();
@@ -59,6 +59,13 @@ bool EncoderVP8::SetCodecParams()
 		}
 	}
 
+	if (IsComplexityReduced())
+	{
+		// The fastest settings for the realtime encoding (cpu-used: 0 ~ 16)
+		::av_opt_set(_codec_context->priv_data, "quality", "realtime", 0);
+		::av_opt_set_int(_codec_context->priv_data, "cpu-used", 16, 0);
+	}
+
 	return true;
 }
 
@@ -91,86 +98,69 @@ bool EncoderVP8::Configure(std::shared_ptr<MediaTrack> context)
 		return false;
 	}
 
-	if (::avcodec_open2(_codec_context, codec, nullptr) < 0)
+	// The threads created by the encoder inherit the CPU affinity of the Encoder pool
+	int result;
 	{
-		logte("Could not open codec");
-		return false;
+		ov::ThreadTopology::ScopedAffinity scoped_affinity(OV_THREAD_POOL_ENCODER);
+		result = ::avcodec_open2(_codec_context, codec, nullptr);
 	}
 
-	try
+	if (result < 0)
 	{
-		_kill_flag = false;
-
-		_codec_thread = std::thread(&EncoderVP8::CodecThread, this);
-		pthread_setname_np(_codec_thread.native_handle(), ov::String::FormatString("Enc%s", avcodec_get_name(GetCodecID())).CStr());
-	}
-	catch (const std::system_error &e)
-	{
-		logte("Failed to start encoder thread.");
-		_kill_flag = true;
-
+		logte("Could not open codec");
 		return false;
 	}
 
-	return true;
+	return StartCodec();
 }
 
-void EncoderVP8::CodecThread()
+void EncoderVP8::EncodeFrame(std::shared_ptr<const MediaFrame> media_frame)
 {
-	while (!_kill_flag)
+	///////////////////////////////////////////////////
+	// Request frame encoding to codec
+	///////////////////////////////////////////////////
+	auto av_frame = ffmpeg::Conv::ToAVFrame(cmn::MediaType::Video, media_frame);
+	if (!av_frame)
 	{
-		auto obj = _input_buffer.Dequeue();
-		if (obj.has_value() == false)
-			continue;
+		logte("Could not allocate the frame data");
+		return;
+	}
 
-		auto media_frame = std::move(obj.value());
+	int ret = ::avcodec_send_frame(_codec_context, av_frame);
+	if (ret < 0)
+	{
+		logte("Error sending a frame for encoding : %d", ret);
+	}
 
-		///////////////////////////////////////////////////
-		// Request frame encoding to codec
-		///////////////////////////////////////////////////
-		auto av_frame = ffmpeg::Conv::ToAVFrame(cmn::MediaType::Video, media_frame);
-		if (!av_frame)
+	///////////////////////////////////////////////////
+	// The encoded packet is taken from the codec.
+	///////////////////////////////////////////////////
+	while (true)
+	{
+		// Check frame is available
+		int ret = ::avcodec_receive_packet(_codec_context, _packet);
+		if (ret == AVERROR(EAGAIN))
 		{
-			logte("Could not allocate the frame data");
+			// More packets are needed for encoding.
 			break;
 		}
-
-		int ret = ::avcodec_send_frame(_codec_context, av_frame);
-		if (ret < 0)
+		else if (ret == AVERROR_EOF && ret < 0)
 		{
-			logte("Error sending a frame for encoding : %d", ret);
+			logte("Error receiving a packet for decoding : %d", ret);
+			break;
 		}
-
-		///////////////////////////////////////////////////
-		// The encoded packet is taken from the codec.
-		///////////////////////////////////////////////////
-		while (true)
+		else
 		{
-			// Check frame is available
-			int ret = ::avcodec_receive_packet(_codec_context, _packet);
-			if (ret == AVERROR(EAGAIN))
-			{
-				// More packets are needed for encoding.
-				break;
-			}
-			else if (ret == AVERROR_EOF && ret < 0)
+			auto media_packet = ffmpeg::Conv::ToMediaPacket(_packet, cmn::MediaType::Video, cmn::BitstreamFormat::VP8, cmn::PacketType::RAW);
+			if (media_packet == nullptr)
 			{
-				logte("Error receiving a packet for decoding : %d", ret);
+				logte("Could not allocate the media packet");
 				break;
 			}
-			else
-			{
-				auto media_packet = ffmpeg::Conv::ToMediaPacket(_packet, cmn::MediaType::Video, cmn::BitstreamFormat::VP8, cmn::PacketType::RAW);
-				if (media_packet == nullptr)
-				{
-					logte("Could not allocate the media packet");
-					break;
-				}
 
-				::av_packet_unref(_packet);
+			::av_packet_unref(_packet);
 
-				SendOutputBuffer(std::move(media_packet));
-			}
+			SendOutputBuffer(std::move(media_packet));
 		}
 	}
 }
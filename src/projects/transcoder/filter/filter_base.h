@@ -17,6 +17,7 @@
 
 #include "../codec/codec_base.h"
 #include "../transcoder_context.h"
+#include "../transcoder_executor.h"
 
 #include <base/info/application.h>
 #include <base/info/media_track.h>
@@ -71,6 +72,12 @@ public:
 		_input_buffer.SetUrn(urn);
 	}
 
+	// If the strand is set before Start(), the frames are filtered by the tasks of the strand instead of _thread_work
+	void SetStrand(const std::shared_ptr<TranscoderExecutor::Strand> &strand)
+	{
+		_strand = strand;
+	}
+
 	void SetState(State state)
 	{
 		_state = state;
@@ -87,6 +94,22 @@ public:
 		{
 			_input_buffer.Enqueue(std::move(buffer));
 
+			if (_strand != nullptr)
+			{
+				_strand->Post([this]() {
+					auto obj = _input_buffer.Dequeue(0);
+					if ((obj.has_value() == false) || _kill_flag)
+					{
+						return;
+					}
+
+					if (ProcessFrame(std::move(obj.value())) == false)
+					{
+						_kill_flag = true;
+					}
+				});
+			}
+
 			return true;
 		}
 
@@ -94,6 +117,68 @@ public:
 	}
 
 protected:
+	// Filters a frame, and sends the filtered frames to the complete handler
+	// Returns false if the filter cannot process the frames anymore
+	virtual bool ProcessFrame(std::shared_ptr<MediaFrame> media_frame) = 0;
+
+	// Starts _thread_work (or nothing if the filter runs on the strand)
+	bool StartWorker(const char *thread_name)
+	{
+		_kill_flag = false;
+
+		if (_strand != nullptr)
+		{
+			return true;
+		}
+
+		try
+		{
+			_thread_work = std::thread(&FilterBase::WorkerThread, this);
+			pthread_setname_np(_thread_work.native_handle(), thread_name);
+		}
+		catch (const std::system_error &e)
+		{
+			_kill_flag = true;
+			return false;
+		}
+
+		return true;
+	}
+
+	void StopWorker()
+	{
+		_kill_flag = true;
+
+		_input_buffer.Stop();
+
+		if (_strand != nullptr)
+		{
+			_strand->Stop();
+		}
+
+		if (_thread_work.joinable())
+		{
+			_thread_work.join();
+		}
+	}
+
+	void WorkerThread()
+	{
+		while (!_kill_flag)
+		{
+			auto obj = _input_buffer.Dequeue();
+			if (obj.has_value() == false)
+			{
+				continue;
+			}
+
+			if (ProcessFrame(std::move(obj.value())) == false)
+			{
+				break;
+			}
+		}
+	}
+
 
 	std::atomic<State> _state = State::CREATED;
 
@@ -117,6 +202,7 @@ protected:
 
 	bool _kill_flag = false;
 	std::thread _thread_work;
+	std::shared_ptr<TranscoderExecutor::Strand> _strand;
 
 	CompleteHandler _complete_handler;
 };
@@ -15,7 +15,11 @@
 
 #define MAX_QUEUE_SIZE 500
 
-FilterResampler::FilterResampler()
+// If the PTS of the input jumps more than this (ms), the native resampler restarts from the PTS
+#define NATIVE_DISCONTINUITY_THRESHOLD 100
+
+FilterResampler::FilterResampler(bool use_native)
+	: _use_native(use_native)
 {
 	_frame = ::av_frame_alloc();
 
@@ -50,6 +54,11 @@ bool FilterResampler::Configure(const std::shared_ptr<MediaTrack> &input_track,
 	_input_track = input_track;
 	_output_track = output_track;
 
+	if (ConfigureNative(input_track, output_track))
+	{
+		return true;
+	}
+
 	const AVFilter *abuffersrc = ::avfilter_get_by_name("abuffer");
 	const AVFilter *abuffersink = ::avfilter_get_by_name("abuffersink");
 	int ret;
@@ -171,17 +180,8 @@ bool FilterResampler::Configure(const std::shared_ptr<MediaTrack> &input_track,
 bool FilterResampler::Start()
 {
 	// Generates a thread that reads and encodes frames in the input_buffer queue and places them in the output queue.
-	try
+	if (StartWorker("Resampler") == false)
 	{
-		_kill_flag = false;
-
-		_thread_work = std::thread(&FilterResampler::WorkerThread, this);
-		pthread_setname_np(_thread_work.native_handle(), "Resampler");
-	}
-	catch (const std::system_error &e)
-	{
-		_kill_flag = true;
-
 		SetState(State::ERROR);
 
 		logte("Failed to start resample filter thread.");
@@ -194,94 +194,365 @@ bool FilterResampler::Start()
 
 void FilterResampler::Stop()
 {
-	_kill_flag = true;
+	StopWorker();
 
-	_input_buffer.Stop();
-
-	if (_thread_work.joinable())
-	{
-		_thread_work.join();
-
-		logtd("resampler filter thread has ended");
-	}
+	logtd("resampler filter thread has ended");
 
 	SetState(State::STOPPED);
 }
 
-void FilterResampler::WorkerThread()
+bool FilterResampler::ProcessFrame(std::shared_ptr<MediaFrame> media_frame)
 {
-	logtd("Start resampler filter thread.");
+	if (_native_resampler != nullptr)
+	{
+		return ProcessFrameNative(media_frame);
+	}
 
 	int ret;
 
+	auto av_frame = ffmpeg::Conv::ToAVFrame(cmn::MediaType::Video, media_frame);
+	if (!av_frame)
+	{
+		logte("Could not allocate the frame data");
+
+		SetState(State::ERROR);
+
+		return false;
+	}
+
+	ret = ::av_buffersrc_write_frame(_buffersrc_ctx, av_frame);
+	if (ret < 0)
+	{
+		logte("An error occurred while feeding the audio filtergraph: pts: %lld, linesize: %d, srate: %d, layout: %d, channels: %d, format: %d, rq: %d", _frame->pts, _frame->linesize[0], _frame->sample_rate, _frame->channel_layout, _frame->channels, _frame->format, _input_buffer.Size());
+
+		return true;
+	}
+
 	while (!_kill_flag)
 	{
-		auto obj = _input_buffer.Dequeue();
-		if (obj.has_value() == false)
+		int ret = ::av_buffersink_get_frame(_buffersink_ctx, _frame);
+
+		if (ret == AVERROR(EAGAIN))
 		{
-			continue;
+			break;
 		}
+		else if (ret == AVERROR_EOF)
+		{
+			logte("Error receiving filtered frame. error(EOF)");
 
-		auto media_frame = std::move(obj.value());
+			SetState(State::ERROR);
 
-		auto av_frame = ffmpeg::Conv::ToAVFrame(cmn::MediaType::Video, media_frame);
-		if (!av_frame)
+			break;
+		}
+		else if (ret < 0)
 		{
-			logte("Could not allocate the frame data");
+			logte("Error receiving filtered frame. error(%d)", ret);
 
 			SetState(State::ERROR);
 
 			break;
 		}
-
-		ret = ::av_buffersrc_write_frame(_buffersrc_ctx, av_frame);
-		if (ret < 0)
+		else
 		{
-			logte("An error occurred while feeding the audio filtergraph: pts: %lld, linesize: %d, srate: %d, layout: %d, channels: %d, format: %d, rq: %d", _frame->pts, _frame->linesize[0], _frame->sample_rate, _frame->channel_layout, _frame->channels, _frame->format, _input_buffer.Size());
+			auto output_frame = ffmpeg::Conv::ToMediaFrame(cmn::MediaType::Audio, _frame);
+			::av_frame_unref(_frame);
+			if (output_frame == nullptr)
+			{
+				logte("Could not allocate the frame data");
 
-			continue;
+				continue;
+			}
+
+			if (_complete_handler != nullptr && _kill_flag == false)
+			{
+				_complete_handler(std::move(output_frame));
+			}
 		}
+	}
 
-		while (!_kill_flag)
+	return true;
+}
+
+bool FilterResampler::ConfigureNative(const std::shared_ptr<MediaTrack> &input_track, const std::shared_ptr<MediaTrack> &output_track)
+{
+	if (_use_native == false)
+	{
+		return false;
+	}
+
+	auto is_supported_format = [](cmn::AudioSample::Format format) -> bool {
+		switch (format)
 		{
-			int ret = ::av_buffersink_get_frame(_buffersink_ctx, _frame);
+			case cmn::AudioSample::Format::S16:
+			case cmn::AudioSample::Format::S16P:
+			case cmn::AudioSample::Format::Flt:
+			case cmn::AudioSample::Format::FltP:
+				return true;
+
+			default:
+				return false;
+		}
+	};
+
+	auto is_supported_layout = [](const cmn::AudioChannel &channel) -> bool {
+		return (channel.GetLayout() == cmn::AudioChannel::Layout::LayoutMono) || (channel.GetLayout() == cmn::AudioChannel::Layout::LayoutStereo);
+	};
+
+	auto input_format = input_track->GetSample().GetFormat();
+	auto output_format = output_track->GetSample().GetFormat();
+
+	if ((is_supported_format(input_format) == false) || (is_supported_format(output_format) == false) ||
+		(is_supported_layout(input_track->GetChannel()) == false) || (is_supported_layout(output_track->GetChannel()) == false) ||
+		(output_track->GetAudioSamplesPerFrame() <= 0) || (input_track->GetTimeBase().GetNum() <= 0) || (output_track->GetTimeBase().GetNum() <= 0))
+	{
+		return false;
+	}
+
+	_native_input_channels = static_cast<int>(input_track->GetChannel().GetCounts());
+	_native_output_channels = static_cast<int>(output_track->GetChannel().GetCounts());
+
+	// Downmixing is done before resampling, and upmixing is done after resampling
+	auto resampler = std::make_shared<PcmResampler>();
+	if (resampler->Configure(input_track->GetSampleRate(), output_track->GetSampleRate(), std::min(_native_input_channels, _native_output_channels)) == false)
+	{
+		return false;
+	}
+
+	_native_resampler = resampler;
+	_native_input_format = input_format;
+	_native_output_format = output_format;
+	_native_samples_per_frame = output_track->GetAudioSamplesPerFrame();
 
-			if (ret == AVERROR(EAGAIN))
+	logti("Resampler is enabled for track #%u using the native resampler (%s). input: %dHz/%s/%s, output: %dHz/%s/%s, %d samples per frame",
+		  input_track->GetId(), ov::pcm::StringFromSimdLevel(ov::pcm::GetSimdLevel()),
+		  input_track->GetSampleRate(), input_track->GetSample().GetName(), input_track->GetChannel().GetName(),
+		  output_track->GetSampleRate(), output_track->GetSample().GetName(), output_track->GetChannel().GetName(),
+		  _native_samples_per_frame);
+
+	return true;
+}
+
+bool FilterResampler::ProcessFrameNative(const std::shared_ptr<MediaFrame> &media_frame)
+{
+	auto av_frame = ffmpeg::Conv::ToAVFrame(cmn::MediaType::Audio, media_frame);
+	if (av_frame == nullptr)
+	{
+		logte("Could not allocate the frame data");
+
+		SetState(State::ERROR);
+
+		return false;
+	}
+
+	if ((static_cast<cmn::AudioSample::Format>(av_frame->format) != _native_input_format) ||
+		(av_frame->channels != _native_input_channels) ||
+		(av_frame->sample_rate != _native_resampler->GetInputRate()))
+	{
+		logte("The format of the audio frame is changed: format: %d, channels: %d, samplerate: %d (expected: %d, %d, %d)",
+			  av_frame->format, av_frame->channels, av_frame->sample_rate,
+			  static_cast<int>(_native_input_format), _native_input_channels, _native_resampler->GetInputRate());
+
+		return true;
+	}
+
+	int samples = av_frame->nb_samples;
+	AVRational input_timebase = ffmpeg::Conv::TimebaseToAVRational(_input_track->GetTimeBase());
+	AVRational output_timebase = ffmpeg::Conv::TimebaseToAVRational(_output_track->GetTimeBase());
+	int64_t pts = media_frame->GetPts();
+
+	if (pts >= 0)
+	{
+		int64_t threshold = ::av_rescale_q(NATIVE_DISCONTINUITY_THRESHOLD, (AVRational){1, 1000}, input_timebase);
+
+		if ((_native_expected_pts < 0) || (std::abs(pts - _native_expected_pts) > threshold))
+		{
+			if (_native_expected_pts >= 0)
 			{
-				break;
+				logtw("The PTS of the audio frame jumped from %" PRId64 " to %" PRId64 ", the resampler restarts", _native_expected_pts, pts);
 			}
-			else if (ret == AVERROR_EOF)
+
+			_native_resampler->Reset();
+
+			for (auto &output : _native_output)
 			{
-				logte("Error receiving filtered frame. error(EOF)");
+				output.clear();
+			}
+
+			_native_base_pts = ::av_rescale_q(pts, input_timebase, output_timebase);
+			_native_output_count = 0;
+		}
+
+		_native_expected_pts = pts + ::av_rescale_q(samples, (AVRational){1, av_frame->sample_rate}, input_timebase);
+	}
 
-				SetState(State::ERROR);
+	// Converts the input to planar float
+	const float *planes[PcmResampler::MAX_CHANNELS] = {nullptr, nullptr};
 
-				break;
+	for (int channel = 0; channel < _native_input_channels; channel++)
+	{
+		_native_input[channel].resize(samples);
+	}
+
+	switch (_native_input_format)
+	{
+		case cmn::AudioSample::Format::FltP:
+			for (int channel = 0; channel < _native_input_channels; channel++)
+			{
+				planes[channel] = reinterpret_cast<const float *>(av_frame->data[channel]);
 			}
-			else if (ret < 0)
+			break;
+
+		case cmn::AudioSample::Format::Flt:
+			if (_native_input_channels == 2)
+			{
+				ov::pcm::DeinterleaveStereo(_native_input[0].data(), _native_input[1].data(), reinterpret_cast<const float *>(av_frame->data[0]), samples);
+				planes[0] = _native_input[0].data();
+				planes[1] = _native_input[1].data();
+			}
+			else
 			{
-				logte("Error receiving filtered frame. error(%d)", ret);
+				planes[0] = reinterpret_cast<const float *>(av_frame->data[0]);
+			}
+			break;
 
-				SetState(State::ERROR);
+		case cmn::AudioSample::Format::S16P:
+			for (int channel = 0; channel < _native_input_channels; channel++)
+			{
+				ov::pcm::ConvertS16ToFloat(_native_input[channel].data(), reinterpret_cast<const int16_t *>(av_frame->data[channel]), samples);
+				planes[channel] = _native_input[channel].data();
+			}
+			break;
 
-				break;
+		case cmn::AudioSample::Format::S16:
+			if (_native_input_channels == 2)
+			{
+				ov::pcm::DeinterleaveStereoFromS16(_native_input[0].data(), _native_input[1].data(), reinterpret_cast<const int16_t *>(av_frame->data[0]), samples);
+				planes[1] = _native_input[1].data();
 			}
 			else
 			{
-				auto output_frame = ffmpeg::Conv::ToMediaFrame(cmn::MediaType::Audio, _frame);
-				::av_frame_unref(_frame);
-				if (output_frame == nullptr)
-				{
-					logte("Could not allocate the frame data");
-
-					continue;
-				}
-
-				if (_complete_handler != nullptr && _kill_flag == false)
-				{
-					_complete_handler(std::move(output_frame));
-				}
+				ov::pcm::ConvertS16ToFloat(_native_input[0].data(), reinterpret_cast<const int16_t *>(av_frame->data[0]), samples);
 			}
+			planes[0] = _native_input[0].data();
+			break;
+
+		default:
+			OV_ASSERT2(false);
+			return true;
+	}
+
+	if ((_native_input_channels == 2) && (_native_output_channels == 1))
+	{
+		ov::pcm::DownmixStereo(_native_input[0].data(), planes[0], planes[1], samples);
+		planes[0] = _native_input[0].data();
+	}
+
+	_native_resampler->Process(planes, samples, _native_output);
+
+	while ((_native_output[0].size() >= static_cast<size_t>(_native_samples_per_frame)) && (_kill_flag == false))
+	{
+		auto output_frame = PopNativeFrame(_native_samples_per_frame);
+		if (output_frame == nullptr)
+		{
+			logte("Could not allocate the frame data");
+
+			continue;
+		}
+
+		if (_complete_handler != nullptr && _kill_flag == false)
+		{
+			_complete_handler(std::move(output_frame));
 		}
 	}
+
+	return true;
+}
+
+std::shared_ptr<MediaFrame> FilterResampler::PopNativeFrame(int samples)
+{
+	int output_rate = _native_resampler->GetOutputRate();
+	AVRational output_timebase = ffmpeg::Conv::TimebaseToAVRational(_output_track->GetTimeBase());
+
+	// Channels of _native_output (mono is upmixed to stereo here)
+	int resampled_channels = std::min(_native_input_channels, _native_output_channels);
+	const float *left = _native_output[0].data();
+	const float *right = (resampled_channels == 2) ? _native_output[1].data() : left;
+
+	AVFrame *frame = ::av_frame_alloc();
+	if (frame == nullptr)
+	{
+		return nullptr;
+	}
+
+	frame->format = static_cast<int>(_native_output_format);
+	frame->nb_samples = samples;
+	frame->sample_rate = output_rate;
+	frame->channel_layout = (_native_output_channels == 2) ? AV_CH_LAYOUT_STEREO : AV_CH_LAYOUT_MONO;
+	frame->channels = _native_output_channels;
+	frame->pts = _native_base_pts + ::av_rescale_q(_native_output_count, (AVRational){1, output_rate}, output_timebase);
+	frame->pkt_duration = ::av_rescale_q(samples, (AVRational){1, output_rate}, output_timebase);
+
+	if (::av_frame_get_buffer(frame, 0) < 0)
+	{
+		::av_frame_free(&frame);
+		return nullptr;
+	}
+
+	switch (_native_output_format)
+	{
+		case cmn::AudioSample::Format::FltP:
+			::memcpy(frame->data[0], left, samples * sizeof(float));
+			if (_native_output_channels == 2)
+			{
+				::memcpy(frame->data[1], right, samples * sizeof(float));
+			}
+			break;
+
+		case cmn::AudioSample::Format::Flt:
+			if (_native_output_channels == 2)
+			{
+				ov::pcm::InterleaveStereo(reinterpret_cast<float *>(frame->data[0]), left, right, samples);
+			}
+			else
+			{
+				::memcpy(frame->data[0], left, samples * sizeof(float));
+			}
+			break;
+
+		case cmn::AudioSample::Format::S16P:
+			ov::pcm::ConvertFloatToS16(reinterpret_cast<int16_t *>(frame->data[0]), left, samples);
+			if (_native_output_channels == 2)
+			{
+				ov::pcm::ConvertFloatToS16(reinterpret_cast<int16_t *>(frame->data[1]), right, samples);
+			}
+			break;
+
+		case cmn::AudioSample::Format::S16:
+			if (_native_output_channels == 2)
+			{
+				ov::pcm::InterleaveStereoToS16(reinterpret_cast<int16_t *>(frame->data[0]), left, right, samples);
+			}
+			else
+			{
+				ov::pcm::ConvertFloatToS16(reinterpret_cast<int16_t *>(frame->data[0]), left, samples);
+			}
+			break;
+
+		default:
+			OV_ASSERT2(false);
+			break;
+	}
+
+	for (int channel = 0; channel < resampled_channels; channel++)
+	{
+		auto &output = _native_output[channel];
+		output.erase(output.begin(), output.begin() + samples);
+	}
+
+	_native_output_count += samples;
+
+	auto output_frame = ffmpeg::Conv::ToMediaFrame(cmn::MediaType::Audio, frame);
+	::av_frame_free(&frame);
+
+	return output_frame;
 }
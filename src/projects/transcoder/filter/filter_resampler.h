@@ -13,16 +13,47 @@
 #include "base/mediarouter/media_buffer.h"
 #include "base/mediarouter/media_type.h"
 #include "filter_base.h"
+#include "pcm_resampler.h"
 
 class FilterResampler : public FilterBase
 {
 public:
-	FilterResampler();
+	// use_native: Use PcmResampler for the common conversions (see <OutputProfiles><NativeResampler>)
+	explicit FilterResampler(bool use_native);
 	~FilterResampler();
 
 	bool Configure(const std::shared_ptr<MediaTrack> &input_track, const std::shared_ptr<MediaTrack> &output_track) override;
 	bool Start() override;
 	void Stop() override;
 
-	void WorkerThread();
+protected:
+	bool ProcessFrame(std::shared_ptr<MediaFrame> media_frame) override;
+
+	// If _use_native is true, the common conversions (mono/stereo, S16/FLT, planar/packed) are done by PcmResampler and
+	// the SIMD kernels of ov::pcm instead of the filter graph. Unlike aresample=async of the filter graph, PcmResampler
+	// does not compensate the drift of the timestamps (it restarts from the PTS if the input jumps).
+	bool ConfigureNative(const std::shared_ptr<MediaTrack> &input_track, const std::shared_ptr<MediaTrack> &output_track);
+	bool ProcessFrameNative(const std::shared_ptr<MediaFrame> &media_frame);
+	// Makes a frame from the first <samples> samples of _native_output
+	std::shared_ptr<MediaFrame> PopNativeFrame(int samples);
+
+	bool _use_native = false;
+	std::shared_ptr<PcmResampler> _native_resampler;
+	cmn::AudioSample::Format _native_input_format = cmn::AudioSample::Format::None;
+	cmn::AudioSample::Format _native_output_format = cmn::AudioSample::Format::None;
+	int _native_input_channels = 0;
+	int _native_output_channels = 0;
+	int _native_samples_per_frame = 0;
+
+	// Input samples converted to planar float
+	std::vector<float> _native_input[PcmResampler::MAX_CHANNELS];
+	// Resampled samples that are not sent yet
+	std::vector<float> _native_output[PcmResampler::MAX_CHANNELS];
+
+	// PTS of the first output sample after the (re)start (output timebase)
+	int64_t _native_base_pts = 0;
+	// Number of the output samples sent after the (re)start
+	int64_t _native_output_count = 0;
+	// PTS of the next input frame if it is contiguous (input timebase)
+	int64_t _native_expected_pts = -1;
 };
@@ -138,7 +138,10 @@ bool FilterRescaler::Configure(const std::shared_ptr<MediaTrack> &input_track, c
 	std::vector<ov::String> filters;
 
 	// 2. Framerate
-	if (output_track->GetFrameRateByConfig() > 0.0f)
+	//
+	// If only the key frames are decoded, the transcoder already drops them to fit the framerate,
+	// so the fps filter must not duplicate the frames
+	if ((output_track->GetFrameRateByConfig() > 0.0f) && (input_track->IsKeyFrameDecodeOnly() == false))
 	{
 		filters.push_back(ov::String::FormatString("fps=fps=%.2f:round=near", output_track->GetFrameRateByConfig()));
 	}
@@ -262,16 +265,8 @@ bool FilterRescaler::Configure(const std::shared_ptr<MediaTrack> &input_track, c
 bool FilterRescaler::Start()
 {
 	// Generates a thread that reads and encodes frames in the input_buffer queue and places them in the output queue.
-	try
+	if (StartWorker("Rescaler") == false)
 	{
-		_kill_flag = false;
-
-		_thread_work = std::thread(&FilterRescaler::WorkerThread, this);
-		pthread_setname_np(_thread_work.native_handle(), "Rescaler");
-	}
-	catch (const std::system_error &e)
-	{
-		_kill_flag = true;
 		SetState(State::ERROR);
 
 		logte("Failed to start rescaling filter thread");
@@ -279,97 +274,79 @@ bool FilterRescaler::Start()
 		return false;
 	}
 
+	SetState(State::STARTED);
+
 	return true;
 }
 
 void FilterRescaler::Stop()
 {
-	_kill_flag = true;
-
-	_input_buffer.Stop();
-
-	if (_thread_work.joinable())
-	{
-		_thread_work.join();
-	}
+	StopWorker();
 
 	SetState(State::STOPPED);
 }
 
-void FilterRescaler::WorkerThread()
+bool FilterRescaler::ProcessFrame(std::shared_ptr<MediaFrame> media_frame)
 {
-	logtd("Start rescaling filter thread");
 	int ret;
 
+	auto av_frame = ffmpeg::Conv::ToAVFrame(cmn::MediaType::Video, media_frame);
+	if (!av_frame)
+	{
+		logte("Could not allocate the video frame data");
 
-	SetState(State::STARTED);
+		SetState(State::ERROR);
+
+		return false;
+	}
+
+	ret = ::av_buffersrc_write_frame(_buffersrc_ctx, av_frame);
+	if (ret < 0)
+	{
+		logte("An error occurred while feeding to filtergraph: format: %d, pts: %lld, linesize: %d, queue.size: %d", av_frame->format, av_frame->pts, av_frame->linesize[0], _input_buffer.Size());
+
+		return true;
+	}
 
 	while (!_kill_flag)
 	{
-		auto obj = _input_buffer.Dequeue();
-		if (obj.has_value() == false)
+		ret = ::av_buffersink_get_frame(_buffersink_ctx, _frame);
+		if (ret == AVERROR(EAGAIN))
 		{
-			continue;
+			break;
 		}
-
-		auto media_frame = std::move(obj.value());
-
-		auto av_frame = ffmpeg::Conv::ToAVFrame(cmn::MediaType::Video, media_frame);
-		if (!av_frame)
+		else if (ret == AVERROR_EOF)
 		{
-			logte("Could not allocate the video frame data");
+			logte("Error receiving filtered frame. error(EOF)");
 
 			SetState(State::ERROR);
 
 			break;
 		}
-
-		ret = ::av_buffersrc_write_frame(_buffersrc_ctx, av_frame);
-		if (ret < 0)
+		else if (ret < 0)
 		{
-			logte("An error occurred while feeding to filtergraph: format: %d, pts: %lld, linesize: %d, queue.size: %d", av_frame->format, av_frame->pts, av_frame->linesize[0], _input_buffer.Size());
+			logte("Error receiving filtered frame. error(%d)", ret);
 
-			continue;
-		}
+			SetState(State::ERROR);
 
-		while (!_kill_flag)
+			break;
+		}
+		else
 		{
-			ret = ::av_buffersink_get_frame(_buffersink_ctx, _frame);
-			if (ret == AVERROR(EAGAIN))
+			_frame->pict_type = AV_PICTURE_TYPE_NONE;
+			auto output_frame = ffmpeg::Conv::ToMediaFrame(cmn::MediaType::Video, _frame);
+			::av_frame_unref(_frame);
+			if (output_frame == nullptr)
 			{
-				break;
+				continue;
 			}
-			else if (ret == AVERROR_EOF)
-			{
-				logte("Error receiving filtered frame. error(EOF)");
 
-				SetState(State::ERROR);
-
-				break;
-			}
-			else if (ret < 0)
+			if (_complete_handler != nullptr && _kill_flag == false)
 			{
-				logte("Error receiving filtered frame. error(%d)", ret);
-
-				SetState(State::ERROR);
-
-				break;
-			}
-			else
-			{
-				_frame->pict_type = AV_PICTURE_TYPE_NONE;
-				auto output_frame = ffmpeg::Conv::ToMediaFrame(cmn::MediaType::Video, _frame);
-				::av_frame_unref(_frame);
-				if (output_frame == nullptr)
-				{
-					continue;
-				}
-
-				if (_complete_handler != nullptr && _kill_flag == false)
-				{
-					_complete_handler(std::move(output_frame));
-				}
+				_complete_handler(std::move(output_frame));
 			}
 		}
 	}
+
+	return true;
 }
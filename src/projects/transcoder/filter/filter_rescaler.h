@@ -24,5 +24,6 @@ public:
 	bool Start() override;
 	void Stop() override;
 
-	void WorkerThread();
+protected:
+	bool ProcessFrame(std::shared_ptr<MediaFrame> media_frame) override;
 };
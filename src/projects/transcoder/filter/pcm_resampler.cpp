@@ -0,0 +1,204 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by agent
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "pcm_resampler.h"
+
+#include <base/ovlibrary/ovlibrary.h>
+#include <math.h>
+
+#include <numeric>
+
+// Same as the default of libswresample (filter_size: 32, cutoff: 0.97, kaiser_beta: 9)
+#define HALF_TAPS 16
+#define CUTOFF 0.97
+#define KAISER_BETA 9.0
+
+// Limits the size of the coefficients (up to 1MB)
+#define MAX_PHASES 1024
+#define MAX_TAPS 256
+
+namespace
+{
+	// Modified Bessel function of the first kind (order 0)
+	double BesselI0(double x)
+	{
+		double sum = 1.0;
+		double term = 1.0;
+
+		for (int k = 1; k < 50; k++)
+		{
+			term *= (x / (2.0 * k)) * (x / (2.0 * k));
+			sum += term;
+
+			if (term < (sum * 1e-12))
+			{
+				break;
+			}
+		}
+
+		return sum;
+	}
+}  // namespace
+
+bool PcmResampler::Configure(int32_t input_rate, int32_t output_rate, int channels)
+{
+	if ((input_rate <= 0) || (output_rate <= 0) || (channels <= 0) || (channels > MAX_CHANNELS))
+	{
+		return false;
+	}
+
+	auto gcd = std::gcd(input_rate, output_rate);
+	int up = output_rate / gcd;
+	int down = input_rate / gcd;
+
+	// Downsampling needs a longer filter, since the cutoff is lowered to the nyquist frequency of the output
+	double ratio = std::min(1.0, static_cast<double>(up) / down);
+	int half_taps = static_cast<int>(::ceil(HALF_TAPS / ratio));
+
+	if ((up > MAX_PHASES) || ((half_taps * 2) > MAX_TAPS))
+	{
+		return false;
+	}
+
+	_input_rate = input_rate;
+	_output_rate = output_rate;
+	_channels = channels;
+	_up = up;
+	_down = down;
+	_taps = half_taps * 2;
+
+	_coefficients.clear();
+
+	if (_up != _down)
+	{
+		double cutoff = CUTOFF * ratio;
+		double i0_beta = BesselI0(KAISER_BETA);
+
+		_coefficients.resize(static_cast<size_t>(_up) * _taps);
+
+		for (int phase = 0; phase < _up; phase++)
+		{
+			float *coefficients = _coefficients.data() + static_cast<size_t>(phase) * _taps;
+			double sum = 0.0;
+
+			for (int tap = 0; tap < _taps; tap++)
+			{
+				// Distance from the input sample of the tap to the output (in input samples)
+				double distance = static_cast<double>(phase) / _up + (half_taps - 1) - tap;
+				double x = distance / half_taps;
+				double value = 0.0;
+
+				if (::fabs(x) <= 1.0)
+				{
+					double sinc = (distance == 0.0) ? 1.0 : ::sin(M_PI * cutoff * distance) / (M_PI * cutoff * distance);
+					double window = BesselI0(KAISER_BETA * ::sqrt(1.0 - x * x)) / i0_beta;
+
+					value = cutoff * sinc * window;
+				}
+
+				coefficients[tap] = static_cast<float>(value);
+				sum += value;
+			}
+
+			// Unity gain for DC
+			for (int tap = 0; tap < _taps; tap++)
+			{
+				coefficients[tap] = static_cast<float>(coefficients[tap] / sum);
+			}
+		}
+	}
+
+	Reset();
+
+	return true;
+}
+
+void PcmResampler::Reset()
+{
+	int half_taps = _taps / 2;
+
+	for (auto &history : _history)
+	{
+		history.clear();
+	}
+
+	if (_up != _down)
+	{
+		// Silence before the first sample
+		for (int channel = 0; channel < _channels; channel++)
+		{
+			_history[channel].assign(half_taps - 1, 0.0f);
+		}
+
+		_position = half_taps - 1;
+	}
+	else
+	{
+		_position = 0;
+	}
+
+	_phase = 0;
+}
+
+void PcmResampler::Process(const float *const *inputs, int samples, std::vector<float> *outputs)
+{
+	if (_up == _down)
+	{
+		for (int channel = 0; channel < _channels; channel++)
+		{
+			outputs[channel].insert(outputs[channel].end(), inputs[channel], inputs[channel] + samples);
+		}
+
+		return;
+	}
+
+	int half_taps = _taps / 2;
+	int64_t position = _position;
+	int phase = _phase;
+
+	for (int channel = 0; channel < _channels; channel++)
+	{
+		auto &history = _history[channel];
+		auto &output = outputs[channel];
+
+		history.insert(history.end(), inputs[channel], inputs[channel] + samples);
+
+		// All channels have the same position
+		position = _position;
+		phase = _phase;
+
+		auto last = static_cast<int64_t>(history.size()) - half_taps;
+
+		while (position < last)
+		{
+			const float *window = history.data() + (position - half_taps + 1);
+			output.push_back(ov::pcm::DotProduct(window, _coefficients.data() + static_cast<size_t>(phase) * _taps, _taps));
+
+			phase += _down;
+			position += phase / _up;
+			phase %= _up;
+		}
+	}
+
+	// Drop the samples that are no longer needed
+	auto consumed = position - half_taps + 1;
+
+	if (consumed > 0)
+	{
+		for (int channel = 0; channel < _channels; channel++)
+		{
+			auto &history = _history[channel];
+			history.erase(history.begin(), history.begin() + std::min<int64_t>(consumed, history.size()));
+		}
+
+		position -= consumed;
+	}
+
+	_position = position;
+	_phase = phase;
+}
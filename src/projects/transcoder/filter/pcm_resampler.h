@@ -0,0 +1,68 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by agent
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <stdint.h>
+
+#include <vector>
+
+// Polyphase FIR resampler of planar float samples (Kaiser windowed sinc, like libswresample)
+//
+// The ratio of the samplerates is reduced to <up>/<down>, and the coefficients of the <up> phases are calculated in advance,
+// so an output sample is a dot product of <taps> input samples (SIMD, see ov::pcm::DotProduct()).
+// The output is not delayed: output sample N is the value at (N * input_rate / output_rate) of the input.
+class PcmResampler
+{
+public:
+	static constexpr int MAX_CHANNELS = 2;
+
+	// Returns false if the ratio of the samplerates needs too many phases/taps
+	bool Configure(int32_t input_rate, int32_t output_rate, int channels);
+
+	// Discards the input samples kept for the next output
+	void Reset();
+
+	// Resamples <samples> samples of each channel, and appends the result to outputs[channel]
+	void Process(const float *const *inputs, int samples, std::vector<float> *outputs);
+
+	int32_t GetInputRate() const
+	{
+		return _input_rate;
+	}
+
+	int32_t GetOutputRate() const
+	{
+		return _output_rate;
+	}
+
+	int GetTaps() const
+	{
+		return _taps;
+	}
+
+private:
+	int32_t _input_rate = 0;
+	int32_t _output_rate = 0;
+	int _channels = 0;
+
+	// output_rate / input_rate == _up / _down
+	int _up = 1;
+	int _down = 1;
+
+	// Number of the coefficients of a phase
+	int _taps = 0;
+	// [phase][tap]
+	std::vector<float> _coefficients;
+
+	// Input samples that are not consumed yet (including <_taps / 2 - 1> samples before the next output)
+	std::vector<float> _history[MAX_CHANNELS];
+	// Position of the next output: _history[_position] + _phase / _up
+	int64_t _position = 0;
+	int _phase = 0;
+};
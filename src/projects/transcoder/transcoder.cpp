@@ -15,6 +15,7 @@
 
 #include "config/config_manager.h"
 #include "transcoder.h"
+#include "transcoder_executor.h"
 #include "transcoder_private.h"
 
 std::shared_ptr<Transcoder> Transcoder::Create(std::shared_ptr<MediaRouteInterface> router)
@@ -35,6 +36,19 @@ Transcoder::Transcoder(std::shared_ptr<MediaRouteInterface> router)
 
 bool Transcoder::Start()
 {
+	// If the Transcoder thread pool is configured, the S/W decoders/filters/encoders of all streams run on it
+	auto thread_topology = ov::ThreadTopology::GetInstance();
+	ov::ThreadPoolTopology topology;
+	if (thread_topology->GetPool(OV_THREAD_POOL_TRANSCODER, &topology))
+	{
+		auto worker_count = thread_topology->GetThreadCount(OV_THREAD_POOL_TRANSCODER, thread_topology->GetCpuCount(OV_THREAD_POOL_TRANSCODER));
+
+		if (TranscoderExecutor::GetInstance()->Start(worker_count) == false)
+		{
+			return false;
+		}
+	}
+
 	logtd("Transcoder has been started");
 
 	SetModuleAvailable(true);
@@ -44,6 +58,8 @@ bool Transcoder::Start()
 
 bool Transcoder::Stop()
 {
+	TranscoderExecutor::GetInstance()->Stop();
+
 	logtd("Transcoder has been stopped");
 	return true;
 }
@@ -22,6 +22,12 @@ extern "C"
 class MediaFrame
 {
 public:
+	// Creates a frame whose object and shared_ptr control block are allocated from ov::MemoryPool
+	static std::shared_ptr<MediaFrame> Create()
+	{
+		return std::allocate_shared<MediaFrame>(ov::PoolAllocator<MediaFrame>());
+	}
+
 	MediaFrame() = default;
 	~MediaFrame() {
 		if(_priv_data)
@@ -186,9 +192,9 @@ public:
 	}
 
 	// This function should only be called before filtering (_track_id 0, 1)
-	std::shared_ptr<MediaFrame> CloneFrame()
+	std::shared_ptr<MediaFrame> CloneFrame() const
 	{
-		auto frame = std::make_shared<MediaFrame>();
+		auto frame = MediaFrame::Create();
 
 		if(_priv_data != nullptr){
 			frame->SetPrivData(::av_frame_clone(_priv_data));
@@ -24,7 +24,7 @@
 
 #define MAX_QUEUE_SIZE 500
 
-std::shared_ptr<TranscodeDecoder> TranscodeDecoder::Create(int32_t decoder_id, const info::Stream &info, std::shared_ptr<MediaTrack> track, CompleteHandler complete_handler)
+std::shared_ptr<TranscodeDecoder> TranscodeDecoder::Create(int32_t decoder_id, const info::Stream &info, std::shared_ptr<MediaTrack> track, const std::shared_ptr<TranscodeFramePool> &frame_pool, CompleteHandler complete_handler)
 {
 	std::shared_ptr<TranscodeDecoder> decoder = nullptr;
 
@@ -68,6 +68,7 @@ std::shared_ptr<TranscodeDecoder> TranscodeDecoder::Create(int32_t decoder_id, c
 			}
 
 			decoder = std::make_shared<DecoderAVC>(info);
+			decoder->SetFramePool(frame_pool);
 			if (decoder != nullptr && decoder->Configure(track) == true)
 			{
 				track->SetCodecLibraryId(cmn::MediaCodecLibraryId::DEFAULT);
@@ -111,6 +112,7 @@ std::shared_ptr<TranscodeDecoder> TranscodeDecoder::Create(int32_t decoder_id, c
 			}
 
 			decoder = std::make_shared<DecoderHEVC>(info);
+			decoder->SetFramePool(frame_pool);
 			if (decoder != nullptr && decoder->Configure(track) == true)
 			{
 				track->SetCodecLibraryId(cmn::MediaCodecLibraryId::DEFAULT);
@@ -120,6 +122,7 @@ std::shared_ptr<TranscodeDecoder> TranscodeDecoder::Create(int32_t decoder_id, c
 
 		case cmn::MediaCodecId::Vp8:
 			decoder = std::make_shared<DecoderVP8>(info);
+			decoder->SetFramePool(frame_pool);
 			if (decoder != nullptr && decoder->Configure(track) == true)
 			{
 				track->SetCodecLibraryId(cmn::MediaCodecLibraryId::DEFAULT);
@@ -221,6 +224,34 @@ void TranscodeDecoder::SetDecoderId(int32_t decoder_id)
 	_decoder_id = decoder_id;
 }
 
+void TranscodeDecoder::SetFramePool(const std::shared_ptr<TranscodeFramePool> &frame_pool)
+{
+	_frame_pool = frame_pool;
+}
+
+void TranscodeDecoder::AttachFramePool()
+{
+	if (_frame_pool != nullptr)
+	{
+		_frame_pool->Attach(_context);
+	}
+}
+
+void TranscodeDecoder::SetKeyFrameDecodeOnlyOptions()
+{
+	if ((_context == nullptr) || (_track->IsKeyFrameDecodeOnly() == false))
+	{
+		return;
+	}
+
+	// Drop the non-key frames that are fed without the key frame flag
+	_context->skip_frame = AVDISCARD_NONKEY;
+
+	// There is nothing to reorder, so output the frame as soon as it is decoded
+	_context->flags |= AV_CODEC_FLAG_LOW_DELAY;
+	_context->has_b_frames = 0;
+}
+
 bool TranscodeDecoder::Configure(std::shared_ptr<MediaTrack> track)
 {
 	_track = track;
@@ -242,6 +273,62 @@ bool TranscodeDecoder::Configure(std::shared_ptr<MediaTrack> track)
 void TranscodeDecoder::SendBuffer(std::shared_ptr<const MediaPacket> packet)
 {
 	_input_buffer.Enqueue(std::move(packet));
+
+	if (_strand != nullptr)
+	{
+		_strand->Post([this]() {
+			auto obj = _input_buffer.Dequeue(0);
+			if ((obj.has_value() == false) || _kill_flag)
+			{
+				return;
+			}
+
+			DecodePacket(std::move(obj.value()));
+		});
+	}
+}
+
+bool TranscodeDecoder::StartCodec()
+{
+	_kill_flag = false;
+
+	auto executor = TranscoderExecutor::GetInstance();
+	if (executor->IsRunning())
+	{
+		_strand = executor->CreateStrand(TranscoderExecutor::GetApplicationPriority(_stream_info.GetApplicationInfo()),
+										 ov::String::FormatString("Dec%s", avcodec_get_name(GetCodecID())));
+		return true;
+	}
+
+	// Generates a thread that reads and decodes packets in the input_buffer queue and sends the frames to the complete handler.
+	try
+	{
+		_codec_thread = std::thread(&TranscodeDecoder::CodecThread, this);
+		pthread_setname_np(_codec_thread.native_handle(), ov::String::FormatString("Dec%s", avcodec_get_name(GetCodecID())).CStr());
+		ov::ThreadTopology::GetInstance()->Apply(OV_THREAD_POOL_DECODER, _codec_thread.native_handle());
+	}
+	catch (const std::system_error &e)
+	{
+		logte("Failed to start decoder thread");
+		_kill_flag = true;
+		return false;
+	}
+
+	return true;
+}
+
+void TranscodeDecoder::CodecThread()
+{
+	while (!_kill_flag)
+	{
+		auto obj = _input_buffer.Dequeue();
+		if (obj.has_value() == false)
+		{
+			continue;
+		}
+
+		DecodePacket(std::move(obj.value()));
+	}
 }
 
 void TranscodeDecoder::SendOutputBuffer(TranscodeResult result, std::shared_ptr<MediaFrame> frame)
@@ -260,6 +347,11 @@ void TranscodeDecoder::Stop()
 
 	_input_buffer.Stop();
 
+	if (_strand != nullptr)
+	{
+		_strand->Stop();
+	}
+
 	if (_codec_thread.joinable())
 	{
 		_codec_thread.join();
@@ -10,6 +10,8 @@
 
 #include "base/info/stream.h"
 #include "codec/codec_base.h"
+#include "transcoder_executor.h"
+#include "transcoder_frame_pool.h"
 
 class TranscodeDecoder : public TranscodeBase<MediaPacket, MediaFrame>
 {
@@ -20,9 +22,11 @@ public:
 	TranscodeDecoder(info::Stream stream_info);
 	~TranscodeDecoder() override;
 
-	static std::shared_ptr<TranscodeDecoder> Create(int32_t decoder_id, const info::Stream &info, std::shared_ptr<MediaTrack> track,  CompleteHandler complete_handler);
+	static std::shared_ptr<TranscodeDecoder> Create(int32_t decoder_id, const info::Stream &info, std::shared_ptr<MediaTrack> track, const std::shared_ptr<TranscodeFramePool> &frame_pool, CompleteHandler complete_handler);
 
 	void SetDecoderId(int32_t decoder_id);
+	// Used by the S/W video decoders (must be set before Configure())
+	void SetFramePool(const std::shared_ptr<TranscodeFramePool> &frame_pool);
 
 	bool Configure(std::shared_ptr<MediaTrack> track) override;
 
@@ -33,7 +37,8 @@ public:
 
 	cmn::Timebase GetTimebase();
 
-	virtual void CodecThread() = 0;
+	// Decodes the packets of _input_buffer until Stop() is called (the H/W decoders override it)
+	virtual void CodecThread();
 
 	virtual void Stop();
 
@@ -43,6 +48,17 @@ public:
 	}
 
 protected:
+	// Decodes a packet, and sends the decoded frames to the complete handler
+	// Implemented by the decoders that are started with StartCodec()
+	virtual void DecodePacket(std::shared_ptr<const MediaPacket> packet) {}
+
+	// Runs DecodePacket() as the tasks of TranscoderExecutor if it is running, otherwise starts the codec thread
+	bool StartCodec();
+
+	void AttachFramePool();
+	// Sets the options of the codec context for the track that is decoded only from the key frames
+	void SetKeyFrameDecodeOnlyOptions();
+
 	int32_t _decoder_id;
 
 	std::shared_ptr<MediaTrack> _track;
@@ -60,6 +76,11 @@ protected:
 
 	bool _kill_flag = false;
 	std::thread _codec_thread;
+	// Used instead of _codec_thread if the decoder runs on TranscoderExecutor
+	std::shared_ptr<TranscoderExecutor::Strand> _strand;
 
 	CompleteHandler _complete_handler;
+
+	// Declared last, so it is released after _context is freed
+	std::shared_ptr<TranscodeFramePool> _frame_pool;
 };
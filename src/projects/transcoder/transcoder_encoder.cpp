@@ -8,6 +8,9 @@
 //==============================================================================
 #include "transcoder_encoder.h"
 
+#include <monitoring/monitoring.h>
+
+#include <chrono>
 #include <utility>
 
 #include "codec/encoder/encoder_aac.h"
@@ -257,6 +260,179 @@ std::shared_ptr<MediaTrack> &TranscodeEncoder::GetRefTrack()
 void TranscodeEncoder::SendBuffer(std::shared_ptr<const MediaFrame> frame)
 {
 	_input_buffer.Enqueue(std::move(frame));
+
+	if (_strand != nullptr)
+	{
+		_strand->Post([this]() {
+			auto obj = _input_buffer.Dequeue(0);
+			if ((obj.has_value() == false) || _kill_flag)
+			{
+				return;
+			}
+
+			ProcessFrame(std::move(obj.value()));
+		});
+	}
+}
+
+bool TranscodeEncoder::StartCodec()
+{
+	_kill_flag = false;
+
+	if (IsLoadControlSupported() && _stream_info.GetApplicationInfo().GetConfig().GetOutputProfiles().IsAdaptiveEncoding())
+	{
+		auto frame_rate = (_track->GetFrameRate() > 0) ? _track->GetFrameRate() : _track->GetEstimateFrameRate();
+
+		if (frame_rate > 0)
+		{
+			_load_governor = std::make_shared<TranscoderLoadGovernor>(frame_rate);
+		}
+		else
+		{
+			logtw("Adaptive encoding is disabled for track %d, because the frame rate is unknown", _track->GetId());
+		}
+	}
+
+	auto executor = TranscoderExecutor::GetInstance();
+	if (executor->IsRunning())
+	{
+		_strand = executor->CreateStrand(TranscoderExecutor::GetApplicationPriority(_stream_info.GetApplicationInfo()),
+										 ov::String::FormatString("Enc%s", avcodec_get_name(GetCodecID())));
+		return true;
+	}
+
+	// Generates a thread that reads and encodes frames in the input_buffer queue and places them in the output queue.
+	try
+	{
+		_codec_thread = std::thread(&TranscodeEncoder::CodecThread, this);
+		pthread_setname_np(_codec_thread.native_handle(), ov::String::FormatString("Enc%s", avcodec_get_name(GetCodecID())).CStr());
+		ov::ThreadTopology::GetInstance()->Apply(OV_THREAD_POOL_ENCODER, _codec_thread.native_handle());
+	}
+	catch (const std::system_error &e)
+	{
+		logte("Failed to start encoder thread.");
+		_kill_flag = true;
+
+		return false;
+	}
+
+	return true;
+}
+
+void TranscodeEncoder::CodecThread()
+{
+	while (!_kill_flag)
+	{
+		auto obj = _input_buffer.Dequeue();
+		if (obj.has_value() == false)
+		{
+			continue;
+		}
+
+		ProcessFrame(std::move(obj.value()));
+	}
+}
+
+void TranscodeEncoder::ProcessFrame(std::shared_ptr<const MediaFrame> frame)
+{
+	if (_load_governor == nullptr)
+	{
+		EncodeFrame(std::move(frame));
+		return;
+	}
+
+	if (_load_governor->ShouldEncode() == false)
+	{
+		return;
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	EncodeFrame(std::move(frame));
+	auto encoding_time_us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+	if (_load_governor->Update(encoding_time_us, _input_buffer.Size()))
+	{
+		OnLoadLevelChanged();
+	}
+}
+
+void TranscodeEncoder::OnLoadLevelChanged()
+{
+	auto level = TranscoderLoadGovernor::StringFromLevel(_load_governor->GetLevel());
+	auto frame_rate = _load_governor->GetFrameRate() / _load_governor->GetFrameRateDivisor();
+
+	auto message = ov::String::FormatString("The level of the %s encoder of track %d is changed to %s (load: %.2f, queue: %zu, frame rate: %.2f)",
+											::avcodec_get_name(GetCodecID()), _track->GetId(), level,
+											_load_governor->GetLoad(), _load_governor->GetQueueSize(), frame_rate);
+
+	if (ReopenCodec())
+	{
+		logti("[%s/%s] %s", _stream_info.GetApplicationInfo().GetName().CStr(), _stream_info.GetName().CStr(), message.CStr());
+	}
+	else
+	{
+		// The previous codec context is still used, but the frames are dropped by the new level
+		logte("[%s/%s] %s, but could not reopen the encoder", _stream_info.GetApplicationInfo().GetName().CStr(), _stream_info.GetName().CStr(), message.CStr());
+	}
+
+	MonitorInstance->OnEncoderLoadChanged(_stream_info, message, {
+		{"trackId", static_cast<int>(_track->GetId())},
+		{"codec", ov::String(::avcodec_get_name(GetCodecID()))},
+		{"level", ov::String(level)},
+		{"load", static_cast<float>(_load_governor->GetLoad())},
+		{"queueSize", static_cast<int>(_load_governor->GetQueueSize())},
+		{"frameRate", static_cast<float>(frame_rate)},
+	});
+}
+
+bool TranscodeEncoder::ReopenCodec()
+{
+	if ((_codec_context == nullptr) || (_codec_context->codec == nullptr))
+	{
+		return false;
+	}
+
+	const AVCodec *codec = _codec_context->codec;
+	AVCodecContext *previous_context = _codec_context;
+
+	_codec_context = ::avcodec_alloc_context3(codec);
+	if (_codec_context == nullptr)
+	{
+		_codec_context = previous_context;
+		return false;
+	}
+
+	bool result = SetCodecParams();
+
+	if (result && (_load_governor != nullptr))
+	{
+		// The rate control and the key frame interval follow the frames that are actually encoded
+		auto divisor = _load_governor->GetFrameRateDivisor();
+
+		if (divisor > 1)
+		{
+			_codec_context->framerate = ::av_div_q(_codec_context->framerate, ::av_make_q(divisor, 1));
+			_codec_context->gop_size = std::max(1, _codec_context->gop_size / divisor);
+		}
+	}
+
+	if (result)
+	{
+		ov::ThreadTopology::ScopedAffinity scoped_affinity(OV_THREAD_POOL_ENCODER);
+		result = (::avcodec_open2(_codec_context, codec, nullptr) >= 0);
+	}
+
+	if (result == false)
+	{
+		::avcodec_free_context(&_codec_context);
+		_codec_context = previous_context;
+		return false;
+	}
+
+	// The encoders that support reopening have no delayed frames, so nothing is lost here
+	::avcodec_free_context(&previous_context);
+
+	return true;
 }
 
 void TranscodeEncoder::SendOutputBuffer(std::shared_ptr<MediaPacket> packet)
@@ -273,6 +449,11 @@ void TranscodeEncoder::Stop()
 
 	_input_buffer.Stop();
 
+	if (_strand != nullptr)
+	{
+		_strand->Stop();
+	}
+
 	if (_codec_thread.joinable())
 	{
 		_codec_thread.join();
@@ -10,6 +10,8 @@
 
 #include "base/info/stream.h"
 #include "codec/codec_base.h"
+#include "transcoder_executor.h"
+#include "transcoder_load_governor.h"
 
 class TranscodeEncoder : public TranscodeBase<MediaFrame, MediaPacket>
 {
@@ -32,7 +34,8 @@ public:
 
 	std::shared_ptr<MediaTrack> &GetRefTrack();
 
-	virtual void CodecThread() = 0;
+	// Encodes the frames of _input_buffer until Stop() is called (the H/W encoders override it)
+	virtual void CodecThread();
 
 	virtual void Stop();
 
@@ -49,7 +52,34 @@ public:
 private:
 	virtual bool SetCodecParams() = 0;
 
+	// Encodes the frame, or drops it if the frame rate is lowered by _load_governor
+	void ProcessFrame(std::shared_ptr<const MediaFrame> frame);
+	void OnLoadLevelChanged();
+
 protected:
+	// Encodes a frame, and sends the encoded packets to the complete handler
+	// Implemented by the encoders that are started with StartCodec()
+	virtual void EncodeFrame(std::shared_ptr<const MediaFrame> frame) {}
+
+	// Returns true if the encoder can be reopened with SetCodecParams() while encoding,
+	// and SetCodecParams() uses IsComplexityReduced() (see <OutputProfiles><AdaptiveEncoding>)
+	virtual bool IsLoadControlSupported() const
+	{
+		return false;
+	}
+
+	// Whether SetCodecParams() should use the faster settings of the encoder
+	bool IsComplexityReduced() const
+	{
+		return (_load_governor != nullptr) && _load_governor->IsComplexityReduced();
+	}
+
+	// Replaces _codec_context with a new one that is opened with the current parameters
+	bool ReopenCodec();
+
+	// Runs EncodeFrame() as the tasks of TranscoderExecutor if it is running, otherwise starts the codec thread
+	bool StartCodec();
+
 	std::shared_ptr<MediaTrack> _track = nullptr;
 
 	int32_t _encoder_id;
@@ -67,7 +97,12 @@ protected:
 
 	bool _kill_flag = false;
 	std::thread _codec_thread;
+	// Used instead of _codec_thread if the encoder runs on TranscoderExecutor
+	std::shared_ptr<TranscoderExecutor::Strand> _strand;
 
 	CompleteHandler _complete_handler;
 
+	// Created by StartCodec() if <AdaptiveEncoding> is enabled, and used only by the encoding thread/strand
+	std::shared_ptr<TranscoderLoadGovernor> _load_governor;
+
 };
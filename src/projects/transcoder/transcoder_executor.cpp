@@ -0,0 +1,364 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by agent
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "transcoder_executor.h"
+
+#include "transcoder_private.h"
+
+// A strand yields the worker after this number of tasks, so the other strands of the same priority are not starved
+#define MAX_TASKS_PER_TURN 8
+
+namespace
+{
+	// The executor/index of the worker running on the current thread
+	thread_local TranscoderExecutor *current_executor = nullptr;
+	thread_local size_t current_worker_index = 0;
+}  // namespace
+
+//--------------------------------------------------------------------
+// TranscoderExecutor::Strand
+//--------------------------------------------------------------------
+TranscoderExecutor::Strand::Strand(TranscoderExecutor *executor, Priority priority, const ov::String &name)
+	: _executor(executor),
+	  _priority(priority),
+	  _name(name)
+{
+}
+
+bool TranscoderExecutor::Strand::Post(std::function<void()> task)
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		if (_stopped)
+		{
+			return false;
+		}
+
+		_tasks.push_back(std::move(task));
+
+		if (_scheduled)
+		{
+			// It will be run by the worker that has the strand
+			return true;
+		}
+
+		_scheduled = true;
+	}
+
+	_executor->Schedule(shared_from_this());
+
+	return true;
+}
+
+void TranscoderExecutor::Strand::Stop()
+{
+	std::deque<std::function<void()>> tasks;
+
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+
+		_stopped = true;
+		tasks = std::move(_tasks);
+
+		if (_running && (_running_thread_id != std::this_thread::get_id()))
+		{
+			_condition.wait(lock, [this]() -> bool {
+				return (_running == false);
+			});
+		}
+	}
+
+	// The pending tasks (and the packets/frames captured by them) are released outside the lock
+	tasks.clear();
+}
+
+bool TranscoderExecutor::Strand::Run(size_t max_tasks)
+{
+	for (size_t count = 0; count < max_tasks; count++)
+	{
+		std::function<void()> task;
+
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+
+			if (_stopped || _tasks.empty())
+			{
+				_scheduled = false;
+				return false;
+			}
+
+			task = std::move(_tasks.front());
+			_tasks.pop_front();
+
+			_running = true;
+			_running_thread_id = std::this_thread::get_id();
+		}
+
+		task();
+		task = nullptr;
+
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+
+			_running = false;
+
+			if (_stopped)
+			{
+				_condition.notify_all();
+			}
+		}
+	}
+
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	if (_stopped || _tasks.empty())
+	{
+		_scheduled = false;
+		return false;
+	}
+
+	// Keep _scheduled, the worker queues the strand again
+	return true;
+}
+
+//--------------------------------------------------------------------
+// TranscoderExecutor
+//--------------------------------------------------------------------
+TranscoderExecutor::~TranscoderExecutor()
+{
+	Stop();
+}
+
+bool TranscoderExecutor::Start(int worker_count)
+{
+	if (_running)
+	{
+		return true;
+	}
+
+	if (worker_count <= 0)
+	{
+		logte("Invalid worker count of the transcoder executor: %d", worker_count);
+		return false;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(_idle_mutex);
+
+		_stop = false;
+		_pending_count = 0;
+		_idle_count = 0;
+	}
+
+	for (int index = 0; index < worker_count; index++)
+	{
+		_workers.push_back(std::make_unique<Worker>());
+	}
+
+	for (size_t index = 0; index < _workers.size(); index++)
+	{
+		auto &worker = _workers[index];
+
+		try
+		{
+			worker->thread = std::thread(&TranscoderExecutor::WorkerThread, this, index);
+		}
+		catch (const std::system_error &e)
+		{
+			logte("Could not start the worker thread of the transcoder executor: %s", e.what());
+
+			Stop();
+			return false;
+		}
+
+		pthread_setname_np(worker->thread.native_handle(), ov::String::FormatString("Transcoder%zu", index).CStr());
+		ov::ThreadTopology::GetInstance()->Apply(OV_THREAD_POOL_TRANSCODER, worker->thread.native_handle(), static_cast<int>(index));
+	}
+
+	_running = true;
+
+	logti("Transcoder executor has been started with %zu workers", _workers.size());
+
+	return true;
+}
+
+void TranscoderExecutor::Stop()
+{
+	{
+		std::lock_guard<std::mutex> lock(_idle_mutex);
+		_stop = true;
+	}
+
+	_idle_condition.notify_all();
+
+	for (auto &worker : _workers)
+	{
+		if (worker->thread.joinable())
+		{
+			worker->thread.join();
+		}
+	}
+
+	_workers.clear();
+
+	if (_running.exchange(false))
+	{
+		logti("Transcoder executor has been stopped");
+	}
+}
+
+std::shared_ptr<TranscoderExecutor::Strand> TranscoderExecutor::CreateStrand(Priority priority, const ov::String &name)
+{
+	return std::make_shared<Strand>(this, priority, name);
+}
+
+void TranscoderExecutor::Schedule(std::shared_ptr<Strand> strand)
+{
+	if (_workers.empty())
+	{
+		// Stopped
+		return;
+	}
+
+	size_t worker_index = (current_executor == this)
+							  ? current_worker_index
+							  : (_next_worker_index++ % _workers.size());
+	auto &worker = _workers[worker_index];
+
+	{
+		std::lock_guard<std::mutex> lock(worker->mutex);
+		worker->queues[static_cast<size_t>(strand->GetPriority())].push_back(std::move(strand));
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(_idle_mutex);
+
+		_pending_count++;
+
+		if (_idle_count == 0)
+		{
+			// All workers are busy, and they take the strand after the current task
+			return;
+		}
+	}
+
+	_idle_condition.notify_one();
+}
+
+std::shared_ptr<TranscoderExecutor::Strand> TranscoderExecutor::Take(size_t worker_index)
+{
+	auto worker_count = _workers.size();
+
+	// Higher priority strands of any worker are taken before the lower ones
+	for (size_t priority = 0; priority < static_cast<size_t>(Priority::Count); priority++)
+	{
+		for (size_t offset = 0; offset < worker_count; offset++)
+		{
+			auto &worker = _workers[(worker_index + offset) % worker_count];
+			std::shared_ptr<Strand> strand;
+
+			{
+				std::lock_guard<std::mutex> lock(worker->mutex);
+
+				auto &queue = worker->queues[priority];
+
+				if (queue.empty())
+				{
+					continue;
+				}
+
+				strand = std::move(queue.front());
+				queue.pop_front();
+			}
+
+			std::lock_guard<std::mutex> lock(_idle_mutex);
+			_pending_count--;
+
+			return strand;
+		}
+	}
+
+	return nullptr;
+}
+
+void TranscoderExecutor::WorkerThread(size_t worker_index)
+{
+	current_executor = this;
+	current_worker_index = worker_index;
+
+	while (_stop == false)
+	{
+		auto strand = Take(worker_index);
+
+		if (strand == nullptr)
+		{
+			std::unique_lock<std::mutex> lock(_idle_mutex);
+
+			_idle_count++;
+			_idle_condition.wait(lock, [this]() -> bool {
+				return (_pending_count > 0) || _stop;
+			});
+			_idle_count--;
+
+			if (_stop)
+			{
+				break;
+			}
+
+			continue;
+		}
+
+		if (strand->Run(MAX_TASKS_PER_TURN))
+		{
+			Schedule(std::move(strand));
+		}
+	}
+
+	current_executor = nullptr;
+}
+
+TranscoderExecutor::Priority TranscoderExecutor::GetApplicationPriority(const info::Application &application_info)
+{
+	Priority priority = Priority::Normal;
+
+	PriorityFromString(application_info.GetConfig().GetOutputProfiles().GetPriority(), &priority);
+
+	return priority;
+}
+
+bool TranscoderExecutor::PriorityFromString(const ov::String &priority_string, Priority *priority)
+{
+	for (auto candidate : {Priority::High, Priority::Normal, Priority::Low})
+	{
+		if (priority_string.UpperCaseString() == ov::String(StringFromPriority(candidate)).UpperCaseString())
+		{
+			*priority = candidate;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+const char *TranscoderExecutor::StringFromPriority(Priority priority)
+{
+	switch (priority)
+	{
+		case Priority::High:
+			return "High";
+		case Priority::Normal:
+			return "Normal";
+		case Priority::Low:
+			return "Low";
+		case Priority::Count:
+			break;
+	}
+
+	return "Unknown";
+}
@@ -0,0 +1,135 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by agent
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/info/application.h>
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Runs the decoders/filters/encoders of all streams on a fixed pool of threads
+//
+// Each component owns a Strand, which runs the tasks one at a time in the order they are posted,
+// so the order of the packets/frames of a track is preserved and the codec contexts don't need to be locked.
+// A strand that becomes runnable is queued to the worker that posted it (the next stage of the pipeline
+// runs on the same CPU while the frame is hot in the cache), and the idle workers steal the strands from the others.
+class TranscoderExecutor : public ov::Singleton<TranscoderExecutor>
+{
+public:
+	// <OutputProfiles><Priority> of the application
+	enum class Priority : uint8_t
+	{
+		High,
+		Normal,
+		Low,
+
+		// Number of priorities
+		Count
+	};
+
+	class Strand : public std::enable_shared_from_this<Strand>
+	{
+	public:
+		Strand(TranscoderExecutor *executor, Priority priority, const ov::String &name);
+
+		// Returns false if the strand is stopped
+		bool Post(std::function<void()> task);
+
+		// Discards the pending tasks, and waits for the running task to finish (unless it is called from the task)
+		void Stop();
+
+		Priority GetPriority() const
+		{
+			return _priority;
+		}
+
+		const ov::String &GetName() const
+		{
+			return _name;
+		}
+
+	protected:
+		friend class TranscoderExecutor;
+
+		// Runs up to max_tasks tasks. Returns true if the strand has more tasks (must be scheduled again)
+		bool Run(size_t max_tasks);
+
+		TranscoderExecutor *_executor = nullptr;
+		Priority _priority = Priority::Normal;
+		ov::String _name;
+
+		std::mutex _mutex;
+		std::condition_variable _condition;
+		std::deque<std::function<void()>> _tasks;
+
+		// true while the strand is queued to a worker or running
+		bool _scheduled = false;
+		bool _running = false;
+		bool _stopped = false;
+		std::thread::id _running_thread_id;
+	};
+
+public:
+	~TranscoderExecutor() override;
+
+	bool Start(int worker_count);
+	void Stop();
+
+	bool IsRunning() const
+	{
+		return _running;
+	}
+
+	size_t GetWorkerCount() const
+	{
+		return _workers.size();
+	}
+
+	std::shared_ptr<Strand> CreateStrand(Priority priority, const ov::String &name);
+
+	static Priority GetApplicationPriority(const info::Application &application_info);
+	static bool PriorityFromString(const ov::String &priority_string, Priority *priority);
+	static const char *StringFromPriority(Priority priority);
+
+protected:
+	struct Worker
+	{
+		std::mutex mutex;
+		// Runnable strands by priority
+		std::deque<std::shared_ptr<Strand>> queues[static_cast<size_t>(Priority::Count)];
+
+		std::thread thread;
+	};
+
+	void Schedule(std::shared_ptr<Strand> strand);
+	// Takes a strand from the queue of the worker, or steals it from the other workers
+	std::shared_ptr<Strand> Take(size_t worker_index);
+
+	void WorkerThread(size_t worker_index);
+
+	std::atomic<bool> _running{false};
+	std::vector<std::unique_ptr<Worker>> _workers;
+	std::atomic<size_t> _next_worker_index{0};
+
+	// Protects _pending_count and _idle_count (and the change of _stop)
+	std::mutex _idle_mutex;
+	std::condition_variable _idle_condition;
+	// Number of the strands queued to the workers
+	size_t _pending_count = 0;
+	// Number of the workers waiting for the strands
+	size_t _idle_count = 0;
+	std::atomic<bool> _stop{false};
+};
@@ -52,7 +52,7 @@ bool TranscodeFilter::Create()
 	switch (_input_track->GetMediaType())
 	{
 		case MediaType::Audio:
-			_internal = std::make_shared<FilterResampler>();
+			_internal = std::make_shared<FilterResampler>(_input_stream_info->GetApplicationInfo().GetConfig().GetOutputProfiles().IsNativeResampler());
 			break;
 		case MediaType::Video:
 			_internal = std::make_shared<FilterRescaler>();
@@ -71,6 +71,15 @@ bool TranscodeFilter::Create()
 	_internal->SetQueueUrn(urn);
 	_internal->SetCompleteHandler(bind(&TranscodeFilter::OnComplete, this, std::placeholders::_1));
 
+	// The filters uploading/downloading the frames to/from the GPU keep their own threads, since the device contexts are bound to the thread
+	auto executor = TranscoderExecutor::GetInstance();
+	auto library_id = _input_track->GetCodecLibraryId();
+	if (executor->IsRunning() &&
+		(library_id != cmn::MediaCodecLibraryId::NVENC) && (library_id != cmn::MediaCodecLibraryId::QSV) && (library_id != cmn::MediaCodecLibraryId::XMA))
+	{
+		_internal->SetStrand(executor->CreateStrand(TranscoderExecutor::GetApplicationPriority(_input_stream_info->GetApplicationInfo()), name));
+	}
+
 	bool success = _internal->Configure(_input_track, _output_track);
 	if (success == false)
 	{
@@ -0,0 +1,321 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by agent
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "transcoder_frame_bus.h"
+
+#include <math.h>
+
+#include <algorithm>
+#include <string_view>
+
+#include "transcoder_private.h"
+
+// Key packets of each track kept to align the timelines (about 1 minute of the key frames of a video track with 1s GOP)
+#define MAX_PUBLISHER_KEY_PACKETS 64
+#define MAX_SUBSCRIBER_KEY_PACKETS 16
+
+// The offset is updated if a key packet is matched with a different offset (ex: the publisher is reconnected to the origin)
+#define OFFSET_TOLERANCE_US 1000
+
+TranscoderFrameBus::Member::Member(const std::shared_ptr<Channel> &channel, FrameHandler frame_handler, PromotionHandler promotion_handler)
+	: _channel(channel),
+	  _frame_handler(std::move(frame_handler)),
+	  _promotion_handler(std::move(promotion_handler))
+{
+}
+
+TranscoderFrameBus::Member::~Member()
+{
+	Leave();
+}
+
+void TranscoderFrameBus::Member::Leave()
+{
+	TranscoderFrameBus::GetInstance()->Leave(this);
+}
+
+const ov::String &TranscoderFrameBus::Member::GetKey() const
+{
+	return _channel->GetKey();
+}
+
+bool TranscoderFrameBus::Member::HasSubscribers() const
+{
+	std::shared_lock<std::shared_mutex> lock(_channel->_member_mutex);
+
+	return (_channel->_publisher == this) && (_channel->_subscribers.empty() == false);
+}
+
+void TranscoderFrameBus::Member::OnKeyPacket(MediaTrackId track_id, const std::shared_ptr<MediaPacket> &packet, double timebase_expr)
+{
+	KeyPacket key_packet{GetFingerprint(packet), static_cast<int64_t>(packet->GetPts() * timebase_expr * 1000000.0)};
+
+	if (_is_publisher)
+	{
+		std::lock_guard<std::mutex> lock(_channel->_key_packet_mutex);
+
+		auto &key_packets = _channel->_key_packets[track_id];
+		key_packets.push_back(key_packet);
+
+		while (key_packets.size() > MAX_PUBLISHER_KEY_PACKETS)
+		{
+			key_packets.pop_front();
+		}
+
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(_alignment_mutex);
+
+	auto &key_packets = _key_packets[track_id];
+	key_packets.push_back(key_packet);
+
+	while (key_packets.size() > MAX_SUBSCRIBER_KEY_PACKETS)
+	{
+		key_packets.pop_front();
+	}
+
+	Align();
+}
+
+bool TranscoderFrameBus::Member::Align()
+{
+	std::lock_guard<std::mutex> lock(_channel->_key_packet_mutex);
+
+	// The latest key packet of this member that is found only once in the key packets of the publisher
+	// (the same packet can be repeated, like the silence of the audio)
+	for (auto &[track_id, key_packets] : _key_packets)
+	{
+		auto publisher_packets_it = _channel->_key_packets.find(track_id);
+		if (publisher_packets_it == _channel->_key_packets.end())
+		{
+			continue;
+		}
+
+		auto &publisher_packets = publisher_packets_it->second;
+
+		for (auto key_packet = key_packets.rbegin(); key_packet != key_packets.rend(); ++key_packet)
+		{
+			const KeyPacket *matched_packet = nullptr;
+			int match_count = 0;
+
+			for (auto &publisher_packet : publisher_packets)
+			{
+				if (publisher_packet.fingerprint == key_packet->fingerprint)
+				{
+					matched_packet = &publisher_packet;
+					match_count++;
+				}
+			}
+
+			if (match_count != 1)
+			{
+				continue;
+			}
+
+			auto offset_us = key_packet->pts_us - matched_packet->pts_us;
+
+			if (_is_aligned == false)
+			{
+				logti("The timeline of the frame bus (%s) is aligned by track %d (offset: %lldus)", _channel->GetKey().CStr(), track_id, offset_us);
+			}
+			else if (::llabs(offset_us - _offset_us) > OFFSET_TOLERANCE_US)
+			{
+				logti("The timeline of the frame bus (%s) is changed by track %d (offset: %lldus -> %lldus)", _channel->GetKey().CStr(), track_id, _offset_us, offset_us);
+			}
+
+			_is_aligned = true;
+			_offset_us = offset_us;
+
+			// Older packets are not needed any more
+			_key_packets.clear();
+
+			return true;
+		}
+	}
+
+	return _is_aligned;
+}
+
+void TranscoderFrameBus::Member::ResetAlignment()
+{
+	std::lock_guard<std::mutex> lock(_alignment_mutex);
+
+	_is_aligned = false;
+	_offset_us = 0;
+	_key_packets.clear();
+}
+
+void TranscoderFrameBus::Member::Publish(TranscodeResult result, MediaTrackId track_id, const std::shared_ptr<MediaFrame> &frame)
+{
+	std::shared_lock<std::shared_mutex> lock(_channel->_member_mutex);
+
+	if (_channel->_publisher != this)
+	{
+		return;
+	}
+
+	for (auto subscriber : _channel->_subscribers)
+	{
+		subscriber->Deliver(result, track_id, frame);
+	}
+}
+
+void TranscoderFrameBus::Member::Deliver(TranscodeResult result, MediaTrackId track_id, const std::shared_ptr<MediaFrame> &frame)
+{
+	int64_t offset_us = 0;
+
+	{
+		std::lock_guard<std::mutex> lock(_alignment_mutex);
+
+		if ((_is_aligned == false) && (Align() == false))
+		{
+			return;
+		}
+
+		offset_us = _offset_us;
+
+		// The filters/encoders of the subscriber are created by the first frame
+		if (_started_tracks.insert(track_id).second)
+		{
+			if (result != TranscodeResult::DataReady)
+			{
+				// NoData (filler) needs the last decoded frame of the subscriber
+				_started_tracks.erase(track_id);
+				return;
+			}
+
+			result = TranscodeResult::FormatChanged;
+		}
+	}
+
+	_frame_handler(result, track_id, frame, offset_us);
+}
+
+std::shared_ptr<TranscoderFrameBus::Member> TranscoderFrameBus::Join(const ov::String &key, FrameHandler frame_handler, PromotionHandler promotion_handler)
+{
+	std::lock_guard<std::mutex> lock(_channel_mutex);
+
+	std::shared_ptr<Channel> channel;
+
+	auto channel_it = _channels.find(key);
+	if (channel_it != _channels.end())
+	{
+		channel = channel_it->second.lock();
+	}
+
+	if (channel == nullptr)
+	{
+		channel = std::make_shared<Channel>(key);
+		_channels[key] = channel;
+	}
+
+	auto member = std::make_shared<Member>(channel, std::move(frame_handler), std::move(promotion_handler));
+
+	std::lock_guard<std::shared_mutex> member_lock(channel->_member_mutex);
+
+	if (channel->_publisher == nullptr)
+	{
+		channel->_publisher = member.get();
+		member->_is_publisher = true;
+
+		logtd("Frame bus (%s) is created", key.CStr());
+	}
+	else
+	{
+		channel->_subscribers.push_back(member.get());
+
+		logti("A subscriber has joined the frame bus (%s). Subscribers: %zu", key.CStr(), channel->_subscribers.size());
+	}
+
+	return member;
+}
+
+void TranscoderFrameBus::Leave(Member *member)
+{
+	std::lock_guard<std::mutex> lock(_channel_mutex);
+
+	if (member->_has_left)
+	{
+		return;
+	}
+
+	member->_has_left = true;
+	member->_is_publisher = false;
+
+	auto &channel = member->_channel;
+
+	{
+		std::lock_guard<std::shared_mutex> member_lock(channel->_member_mutex);
+
+		if (channel->_publisher == member)
+		{
+			channel->_publisher = nullptr;
+
+			{
+				std::lock_guard<std::mutex> key_packet_lock(channel->_key_packet_mutex);
+				channel->_key_packets.clear();
+			}
+
+			if (channel->_subscribers.empty() == false)
+			{
+				// The oldest subscriber decodes the stream from now on, and the others are aligned with it
+				auto publisher = channel->_subscribers.front();
+				channel->_subscribers.erase(channel->_subscribers.begin());
+
+				channel->_publisher = publisher;
+				publisher->_is_publisher = true;
+
+				for (auto subscriber : channel->_subscribers)
+				{
+					subscriber->ResetAlignment();
+				}
+
+				logti("The publisher of the frame bus (%s) has left, and a subscriber is promoted. Subscribers: %zu", channel->GetKey().CStr(), channel->_subscribers.size());
+
+				if (publisher->_promotion_handler)
+				{
+					publisher->_promotion_handler();
+				}
+			}
+		}
+		else
+		{
+			auto subscriber_it = std::find(channel->_subscribers.begin(), channel->_subscribers.end(), member);
+			if (subscriber_it != channel->_subscribers.end())
+			{
+				channel->_subscribers.erase(subscriber_it);
+			}
+		}
+
+		if (channel->_publisher != nullptr)
+		{
+			return;
+		}
+	}
+
+	// The last member has left
+	auto channel_it = _channels.find(channel->GetKey());
+	if ((channel_it != _channels.end()) && (channel_it->second.lock() == channel))
+	{
+		_channels.erase(channel_it);
+	}
+
+	logtd("Frame bus (%s) is deleted", channel->GetKey().CStr());
+}
+
+size_t TranscoderFrameBus::GetFingerprint(const std::shared_ptr<MediaPacket> &packet)
+{
+	auto &data = packet->GetData();
+	if (data == nullptr)
+	{
+		return 0;
+	}
+
+	return std::hash<std::string_view>()(std::string_view(data->GetDataAs<char>(), data->GetLength()));
+}
@@ -0,0 +1,147 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by agent
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <shared_mutex>
+#include <vector>
+
+#include "codec/codec_base.h"
+
+// Shares the decoded frames of an input stream between the TranscoderStreams of the applications
+// that pull the same origin stream, so the stream is decoded once in the server
+//
+// The members of a channel (same key) are reference counted: the first member becomes the publisher, which decodes
+// the stream and publishes the frames, and the others get the frames instead of decoding their own packets.
+// When the publisher leaves, the oldest subscriber is promoted and starts decoding. The channel is removed with the last member.
+//
+// The providers rebase the timestamps of each pulled stream to its own start, so the timelines of the members
+// differ by a constant. A subscriber finds the difference by matching its key packets with the key packets fed to
+// the decoders of the publisher, and the frames are dropped until it is found.
+class TranscoderFrameBus : public ov::Singleton<TranscoderFrameBus>
+{
+public:
+	// offset_us: (timeline of the subscriber) - (timeline of the publisher) in microseconds
+	using FrameHandler = std::function<void(TranscodeResult result, MediaTrackId track_id, const std::shared_ptr<MediaFrame> &frame, int64_t offset_us)>;
+	// Called when the member becomes the publisher of the channel
+	using PromotionHandler = std::function<void()>;
+
+	class Channel;
+
+	class Member
+	{
+	public:
+		Member(const std::shared_ptr<Channel> &channel, FrameHandler frame_handler, PromotionHandler promotion_handler);
+		~Member();
+
+		// Leaves the channel. It waits for the frame being delivered to this member, and no frame is delivered after that.
+		// Called by the destructor if it isn't called.
+		void Leave();
+
+		const ov::String &GetKey() const;
+
+		bool IsPublisher() const
+		{
+			return _is_publisher;
+		}
+
+		bool HasSubscribers() const;
+
+		// Publisher: keeps the key packet to align the timelines of the subscribers
+		// Subscriber: aligns its timeline with the publisher
+		void OnKeyPacket(MediaTrackId track_id, const std::shared_ptr<MediaPacket> &packet, double timebase_expr);
+
+		// Sends the frame decoded by the publisher to the subscribers
+		void Publish(TranscodeResult result, MediaTrackId track_id, const std::shared_ptr<MediaFrame> &frame);
+
+	private:
+		friend class TranscoderFrameBus;
+		friend class Channel;
+
+		struct KeyPacket
+		{
+			size_t fingerprint;
+			int64_t pts_us;
+		};
+
+		// Called by the publisher (with the shared lock of the channel)
+		void Deliver(TranscodeResult result, MediaTrackId track_id, const std::shared_ptr<MediaFrame> &frame);
+		// Returns true if the offset is found (_alignment_mutex must be locked)
+		bool Align();
+		void ResetAlignment();
+
+		std::shared_ptr<Channel> _channel;
+		FrameHandler _frame_handler;
+		PromotionHandler _promotion_handler;
+
+		std::atomic<bool> _is_publisher{false};
+		// Protected by TranscoderFrameBus::_channel_mutex
+		bool _has_left = false;
+
+		// Subscriber
+		std::mutex _alignment_mutex;
+		bool _is_aligned = false;
+		int64_t _offset_us = 0;
+		// Recent key packets of this member
+		// [TRACK_ID, KEY_PACKETS]
+		std::map<MediaTrackId, std::deque<KeyPacket>> _key_packets;
+		// Tracks that got the first frame (which is delivered as TranscodeResult::FormatChanged to create the filters/encoders)
+		std::set<MediaTrackId> _started_tracks;
+	};
+
+	class Channel
+	{
+	public:
+		explicit Channel(const ov::String &key)
+			: _key(key)
+		{
+		}
+
+		const ov::String &GetKey() const
+		{
+			return _key;
+		}
+
+	private:
+		friend class TranscoderFrameBus;
+		friend class Member;
+
+		ov::String _key;
+
+		// Protects the members. Shared while the frames are delivered
+		mutable std::shared_mutex _member_mutex;
+		Member *_publisher = nullptr;
+		// In the order of joining
+		std::vector<Member *> _subscribers;
+
+		// Key packets fed to the decoders of the publisher
+		// [TRACK_ID, KEY_PACKETS]
+		std::mutex _key_packet_mutex;
+		std::map<MediaTrackId, std::deque<Member::KeyPacket>> _key_packets;
+	};
+
+	// Joins the channel of <key> (see TranscoderStream::GetFrameBusKey()). The member leaves the channel when it is released.
+	std::shared_ptr<Member> Join(const ov::String &key, FrameHandler frame_handler, PromotionHandler promotion_handler);
+
+	static size_t GetFingerprint(const std::shared_ptr<MediaPacket> &packet);
+
+private:
+	void Leave(Member *member);
+
+	std::mutex _channel_mutex;
+	// [KEY, CHANNEL]
+	std::map<ov::String, std::weak_ptr<Channel>> _channels;
+};
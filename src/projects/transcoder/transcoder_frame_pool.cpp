@@ -0,0 +1,266 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by agent
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "transcoder_frame_pool.h"
+
+extern "C"
+{
+#include <libavutil/imgutils.h>
+#include <libavutil/pixdesc.h>
+}
+
+#include "transcoder_private.h"
+
+// Same as STRIDE_ALIGN of FFmpeg (enough for AVX-512)
+#define FRAME_POOL_STRIDE_ALIGN 64
+
+TranscodeFramePool::~TranscodeFramePool()
+{
+	std::lock_guard lock_guard(_mutex);
+
+	for (auto &item : _pools)
+	{
+		ReleasePool(&(item.second));
+	}
+
+	_pools.clear();
+}
+
+void TranscodeFramePool::Attach(AVCodecContext *context)
+{
+	if (context == nullptr)
+	{
+		return;
+	}
+
+	context->opaque = this;
+	context->get_buffer2 = &TranscodeFramePool::GetBuffer;
+}
+
+int TranscodeFramePool::GetBuffer(AVCodecContext *context, AVFrame *frame, int flags)
+{
+	auto frame_pool = static_cast<TranscodeFramePool *>(context->opaque);
+	auto descriptor = ::av_pix_fmt_desc_get(static_cast<AVPixelFormat>(frame->format));
+
+	if ((frame_pool == nullptr) ||
+		(context->codec_type != AVMEDIA_TYPE_VIDEO) ||
+		((context->codec->capabilities & AV_CODEC_CAP_DR1) == 0) ||
+		(descriptor == nullptr) ||
+		(descriptor->flags & AV_PIX_FMT_FLAG_HWACCEL))
+	{
+		return ::avcodec_default_get_buffer2(context, frame, flags);
+	}
+
+	if (frame_pool->GetVideoBuffer(context, frame) == false)
+	{
+		return ::avcodec_default_get_buffer2(context, frame, flags);
+	}
+
+	return 0;
+}
+
+AVBufferRef *TranscodeFramePool::AllocateBuffer(void *opaque, size_t size)
+{
+	// Called by av_buffer_pool_get() only when there is no buffer to reuse (_mutex is held)
+	auto pool = static_cast<Pool *>(opaque);
+	auto buffer = ::av_buffer_alloc(size);
+
+	if (buffer != nullptr)
+	{
+		pool->buffer_count++;
+		pool->buffer_bytes += size;
+	}
+
+	return buffer;
+}
+
+TranscodeFramePool::Pool *TranscodeFramePool::GetPool(AVCodecContext *context, AVPixelFormat format, int width, int height)
+{
+	auto key = std::make_tuple(static_cast<int>(format), width, height);
+	auto pool_it = _pools.find(key);
+
+	if (pool_it != _pools.end())
+	{
+		return &(pool_it->second);
+	}
+
+	if (_pools.size() >= MAX_FRAME_POOL_COUNT)
+	{
+		// The buffers of the evicted pool are freed when the frames using them are released
+		auto oldest_it = std::min_element(_pools.begin(), _pools.end(), [](const auto &a, const auto &b) {
+			return a.second.last_used < b.second.last_used;
+		});
+
+		_evicted_request_count += oldest_it->second.request_count;
+		_evicted_miss_count += oldest_it->second.miss_count;
+
+		ReleasePool(&(oldest_it->second));
+		_pools.erase(oldest_it);
+	}
+
+	// Calculate the linesizes in the same way as avcodec_default_get_buffer2()
+	int linesize_align[AV_NUM_DATA_POINTERS];
+	int linesizes[4] = {};
+	int aligned_width = width;
+	int aligned_height = height;
+	bool unaligned = false;
+
+	::avcodec_align_dimensions2(context, &aligned_width, &aligned_height, linesize_align);
+
+	do
+	{
+		if (::av_image_fill_linesizes(linesizes, format, aligned_width) < 0)
+		{
+			return nullptr;
+		}
+
+		// Increase the alignment of the width for the next try
+		aligned_width += aligned_width & ~(aligned_width - 1);
+
+		unaligned = false;
+		for (int plane = 0; plane < 4; plane++)
+		{
+			unaligned |= (linesize_align[plane] > 0) && ((linesizes[plane] % linesize_align[plane]) != 0);
+		}
+	} while (unaligned);
+
+	ptrdiff_t plane_linesizes[4];
+	size_t plane_sizes[4];
+
+	for (int plane = 0; plane < 4; plane++)
+	{
+		plane_linesizes[plane] = linesizes[plane];
+	}
+
+	if (::av_image_fill_plane_sizes(plane_sizes, format, aligned_height, plane_linesizes) < 0)
+	{
+		return nullptr;
+	}
+
+	auto &pool = _pools[key];
+
+	for (int plane = 0; plane < 4; plane++)
+	{
+		pool.linesizes[plane] = linesizes[plane];
+
+		if (plane_sizes[plane] == 0)
+		{
+			continue;
+		}
+
+		pool.buffer_pools[plane] = ::av_buffer_pool_init2(plane_sizes[plane] + 16 + FRAME_POOL_STRIDE_ALIGN - 1, &pool, &TranscodeFramePool::AllocateBuffer, nullptr);
+
+		if (pool.buffer_pools[plane] == nullptr)
+		{
+			ReleasePool(&pool);
+			_pools.erase(key);
+
+			return nullptr;
+		}
+	}
+
+	logtd("Frame pool is created: %s %dx%d", ::av_get_pix_fmt_name(format), width, height);
+
+	return &pool;
+}
+
+bool TranscodeFramePool::GetVideoBuffer(AVCodecContext *context, AVFrame *frame)
+{
+	// With frame threading, this is called from the threads of the decoder
+	std::lock_guard lock_guard(_mutex);
+
+	auto pool = GetPool(context, static_cast<AVPixelFormat>(frame->format), frame->width, frame->height);
+
+	if (pool == nullptr)
+	{
+		return false;
+	}
+
+	auto buffer_count = pool->buffer_count;
+
+	for (int plane = 0; plane < 4; plane++)
+	{
+		if (pool->buffer_pools[plane] == nullptr)
+		{
+			break;
+		}
+
+		frame->buf[plane] = ::av_buffer_pool_get(pool->buffer_pools[plane]);
+
+		if (frame->buf[plane] == nullptr)
+		{
+			for (int index = 0; index < plane; index++)
+			{
+				::av_buffer_unref(&(frame->buf[index]));
+				frame->data[index] = nullptr;
+				frame->linesize[index] = 0;
+			}
+
+			return false;
+		}
+
+		frame->data[plane] = frame->buf[plane]->data;
+		frame->linesize[plane] = pool->linesizes[plane];
+	}
+
+	frame->extended_data = frame->data;
+
+	pool->last_used = ++_last_used;
+	pool->request_count++;
+
+	if (pool->buffer_count != buffer_count)
+	{
+		pool->miss_count++;
+	}
+
+	return true;
+}
+
+void TranscodeFramePool::ReleasePool(Pool *pool)
+{
+	for (auto &buffer_pool : pool->buffer_pools)
+	{
+		// The pool is freed after all the buffers are returned
+		::av_buffer_pool_uninit(&buffer_pool);
+	}
+}
+
+TranscodeFramePool::Stats TranscodeFramePool::GetStats() const
+{
+	std::lock_guard lock_guard(_mutex);
+
+	Stats stats;
+	uint64_t miss_count = _evicted_miss_count;
+
+	stats.pool_count = _pools.size();
+	stats.request_count = _evicted_request_count;
+
+	for (auto &[key, pool] : _pools)
+	{
+		stats.buffer_count += pool.buffer_count;
+		stats.buffer_bytes += pool.buffer_bytes;
+		stats.request_count += pool.request_count;
+
+		miss_count += pool.miss_count;
+	}
+
+	stats.reuse_count = stats.request_count - miss_count;
+
+	return stats;
+}
+
+ov::String TranscodeFramePool::GetStatsString() const
+{
+	auto stats = GetStats();
+
+	return ov::String::FormatString(
+		"pools: %zu, buffers: %" PRIu64 " (%" PRIu64 " bytes), requests: %" PRIu64 ", reused: %" PRIu64 " (%.2f%%)",
+		stats.pool_count,
+		stats.buffer_count, stats.buffer_bytes,
+		stats.request_count, stats.reuse_count, stats.GetReuseRate());
+}
@@ -0,0 +1,95 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by agent
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <map>
+#include <mutex>
+#include <tuple>
+
+#include "codec/codec_base.h"
+
+// Maximum number of (pixel format, resolution) pools kept by a stream
+#define MAX_FRAME_POOL_COUNT 4
+
+// Pool of the video frame buffers used by the decoders of a stream
+//
+// The decoded frames are ref-counted (the clones given to the filters share the planes), and the planes
+// go back to the pool when the last reference is released. Buffers are pooled per (pixel format, resolution),
+// so they are reused as long as the resolution of the input doesn't change.
+class TranscodeFramePool
+{
+public:
+	struct Stats
+	{
+		// Number of (pixel format, resolution) pools
+		size_t pool_count = 0;
+		// Number of the plane buffers allocated by the pools (in use + kept in the pools)
+		uint64_t buffer_count = 0;
+		uint64_t buffer_bytes = 0;
+
+		// Number of the frames requested by the decoders
+		uint64_t request_count = 0;
+		// Number of the frames served without allocating a new plane buffer
+		uint64_t reuse_count = 0;
+
+		double GetReuseRate() const
+		{
+			return (request_count > 0) ? (static_cast<double>(reuse_count) * 100.0 / request_count) : 0.0;
+		}
+	};
+
+public:
+	TranscodeFramePool() = default;
+	~TranscodeFramePool();
+
+	// Makes the decoder allocate the frames from this pool
+	//
+	// It MUST be called before avcodec_open2(), and the pool MUST outlive the context.
+	// Codecs without AV_CODEC_CAP_DR1 and H/W frames use the default allocator of FFmpeg.
+	void Attach(AVCodecContext *context);
+
+	Stats GetStats() const;
+	ov::String GetStatsString() const;
+
+private:
+	struct Pool
+	{
+		AVBufferPool *buffer_pools[4] = {};
+		int linesizes[4] = {};
+
+		// Used to evict the least recently used pool
+		uint64_t last_used = 0;
+
+		uint64_t buffer_count = 0;
+		uint64_t buffer_bytes = 0;
+		uint64_t request_count = 0;
+		// Number of the requests that needed a new plane buffer
+		uint64_t miss_count = 0;
+	};
+
+	static int GetBuffer(AVCodecContext *context, AVFrame *frame, int flags);
+	static AVBufferRef *AllocateBuffer(void *opaque, size_t size);
+
+	bool GetVideoBuffer(AVCodecContext *context, AVFrame *frame);
+	// _mutex MUST be held
+	Pool *GetPool(AVCodecContext *context, AVPixelFormat format, int width, int height);
+	static void ReleasePool(Pool *pool);
+
+	mutable std::mutex _mutex;
+
+	// [format, width, height]: Pool
+	std::map<std::tuple<int, int, int>, Pool> _pools;
+	uint64_t _last_used = 0;
+
+	// Counters of the evicted pools
+	uint64_t _evicted_request_count = 0;
+	uint64_t _evicted_miss_count = 0;
+};
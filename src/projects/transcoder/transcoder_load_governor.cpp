@@ -0,0 +1,189 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by agent
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "transcoder_load_governor.h"
+
+#include <math.h>
+
+#include <algorithm>
+
+// The encoder is overloaded if the encoding time exceeds 85% of the frame interval,
+#define OVERLOADED_LOAD 0.85
+// or if 1 second of frames is waiting in the queue
+#define OVERLOADED_QUEUE_SECONDS 1.0
+// The level goes down without waiting for the next window if 3 seconds of frames are waiting
+#define CRITICAL_QUEUE_SECONDS 3.0
+
+#define OVERLOADED_WINDOWS 2
+#define UNDERLOADED_WINDOWS 10
+#define COOLDOWN_WINDOWS 3
+
+// The level goes back up if the load at the previous level is expected to be under 60%
+#define UNDERLOADED_LOAD 0.6
+
+namespace
+{
+	// Expected increase of the load when the level goes back up from <level>
+	double GetRestoreFactor(TranscoderLoadGovernor::Level level)
+	{
+		switch (level)
+		{
+			case TranscoderLoadGovernor::Level::ThirdFrameRate:
+				// 1/3 -> 1/2 of the frames
+				return 1.5;
+
+			case TranscoderLoadGovernor::Level::HalfFrameRate:
+				// 1/2 -> all frames
+				return 2.0;
+
+			case TranscoderLoadGovernor::Level::LowComplexity:
+				// Differs by the encoder, so it is assumed to be the same as the frame rate
+				return 2.0;
+
+			case TranscoderLoadGovernor::Level::Normal:
+				break;
+		}
+
+		return 1.0;
+	}
+}  // namespace
+
+TranscoderLoadGovernor::TranscoderLoadGovernor(double frame_rate)
+	: _frame_rate(std::max(frame_rate, 1.0))
+{
+	StartWindow();
+}
+
+bool TranscoderLoadGovernor::ShouldEncode()
+{
+	return ((_frame_index++ % GetFrameRateDivisor()) == 0);
+}
+
+bool TranscoderLoadGovernor::Update(int64_t encoding_time_us, size_t queue_size)
+{
+	_window_frame_count++;
+	_window_encoding_time_us += encoding_time_us;
+	_window_peak_queue_size = std::max(_window_peak_queue_size, queue_size);
+
+	auto critical = (_window_peak_queue_size >= static_cast<size_t>(_frame_rate * CRITICAL_QUEUE_SECONDS));
+
+	if ((_window_frame_count < _window_frames) && ((critical == false) || (_cooldown_windows > 0)))
+	{
+		return false;
+	}
+
+	auto frame_interval_us = 1000000.0 * GetFrameRateDivisor() / _frame_rate;
+	_load = (static_cast<double>(_window_encoding_time_us) / _window_frame_count) / frame_interval_us;
+
+	_queue_size = _window_peak_queue_size;
+	StartWindow();
+
+	if (_cooldown_windows > 0)
+	{
+		_cooldown_windows--;
+		return false;
+	}
+
+	auto overloaded = critical ||
+					  (_load > OVERLOADED_LOAD) ||
+					  (_queue_size >= static_cast<size_t>(_frame_rate * OVERLOADED_QUEUE_SECONDS));
+
+	if (overloaded)
+	{
+		_underloaded_windows = 0;
+		_overloaded_windows++;
+
+		if ((critical || (_overloaded_windows >= OVERLOADED_WINDOWS)) && (_level < Level::ThirdFrameRate))
+		{
+			ChangeLevel(static_cast<Level>(static_cast<uint8_t>(_level) + 1));
+			return true;
+		}
+
+		return false;
+	}
+
+	_overloaded_windows = 0;
+
+	if ((_level > Level::Normal) &&
+		((_load * GetRestoreFactor(_level)) < UNDERLOADED_LOAD) &&
+		(_queue_size <= static_cast<size_t>(::ceil(_frame_rate / 4.0))))
+	{
+		_underloaded_windows++;
+
+		if (_underloaded_windows >= UNDERLOADED_WINDOWS)
+		{
+			ChangeLevel(static_cast<Level>(static_cast<uint8_t>(_level) - 1));
+			return true;
+		}
+	}
+	else
+	{
+		_underloaded_windows = 0;
+	}
+
+	return false;
+}
+
+int TranscoderLoadGovernor::GetFrameRateDivisor() const
+{
+	switch (_level)
+	{
+		case Level::ThirdFrameRate:
+			return 3;
+
+		case Level::HalfFrameRate:
+			return 2;
+
+		case Level::LowComplexity:
+		case Level::Normal:
+			break;
+	}
+
+	return 1;
+}
+
+const char *TranscoderLoadGovernor::StringFromLevel(Level level)
+{
+	switch (level)
+	{
+		case Level::Normal:
+			return "Normal";
+
+		case Level::LowComplexity:
+			return "LowComplexity";
+
+		case Level::HalfFrameRate:
+			return "HalfFrameRate";
+
+		case Level::ThirdFrameRate:
+			return "ThirdFrameRate";
+	}
+
+	return "Unknown";
+}
+
+void TranscoderLoadGovernor::StartWindow()
+{
+	// About 1 second of the encoded frames
+	_window_frames = std::max(1, static_cast<int>(::lround(_frame_rate / GetFrameRateDivisor())));
+	_window_frame_count = 0;
+	_window_encoding_time_us = 0;
+	_window_peak_queue_size = 0;
+}
+
+void TranscoderLoadGovernor::ChangeLevel(Level level)
+{
+	_level = level;
+
+	_frame_index = 0;
+	_overloaded_windows = 0;
+	_underloaded_windows = 0;
+	_cooldown_windows = COOLDOWN_WINDOWS;
+
+	StartWindow();
+}
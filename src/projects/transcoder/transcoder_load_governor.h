@@ -0,0 +1,103 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by agent
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Decides how much an encoder has to be degraded to keep up with its input (<OutputProfiles><AdaptiveEncoding>)
+//
+// The encoding time of the frames is compared with the frame interval, and the size of the input queue is checked,
+// for each window of about 1 second. The level goes down after 2 overloaded windows in a row (immediately if the queue
+// holds more than 3 seconds of frames), and goes back up after 10 windows in which the previous level would have fit.
+// Some windows are skipped after a change, since the encoder is reopened and the queue needs time to drain.
+class TranscoderLoadGovernor
+{
+public:
+	enum class Level : uint8_t
+	{
+		// As configured
+		Normal,
+		// Faster (lower quality) settings of the encoder
+		LowComplexity,
+		// LowComplexity + encodes 1/2 of the frames
+		HalfFrameRate,
+		// LowComplexity + encodes 1/3 of the frames
+		ThirdFrameRate,
+	};
+
+	// frame_rate: frame rate of the input of the encoder
+	explicit TranscoderLoadGovernor(double frame_rate);
+
+	// Called for each input frame. Returns false if the frame has to be dropped at the current level
+	bool ShouldEncode();
+
+	// Called after a frame is encoded
+	//
+	// encoding_time_us: time taken to encode the frame
+	// queue_size: number of the frames waiting in the input queue of the encoder
+	//
+	// Returns true if the level is changed
+	bool Update(int64_t encoding_time_us, size_t queue_size);
+
+	Level GetLevel() const
+	{
+		return _level;
+	}
+
+	bool IsComplexityReduced() const
+	{
+		return _level >= Level::LowComplexity;
+	}
+
+	// 1 if all frames are encoded
+	int GetFrameRateDivisor() const;
+
+	double GetFrameRate() const
+	{
+		return _frame_rate;
+	}
+
+	// Encoding time / frame interval of the last window (over 1.0 means the encoder can't keep up with the input)
+	double GetLoad() const
+	{
+		return _load;
+	}
+
+	// Peak size of the input queue in the last window
+	size_t GetQueueSize() const
+	{
+		return _queue_size;
+	}
+
+	static const char *StringFromLevel(Level level);
+
+private:
+	void StartWindow();
+	void ChangeLevel(Level level);
+
+	double _frame_rate;
+	Level _level = Level::Normal;
+
+	int64_t _frame_index = 0;
+
+	// Number of the encoded frames of a window
+	int _window_frames = 1;
+	int _window_frame_count = 0;
+	int64_t _window_encoding_time_us = 0;
+	size_t _window_peak_queue_size = 0;
+
+	double _load = 0.0;
+	size_t _queue_size = 0;
+
+	int _overloaded_windows = 0;
+	int _underloaded_windows = 0;
+	// Windows to skip after the level is changed
+	int _cooldown_windows = 0;
+};
@@ -10,6 +10,11 @@
 #include "transcoder_stream.h"
 
 #include <config/config_manager.h>
+#include <monitoring/monitoring.h>
+
+#include <cmath>
+#include <functional>
+#include <limits>
 
 #include "transcoder_application.h"
 #include "transcoder_private.h"
@@ -18,9 +23,16 @@
 #define GENERATE_FILLER_FRAME true
 #define UNUSED_VARIABLE(var) (void)var;
 
+// On-demand renditions
+#define ON_DEMAND_CHECK_INTERVAL_MS 1000
+// Time to wait before suspending the rendition after the last subscriber has left
+#define ON_DEMAND_GRACE_PERIOD_MS 10000
+
 TranscoderStream::TranscoderStream(const info::Application &application_info, const std::shared_ptr<info::Stream> &stream, TranscodeApplication *parent)
 	: _parent(parent), _application_info(application_info), _input_stream(stream)
 {
+	_frame_pool = std::make_shared<TranscodeFramePool>();
+
 	_log_prefix = ov::String::FormatString("[%s/%s(%u)]", _application_info.GetName().CStr(), _input_stream->GetName().CStr(), _input_stream->GetId());
 
 	logtd("%s Trying to create transcode stream", _log_prefix.CStr());
@@ -57,8 +69,13 @@ bool TranscoderStream::Stop()
 
 	logtd("%s Wait for terminated trancode stream thread", _log_prefix.CStr());
 
+	// No more frames from the frame bus, and the subscribers are handed over to the other member
+	LeaveFrameBus();
+
 	RemoveAllComponents();
 
+	logti("%s Frame pool - %s", _log_prefix.CStr(), _frame_pool->GetStatsString().CStr());
+
 	// Notify to delete the stream created on the MediaRouter
 	NotifyDeleteStreams();
 
@@ -68,6 +85,21 @@ bool TranscoderStream::Stop()
 	_link_decoder_to_filters.clear();
 	_link_filter_to_encoder.clear();
 	_link_encoder_to_outputs.clear();
+	_key_frame_only_decoders.clear();
+	_last_key_frame_only_time.clear();
+
+	// Delete all demand information of the on-demand renditions
+	_on_demand_output_streams.clear();
+	_rendition_demands.clear();
+	_idle_decoders.clear();
+	_resuming_decoders.clear();
+	_demand_check_timer.Stop();
+	{
+		std::lock_guard<std::shared_mutex> demand_lock(_demand_mutex);
+		_idle_filters.clear();
+		_idle_encoders.clear();
+		_key_frame_requested_encoders.clear();
+	}
 
 	// Delete all last decoded frame information
 	_last_decoded_frame_pts.clear();
@@ -133,6 +165,8 @@ bool TranscoderStream::StartInternal()
 		logti("No decoder generated");
 	}
 
+	JoinFrameBus();
+
 	// Notify to create a new stream on the media router.
 	NotifyCreateStreams();
 
@@ -149,20 +183,28 @@ bool TranscoderStream::Update(const std::shared_ptr<info::Stream> &stream)
 	{
 		logti("%s This stream will be a smooth transition", _log_prefix.CStr());
 
+		LeaveFrameBus();
+
 		RemoveDecoders();
 
 		CreateDecoders();
 
+		JoinFrameBus();
+
 		UpdateMsidOfOutputStreams(stream->GetMsid());
 	}
 	else
 	{
 		logti("%s This stream does not support smooth transitions. renew the encoder", _log_prefix.CStr());
 
+		LeaveFrameBus();
+
 		RemoveAllComponents();
 
 		CreateDecoders();
 
+		JoinFrameBus();
+
 		UpdateMsidOfOutputStreams(stream->GetMsid());
 
 		NotifyUpdateStreams();
@@ -199,15 +241,25 @@ void TranscoderStream::RemoveDecoders()
 
 void TranscoderStream::RemoveFilters()
 {
-	std::lock_guard<std::shared_mutex> filter_lock(_filter_map_mutex);
-	
-	for (auto &it : _filters)
+	std::map<MediaTrackId, std::shared_ptr<TranscodeFilter>> filters;
+
+	{
+		std::lock_guard<std::shared_mutex> filter_lock(_filter_map_mutex);
+
+		filters = std::move(_filters);
+		_filters.clear();
+
+		_link_filter_to_filters.clear();
+		_link_filter_to_parent_filter.clear();
+	}
+
+	// The filter thread may be waiting for _filter_map_mutex to feed the cascaded filters, so stop it without the lock
+	for (auto &it : filters)
 	{
 		auto object = it.second;
 		object->Stop();
 		object.reset();
 	}
-	_filters.clear();
 }
 
 void TranscoderStream::RemoveEncoders()
@@ -276,6 +328,8 @@ bool TranscoderStream::IsAvailableSmoothTransitionStream(const std::shared_ptr<i
 
 bool TranscoderStream::Push(std::shared_ptr<MediaPacket> packet)
 {
+	UpdateDemands();
+
 	DecodePacket(std::move(packet));
 
 	return true;
@@ -345,7 +399,13 @@ int32_t TranscoderStream::CreateOutputStreams()
 
 		_output_streams.insert(std::make_pair(output_stream->GetName(), output_stream));
 
-		logti("%s Output stream has been created. [%s/%s(%u)]", _log_prefix.CStr(), _application_info.GetName().CStr(), output_stream->GetName().CStr(), output_stream->GetId());
+		if (cfg_output_profile.IsOnDemand())
+		{
+			_on_demand_output_streams.insert(output_stream->GetName());
+		}
+
+		logti("%s Output stream has been created. [%s/%s(%u)]%s", _log_prefix.CStr(), _application_info.GetName().CStr(), output_stream->GetName().CStr(), output_stream->GetId(),
+			  cfg_output_profile.IsOnDemand() ? " (OnDemand)" : "");
 
 		created_count++;
 	}
@@ -574,7 +634,18 @@ ov::String TranscoderStream::GetInfoStringComposite()
 				auto &filter_ids = _link_decoder_to_filters[decoder_id];
 				for (auto &filter_id : filter_ids)
 				{
-					debug_log.AppendFormat("        + Filter(%d)\n", filter_id);
+					std::shared_lock<std::shared_mutex> filter_lock(_filter_map_mutex);
+					auto parent_filter_it = _link_filter_to_parent_filter.find(filter_id);
+
+					if (parent_filter_it != _link_filter_to_parent_filter.end())
+					{
+						debug_log.AppendFormat("        + Filter(%d) <- (Cascade) Filter(%d)\n", filter_id, parent_filter_it->second);
+					}
+					else
+					{
+						debug_log.AppendFormat("        + Filter(%d)\n", filter_id);
+					}
+					filter_lock.unlock();
 
 					if (_link_filter_to_encoder.find(filter_id) != _link_filter_to_encoder.end())
 					{
@@ -640,6 +711,17 @@ int32_t TranscoderStream::CreateDecoders()
 		auto use_hwaccel = _application_info.GetConfig().GetOutputProfiles().IsHardwareAcceleration();
 		track->SetHardwareAccel(use_hwaccel);
 
+		// If the track is transcoded only to thumbnails, the frames other than the key frames are not needed
+		auto key_frame_only_interval = GetKeyFrameOnlyInterval(decoder_id);
+		track->SetKeyFrameDecodeOnly(key_frame_only_interval >= 0.0);
+
+		if (track->IsKeyFrameDecodeOnly())
+		{
+			_key_frame_only_decoders[decoder_id] = key_frame_only_interval;
+
+			logti("%s Decoder(%d) decodes only the key frames for the image outputs (interval: %.3fs)", _log_prefix.CStr(), decoder_id, key_frame_only_interval);
+		}
+
 		// Deprecated
 		// Set the number of b frames for compatibility with specific encoders.
 		// Default is 16. refer to .../config/.../applications/decodes.h
@@ -670,7 +752,7 @@ bool TranscoderStream::CreateDecoder(int32_t decoder_id, std::shared_ptr<MediaTr
 		return true;
 	}
 
-	auto decoder = TranscodeDecoder::Create(decoder_id, *_input_stream, input_track, bind(&TranscoderStream::OnDecodedFrame, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
+	auto decoder = TranscodeDecoder::Create(decoder_id, *_input_stream, input_track, _frame_pool, bind(&TranscoderStream::OnDecodedFrame, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
 	if (decoder == nullptr)
 	{
 		logte("[%s/%s(%u)] Decoder allocation failed", _input_stream->GetApplicationName(), _input_stream->GetName().CStr(), _input_stream->GetId());
@@ -683,6 +765,477 @@ bool TranscoderStream::CreateDecoder(int32_t decoder_id, std::shared_ptr<MediaTr
 	return true;
 }
 
+double TranscoderStream::GetKeyFrameOnlyInterval(int32_t decoder_id)
+{
+	auto input_track = GetInputTrack(decoder_id);
+	if ((input_track == nullptr) || (input_track->GetMediaType() != cmn::MediaType::Video))
+	{
+		return -1.0;
+	}
+
+	auto decoder_to_filters_it = _link_decoder_to_filters.find(decoder_id);
+	if (decoder_to_filters_it == _link_decoder_to_filters.end())
+	{
+		return -1.0;
+	}
+
+	double max_framerate = 0.0;
+	size_t output_count = 0;
+
+	for (auto &filter_id : decoder_to_filters_it->second)
+	{
+		auto filter_to_encoder_it = _link_filter_to_encoder.find(filter_id);
+		if (filter_to_encoder_it == _link_filter_to_encoder.end())
+		{
+			continue;
+		}
+
+		auto encoder_to_outputs_it = _link_encoder_to_outputs.find(filter_to_encoder_it->second);
+		if (encoder_to_outputs_it == _link_encoder_to_outputs.end())
+		{
+			continue;
+		}
+
+		for (auto &[output_stream, output_track_id] : encoder_to_outputs_it->second)
+		{
+			auto output_track = output_stream->GetTrack(output_track_id);
+			if (output_track == nullptr)
+			{
+				continue;
+			}
+
+			if (cmn::IsImageCodec(output_track->GetCodecId()) == false)
+			{
+				return -1.0;
+			}
+
+			auto framerate = output_track->GetFrameRateByConfig();
+			if (framerate <= 0.0)
+			{
+				// Every key frame is needed
+				max_framerate = std::numeric_limits<double>::infinity();
+			}
+			else
+			{
+				max_framerate = std::max(max_framerate, framerate);
+			}
+
+			output_count++;
+		}
+	}
+
+	if (output_count == 0)
+	{
+		return -1.0;
+	}
+
+	return std::isinf(max_framerate) ? 0.0 : (1.0 / max_framerate);
+}
+
+bool TranscoderStream::IsKeyFrameOnlyPacketNeeded(int32_t decoder_id, const std::shared_ptr<MediaPacket> &packet)
+{
+	auto key_frame_only_it = _key_frame_only_decoders.find(decoder_id);
+	if (key_frame_only_it == _key_frame_only_decoders.end())
+	{
+		return true;
+	}
+
+	// Non-key frames (NoFlag) are dropped here, since the decoder discards them anyway (skip_frame)
+	if (packet->GetFlag() == MediaPacketFlag::NoFlag)
+	{
+		return false;
+	}
+
+	// Packets of an unknown type are passed, and dropped by the decoder (skip_frame) if they are not key frames.
+	// They are not counted as key frames for the interval below.
+	if (packet->GetFlag() != MediaPacketFlag::Key)
+	{
+		return true;
+	}
+
+	auto input_track = GetInputTrack(decoder_id);
+	if (input_track == nullptr)
+	{
+		return true;
+	}
+
+	// Skip the key frames that come faster than the framerate of the image outputs
+	double time = packet->GetPts() * input_track->GetTimeBase().GetExpr();
+	auto last_time_it = _last_key_frame_only_time.find(decoder_id);
+
+	if (last_time_it != _last_key_frame_only_time.end())
+	{
+		double elapsed = time - last_time_it->second;
+
+		// The timestamp can be reset (ex: the input is changed)
+		if ((elapsed >= 0.0) && (elapsed < key_frame_only_it->second))
+		{
+			return false;
+		}
+	}
+
+	_last_key_frame_only_time[decoder_id] = time;
+
+	return true;
+}
+
+void TranscoderStream::UpdateDemands()
+{
+	if (_on_demand_output_streams.empty())
+	{
+		return;
+	}
+
+	if (_demand_check_timer.IsStart() == false)
+	{
+		_demand_check_timer.Start();
+	}
+	else if (_demand_check_timer.IsElapsed(ON_DEMAND_CHECK_INTERVAL_MS) == false)
+	{
+		return;
+	}
+
+	_demand_check_timer.Update();
+	auto now = _demand_check_timer.TotalElapsed();
+
+	// 1. Check whether the output streams have subscribers (reported by the publishers)
+	// [OUTPUT_STREAM_NAME, HAS_SUBSCRIBERS]
+	std::map<ov::String, bool> stream_demands;
+
+	for (auto &output_stream_name : _on_demand_output_streams)
+	{
+		auto output_stream_it = _output_streams.find(output_stream_name);
+		if (output_stream_it == _output_streams.end())
+		{
+			continue;
+		}
+
+		auto stream_metrics = MonitorInstance->GetStreamMetrics(*(output_stream_it->second));
+
+		// If the metrics are not available, the stream is regarded as demanded
+		stream_demands[output_stream_name] = (stream_metrics == nullptr) || (stream_metrics->GetTotalConnections() > 0);
+	}
+
+	// 2. Suspend/resume the encoders whose output streams are all on-demand
+	std::set<MediaTrackId> idle_encoders;
+	std::set<MediaTrackId> resumed_encoders;
+
+	for (auto &[encoder_id, output_tracks] : _link_encoder_to_outputs)
+	{
+		bool on_demand = true;
+		bool demanded = false;
+
+		for (auto &[output_stream, output_track_id] : output_tracks)
+		{
+			UNUSED_VARIABLE(output_track_id)
+
+			auto stream_demand_it = stream_demands.find(output_stream->GetName());
+			if (stream_demand_it == stream_demands.end())
+			{
+				on_demand = false;
+				break;
+			}
+
+			demanded = demanded || stream_demand_it->second;
+		}
+
+		if (on_demand == false)
+		{
+			continue;
+		}
+
+		auto &demand = _rendition_demands[encoder_id];
+
+		if (demanded)
+		{
+			demand.idle_since = -1;
+
+			if (demand.active == false)
+			{
+				demand.active = true;
+				resumed_encoders.insert(encoder_id);
+
+				logti("%s Rendition has been resumed. Encoder(%d)", _log_prefix.CStr(), encoder_id);
+			}
+		}
+		else if (demand.active)
+		{
+			if (demand.idle_since < 0)
+			{
+				demand.idle_since = now;
+			}
+			else if ((now - demand.idle_since) >= ON_DEMAND_GRACE_PERIOD_MS)
+			{
+				demand.active = false;
+
+				logti("%s Rendition has been suspended since there are no subscribers for %lld ms. Encoder(%d)",
+					  _log_prefix.CStr(), now - demand.idle_since, encoder_id);
+			}
+		}
+
+		if (demand.active == false)
+		{
+			idle_encoders.insert(encoder_id);
+		}
+	}
+
+	// 3. Filters are needed if the encoder or any cascaded filter is active
+	std::set<MediaTrackId> idle_filters;
+	{
+		std::shared_lock<std::shared_mutex> filter_lock(_filter_map_mutex);
+
+		std::function<bool(MediaTrackId)> is_filter_needed = [&](MediaTrackId filter_id) -> bool {
+			auto filter_to_encoder_it = _link_filter_to_encoder.find(filter_id);
+			if ((filter_to_encoder_it != _link_filter_to_encoder.end()) && (idle_encoders.find(filter_to_encoder_it->second) == idle_encoders.end()))
+			{
+				return true;
+			}
+
+			auto child_filters_it = _link_filter_to_filters.find(filter_id);
+			if (child_filters_it != _link_filter_to_filters.end())
+			{
+				for (auto &child_filter_id : child_filters_it->second)
+				{
+					if (is_filter_needed(child_filter_id))
+					{
+						return true;
+					}
+				}
+			}
+
+			return false;
+		};
+
+		for (auto &[filter_id, encoder_id] : _link_filter_to_encoder)
+		{
+			UNUSED_VARIABLE(encoder_id)
+
+			if (is_filter_needed(filter_id) == false)
+			{
+				idle_filters.insert(filter_id);
+			}
+		}
+	}
+
+	// 4. Decoders are suspended if all the filters are suspended, and resumed from the next key frame
+	//    (unless the decoded frames are used by the subscribers of the frame bus)
+	auto frame_bus_member = GetFrameBusMember();
+	bool has_frame_bus_subscribers = (frame_bus_member != nullptr) && frame_bus_member->HasSubscribers();
+
+	for (auto &[decoder_id, filter_ids] : _link_decoder_to_filters)
+	{
+		bool idle = (has_frame_bus_subscribers == false) && std::all_of(filter_ids.begin(), filter_ids.end(), [&](MediaTrackId filter_id) {
+			return idle_filters.find(filter_id) != idle_filters.end();
+		});
+
+		if (idle)
+		{
+			if (_idle_decoders.insert(decoder_id).second)
+			{
+				logtd("%s Decoder has been suspended. Decoder(%d)", _log_prefix.CStr(), decoder_id);
+			}
+
+			_resuming_decoders.erase(decoder_id);
+		}
+		else if (_idle_decoders.erase(decoder_id) > 0)
+		{
+			logtd("%s Decoder will be resumed from the next key frame. Decoder(%d)", _log_prefix.CStr(), decoder_id);
+
+			_resuming_decoders.insert(decoder_id);
+		}
+	}
+
+	// The resumed filters and encoders are not fed until they are recreated (they are still idle)
+	std::set<MediaTrackId> resumed_filters;
+	{
+		std::shared_lock<std::shared_mutex> demand_lock(_demand_mutex);
+
+		for (auto &filter_id : _idle_filters)
+		{
+			if (idle_filters.find(filter_id) == idle_filters.end())
+			{
+				resumed_filters.insert(filter_id);
+			}
+		}
+	}
+
+	for (auto &encoder_id : resumed_encoders)
+	{
+		RecreateEncoder(encoder_id);
+	}
+
+	for (auto &filter_id : resumed_filters)
+	{
+		RecreateFilter(filter_id);
+	}
+
+	{
+		std::lock_guard<std::shared_mutex> demand_lock(_demand_mutex);
+
+		_idle_filters = std::move(idle_filters);
+		_idle_encoders = idle_encoders;
+
+		for (auto &encoder_id : resumed_encoders)
+		{
+			_key_frame_requested_encoders.insert(encoder_id);
+		}
+	}
+
+	// 5. Report the state of the renditions (output tracks of the encoders) to the stream metrics
+	for (auto &[output_stream_name, demanded] : stream_demands)
+	{
+		UNUSED_VARIABLE(demanded)
+
+		auto &output_stream = _output_streams[output_stream_name];
+
+		auto stream_metrics = MonitorInstance->GetStreamMetrics(*output_stream);
+		if (stream_metrics == nullptr)
+		{
+			continue;
+		}
+
+		for (auto &[encoder_id, output_tracks] : _link_encoder_to_outputs)
+		{
+			for (auto &[stream, output_track_id] : output_tracks)
+			{
+				if (stream != output_stream)
+				{
+					continue;
+				}
+
+				auto output_track = stream->GetTrack(output_track_id);
+				if (output_track == nullptr)
+				{
+					continue;
+				}
+
+				stream_metrics->SetRenditionIdle(output_track->GetVariantName(), idle_encoders.find(encoder_id) != idle_encoders.end());
+			}
+		}
+	}
+}
+
+bool TranscoderStream::IsDemandedPacket(int32_t decoder_id, const std::shared_ptr<MediaPacket> &packet)
+{
+	if (_idle_decoders.find(decoder_id) != _idle_decoders.end())
+	{
+		return false;
+	}
+
+	auto resuming_decoder_it = _resuming_decoders.find(decoder_id);
+	if (resuming_decoder_it != _resuming_decoders.end())
+	{
+		if ((packet->GetMediaType() == cmn::MediaType::Video) && (packet->GetFlag() != MediaPacketFlag::Key))
+		{
+			return false;
+		}
+
+		_resuming_decoders.erase(resuming_decoder_it);
+	}
+
+	return true;
+}
+
+bool TranscoderStream::IsFilterIdle(int32_t filter_id)
+{
+	std::shared_lock<std::shared_mutex> demand_lock(_demand_mutex);
+
+	return _idle_filters.find(filter_id) != _idle_filters.end();
+}
+
+bool TranscoderStream::IsEncoderIdle(int32_t encoder_id, bool *key_frame_requested)
+{
+	{
+		std::shared_lock<std::shared_mutex> demand_lock(_demand_mutex);
+
+		if (_idle_encoders.find(encoder_id) != _idle_encoders.end())
+		{
+			return true;
+		}
+
+		if (_key_frame_requested_encoders.find(encoder_id) == _key_frame_requested_encoders.end())
+		{
+			return false;
+		}
+	}
+
+	std::lock_guard<std::shared_mutex> demand_lock(_demand_mutex);
+
+	*key_frame_requested = (_key_frame_requested_encoders.erase(encoder_id) > 0);
+
+	return false;
+}
+
+void TranscoderStream::RecreateFilter(int32_t filter_id)
+{
+	// Not to race with ChangeOutputFormat() in the thread of the decoder
+	std::lock_guard<std::shared_mutex> format_change_lock(_format_change_mutex);
+
+	std::shared_ptr<TranscodeFilter> filter;
+	{
+		std::shared_lock<std::shared_mutex> filter_lock(_filter_map_mutex);
+
+		auto filter_it = _filters.find(filter_id);
+		if (filter_it == _filters.end())
+		{
+			return;
+		}
+
+		filter = filter_it->second;
+	}
+
+	// The tracks are kept, so the cascaded filters are not changed
+	auto input_track = filter->GetInputTrack();
+	auto output_track = filter->GetOutputTrack();
+	filter = nullptr;
+
+	if (CreateFilter(filter_id, input_track, output_track) == false)
+	{
+		logte("%s Could not recreate the resumed filter. Filter(%d)", _log_prefix.CStr(), filter_id);
+		return;
+	}
+
+	logtd("%s Filter has been recreated for the resumed rendition. Filter(%d)", _log_prefix.CStr(), filter_id);
+}
+
+void TranscoderStream::RecreateEncoder(int32_t encoder_id)
+{
+	std::shared_ptr<TranscodeEncoder> prev_encoder;
+	{
+		std::lock_guard<std::shared_mutex> encoder_lock(_encoder_map_mutex);
+
+		auto encoder_it = _encoders.find(encoder_id);
+		if (encoder_it == _encoders.end())
+		{
+			return;
+		}
+
+		auto output_track = encoder_it->second->GetRefTrack();
+		auto output_stream = GetOutputStreamByTrackId(output_track->GetId());
+		if (output_stream == nullptr)
+		{
+			logte("%s Could not found output stream. Encoder(%d)", _log_prefix.CStr(), encoder_id);
+			return;
+		}
+
+		// The new encoder starts with a key frame
+		auto encoder = TranscodeEncoder::Create(encoder_id, *output_stream, output_track, bind(&TranscoderStream::OnEncodedPacket, this, std::placeholders::_1, std::placeholders::_2));
+		if (encoder == nullptr)
+		{
+			logte("%s Could not recreate the resumed encoder. Encoder(%d)", _log_prefix.CStr(), encoder_id);
+			return;
+		}
+
+		prev_encoder = std::move(encoder_it->second);
+		encoder_it->second = std::move(encoder);
+	}
+
+	// Stop the previous encoder without the lock (like the filter)
+	prev_encoder->Stop();
+
+	logtd("%s Encoder has been recreated for the resumed rendition. Encoder(%d)", _log_prefix.CStr(), encoder_id);
+}
+
 int32_t TranscoderStream::CreateEncoders(MediaFrame *buffer)
 {
 	MediaTrackId track_id = buffer->GetTrackId();
@@ -787,6 +1340,8 @@ int32_t TranscoderStream::CreateFilters(MediaFrame *buffer)
 	auto filter_ids = decoder_to_filters_it->second;
 
 	// 2. Get Output Track of Encoders
+	std::vector<std::pair<int32_t, std::shared_ptr<MediaTrack>>> filter_outputs;
+
 	for (auto &filter_id : filter_ids)
 	{
 		MediaTrackId encoder_id = _link_filter_to_encoder[filter_id];
@@ -796,29 +1351,169 @@ int32_t TranscoderStream::CreateFilters(MediaFrame *buffer)
 			continue;
 		}
 
-		auto output_track = _encoders[encoder_id]->GetRefTrack();
+		filter_outputs.emplace_back(filter_id, _encoders[encoder_id]->GetRefTrack());
+	}
+
+	// The frames of the H/W decoders are scaled by the H/W specific filters, so they are always scaled from the decoder
+	bool cascade_scaling = (input_track->GetMediaType() == cmn::MediaType::Video) &&
+						   (input_track->GetCodecLibraryId() == cmn::MediaCodecLibraryId::DEFAULT) &&
+						   _application_info.GetConfig().GetOutputProfiles().IsCascadeScaling();
+
+	if (cascade_scaling)
+	{
+		// Larger renditions are created first, so they can be the parent of the smaller ones
+		std::stable_sort(filter_outputs.begin(), filter_outputs.end(), [](const auto &a, const auto &b) {
+			return ((int64_t)a.second->GetWidth() * a.second->GetHeight()) > ((int64_t)b.second->GetWidth() * b.second->GetHeight());
+		});
+	}
+
+	// Filters that can be the parent of the next filters
+	std::vector<std::pair<int32_t, std::shared_ptr<MediaTrack>>> created_filters;
+
+	for (auto &[filter_id, output_track] : filter_outputs)
+	{
+		MediaTrackId encoder_id = _link_filter_to_encoder[filter_id];
+
+		auto filter_input_track = input_track;
+		int32_t parent_filter_id = cascade_scaling ? FindCascadeParentFilter(output_track, created_filters) : -1;
+
+		if (parent_filter_id >= 0)
+		{
+			auto parent_it = std::find_if(created_filters.begin(), created_filters.end(), [parent_filter_id](const auto &item) {
+				return item.first == parent_filter_id;
+			});
+			auto &parent_output_track = parent_it->second;
+
+			// The output of the parent filter (already scaled and converted to the timebase of the parent) is scaled again
+			filter_input_track = parent_output_track->Clone();
+			filter_input_track->SetCodecLibraryId(cmn::MediaCodecLibraryId::DEFAULT);
+
+			logti("%s Cascade scaling. Decoder(%d) > Filter(%d, %dx%d) > Filter(%d, %dx%d) > Encoder(%d)",
+				  _log_prefix.CStr(), decoder_id,
+				  parent_filter_id, parent_output_track->GetWidth(), parent_output_track->GetHeight(),
+				  filter_id, output_track->GetWidth(), output_track->GetHeight(),
+				  encoder_id);
+		}
+		else
+		{
+			logtd("%s Create Filter. Decoder(%d) > Filter(%d) > Encoder(%d)", _log_prefix.CStr(), decoder_id, filter_id, encoder_id);
+		}
+
+		// Detach the filter from the previous parent while it is recreated
+		SetCascadeParentFilter(filter_id, -1);
 
-		logtd("%s Create Filter. Decoder(%d) > Filter(%d) > Encoder(%d)", _log_prefix.CStr(), decoder_id, filter_id, encoder_id);
-		if(CreateFilter(filter_id, input_track, output_track) == false)
+		if (CreateFilter(filter_id, filter_input_track, output_track) == false)
 		{
 			continue;
 		}
 
+		SetCascadeParentFilter(filter_id, parent_filter_id);
+		created_filters.emplace_back(filter_id, output_track);
+
 		created_count++;
 	}
 
 	return created_count;
 }
 
-bool TranscoderStream::CreateFilter(int32_t filter_id, std::shared_ptr<MediaTrack> input_track, std::shared_ptr<MediaTrack> output_track)
+int32_t TranscoderStream::FindCascadeParentFilter(const std::shared_ptr<MediaTrack> &output_track, const std::vector<std::pair<int32_t, std::shared_ptr<MediaTrack>>> &candidates)
+{
+	int32_t parent_filter_id = -1;
+	int64_t parent_area = 0;
+
+	for (auto &[filter_id, candidate_track] : candidates)
+	{
+		// Only downscaling is allowed
+		if ((candidate_track->GetWidth() < output_track->GetWidth()) || (candidate_track->GetHeight() < output_track->GetHeight()))
+		{
+			continue;
+		}
+
+		// If the parent drops frames, the output can't have more frames than the parent
+		auto parent_framerate = candidate_track->GetFrameRateByConfig();
+		auto output_framerate = output_track->GetFrameRateByConfig();
+		if ((parent_framerate > 0.0) && ((output_framerate <= 0.0) || (output_framerate > parent_framerate)))
+		{
+			continue;
+		}
+
+		// Use the smallest parent
+		auto area = (int64_t)candidate_track->GetWidth() * candidate_track->GetHeight();
+		if ((parent_filter_id < 0) || (area < parent_area))
+		{
+			parent_filter_id = filter_id;
+			parent_area = area;
+		}
+	}
+
+	return parent_filter_id;
+}
+
+void TranscoderStream::SetCascadeParentFilter(int32_t filter_id, int32_t parent_filter_id)
 {
 	std::lock_guard<std::shared_mutex> filter_lock(_filter_map_mutex);
 
+	auto parent_it = _link_filter_to_parent_filter.find(filter_id);
+	if (parent_it != _link_filter_to_parent_filter.end())
+	{
+		auto &child_filter_ids = _link_filter_to_filters[parent_it->second];
+		child_filter_ids.erase(std::remove(child_filter_ids.begin(), child_filter_ids.end(), filter_id), child_filter_ids.end());
+
+		_link_filter_to_parent_filter.erase(parent_it);
+	}
+
+	if (parent_filter_id >= 0)
+	{
+		_link_filter_to_parent_filter[filter_id] = parent_filter_id;
+		_link_filter_to_filters[parent_filter_id].push_back(filter_id);
+	}
+}
+
+std::vector<MediaTrackId> TranscoderStream::GetRootFilters(int32_t decoder_id)
+{
+	std::vector<MediaTrackId> root_filter_ids;
+
+	auto decoder_to_filters_it = _link_decoder_to_filters.find(decoder_id);
+	if (decoder_to_filters_it == _link_decoder_to_filters.end())
+	{
+		return root_filter_ids;
+	}
+
+	std::shared_lock<std::shared_mutex> filter_lock(_filter_map_mutex);
+
+	for (auto &filter_id : decoder_to_filters_it->second)
+	{
+		// Cascaded filters are fed by the parent filter
+		if (_link_filter_to_parent_filter.find(filter_id) == _link_filter_to_parent_filter.end())
+		{
+			root_filter_ids.push_back(filter_id);
+		}
+	}
+
+	return root_filter_ids;
+}
+
+bool TranscoderStream::CreateFilter(int32_t filter_id, std::shared_ptr<MediaTrack> input_track, std::shared_ptr<MediaTrack> output_track)
+{
+	std::shared_ptr<TranscodeFilter> prev_filter;
+
 	// remove the previous created filter
-	if (_filters.find(filter_id) != _filters.end())
 	{
-		_filters[filter_id]->Stop();
-		_filters[filter_id] = nullptr;
+		std::lock_guard<std::shared_mutex> filter_lock(_filter_map_mutex);
+
+		auto filter_it = _filters.find(filter_id);
+		if (filter_it != _filters.end())
+		{
+			prev_filter = filter_it->second;
+			_filters.erase(filter_it);
+		}
+	}
+
+	// The filter thread may be waiting for _filter_map_mutex to feed the cascaded filters, so stop it without the lock
+	if (prev_filter != nullptr)
+	{
+		prev_filter->Stop();
+		prev_filter = nullptr;
 	}
 
 	auto input_stream = GetInputStream();
@@ -843,6 +1538,8 @@ bool TranscoderStream::CreateFilter(int32_t filter_id, std::shared_ptr<MediaTrac
 		return false;
 	}
 
+	std::lock_guard<std::shared_mutex> filter_lock(_filter_map_mutex);
+
 	_filters[filter_id] = filter;
 
 	return true;
@@ -1016,6 +1713,113 @@ void TranscoderStream::UpdateOutputTrack(MediaFrame *buffer)
 }
 
 
+ov::String TranscoderStream::GetFrameBusKey()
+{
+	// Only the streams pulled from an origin (OVT) are known to have the same packets,
+	// and the frames are shared only between the applications which enabled <OutputProfiles><ShareDecodedFrames>
+	if ((_application_info.GetConfig().GetOutputProfiles().IsShareDecodedFrames() == false) || _input_stream->GetOriginStreamUUID().IsEmpty() || _link_input_to_decoder.empty())
+	{
+		return "";
+	}
+
+	// The decoders of the members must be the same
+	auto key = ov::String::FormatString("%s/hwaccel:%s", _input_stream->GetOriginStreamUUID().CStr(),
+										_application_info.GetConfig().GetOutputProfiles().IsHardwareAcceleration() ? "true" : "false");
+
+	for (auto &[input_track_id, decoder_id] : _link_input_to_decoder)
+	{
+		UNUSED_VARIABLE(decoder_id)
+
+		auto input_track = GetInputTrack(input_track_id);
+		if (input_track == nullptr)
+		{
+			return "";
+		}
+
+		key.AppendFormat("/%d:%s:%d/%d%s", input_track_id, ::StringFromMediaCodecId(input_track->GetCodecId()).CStr(),
+						 input_track->GetTimeBase().GetNum(), input_track->GetTimeBase().GetDen(),
+						 input_track->IsKeyFrameDecodeOnly() ? ":key_frame_only" : "");
+	}
+
+	return key;
+}
+
+void TranscoderStream::JoinFrameBus()
+{
+	auto key = GetFrameBusKey();
+	if (key.IsEmpty())
+	{
+		return;
+	}
+
+	auto member = TranscoderFrameBus::GetInstance()->Join(
+		key,
+		std::bind(&TranscoderStream::OnFrameBusFrame, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4),
+		[this]() {
+			logti("%s The decoded frames will be shared from this stream", _log_prefix.CStr());
+			_frame_bus_promoted = true;
+		});
+
+	if (member->IsPublisher() == false)
+	{
+		logti("%s The decoded frames are shared from the stream of the other application (%s)", _log_prefix.CStr(), key.CStr());
+	}
+
+	std::lock_guard<std::shared_mutex> lock(_frame_bus_mutex);
+	_frame_bus_member = std::move(member);
+}
+
+void TranscoderStream::LeaveFrameBus()
+{
+	std::shared_ptr<TranscoderFrameBus::Member> member;
+
+	{
+		std::lock_guard<std::shared_mutex> lock(_frame_bus_mutex);
+		member = std::move(_frame_bus_member);
+		_frame_bus_member = nullptr;
+	}
+
+	if (member != nullptr)
+	{
+		member->Leave();
+	}
+
+	_frame_bus_promoted = false;
+}
+
+std::shared_ptr<TranscoderFrameBus::Member> TranscoderStream::GetFrameBusMember()
+{
+	std::shared_lock<std::shared_mutex> lock(_frame_bus_mutex);
+	return _frame_bus_member;
+}
+
+void TranscoderStream::OnFrameBusFrame(TranscodeResult result, MediaTrackId track_id, const std::shared_ptr<MediaFrame> &frame, int64_t offset_us)
+{
+	auto input_to_decoder_it = _link_input_to_decoder.find(track_id);
+	if (input_to_decoder_it == _link_input_to_decoder.end())
+	{
+		return;
+	}
+
+	auto input_track = GetInputTrack(track_id);
+	if (input_track == nullptr)
+	{
+		return;
+	}
+
+	auto frame_clone = frame->CloneFrame();
+	if (frame_clone == nullptr)
+	{
+		logte("%s Failed to clone frame", _log_prefix.CStr());
+		return;
+	}
+
+	// To the timeline of the input stream of this application
+	frame_clone->SetPts(frame->GetPts() + static_cast<int64_t>(::llround(offset_us / (input_track->GetTimeBase().GetExpr() * 1000000.0))));
+
+	OnDecodedFrame(result, input_to_decoder_it->second, std::move(frame_clone));
+}
+
 void TranscoderStream::DecodePacket(std::shared_ptr<MediaPacket> packet)
 {
 	MediaTrackId input_track_id = packet->GetTrackId();
@@ -1063,6 +1867,46 @@ void TranscoderStream::DecodePacket(std::shared_ptr<MediaPacket> packet)
 	}
 	auto decoder_id = input_to_decoder_it->second;
 
+	auto frame_bus_member = GetFrameBusMember();
+	if (frame_bus_member != nullptr)
+	{
+		if (_frame_bus_promoted.exchange(false))
+		{
+			// The decoders start from the next key frame
+			for (auto &[track_id, promoted_decoder_id] : _link_input_to_decoder)
+			{
+				UNUSED_VARIABLE(track_id)
+
+				_resuming_decoders.insert(promoted_decoder_id);
+			}
+		}
+
+		if (packet->GetFlag() == MediaPacketFlag::Key)
+		{
+			auto input_track = GetInputTrack(input_track_id);
+			if (input_track != nullptr)
+			{
+				frame_bus_member->OnKeyPacket(input_track_id, packet, input_track->GetTimeBase().GetExpr());
+			}
+		}
+
+		// The frames are decoded by the publisher of the frame bus
+		if (frame_bus_member->IsPublisher() == false)
+		{
+			return;
+		}
+	}
+
+	if (IsKeyFrameOnlyPacketNeeded(decoder_id, packet) == false)
+	{
+		return;
+	}
+
+	if (IsDemandedPacket(decoder_id, packet) == false)
+	{
+		return;
+	}
+
 	std::shared_lock<std::shared_mutex> lock(_decoder_map_mutex);
 
 	auto decoder_it = _decoders.find(decoder_id);
@@ -1081,6 +1925,12 @@ void TranscoderStream::OnDecodedFrame(TranscodeResult result, int32_t decoder_id
 		return;
 	}
 
+	auto frame_bus_member = GetFrameBusMember();
+	if ((frame_bus_member != nullptr) && frame_bus_member->IsPublisher())
+	{
+		frame_bus_member->Publish(result, decoder_id, decoded_frame);
+	}
+
 	switch (result)
 	{
 		case TranscodeResult::NoData: {
@@ -1092,6 +1942,12 @@ void TranscoderStream::OnDecodedFrame(TranscodeResult result, int32_t decoder_id
 			// - When the input stream is switched, decoding fails until a KeyFrame is received. 
 			//   If the keyframe interval is longer than the buffered length of the player, buffering occurs in the player.
 			//   Therefore, the number of frames in which decoding fails is replaced with the last decoded frame and used as a filler frame.
+			// - The images are made only from the key frames, so they don't need the filler frames.
+			if (_key_frame_only_decoders.find(decoder_id) != _key_frame_only_decoders.end())
+			{
+				break;
+			}
+
 			auto last_frame = GetLastDecodedFrame(decoder_id);
 			if (last_frame == nullptr)
 			{
@@ -1240,13 +2096,8 @@ std::shared_ptr<MediaFrame> TranscoderStream::GetLastDecodedFrame(int32_t decode
 
 std::shared_ptr<MediaTrack> TranscoderStream::GetInputTrackOfFilter(int32_t decoder_id)
 {
-	auto decoder_to_filter_map_it = _link_decoder_to_filters.find(decoder_id);
-	if (decoder_to_filter_map_it == _link_decoder_to_filters.end())
-	{
-		return nullptr;
-	}
-
-	auto filter_ids = decoder_to_filter_map_it->second;
+	// The input track of the cascaded filters is the output of the parent filter
+	auto filter_ids = GetRootFilters(decoder_id);
 	if (filter_ids.size() == 0)
 	{
 		return nullptr;
@@ -1288,6 +2139,36 @@ void TranscoderStream::OnFilteredFrame(int32_t filter_id, std::shared_ptr<MediaF
 {
 	filtered_frame->SetTrackId(filter_id);
 
+	// Scaling ladder: the filtered frame is also the input of the cascaded filters
+	std::vector<MediaTrackId> child_filter_ids;
+	{
+		std::shared_lock<std::shared_mutex> filter_lock(_filter_map_mutex);
+
+		auto child_filters_it = _link_filter_to_filters.find(filter_id);
+		if (child_filters_it != _link_filter_to_filters.end())
+		{
+			child_filter_ids = child_filters_it->second;
+		}
+	}
+
+	for (auto &child_filter_id : child_filter_ids)
+	{
+		if (IsFilterIdle(child_filter_id))
+		{
+			continue;
+		}
+
+		auto frame_clone = filtered_frame->CloneFrame();
+		if (frame_clone == nullptr)
+		{
+			logte("%s Failed to clone frame", _log_prefix.CStr());
+
+			continue;
+		}
+
+		FilterFrame(child_filter_id, std::move(frame_clone));
+	}
+
 	EncodeFrame(std::move(filtered_frame));
 }
 
@@ -1302,6 +2183,26 @@ TranscodeResult TranscoderStream::EncodeFrame(std::shared_ptr<const MediaFrame>
 	}
 	auto encoder_id = filter_to_encoder_it->second;
 
+	bool key_frame_requested = false;
+	if (IsEncoderIdle(encoder_id, &key_frame_requested))
+	{
+		return TranscodeResult::NoData;
+	}
+
+	if (key_frame_requested && (frame->GetMediaType() == cmn::MediaType::Video) && (frame->GetPrivData() != nullptr))
+	{
+		// The resumed rendition starts with a key frame, so the players can start decoding immediately.
+		// The picture type is set to a copy, since the frame may be shared with the other encoders.
+		auto key_frame = frame->CloneFrame();
+		if ((key_frame != nullptr) && (key_frame->GetPrivData() != nullptr))
+		{
+			key_frame->SetTrackId(frame->GetTrackId());
+			key_frame->GetPrivData()->pict_type = AV_PICTURE_TYPE_I;
+
+			frame = std::move(key_frame);
+		}
+	}
+
 	std::shared_lock<std::shared_mutex> lock(_encoder_map_mutex);
 	
 	auto encoder_map_it = _encoders.find(encoder_id);
@@ -1411,17 +2312,23 @@ void TranscoderStream::SendFrame(std::shared_ptr<info::Stream> &stream, std::sha
 
 void TranscoderStream::SpreadToFilters(int32_t decoder_id, std::shared_ptr<MediaFrame> frame)
 {
-	auto filters = _link_decoder_to_filters.find(decoder_id);
-	if (filters == _link_decoder_to_filters.end())
+	// The cascaded filters get the frame from the parent filter
+	auto filter_ids = GetRootFilters(decoder_id);
+	if (filter_ids.empty())
 	{
 		logtw("%s Could not found filter", _log_prefix.CStr());
 
 		return;
 	}
-	auto filter_ids = filters->second;
 
 	for (auto &filter_id : filter_ids)
 	{
+		// The filters of the suspended renditions are not fed
+		if (IsFilterIdle(filter_id))
+		{
+			continue;
+		}
+
 		auto frame_clone = frame->CloneFrame();
 		if (frame_clone == nullptr)
 		{
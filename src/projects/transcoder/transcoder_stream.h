@@ -13,6 +13,7 @@
 #include <stdint.h>
 #include <memory>
 #include <queue>
+#include <set>
 #include <vector>
 
 #include "base/info/stream.h"
@@ -22,6 +23,7 @@
 #include "transcoder_decoder.h"
 #include "transcoder_encoder.h"
 #include "transcoder_filter.h"
+#include "transcoder_frame_bus.h"
 #include "transcoder_stream_internal.h"
 
 class TranscodeApplication;
@@ -137,6 +139,13 @@ private:
 	// [FILTER_ID, ENCODER_ID]
 	std::map<MediaTrackId, MediaTrackId> _link_filter_to_encoder;
 
+	// Scaling ladder (CascadeScaling): the filter is fed by the output of the parent filter instead of the decoder
+	// Protected by _filter_map_mutex since it is rebuilt when the format of the decoded frame is changed
+	// [PARENT_FILTER_ID, CHILD_FILTER_IDS]
+	std::map<MediaTrackId, std::vector<MediaTrackId>> _link_filter_to_filters;
+	// [CHILD_FILTER_ID, PARENT_FILTER_ID]
+	std::map<MediaTrackId, MediaTrackId> _link_filter_to_parent_filter;
+
 	// [ENCODER_ID, OUTPUT_TRACKS]
 	std::map<MediaTrackId, std::vector<std::pair<std::shared_ptr<info::Stream>, MediaTrackId>>> _link_encoder_to_outputs;
 
@@ -144,6 +153,14 @@ private:
 	// DECODER_ID, DECODER
 	std::map<MediaTrackId, std::shared_ptr<TranscodeDecoder>> _decoders;
 	std::map<MediaTrackId, std::shared_ptr<MediaFrame>> _last_decoded_frames;
+	// Decoders that only feed the image (thumbnail) encoders are fed only the key frames
+	// [DECODER_ID, Minimum interval between the key frames fed to the decoder (seconds)]
+	std::map<MediaTrackId, double> _key_frame_only_decoders;
+	// [DECODER_ID, PTS of the last key frame fed to the decoder (seconds)]
+	std::map<MediaTrackId, double> _last_key_frame_only_time;
+
+	// Buffers of the decoded video frames, shared by the decoders of the stream
+	std::shared_ptr<TranscodeFramePool> _frame_pool;
 
 	// Filter Component
 	// FILTER_ID, FILTER
@@ -153,10 +170,42 @@ private:
 	// ENCODER_ID, ENCODER
 	std::map<MediaTrackId, std::shared_ptr<TranscodeEncoder>> _encoders;
 
+	// On-demand renditions (OutputProfile.OnDemand)
+	// The renditions are encoded only while the output stream has subscribers. The number of subscribers is
+	// reported by the publishers to the stream metrics, and checked periodically in the thread of Push().
+	struct RenditionDemand
+	{
+		bool active = true;
+		// The time when the last subscriber has left (milliseconds of _demand_check_timer, -1 if there are subscribers)
+		int64_t idle_since = -1;
+	};
+	// Names of the output streams created from the on-demand output profiles
+	std::set<ov::String> _on_demand_output_streams;
+	ov::StopWatch _demand_check_timer;
+	// [ENCODER_ID, RenditionDemand] of the encoders whose output streams are all on-demand
+	std::map<MediaTrackId, RenditionDemand> _rendition_demands;
+	// [DECODER_ID] Decoders whose filters are all suspended (accessed only in the thread of Push())
+	std::set<MediaTrackId> _idle_decoders;
+	// [DECODER_ID] Decoders that are resumed and wait for the key frame (accessed only in the thread of Push())
+	std::set<MediaTrackId> _resuming_decoders;
+
+	// Read by the threads of the filters
+	std::shared_mutex _demand_mutex;
+	std::set<MediaTrackId> _idle_filters;
+	std::set<MediaTrackId> _idle_encoders;
+	// Encoders that are resumed, and need to start with a key frame
+	std::set<MediaTrackId> _key_frame_requested_encoders;
+
 	// Last timestamp decoded frame. 
 	// DECODER_ID, Timestamp(microseconds)
 	std::map<MediaTrackId, int64_t> _last_decoded_frame_pts;
 
+	// The decoded frames are shared with the streams of the other applications that pull the same origin stream
+	std::shared_mutex _frame_bus_mutex;
+	std::shared_ptr<TranscoderFrameBus::Member> _frame_bus_member;
+	// Set when this stream becomes the publisher of the frame bus, and handled in the thread of Push()
+	std::atomic<bool> _frame_bus_promoted = false;
+
 
 	std::shared_ptr<MediaTrack> GetInputTrack(MediaTrackId track_id);
 	std::shared_ptr<info::Stream> GetInputStream();
@@ -180,15 +229,43 @@ private:
 
 	int32_t CreateDecoders();
 	bool CreateDecoder(int32_t decoder_id, std::shared_ptr<MediaTrack> input_track);
+	// Returns the minimum interval (seconds) of the image outputs if all outputs of the decoder are images, otherwise -1
+	double GetKeyFrameOnlyInterval(int32_t decoder_id);
+	// Returns false if the packet doesn't need to be decoded
+	bool IsKeyFrameOnlyPacketNeeded(int32_t decoder_id, const std::shared_ptr<MediaPacket> &packet);
+
+	// Suspends/resumes the on-demand renditions according to the number of subscribers
+	void UpdateDemands();
+	// Returns false if the decoder is suspended, or waiting for the key frame to be resumed
+	bool IsDemandedPacket(int32_t decoder_id, const std::shared_ptr<MediaPacket> &packet);
+	bool IsFilterIdle(int32_t filter_id);
+	// key_frame_requested is set to true if the encoder has just been resumed
+	bool IsEncoderIdle(int32_t encoder_id, bool *key_frame_requested);
+	// The resumed filters and encoders are recreated. Otherwise, the filters (fps, aresample) fill the idle gap
+	// with the duplicated frames and the silence, and they are pushed to the encoders at once.
+	void RecreateFilter(int32_t filter_id);
+	void RecreateEncoder(int32_t encoder_id);
 
 	int32_t CreateFilters(MediaFrame *buffer);
 	bool CreateFilter(int32_t filter_id, std::shared_ptr<MediaTrack> input_track, std::shared_ptr<MediaTrack> output_track);
+	// Returns the filter that has the smallest output which is large enough to be scaled to output_track (or -1)
+	int32_t FindCascadeParentFilter(const std::shared_ptr<MediaTrack> &output_track, const std::vector<std::pair<int32_t, std::shared_ptr<MediaTrack>>> &candidates);
+	void SetCascadeParentFilter(int32_t filter_id, int32_t parent_filter_id);
+	std::vector<MediaTrackId> GetRootFilters(int32_t decoder_id);
 	std::shared_ptr<MediaTrack> GetInputTrackOfFilter(int32_t decoder_id);
 
 	int32_t CreateEncoders(MediaFrame *buffer);
 	bool CreateEncoder(int32_t encoder_id, std::shared_ptr<info::Stream> &output_stream, std::shared_ptr<MediaTrack> &output_track);
 
 
+	// Returns an empty string if the decoded frames can't be shared
+	ov::String GetFrameBusKey();
+	void JoinFrameBus();
+	void LeaveFrameBus();
+	std::shared_ptr<TranscoderFrameBus::Member> GetFrameBusMember();
+	// Frames decoded by the publisher of the frame bus
+	void OnFrameBusFrame(TranscodeResult result, MediaTrackId track_id, const std::shared_ptr<MediaFrame> &frame, int64_t offset_us);
+
 	// Step 1: Decode (Decode a frame from given packets)
 	void DecodePacket(std::shared_ptr<MediaPacket> packet);
 	void OnDecodedFrame(TranscodeResult result, int32_t decoder_id, std::shared_ptr<MediaFrame> decoded_frame);
@@ -11,6 +11,11 @@
 
 #include "transcoder_private.h"
 
+#include <cmath>
+
+// Framerates of the profile and the input are compared with this tolerance (ex: 29.97 vs 30000/1001)
+#define PASSTHROUGH_FRAMERATE_TOLERANCE 0.01
+
 TranscoderStreamInternal::TranscoderStreamInternal()
 {
 }
@@ -164,6 +169,12 @@ std::shared_ptr<MediaTrack> TranscoderStreamInternal::CreateOutputTrack(const st
 	output_track->SetOriginBitstream(input_track->GetOriginBitstream());
 
 	bool need_bypass = IsMatchesBypassCondition(input_track, profile);
+	if ((need_bypass == false) && IsMatchesEncodingSettings(input_track, profile))
+	{
+		logti("OutputTrack(%s) asks for what InputTrack(%d) already has, it will be passed through without transcoding", profile.GetName().CStr(), input_track->GetId());
+		need_bypass = true;
+	}
+
 	if (need_bypass == true)
 	{
 		output_track->SetBypass(true);
@@ -234,6 +245,12 @@ std::shared_ptr<MediaTrack> TranscoderStreamInternal::CreateOutputTrack(const st
 	output_track->SetOriginBitstream(input_track->GetOriginBitstream());
 
 	bool need_bypass = IsMatchesBypassCondition(input_track, profile);
+	if ((need_bypass == false) && IsMatchesEncodingSettings(input_track, profile))
+	{
+		logti("OutputTrack(%s) asks for what InputTrack(%d) already has, it will be passed through without transcoding", profile.GetName().CStr(), input_track->GetId());
+		need_bypass = true;
+	}
+
 	if (need_bypass == true)
 	{
 		output_track->SetBypass(true);
@@ -548,3 +565,103 @@ bool TranscoderStreamInternal::IsMatchesBypassCondition(const std::shared_ptr<Me
 
 	return (if_count > 0) ? true : false;
 }
+
+bool TranscoderStreamInternal::IsMatchesEncodingSettings(const std::shared_ptr<MediaTrack> &input_track, const cfg::vhost::app::oprf::VideoProfile &profile)
+{
+	// <Bypass>false</Bypass> always transcodes, and <BypassIfMatch> is evaluated by IsMatchesBypassCondition()
+	bool is_parsed = false;
+	profile.IsBypass(&is_parsed);
+	if (is_parsed == true)
+	{
+		return false;
+	}
+
+	profile.GetBypassIfMatch(&is_parsed);
+	if (is_parsed == true)
+	{
+		return false;
+	}
+
+	if (cmn::GetCodecIdByName(profile.GetCodec().CStr()) != input_track->GetCodecId())
+	{
+		return false;
+	}
+
+	// From here, an unset value (0) means the same as the input.
+	// If the profile sets a value that the input doesn't know yet, it is transcoded.
+
+	// Bitrate works as a ceiling
+	if ((profile.GetBitrate() > 0) && ((input_track->GetBitrate() <= 0) || (input_track->GetBitrate() > profile.GetBitrate())))
+	{
+		return false;
+	}
+
+	if (((profile.GetWidth() > 0) && (profile.GetWidth() != (int)input_track->GetWidth())) ||
+		((profile.GetHeight() > 0) && (profile.GetHeight() != (int)input_track->GetHeight())))
+	{
+		return false;
+	}
+
+	if ((profile.GetFramerate() > 0.0) && (std::abs(profile.GetFramerate() - input_track->GetFrameRate()) > PASSTHROUGH_FRAMERATE_TOLERANCE))
+	{
+		return false;
+	}
+
+	// The GOP of the input can't be changed without encoding
+	if ((profile.GetKeyFrameInterval() > 0) && (input_track->GetKeyFrameInterval() != profile.GetKeyFrameInterval()))
+	{
+		return false;
+	}
+
+	if ((profile.GetBFrames() > 0) && (input_track->HasBframes() == false))
+	{
+		return false;
+	}
+
+	// The profile of the input bitstream is not known
+	if (profile.GetProfile().IsEmpty() == false)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+bool TranscoderStreamInternal::IsMatchesEncodingSettings(const std::shared_ptr<MediaTrack> &input_track, const cfg::vhost::app::oprf::AudioProfile &profile)
+{
+	bool is_parsed = false;
+	profile.IsBypass(&is_parsed);
+	if (is_parsed == true)
+	{
+		return false;
+	}
+
+	profile.GetBypassIfMatch(&is_parsed);
+	if (is_parsed == true)
+	{
+		return false;
+	}
+
+	if (cmn::GetCodecIdByName(profile.GetCodec().CStr()) != input_track->GetCodecId())
+	{
+		return false;
+	}
+
+	// An unset value (0) means the same as the input
+	if ((profile.GetBitrate() > 0) && ((input_track->GetBitrate() <= 0) || (input_track->GetBitrate() > profile.GetBitrate())))
+	{
+		return false;
+	}
+
+	if ((profile.GetSamplerate() > 0) && (profile.GetSamplerate() != input_track->GetSampleRate()))
+	{
+		return false;
+	}
+
+	if ((profile.GetChannel() > 0) && (profile.GetChannel() != (int)input_track->GetChannel().GetCounts()))
+	{
+		return false;
+	}
+
+	return true;
+}
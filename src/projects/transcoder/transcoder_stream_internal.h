@@ -42,5 +42,10 @@ public:
 	bool IsMatchesBypassCondition(const std::shared_ptr<MediaTrack> &input_track, const cfg::vhost::app::oprf::VideoProfile &profile);
 	bool IsMatchesBypassCondition(const std::shared_ptr<MediaTrack> &input_track, const cfg::vhost::app::oprf::AudioProfile &profile);
 
+	// Whether the profile asks for what the input track already has (codec, resolution, framerate, GOP, ...),
+	// so the packets of the input can be passed through without decoding/encoding. Unset values mean the same as the input.
+	bool IsMatchesEncodingSettings(const std::shared_ptr<MediaTrack> &input_track, const cfg::vhost::app::oprf::VideoProfile &profile);
+	bool IsMatchesEncodingSettings(const std::shared_ptr<MediaTrack> &input_track, const cfg::vhost::app::oprf::AudioProfile &profile);
+
 
 };